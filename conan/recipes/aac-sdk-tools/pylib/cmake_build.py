@@ -88,10 +88,12 @@ def imports(obj, dest_folder):
             out.write(f"set(AAC_UNIT_TEST_FRAMEWORK_INCLUDES{cmake_file_path_sep}")
             out.writelines(os.path.join(source_path, "testing/unit/framework/include"))
             out.write(")\n")
+            unit_tests = utils.list_files(source_path, "testing/unit/tests", "cpp", False, False)
+            # the generated AASB message codec test needs the message sources built into the module
+            if obj.options.get_safe("with_aasb", default=False):
+                unit_tests += utils.list_files(dest_folder, "aasb-messages/tests", "cpp", False, False)
             out.write(f"set(AAC_UNIT_TESTS{cmake_file_path_sep}")
-            out.writelines(
-                cmake_file_path_sep.join(utils.list_files(source_path, "testing/unit/tests", "cpp", False, False))
-            )
+            out.writelines(cmake_file_path_sep.join(unit_tests))
             out.write(")\n")
 
         # write includes cmake variable list
@@ -0,0 +1,469 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <map>
+#include <new>
+#include <random>
+#include <time.h>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/AASB/AASB.h>
+
+// engine includes
+#include <AACE/Engine/AASB/AASBEngineImpl.h>
+#include <AACE/Engine/MessageBroker/Message.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AACE/Engine/MessageBroker/StreamManagerImpl.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+using aace::engine::aasb::AASBEngineImpl;
+using aace::engine::messageBroker::Message;
+using aace::engine::messageBroker::MessageBrokerImpl;
+using aace::engine::messageBroker::StreamManagerImpl;
+using aace::engine::utils::threading::Executor;
+
+//
+// Allocation counting. Allocations are only counted while an AllocationCounter exists, and this test is built into
+// its own executable.
+//
+
+static std::atomic<bool> s_countAllocations{false};
+static std::atomic<uint64_t> s_allocationCount{0};
+
+void* operator new(size_t size) {
+    if (s_countAllocations.load(std::memory_order_relaxed)) {
+        s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+/// Counts the allocations made by every thread during its lifetime.
+class AllocationCounter {
+public:
+    AllocationCounter() : m_start(s_allocationCount.load()) {
+        s_countAllocations = true;
+    }
+
+    ~AllocationCounter() {
+        s_countAllocations = false;
+    }
+
+    uint64_t count() const {
+        return s_allocationCount.load() - m_start;
+    }
+
+private:
+    uint64_t m_start;
+};
+
+/// Environment variable naming the file the benchmark results are appended to, one JSON object per line.
+static const char* BENCHMARK_OUTPUT_VARIABLE = "AACE_BENCHMARK_OUTPUT";
+
+/// Seed of the message mix, so every run drives the same sequence of messages.
+static constexpr uint32_t BENCHMARK_SEED = 20201019;
+
+/// Number of operations driven by the benchmark.
+static constexpr int BENCHMARK_OPERATIONS = 2000;
+
+/// Audio stream chunk of 20ms of 16kHz 16-bit mono audio.
+static constexpr size_t AUDIO_CHUNK_SIZE = 640;
+
+/// Number of chunks in each audio stream.
+static constexpr size_t AUDIO_CHUNK_COUNT = 50;
+
+/// Timeout of a single operation.
+static const std::chrono::seconds OPERATION_TIMEOUT = std::chrono::seconds(5);
+
+/// The scenarios of the message mix, with their weights.
+enum class Scenario { NAVIGATION_CONTEXT, CAR_CONTROL, TTS, AUDIO_STREAM, EXECUTOR_HOP };
+static const std::vector<std::pair<Scenario, int>> SCENARIO_WEIGHTS = {{Scenario::NAVIGATION_CONTEXT, 20},
+                                                                       {Scenario::CAR_CONTROL, 20},
+                                                                       {Scenario::TTS, 20},
+                                                                       {Scenario::AUDIO_STREAM, 10},
+                                                                       {Scenario::EXECUTOR_HOP, 30}};
+
+static std::string scenarioName(Scenario scenario) {
+    switch (scenario) {
+        case Scenario::NAVIGATION_CONTEXT:
+            return "navigationContext";
+        case Scenario::CAR_CONTROL:
+            return "carControl";
+        case Scenario::TTS:
+            return "tts";
+        case Scenario::AUDIO_STREAM:
+            return "audioStream";
+        case Scenario::EXECUTOR_HOP:
+            return "executorHop";
+    }
+    return "";
+}
+
+static const nlohmann::json NAVIGATION_STATE = {
+    {"state", "NAVIGATING"},
+    {"waypoints",
+     {{{"type", "SOURCE"}, {"coordinate", {37.410, -122.025}}},
+      {{"type", "INTERIM"}, {"coordinate", {37.402, -122.032}}, {"name", "Coffee Shop"}},
+      {{"type", "DESTINATION"}, {"coordinate", {37.396, -122.046}}, {"name", "Office"}}}},
+    {"shapes", {{37.410, -122.025}, {37.406, -122.029}, {37.402, -122.032}, {37.399, -122.040}, {37.396, -122.046}}}};
+
+/// Returns the CPU time consumed by the calling thread.
+static std::chrono::nanoseconds threadCpuTime() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+static std::string createMessage(
+    const std::string& topic,
+    const std::string& action,
+    const nlohmann::json& payload,
+    const std::string& replyToId = "") {
+    nlohmann::json description = {{"topic", topic}, {"action", action}};
+    if (!replyToId.empty()) {
+        description["replyToId"] = replyToId;
+    }
+    nlohmann::json message = {{"header",
+                               {{"id", aace::engine::utils::uuid::generateUUID()},
+                                {"messageType", replyToId.empty() ? "Publish" : "Reply"},
+                                {"version", "4.0"},
+                                {"messageDescription", description}}}};
+    if (!payload.is_null()) {
+        message["payload"] = payload;
+    }
+    return message.dump();
+}
+
+/// Tracks the CPU time consumed by a thread between the first and the last sample.
+class ThreadCpuSampler {
+public:
+    void sample() {
+        auto now = threadCpuTime().count();
+        int64_t expected = -1;
+        m_first.compare_exchange_strong(expected, now);
+        m_last.store(now);
+    }
+
+    double milliseconds() const {
+        return m_first < 0 ? 0 : (m_last - m_first) / 1e6;
+    }
+
+private:
+    std::atomic<int64_t> m_first{-1};
+    std::atomic<int64_t> m_last{-1};
+};
+
+/// An engine audio output stream holding a fixed number of chunks.
+class ChunkedAudioStream : public aace::core::MessageStream {
+public:
+    ChunkedAudioStream(size_t chunkCount) : m_remaining(chunkCount * AUDIO_CHUNK_SIZE), m_chunk(AUDIO_CHUNK_SIZE, 'a') {
+    }
+
+    ssize_t read(char* data, size_t size) override {
+        auto count = std::min(std::min(size, m_remaining), AUDIO_CHUNK_SIZE);
+        std::copy(m_chunk.begin(), m_chunk.begin() + count, data);
+        m_remaining -= count;
+        return static_cast<ssize_t>(count);
+    }
+
+    ssize_t write(const char* data, size_t size) override {
+        return -1;
+    }
+
+    bool isClosed() override {
+        return m_remaining == 0;
+    }
+
+    aace::core::MessageStream::Mode getMode() override {
+        return aace::core::MessageStream::Mode::READ;
+    }
+
+private:
+    size_t m_remaining;
+    std::vector<char> m_chunk;
+};
+
+/**
+ * AASB platform implementation. It parses every message it receives from @c AASBEngineImpl, answers the requests of
+ * the engine, and reads the audio streams the engine prepares.
+ */
+class BenchmarkPlatform : public aace::aasb::AASB {
+public:
+    // aace::aasb::AASB
+    void messageReceived(const std::string& message) override {
+        m_cpu.sample();
+        handleMessage(message);
+    }
+
+    /// Registers a completion for a message ID, fulfilled when the platform receives a reply to it.
+    std::future<void> expectReply(const std::string& messageId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending[messageId].get_future();
+    }
+
+    /// Registers a completion for a stream ID, fulfilled when the platform read the whole stream.
+    std::future<void> expectStream(const std::string& streamId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending[streamId].get_future();
+    }
+
+    uint64_t getAudioBytes() const {
+        return m_audioBytes;
+    }
+
+    const ThreadCpuSampler& cpu() const {
+        return m_cpu;
+    }
+
+private:
+    void handleMessage(const std::string& text) {
+        auto message = nlohmann::json::parse(text);
+        auto& header = message["header"];
+        auto& description = header["messageDescription"];
+        auto topic = description["topic"].get<std::string>();
+        auto action = description["action"].get<std::string>();
+        auto id = header["id"].get<std::string>();
+
+        if (header["messageType"] == "Reply") {
+            complete(description["replyToId"].get<std::string>());
+        } else if (topic == "Navigation" && action == "GetNavigationState") {
+            auto payload = nlohmann::json{{"navigationState", NAVIGATION_STATE.dump()}};
+            publish(createMessage(topic, action, payload, id));
+        } else if (topic == "CarControl" && action == "SetControllerValue") {
+            auto payload = nlohmann::json{{"success", true}};
+            publish(createMessage(topic, action, payload, id));
+        } else if (topic == "AudioOutput" && action == "Prepare") {
+            auto streamId = message["payload"]["streamId"].get<std::string>();
+            readStream(streamId);
+            complete(streamId);
+        }
+    }
+
+    void readStream(const std::string& streamId) {
+        auto stream = openStream(streamId, aace::aasb::AASBStream::Mode::READ);
+        if (stream == nullptr) {
+            return;
+        }
+        char buffer[AUDIO_CHUNK_SIZE];
+        while (!stream->isClosed()) {
+            auto count = stream->read(buffer, sizeof(buffer));
+            if (count <= 0) {
+                break;
+            }
+            m_audioBytes += count;
+        }
+    }
+
+    void complete(const std::string& id) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(id);
+        if (it != m_pending.end()) {
+            it->second.set_value();
+            m_pending.erase(it);
+        }
+    }
+
+    std::unordered_map<std::string, std::promise<void>> m_pending;
+    std::mutex m_mutex;
+    std::atomic<uint64_t> m_audioBytes{0};
+    ThreadCpuSampler m_cpu;
+};
+
+/**
+ * Test harness driving a reproducible message mix between an AASB platform and the engine, through
+ * @c AASBEngineImpl, the message broker, the stream manager, and the executors.
+ */
+class AASBBenchmarkTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_broker = MessageBrokerImpl::create();
+        ASSERT_NE(m_broker, nullptr);
+        m_broker->setMessageTimeout(std::chrono::duration_cast<std::chrono::milliseconds>(OPERATION_TIMEOUT));
+        m_streamManager = StreamManagerImpl::create();
+        ASSERT_NE(m_streamManager, nullptr);
+        m_platform = std::make_shared<BenchmarkPlatform>();
+        m_aasbEngineImpl = AASBEngineImpl::create(m_platform, m_broker, m_streamManager);
+        ASSERT_NE(m_aasbEngineImpl, nullptr);
+
+        // stand-in for the engine services handling the speech synthesizer messages
+        m_broker->subscribe(
+            "TextToSpeech",
+            "PrepareSpeech",
+            [this](const Message& message) {
+                m_engineCpu.sample();
+                auto payload = nlohmann::json{{"success", true}};
+                m_broker->publish(createMessage("TextToSpeech", "PrepareSpeech", payload, message.messageId()))
+                    .send();
+            },
+            Message::Direction::INCOMING);
+    }
+
+    void TearDown() override {
+        if (m_broker != nullptr) {
+            m_broker->shutdown();
+        }
+        m_executor.shutdown();
+    }
+
+protected:
+    bool run(Scenario scenario) {
+        switch (scenario) {
+            case Scenario::NAVIGATION_CONTEXT:
+                return m_broker->publish(createMessage("Navigation", "GetNavigationState", nullptr)).get().valid();
+            case Scenario::CAR_CONTROL: {
+                auto payload = nlohmann::json{{"controllerType", "RANGE"},
+                                              {"endpointId", "default.fan"},
+                                              {"instanceId", "speed"},
+                                              {"value", 5}};
+                return m_broker->publish(createMessage("CarControl", "SetControllerValue", payload)).get().valid();
+            }
+            case Scenario::TTS: {
+                auto message = createMessage(
+                    "TextToSpeech",
+                    "PrepareSpeech",
+                    {{"speechId", "speech"}, {"text", "Turn left onto Main Street"}, {"provider", "text-to-speech"}});
+                auto completed = m_platform->expectReply(Message(message, Message::Direction::INCOMING).messageId());
+                m_platform->publish(message);
+                return completed.wait_for(OPERATION_TIMEOUT) == std::future_status::ready;
+            }
+            case Scenario::AUDIO_STREAM: {
+                auto streamId = aace::engine::utils::uuid::generateUUID();
+                auto completed = m_platform->expectStream(streamId);
+                auto stream = std::make_shared<ChunkedAudioStream>(AUDIO_CHUNK_COUNT);
+                m_streamManager->registerStreamHandler(streamId, stream);
+                auto payload = nlohmann::json{
+                    {"channel", "SpeechSynthesizer"}, {"token", streamId}, {"streamId", streamId}, {"encoding", "MP3"}};
+                m_broker->publish(createMessage("AudioOutput", "Prepare", payload)).send();
+                return completed.wait_for(OPERATION_TIMEOUT) == std::future_status::ready;
+            }
+            case Scenario::EXECUTOR_HOP:
+                return m_executor.submit([]() { return true; }).get();
+        }
+        return false;
+    }
+
+    std::shared_ptr<MessageBrokerImpl> m_broker;
+    std::shared_ptr<StreamManagerImpl> m_streamManager;
+    std::shared_ptr<BenchmarkPlatform> m_platform;
+    std::shared_ptr<AASBEngineImpl> m_aasbEngineImpl;
+    Executor m_executor;
+    ThreadCpuSampler m_engineCpu;
+};
+
+TEST_F(AASBBenchmarkTest, messageMix) {
+    const char* path = std::getenv(BENCHMARK_OUTPUT_VARIABLE);
+    if (path == nullptr) {
+        // only run as a benchmark
+        RecordProperty("skipped", BENCHMARK_OUTPUT_VARIABLE);
+        return;
+    }
+
+    std::mt19937 random(BENCHMARK_SEED);
+    std::vector<int> weights;
+    for (auto& next : SCENARIO_WEIGHTS) {
+        weights.push_back(next.second);
+    }
+    std::discrete_distribution<size_t> distribution(weights.begin(), weights.end());
+    std::vector<Scenario> operations;
+    for (int i = 0; i < BENCHMARK_OPERATIONS; i++) {
+        operations.push_back(SCENARIO_WEIGHTS[distribution(random)].first);
+    }
+
+    // warm up every path once so that thread creation and first use costs are not measured
+    for (auto& next : SCENARIO_WEIGHTS) {
+        ASSERT_TRUE(run(next.first)) << scenarioName(next.first);
+    }
+
+    std::map<Scenario, std::vector<double>> latencies;
+    int failures = 0;
+    std::unique_ptr<AllocationCounter> allocationCounter(new AllocationCounter());
+    auto cpuBefore = threadCpuTime();
+    auto start = std::chrono::steady_clock::now();
+    for (auto scenario : operations) {
+        auto operationStart = std::chrono::steady_clock::now();
+        if (!run(scenario)) {
+            failures++;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - operationStart;
+        latencies[scenario].push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto cpu = threadCpuTime() - cpuBefore;
+    auto allocations = allocationCounter->count();
+    allocationCounter.reset();
+
+    nlohmann::json scenarios;
+    for (auto& next : latencies) {
+        auto& samples = next.second;
+        std::sort(samples.begin(), samples.end());
+        scenarios[scenarioName(next.first)] = {{"count", samples.size()},
+                                               {"p50Us", samples[samples.size() / 2]},
+                                               {"p99Us", samples[samples.size() * 99 / 100]},
+                                               {"maxUs", samples.back()}};
+    }
+    nlohmann::json results = {
+        {"benchmark", "AASBBenchmark"},
+        {"seed", BENCHMARK_SEED},
+        {"operations", BENCHMARK_OPERATIONS},
+        {"failures", failures},
+        {"durationSeconds", duration},
+        {"operationsPerSecond", BENCHMARK_OPERATIONS / duration},
+        {"allocations", allocations},
+        {"allocationsPerOperation", static_cast<double>(allocations) / BENCHMARK_OPERATIONS},
+        {"audioBytes", m_platform->getAudioBytes()},
+        {"cpuMs",
+         {{"publisher", std::chrono::duration<double, std::milli>(cpu).count()},
+          {"outgoingExecutor", m_platform->cpu().milliseconds()},
+          {"incomingExecutor", m_engineCpu.milliseconds()}}},
+        {"scenarios", scenarios}};
+
+    RecordProperty("operationsPerSecond", static_cast<int>(BENCHMARK_OPERATIONS / duration));
+    RecordProperty("allocations", static_cast<int>(allocations));
+    for (auto& next : scenarios.items()) {
+        RecordProperty(next.key() + ".p50Us", static_cast<int>(next.value()["p50Us"].get<double>()));
+        RecordProperty(next.key() + ".p99Us", static_cast<int>(next.value()["p99Us"].get<double>()));
+    }
+    std::ofstream output(path, std::ios::app);
+    output << results.dump() << std::endl;
+    EXPECT_TRUE(output.good()) << "Failed to write " << path;
+
+    EXPECT_EQ(failures, 0);
+
+    // every audio stream, including the warm up one, is read to the end
+    auto audioStreams = latencies[Scenario::AUDIO_STREAM].size() + 1;
+    EXPECT_EQ(m_platform->getAudioBytes(), audioStreams * AUDIO_CHUNK_COUNT * AUDIO_CHUNK_SIZE);
+}
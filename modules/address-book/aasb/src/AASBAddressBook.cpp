@@ -16,6 +16,9 @@
 #include <AASB/Engine/AddressBook/AASBAddressBook.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include <AASB/Message/AddressBook/AddressBook/AddAddressBookMessage.h>
 #include <AASB/Message/AddressBook/AddressBook/AddressBook.h>
 #include <AASB/Message/AddressBook/AddressBook/AddressBookType.h>
@@ -35,6 +38,16 @@ static const std::string TAG("aasb.addressbook.AASBAddressBook");
 // aliases
 using Message = aace::engine::messageBroker::Message;
 
+/// The number of cached entries passed to the engine with each @c addEntries() call.
+static const size_t ADD_ENTRIES_BATCH_SIZE = 100;
+
+/// Adds a string field to an entry payload, leaving out values that are not available.
+static void addStringField(nlohmann::json& object, const char* name, const std::string& value) {
+    if (!value.empty()) {
+        object[name] = value;
+    }
+}
+
 std::shared_ptr<AASBAddressBook> AASBAddressBook::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker) {
     try {
@@ -140,44 +153,103 @@ bool AASBAddressBook::getEntries(
         if (addressBookIter != m_addressBookCache.end()) {
             const auto& addressBook = addressBookIter->second;
 
+            // The cached names, phone numbers and postal addresses are grouped by entry, so that each entry is
+            // complete when it is added and the engine can upload the entries batch by batch.
+            struct EntryData {
+                const aasb::message::addressBook::addressBook::NavigationName* navigationName = nullptr;
+                const aasb::message::addressBook::addressBook::ContactName* contactName = nullptr;
+                std::vector<const aasb::message::addressBook::addressBook::PhoneData*> phoneData;
+                std::vector<const aasb::message::addressBook::addressBook::PostalAddress*> postalAddresses;
+            };
+            std::vector<std::string> entryIds;
+            std::unordered_map<std::string, EntryData> entries;
+            auto getEntryData = [&entryIds, &entries](const std::string& entryId) -> EntryData& {
+                auto it = entries.find(entryId);
+                if (it == entries.end()) {
+                    entryIds.push_back(entryId);
+                    it = entries.emplace(entryId, EntryData()).first;
+                }
+                return it->second;
+            };
+
             for (const auto& navName : addressBook.navigationNames) {
-                AACE_DEBUG(LX(TAG).d("navName:entryId", navName.entryId));
-                sp->addName(navName.entryId, navName.name, "", "", navName.phoneticName);
+                auto& entryData = getEntryData(navName.entryId);
+                if (entryData.navigationName == nullptr) {
+                    entryData.navigationName = &navName;
+                }
             }
-
             for (const auto& contactName : addressBook.contactNames) {
-                AACE_DEBUG(LX(TAG).d("contactName:entryId", contactName.entryId));
-                sp->addName(
-                    contactName.entryId,
-                    contactName.firstName,
-                    contactName.lastName,
-                    contactName.nickname,
-                    contactName.phoneticFirstName,
-                    contactName.phoneticLastName);
+                auto& entryData = getEntryData(contactName.entryId);
+                if (entryData.contactName == nullptr) {
+                    entryData.contactName = &contactName;
+                }
             }
-
             for (const auto& phone : addressBook.phoneData) {
-                AACE_DEBUG(LX(TAG).d("phone:entryId", phone.entryId).sensitive("label", phone.label));
-                sp->addPhone(phone.entryId, phone.label, phone.number);
+                getEntryData(phone.entryId).phoneData.push_back(&phone);
             }
-
             for (const auto& postalAddress : addressBook.postalAddresses) {
-                AACE_DEBUG(
-                    LX(TAG).d("postalAddress:entryId", postalAddress.entryId).sensitive("label", postalAddress.label));
-                sp->addPostalAddress(
-                    postalAddress.entryId,
-                    postalAddress.label,
-                    postalAddress.addressLine1,
-                    postalAddress.addressLine2,
-                    postalAddress.addressLine3,
-                    postalAddress.city,
-                    postalAddress.stateOrRegion,
-                    postalAddress.districtOrCounty,
-                    postalAddress.postalCode,
-                    postalAddress.country,
-                    postalAddress.latitudeInDegrees,
-                    postalAddress.longitudeInDegrees,
-                    postalAddress.accuracyInMeters);
+                getEntryData(postalAddress.entryId).postalAddresses.push_back(&postalAddress);
+            }
+
+            auto batch = nlohmann::json::array();
+            for (size_t i = 0; i < entryIds.size(); i++) {
+                const auto& entryId = entryIds[i];
+                const auto& entryData = entries[entryId];
+                AACE_DEBUG(LX(TAG).d("entryId", entryId));
+
+                nlohmann::json name = nlohmann::json::object();
+                if (entryData.contactName != nullptr) {
+                    const auto& contactName = *entryData.contactName;
+                    addStringField(name, "firstName", contactName.firstName);
+                    addStringField(name, "lastName", contactName.lastName);
+                    addStringField(name, "nickName", contactName.nickname);
+                    addStringField(name, "phoneticFirstName", contactName.phoneticFirstName);
+                    addStringField(name, "phoneticLastName", contactName.phoneticLastName);
+                } else if (entryData.navigationName != nullptr) {
+                    addStringField(name, "firstName", entryData.navigationName->name);
+                    addStringField(name, "phoneticFirstName", entryData.navigationName->phoneticName);
+                }
+                nlohmann::json entry = {{"entryId", entryId}, {"name", name}};
+
+                if (!entryData.phoneData.empty()) {
+                    auto& phoneNumbers = entry["phoneNumbers"] = nlohmann::json::array();
+                    for (auto phone : entryData.phoneData) {
+                        AACE_DEBUG(LX(TAG).d("phone:entryId", entryId).sensitive("label", phone->label));
+                        nlohmann::json phoneNumber = nlohmann::json::object();
+                        addStringField(phoneNumber, "label", phone->label);
+                        addStringField(phoneNumber, "number", phone->number);
+                        phoneNumbers.push_back(phoneNumber);
+                    }
+                }
+
+                if (!entryData.postalAddresses.empty()) {
+                    auto& postalAddresses = entry["postalAddresses"] = nlohmann::json::array();
+                    for (auto postalAddress : entryData.postalAddresses) {
+                        AACE_DEBUG(
+                            LX(TAG).d("postalAddress:entryId", entryId).sensitive("label", postalAddress->label));
+                        nlohmann::json address = {
+                            {"latitudeInDegrees", postalAddress->latitudeInDegrees},
+                            {"longitudeInDegrees", postalAddress->longitudeInDegrees},
+                            {"accuracyInMeters", postalAddress->accuracyInMeters}};
+                        addStringField(address, "label", postalAddress->label);
+                        addStringField(address, "addressLine1", postalAddress->addressLine1);
+                        addStringField(address, "addressLine2", postalAddress->addressLine2);
+                        addStringField(address, "addressLine3", postalAddress->addressLine3);
+                        addStringField(address, "city", postalAddress->city);
+                        addStringField(address, "stateOrRegion", postalAddress->stateOrRegion);
+                        addStringField(address, "districtOrCounty", postalAddress->districtOrCounty);
+                        addStringField(address, "postalCode", postalAddress->postalCode);
+                        addStringField(address, "countryCode", postalAddress->country);
+                        postalAddresses.push_back(address);
+                    }
+                }
+
+                batch.push_back(std::move(entry));
+                if (batch.size() >= ADD_ENTRIES_BATCH_SIZE || i + 1 == entryIds.size()) {
+                    // Entries failing the validation are logged and skipped by the engine.
+                    sp->addEntries(batch.dump());
+                    batch = nlohmann::json::array();
+                }
             }
         }
 
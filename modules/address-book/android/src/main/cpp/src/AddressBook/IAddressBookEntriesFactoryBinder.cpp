@@ -159,4 +159,21 @@ JNIEXPORT jboolean JNICALL Java_com_amazon_aace_addressbook_IAddressBookEntriesF
         return false;
     }
 }
+
+JNIEXPORT jboolean JNICALL Java_com_amazon_aace_addressbook_IAddressBookEntriesFactory_addEntries(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring payload) {
+    try {
+        auto iAddressBookEntriesFactoryBinder = I_ADDRESS_BOOK_ENTRIES_FACTORY_BINDER(ref);
+        ThrowIfNull(iAddressBookEntriesFactoryBinder, "invalidIAddressBookEntriesFactoryBinder");
+
+        return static_cast<jboolean>(
+            iAddressBookEntriesFactoryBinder->getIAddressBookEntriesFactory()->addEntries(JString(payload).toStdStr()));
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_addressbook_IAddressBookEntriesFactory_addEntries", ex.what());
+        return false;
+    }
+}
 }
@@ -223,6 +223,19 @@ final public class IAddressBookEntriesFactory extends NativeRef {
         return addEntry(getNativeRef(), payload);
     }
 
+    /**
+     * Add a batch of address book entries. Use this instead of calling @c addEntry() once per entry when ingesting
+     * large address books.
+     *
+     * @param payload A JSON array of address book entries, each in the format accepted by @c addEntry().
+     * @return @c true if all the entries were added, or @c false when the payload is not a valid JSON array or the
+     * input validation of one or more entries fails. Entries failing the validation are handled as described for @c
+     * addEntry(), the remaining entries of the batch are added.
+     */
+    final public boolean addEntries(String payload) {
+        return addEntries(getNativeRef(), payload);
+    }
+
     protected long createNativeRef() {
         return 0;
     }
@@ -241,4 +254,5 @@ final public class IAddressBookEntriesFactory extends NativeRef {
             String postalCode, String country, double latitudeInDegrees, double longitudeInDegrees,
             double accuracyInMeters);
     private native boolean addEntry(long nativeObject, String payload);
+    private native boolean addEntries(long nativeObject, String payload);
 }
@@ -17,12 +17,16 @@
 #define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_CLOUD_UPLOADER_H
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <iostream>
+#include <mutex>
+#include <queue>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
@@ -34,6 +38,7 @@
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Network/NetworkInfoObserver.h>
 #include <AACE/Engine/Network/NetworkObservableInterface.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 
 #include "AddressBookObserver.h"
 #include "AddressBookServiceInterface.h"
@@ -168,9 +173,20 @@ private:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        unsigned int maxConcurrentUploads,
+        std::chrono::seconds removeGracePeriod);
 
 public:
+    /// Default number of entry batches uploaded concurrently.
+    static constexpr unsigned int DEFAULT_MAX_CONCURRENT_UPLOADS = 4;
+
+    /// Default time a removed address book is kept in the cloud. Removed address books are deleted right away unless
+    /// a grace period is configured.
+    static const std::chrono::seconds DEFAULT_REMOVE_GRACE_PERIOD;
+
     static std::shared_ptr<AddressBookCloudUploader> create(
         std::shared_ptr<aace::engine::addressBook::AddressBookServiceInterface> addressBookService,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
@@ -179,7 +195,11 @@ public:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient = nullptr,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage = nullptr,
+        unsigned int maxConcurrentUploads = DEFAULT_MAX_CONCURRENT_UPLOADS,
+        std::chrono::seconds removeGracePeriod = std::chrono::seconds::zero());
 
     // AddressBookObserver
     bool addressBookAdded(std::shared_ptr<AddressBookEntity> addressBookEntity) override;
@@ -204,31 +224,116 @@ private:
     using HTTPResponse = AddressBookCloudUploaderRESTAgent::HTTPResponse;
     using HTTPResponseCode = alexaClientSDK::avsCommon::utils::http::HTTPResponseCode;
 
+    /// Number of entries handled by an address book upload, reported in the request metrics.
+    struct SyncStats {
+        /// Entries posted to the cloud.
+        unsigned int entriesUploaded = 0;
+
+        /// Entries left untouched because their content did not change since the last sync.
+        unsigned int entriesSkipped = 0;
+    };
+
+    /// What was last uploaded for an address book type, used to compute the delta on the next upload.
+    struct SyncState {
+        /// Source id of the uploaded address book.
+        std::string addressBookSourceId;
+
+        /// Id of the cloud address book holding the entries.
+        std::string cloudAddressBookId;
+
+        /// Time the cloud address book was created.
+        std::chrono::system_clock::time_point createTime;
+
+        /// Content hash per entry source id.
+        std::unordered_map<std::string, uint64_t> entryHashes;
+
+        /// Time the cloud address book is deleted if the address book was removed, otherwise the epoch.
+        std::chrono::system_clock::time_point removeTime;
+    };
+
+    /// A removed address book whose cloud address book is deleted when its grace period ends.
+    struct PendingRemove {
+        std::shared_ptr<AddressBookEntity> addressBookEntity;
+        std::chrono::system_clock::time_point removeTime;
+    };
+
     void eventLoop(bool cleanAllAddressBooksAtStart);  // Infinite loop
     const Event popNextEventFromQ();
 
     /**
-     * Upload the specified address book
+     * Upload the specified address book. Each batch of entries is uploaded as soon as it is filled, so only the
+     * batches in flight are kept in memory.
      * @param [in] addressBookEntity Address book to upload
      * @param [out] numBatches int reference to update with the number of
      *        batches it took to complete the upload attempt
      * @param [out] result AddressBookOperationResultCode reference to update
      *        with result of the upload
+     * @param [out] syncStats SyncStats reference to update with the number of
+     *        uploaded and skipped entries
      * @return @c true if the upload was successful, false otherwise
      */
     bool handleUpload(
         std::shared_ptr<AddressBookEntity> addressBookEntity,
         int& numBatches,
-        AddressBookOperationResultCode& result);
+        AddressBookOperationResultCode& result,
+        SyncStats& syncStats);
+
+    /**
+     * Brings the cloud address book in sync with the address book by uploading the added entries, leaving
+     * unchanged entries in place. The address book is read once to compare its entry hashes with the sync state,
+     * and read again to upload the added entries. ACMS does not delete single entries, so a removed or changed
+     * entry requires a full upload.
+     *
+     * @param [in] addressBookEntity Address book to upload
+     * @param [in,out] syncState The state of the previous upload, updated on success
+     * @param [out] numBatches The number of batches uploaded
+     * @param [out] syncStats The number of uploaded and skipped entries
+     * @return @c true if the delta was applied, @c false if a full upload is required
+     */
+    bool handleDeltaUpload(
+        std::shared_ptr<AddressBookEntity> addressBookEntity,
+        SyncState& syncState,
+        int& numBatches,
+        SyncStats& syncStats);
+
+    bool loadSyncState(const std::string& addressBookType, SyncState& syncState);
+    void saveSyncState(const std::string& addressBookType, const SyncState& syncState);
+    void clearSyncState(const std::string& addressBookType);
+    void clearAllSyncStates();
+
+    /**
+     * Keeps the cloud address book of a removed address book for @c m_removeGracePeriod, so adding the same
+     * address book again only uploads what changed.
+     *
+     * @return @c false if the cloud address book must be deleted now.
+     */
+    bool deferRemove(std::shared_ptr<AddressBookEntity> addressBookEntity);
+
+    /// Returns whether the grace period of a removed address book ended, and forgets the removal.
+    bool takeDueRemove(const std::string& addressBookType);
+
+    /// Keeps the cloud address book of a type that is added again during its grace period.
+    void cancelPendingRemove(const std::string& addressBookType);
+
+    /// Schedules the deletion of the cloud address books that were removed before the engine was restarted.
+    void restorePendingRemoves();
+
     bool handleRemove(std::shared_ptr<AddressBookEntity> addressBookEntity, AddressBookOperationResultCode& result);
 
     bool checkAndAutoProvisionAccount();
     AddressBookOperationResultCode prepareForUpload(
         std::shared_ptr<AddressBookEntity> addressBookEntity,
         std::string& cloudAddressBookId);
+
+    AddressBookOperationResultCode uploadBatch(
+        const std::string& cloudAddressBookId,
+        size_t batchIndex,
+        const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
+        std::queue<std::string>& failedEntries);
     AddressBookOperationResultCode uploadEntries(
         const std::string& cloudAddressBookId,
-        std::shared_ptr<rapidjson::Document> document);
+        const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
+        std::queue<std::string>& failedEntries);
 
     std::string createAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
     bool deleteAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
@@ -240,13 +345,16 @@ private:
 
     UploadFlowState handleUploadEntries(
         const std::string& addressBookId,
-        std::shared_ptr<rapidjson::Document> document,
+        const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
         HTTPResponse& httpResponse);
-    UploadFlowState handleParseHTTPResponse(const HTTPResponse& httpResponse);
-    UploadFlowState handleError(const std::string& addressBookId);
+    UploadFlowState handleParseHTTPResponse(const HTTPResponse& httpResponse, std::queue<std::string>& failedEntries);
+    void handleError(const std::string& addressBookId);
 
     static AddressBookOperationResultCode httpResponseCodeToResult(HTTPResponseCode code);
 
+    /// Whether a batch upload that failed with @c result may succeed when retried.
+    static bool isRetryableResult(AddressBookOperationResultCode result);
+
     /// Get AddressBookOperationResultCode as a string for metrics dimensions
     static std::string getResultString(const AddressBookOperationResultCode& result);
 
@@ -262,7 +370,8 @@ private:
         unsigned int retryCount,
         unsigned int numBatchesInRequest,
         AddressBookType addressBookType,
-        AddressBookOperationResultCode result);
+        AddressBookOperationResultCode result,
+        const SyncStats& syncStats = SyncStats());
 
     friend std::ostream& operator<<(std::ostream& stream, const UploadFlowState& state);
 
@@ -298,6 +407,24 @@ private:
     NetworkInfoObserver::NetworkStatus m_networkStatus;
 
     std::thread m_eventThread;
+
+    /// Storage for the sync states, may be null in which case the states are kept in memory only.
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
+    /// Sync state per address book type, loaded lazily from @c m_localStorage.
+    std::unordered_map<std::string, SyncState> m_syncStates;
+
+    /// Serializes access to @c m_syncStates and the persisted sync states.
+    std::mutex m_syncStateMutex;
+
+    /// Maximum number of entry batches in flight while uploading an address book.
+    unsigned int m_maxConcurrentUploads;
+
+    /// Time a removed address book is kept in the cloud, zero to delete it right away.
+    std::chrono::seconds m_removeGracePeriod;
+
+    /// Removed address books per address book type, guarded by @c m_mutex.
+    std::unordered_map<std::string, PendingRemove> m_pendingRemoves;
 };
 
 inline std::ostream& operator<<(std::ostream& stream, const AddressBookCloudUploader::UploadFlowState& state) {
@@ -23,14 +23,12 @@
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/Utils/DeviceInfo.h>
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpDelete.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
 
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
 #include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
@@ -43,7 +41,9 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo);
 
-    bool initialize(std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+    bool initialize(
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 public:
     using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
@@ -51,7 +51,8 @@ public:
     static std::shared_ptr<AddressBookCloudUploaderRESTAgent> create(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient = nullptr);
 
     virtual ~AddressBookCloudUploaderRESTAgent() = default;
 
@@ -66,9 +67,28 @@ public:
         std::string& cloudAddressBookId);
     bool deleteCloudAddressBook(const std::string& cloudAddressBookId);
 
+    /// A batch of entries serialized and compressed for upload.
+    struct UploadBatch {
+        /// The request body.
+        std::string content;
+
+        /// Whether @c content is gzip compressed.
+        bool compressed = false;
+    };
+
+    /**
+     * Serializes and compresses an upload document. This is independent of any request, so the next batch
+     * can be prepared while the previous one is still being uploaded.
+     *
+     * @param document The document with the entries to upload.
+     * @return The prepared batch.
+     */
+    static UploadBatch prepareUploadBatch(const rapidjson::Document& document);
+
     HTTPResponse uploadDocumentToCloud(
         std::shared_ptr<rapidjson::Document> document,
         const std::string& cloudAddressBookId);
+    HTTPResponse uploadBatchToCloud(const UploadBatch& batch, const std::string& cloudAddressBookId);
     bool parseCreateAddressBookEntryResponse(const HTTPResponse& response, std::queue<std::string>& failedEntries);
     std::string buildFailedEntriesJson(std::queue<std::string>& failedContact);
 
@@ -144,6 +164,9 @@ private:
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
 
+    /// Shared HTTP client used for all ACMS requests.
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> m_httpClient;
+
     /// ACMS REST endpoint used for uploading.
     std::string m_acmsEndpoint;
 
@@ -54,6 +54,8 @@ private:
     std::shared_ptr<AddressBookEngineImpl> m_addressBookEngineImpl;
     std::shared_ptr<AddressBookCloudUploader> m_addressBookCloudUploader;
     bool m_cleanAllAddressBooksAtStart;
+    unsigned int m_maxConcurrentUploads;
+    std::chrono::seconds m_removeGracePeriod;
 };
 
 }  // namespace addressBook
@@ -13,9 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
+#include <memory>
 #include <sstream>
 #include <typeinfo>
+#include <unordered_set>
 
 #include <nlohmann/json.hpp>
 #include <rapidjson/error/en.h>
@@ -62,6 +66,15 @@ static const int MAX_ALLOWED_ADDRESS_LINE_SIZE = 60;
 /// Max event retry before event being dropped from the queue.
 static const int MAX_EVENT_RETRY = 3;
 
+/// Max retry of a single entry batch before the upload of the address book fails.
+static const int MAX_BATCH_RETRY = 2;
+
+/// Delay before the first retry of an entry batch, doubled for every further retry.
+static const std::chrono::seconds BATCH_RETRY_DELAY = std::chrono::seconds(1);
+
+/// Upper bound for the configured number of concurrent batch uploads.
+static const unsigned int MAX_CONCURRENT_UPLOADS = 8;
+
 /// Invalid Address Id
 static const std::string INVALID_ADDRESS_BOOK_SOURCE_ID = "INVALID";
 
@@ -113,10 +126,29 @@ static const std::string METRIC_REQUEST_FAILURE_COUNT = "RequestFailureCount";
 /// Request failure type metric dimension key
 static const std::string METRIC_REQUEST_FAILURE_TYPE = "RequestFailureType";
 
+/// Uploaded entries count metric key
+static const std::string METRIC_ENTRIES_UPLOADED = "EntriesUploaded";
+
+/// Unchanged, not uploaded entries count metric key
+static const std::string METRIC_ENTRIES_SKIPPED = "EntriesSkipped";
+
+/// Local storage table holding the sync state per address book type
+static const std::string SYNC_STATE_TABLE = "aace.addressBook.cloudUploader";
+
+/// Age after which a cloud address book is recreated by a full upload, well before it expires in the cloud.
+static const std::chrono::hours MAX_SYNC_STATE_AGE = std::chrono::hours(7 * 24);
+
 using json = nlohmann::json;
 
+constexpr unsigned int AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS;
+const std::chrono::seconds AddressBookCloudUploader::DEFAULT_REMOVE_GRACE_PERIOD = std::chrono::seconds::zero();
+
 AddressBookCloudUploader::AddressBookCloudUploader() :
-        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG), m_isShuttingDown(false), m_isAuthRefreshed(false) {
+        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
+        m_isShuttingDown(false),
+        m_isAuthRefreshed(false),
+        m_maxConcurrentUploads(DEFAULT_MAX_CONCURRENT_UPLOADS),
+        m_removeGracePeriod(std::chrono::seconds::zero()) {
 }
 
 std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
@@ -127,7 +159,11 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    unsigned int maxConcurrentUploads,
+    std::chrono::seconds removeGracePeriod) {
     try {
         auto addressBookCloudUploader = std::shared_ptr<AddressBookCloudUploader>(new AddressBookCloudUploader());
         ThrowIfNull(metricRecorder, "nullMetricRecorder");
@@ -140,7 +176,11 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
                 networkObserver,
                 alexaEndpoints,
                 metricRecorder,
-                cleanAllAddressBooksAtStart),
+                cleanAllAddressBooksAtStart,
+                httpClient,
+                localStorage,
+                maxConcurrentUploads,
+                removeGracePeriod),
             "initializeAddressBookCloudUploaderFailed");
 
         return addressBookCloudUploader;
@@ -158,17 +198,25 @@ bool AddressBookCloudUploader::initialize(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    unsigned int maxConcurrentUploads,
+    std::chrono::seconds removeGracePeriod) {
     try {
+        ThrowIf(maxConcurrentUploads == 0, "invalidMaxConcurrentUploads");
         m_addressBookService = addressBookService;
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
         m_networkStatus = networkStatus;
         m_networkObserver = networkObserver;
         m_metricRecorder = metricRecorder;
+        m_localStorage = localStorage;
+        m_maxConcurrentUploads = std::min(maxConcurrentUploads, MAX_CONCURRENT_UPLOADS);
+        m_removeGracePeriod = std::max(removeGracePeriod, std::chrono::seconds::zero());
 
         m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
-            authDelegate, m_deviceInfo, alexaEndpoints);
+            authDelegate, m_deviceInfo, alexaEndpoints, httpClient);
         ThrowIfNull(m_addressBookCloudUploaderRESTAgent, "createAddressBookCloudRESTAgentFailed");
 
         m_authDelegate->addAuthObserver(shared_from_this());
@@ -221,6 +269,9 @@ void AddressBookCloudUploader::onAuthStateChange(
         case AuthObserverInterface::State::UNRECOVERABLE_ERROR:
             m_addressBookEventQ.clear();
             m_addressBookCloudUploaderRESTAgent->reset();
+            // The cloud address books belong to the signed out user
+            m_pendingRemoves.clear();
+            clearAllSyncStates();
             break;
         case AuthObserverInterface::State::REFRESHED:
             m_waitForEvent.notify_all();
@@ -321,12 +372,105 @@ void AddressBookCloudUploader::removeMatchingAddEventFromQueueLocked(
     }
 }
 
+/**
+ * Computes the 64-bit FNV-1a hash of the serialized entry, so any change to the uploaded content
+ * of the entry changes its hash.
+ *
+ * @param entry The entry as added to the upload document.
+ * @return The content hash.
+ */
+static uint64_t hashEntry(const rapidjson::Value& entry) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    entry.Accept(writer);
+
+    uint64_t hash = 14695981039346656037ULL;
+    auto data = buffer.GetString();
+    for (size_t i = 0; i < buffer.GetSize(); i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Returns the member @c name of the payload node @c node if it is present.
+ *
+ * @param node The payload object to look up the member in.
+ * @param name The member name.
+ * @param reason The exception reason used if the member is present but not a string.
+ * @return A pointer to the string member, or @c nullptr if the member is not present.
+ */
+static const rapidjson::Value* findStringMember(const rapidjson::Value& node, const char* name, const char* reason) {
+    auto it = node.FindMember(name);
+    if (it == node.MemberEnd()) {
+        return nullptr;
+    }
+    ThrowIfNot(it->value.IsString(), reason);
+    return &it->value;
+}
+
+/**
+ * Returns the member @c name of the payload node @c node as a float, or @c defaultValue if not present.
+ */
+static float getFloatMember(const rapidjson::Value& node, const char* name, float defaultValue) {
+    auto it = node.FindMember(name);
+    if (it == node.MemberEnd() || !it->value.IsNumber()) {
+        return defaultValue;
+    }
+    return static_cast<float>(it->value.GetDouble());
+}
+
+static rapidjson::SizeType getStringLength(const rapidjson::Value* value) {
+    return value != nullptr ? value->GetStringLength() : 0;
+}
+
+/**
+ * Copies the payload string @c value into @c target as member @c name, skipping absent and empty strings.
+ */
+static void addStringMember(
+    rapidjson::Value& target,
+    const char* name,
+    const rapidjson::Value* value,
+    rapidjson::Document::AllocatorType& allocator) {
+    if (value != nullptr && value->GetStringLength() > 0) {
+        rapidjson::Value copy(value->GetString(), value->GetStringLength(), allocator);
+        target.AddMember(rapidjson::StringRef(name), copy, allocator);
+    }
+}
+
+/// Mirrors the empty check of the previous payload parser: absent values, empty arrays and empty objects.
+static bool isEmptyNode(const rapidjson::Value& node) {
+    return node.IsNull() || (node.IsArray() && node.Empty()) || (node.IsObject() && node.ObjectEmpty());
+}
+
 class AddressBookEntriesFactory : public aace::addressBook::AddressBook::IAddressBookEntriesFactory {
 public:
-    AddressBookEntriesFactory(
-        std::shared_ptr<AddressBookEntity> addressBookEntity,
-        std::vector<std::shared_ptr<rapidjson::Document>>& documents) :
-            m_addressBookEntity(std::move(addressBookEntity)), m_documents(documents) {
+    /**
+     * Receives every filled upload batch. The batch is released when the handler returns, so only the batch
+     * being filled is kept in memory while the address book is read.
+     *
+     * @return @c false to stop accepting entries, for example when the upload failed.
+     */
+    using BatchHandler = std::function<bool(rapidjson::Document& document)>;
+
+    AddressBookEntriesFactory(std::shared_ptr<AddressBookEntity> addressBookEntity, BatchHandler batchHandler) :
+            m_addressBookEntity(std::move(addressBookEntity)),
+            m_batchHandler(std::move(batchHandler)),
+            m_numHandledEntries(0),
+            m_keepEntries(false),
+            m_stopped(false) {
+    }
+
+    /**
+     * Hands the last, partially filled batch to the batch handler. Called once the platform has provided all
+     * the entries.
+     *
+     * @return @c false if the batch handler stopped accepting entries.
+     */
+    bool flush() {
+        handleBatch();
+        return !m_stopped;
     }
 
 private:
@@ -338,342 +482,418 @@ private:
         return true;
     }
 
-    void createEntryDataField(const std::string& entryId) {
-        auto it = m_ids.find(entryId);
-        if (it == m_ids.end()) {
-            // For "m_ids[id] = m_ids.size();" on Ubuntu platform, [] seems to increment the m_ids
-            // size before assignment that causes incorrect indexes for later usage.
-            auto index = m_ids.size();
-            m_ids[entryId] = index;
-
-            auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-            auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
-
-            // Check if bucket mapping to bucketIndex is new bucket to be created.
-            if (bucketIndex + 1 > (m_documents.size())) {
-                auto document = std::make_shared<rapidjson::Document>();
-                document->SetObject();
-
-                m_documents.push_back(document);
-                auto& allocator = document->GetAllocator();
-
-                rapidjson::Value entries(rapidjson::kArrayType);
-
-                document->AddMember("entries", entries, allocator);
+    /**
+     * Hands the current batch to the batch handler and releases it. A batch that only saw rejected entries
+     * is kept for the next entries instead. Entries kept for the deprecated functions are split into batches
+     * of @c UPLOAD_BATCH_SIZE entries.
+     */
+    void handleBatch() {
+        if (m_document == nullptr || (*m_document)["entries"].Empty() || m_stopped) {
+            return;
+        }
+        auto& entries = (*m_document)["entries"];
+        if (entries.Size() <= static_cast<rapidjson::SizeType>(UPLOAD_BATCH_SIZE)) {
+            if (!m_batchHandler(*m_document)) {
+                m_stopped = true;
+            }
+        } else {
+            for (rapidjson::SizeType begin = 0; begin < entries.Size() && !m_stopped; begin += UPLOAD_BATCH_SIZE) {
+                rapidjson::Document batch;
+                batch.SetObject();
+                auto& allocator = batch.GetAllocator();
+                rapidjson::Value batchEntries(rapidjson::kArrayType);
+                auto end = std::min(entries.Size(), begin + static_cast<rapidjson::SizeType>(UPLOAD_BATCH_SIZE));
+                batchEntries.Reserve(end - begin, allocator);
+                for (auto index = begin; index < end; index++) {
+                    rapidjson::Value entry(entries[index], allocator);
+                    batchEntries.PushBack(entry, allocator);
+                }
+                batch.AddMember("entries", batchEntries, allocator);
+                if (!m_batchHandler(batch)) {
+                    m_stopped = true;
+                }
             }
+        }
+        m_numHandledEntries += entries.Size();
+        m_document.reset();
+    }
 
-            auto& document = *m_documents[bucketIndex];
-            auto& allocator = document.GetAllocator();
+    /**
+     * The deprecated functions can add data to any entry until the address book is read completely, so once
+     * they are used the entries are kept and only handed to the batch handler by @c flush().
+     */
+    void keepEntriesUntilFlush() {
+        m_keepEntries = true;
+    }
 
-            auto& entries = document["entries"];
+    void createEntryDataField(const std::string& entryId) {
+        auto it = m_ids.find(entryId);
+        if (it == m_ids.end()) {
+            rapidjson::Value data(rapidjson::kObjectType);
+            getNextEntryAllocator();
+            appendEntry(entryId, data);
+        }
+    }
 
-            if (entriesIndex + 1 > entries.Size()) {
-                rapidjson::Value entry(rapidjson::kObjectType);
+    /**
+     * Appends an entry to the current upload batch. @c data must be allocated with the allocator returned by
+     * @c getNextEntryAllocator().
+     */
+    void appendEntry(const std::string& entryId, rapidjson::Value& data) {
+        auto& allocator = m_document->GetAllocator();
+
+        rapidjson::Value entry(rapidjson::kObjectType);
+        entry.AddMember("entrySourceId", entryId, allocator);
+        entry.AddMember("data", data, allocator);
+
+        (*m_document)["entries"].PushBack(entry, allocator);
+        // For "m_ids[id] = m_ids.size();" on Ubuntu platform, [] seems to increment the m_ids
+        // size before assignment that causes incorrect indexes for later usage.
+        auto index = m_ids.size();
+        m_ids[entryId] = index;
+    }
 
-                entry.AddMember("entrySourceId", entryId, allocator);
-                rapidjson::Value data(rapidjson::kObjectType);
+    /**
+     * Returns the allocator of the upload batch the next entry is appended to, so a payload can be encoded
+     * directly into its batch. A full batch is handed to the batch handler first.
+     */
+    rapidjson::Document::AllocatorType& getNextEntryAllocator() {
+        if (m_document != nullptr && !m_keepEntries &&
+            (*m_document)["entries"].Size() >= static_cast<rapidjson::SizeType>(UPLOAD_BATCH_SIZE)) {
+            handleBatch();
+        }
+        ThrowIf(m_stopped, "uploadStopped");
+        if (m_document == nullptr) {
+            m_document.reset(new rapidjson::Document());
+            m_document->SetObject();
+            auto& allocator = m_document->GetAllocator();
 
-                entry.AddMember("data", data, allocator);
+            rapidjson::Value entries(rapidjson::kArrayType);
+            entries.Reserve(UPLOAD_BATCH_SIZE, allocator);
 
-                entries.PushBack(entry, allocator);
-            }
+            m_document->AddMember("entries", entries, allocator);
         }
+        return m_document->GetAllocator();
     }
 
+    /// Returns the data of an entry of the current batch. Entries of a handed over batch can no longer change.
     rapidjson::Value& getEntryDataNode(const std::string& entryId) {
-        auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-        auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
+        auto index = m_ids[entryId];
+        ThrowIf(index < m_numHandledEntries, "entryAlreadyUploaded");
 
-        auto& document = *m_documents[bucketIndex];
-        auto& entries = document["entries"];
-
-        return entries[entriesIndex]["data"];
+        return (*m_document)["entries"][static_cast<rapidjson::SizeType>(index - m_numHandledEntries)]["data"];
     }
 
     rapidjson::Document::AllocatorType& GetAllocator(const std::string& entryId) {
-        auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-        auto& document = *m_documents[bucketIndex];
+        ThrowIf(m_ids[entryId] < m_numHandledEntries, "entryAlreadyUploaded");
 
-        return document.GetAllocator();
+        return m_document->GetAllocator();
     }
 
-public:
-    bool addEntry(const std::string& payload) {
+    /**
+     * Validates a single entry of an @c addEntry() or @c addEntries() payload and encodes it into its upload
+     * batch. The entry is appended only once it is fully validated; a batch that only saw rejected entries is
+     * never handed to the batch handler.
+     *
+     * @param entryPayload The entry object.
+     * @return @c true if the entry was added as is, @c false if elements of the entry were dropped.
+     * @throw std::runtime_error if the entry was rejected.
+     */
+    bool encodeEntry(const rapidjson::Value& entryPayload) {
         bool success = true;
-        try {
-            ThrowIf(payload.empty(), "payloadEmpty");
-            auto entryPayload = json::parse(payload);
 
-            ThrowIfNot(
-                entryPayload.contains("entryId") && entryPayload["entryId"].is_string(), "entryIdMissingOrNotString");
-            ThrowIf(entryPayload["entryId"].empty(), "entryIdEmpty");
-
-            std::string entryId = entryPayload["entryId"];
-            AACE_DEBUG(LX(TAG).d("entryId", entryId));
-
-            ThrowIf(entryId.size() > MAX_ALLOWED_ENTRY_ID_SIZE, "entryIdSizeExceedsMaxSize");
-            ThrowIfNot(entryPayload.contains("name") && entryPayload["name"].is_object(), "nameMissingOrInvalid");
-
-            auto& nameNode = entryPayload["name"];
-
-            // clang-format off
-            // Sanitize name  field types
-            ThrowIfNot((nameNode.contains("firstName") ? nameNode["firstName"].is_string() : true), "firstNameInvalid");
-            ThrowIfNot((nameNode.contains("lastName") ? nameNode["lastName"].is_string() : true), "lastNameInvalid");
-            ThrowIfNot((nameNode.contains("nickName") ? nameNode["nickName"].is_string() : true), "nickNameInvalid");
-            ThrowIfNot((nameNode.contains("phoneticFirstName") ? nameNode["phoneticFirstName"].is_string() : true), "phoneticFirstNameInvalid");
-            ThrowIfNot((nameNode.contains("phoneticLastName") ? nameNode["phoneticLastName"].is_string() : true), "phoneticLastNameInvalid");
-            // clang-format on
-
-            std::string firstName = nameNode.value("firstName", "");
-            std::string lastName = nameNode.value("lastName", "");
-            std::string nickName = nameNode.value("nickName", "");
-            std::string phoneticFirstName = nameNode.value("phoneticFirstName", "");
-            std::string phoneticLastName = nameNode.value("phoneticLastName", "");
-
-            // Sanitize field size
-            auto totalSize = firstName.size() + lastName.size() + nickName.size() + phoneticFirstName.size() +
-                             phoneticLastName.size();
-            if (totalSize > MAX_ALLOWED_CHARACTERS) {
-                AACE_ERROR(LX(TAG)
-                               .m("nameTotalLengthExceedsMaxSize")
-                               .d("entryId", entryId)
-                               .d("size", totalSize)
-                               .d("maxSize", MAX_ALLOWED_CHARACTERS));
-                return false;
-            }
+        ThrowIfNot(entryPayload.IsObject(), "entryNotAnObject");
+        auto entryIdNode = findStringMember(entryPayload, "entryId", "entryIdMissingOrNotString");
+        ThrowIfNull(entryIdNode, "entryIdMissingOrNotString");
+        ThrowIf(entryIdNode->GetStringLength() == 0, "entryIdEmpty");
 
-            ThrowIf(isEntryPresent(entryId), "entryAlreadyExists");
+        std::string entryId(entryIdNode->GetString(), entryIdNode->GetStringLength());
+        AACE_DEBUG(LX(TAG).d("entryId", entryId));
 
-            createEntryDataField(entryId);
+        ThrowIf(entryId.size() > MAX_ALLOWED_ENTRY_ID_SIZE, "entryIdSizeExceedsMaxSize");
+        auto nameIt = entryPayload.FindMember("name");
+        ThrowIfNot(nameIt != entryPayload.MemberEnd() && nameIt->value.IsObject(), "nameMissingOrInvalid");
 
-            auto& data = getEntryDataNode(entryId);
-            auto& allocator = GetAllocator(entryId);
-            rapidjson::Value name(rapidjson::kObjectType);
+        auto& nameNode = nameIt->value;
 
-            if (!firstName.empty()) name.AddMember("firstName", firstName, allocator);
-            if (!lastName.empty()) name.AddMember("lastName", lastName, allocator);
-            if (!nickName.empty()) name.AddMember("nickName", nickName, allocator);
-            if (!phoneticFirstName.empty()) name.AddMember("phoneticFirstName", phoneticFirstName, allocator);
-            if (!phoneticLastName.empty()) name.AddMember("phoneticLastName", phoneticLastName, allocator);
+        // Sanitize name  field types
+        auto firstName = findStringMember(nameNode, "firstName", "firstNameInvalid");
+        auto lastName = findStringMember(nameNode, "lastName", "lastNameInvalid");
+        auto nickName = findStringMember(nameNode, "nickName", "nickNameInvalid");
+        auto phoneticFirstName = findStringMember(nameNode, "phoneticFirstName", "phoneticFirstNameInvalid");
+        auto phoneticLastName = findStringMember(nameNode, "phoneticLastName", "phoneticLastNameInvalid");
 
-            data.AddMember("name", name, allocator);
+        // Sanitize field size
+        size_t totalSize = getStringLength(firstName) + getStringLength(lastName) + getStringLength(nickName) +
+                           getStringLength(phoneticFirstName) + getStringLength(phoneticLastName);
+        ThrowIf(totalSize > MAX_ALLOWED_CHARACTERS, "nameTotalLengthExceedsMaxSize");
 
-            if (entryPayload.contains("phoneNumbers") && !entryPayload["phoneNumbers"].empty()) {
-                // Consider phone numbers only when the address book type is CONTACT
-                if (m_addressBookEntity->getType() == AddressBookType::CONTACT) {
-                    if (!entryPayload["phoneNumbers"].is_array()) {
-                        Throw("phoneNumbersFieldIsNotAnArray");
-                    }
+        ThrowIf(isEntryPresent(entryId), "entryAlreadyExists");
 
-                    if (!data.HasMember("addresses")) {
-                        auto addresses(rapidjson::kArrayType);
-                        data.AddMember("addresses", addresses, allocator);
-                    }
+        auto& allocator = getNextEntryAllocator();
+        rapidjson::Value data(rapidjson::kObjectType);
+        rapidjson::Value name(rapidjson::kObjectType);
 
-                    auto& addresses = data["addresses"];
-
-                    int counter = 0;
-                    for (auto& phoneNumber : entryPayload["phoneNumbers"]) {
-                        if (++counter > MAX_ALLOWED_ADDRESSES_PER_ENTRY) {
-                            AACE_WARN(LX(TAG).m("maxAllowedPhoneNumberEntriesReached"));
-                            success = false;
-                            break;  // bail out
-                        }
-
-                        // clang-format off
-                        // Sanitize phone number field types
-                        ThrowIfNot((phoneNumber.contains("label") ? phoneNumber["label"].is_string() : true), "phoneNumberLabelInvalid");
-                        ThrowIfNot((phoneNumber.contains("number") ? phoneNumber["number"].is_string() : true), "phoneNumberNumberInvalid");
-                        // clang-format on
-
-                        // Sanitize phone number field sizes
-                        std::string label = phoneNumber.value("label", "");
-                        std::string number = phoneNumber.value("number", "");
-
-                        totalSize = label.size() + number.size();
-                        if (totalSize > MAX_ALLOWED_CHARACTERS) {
-                            AACE_WARN(LX(TAG)
-                                          .m("phoneNumberFieldExceedsMaxSize")
-                                          .d("label", label)
-                                          .d("number", number)
-                                          .d("size", totalSize)
-                                          .d("maxSize", MAX_ALLOWED_CHARACTERS));
-                            success = false;
-                            continue;
-                        }
-
-                        rapidjson::Value address(rapidjson::kObjectType);
-                        address.AddMember("addressType", "phonenumber", allocator);
-                        if (!label.empty()) address.AddMember("rawType", label, allocator);
-                        if (!number.empty()) address.AddMember("value", number, allocator);
-
-                        addresses.PushBack(address, allocator);
-                    }
-                } else {
-                    AACE_WARN(LX(TAG).m("phoneNumbersNotSupportedInNavigationType"));
-                    success = false;
-                }
-            }
+        addStringMember(name, "firstName", firstName, allocator);
+        addStringMember(name, "lastName", lastName, allocator);
+        addStringMember(name, "nickName", nickName, allocator);
+        addStringMember(name, "phoneticFirstName", phoneticFirstName, allocator);
+        addStringMember(name, "phoneticLastName", phoneticLastName, allocator);
 
-            if (entryPayload.contains("postalAddresses") && !entryPayload["postalAddresses"].empty()) {
-                if (!entryPayload["postalAddresses"].is_array()) {
-                    Throw("postalAddressesFieldIsNotAnArray");
-                }
+        data.AddMember("name", name, allocator);
 
-                if (!data.HasMember("addresses")) {
-                    auto addresses(rapidjson::kArrayType);
-                    data.AddMember("addresses", addresses, allocator);
-                }
+        rapidjson::Value addresses(rapidjson::kArrayType);
 
-                auto& addresses = data["addresses"];
+        auto phoneNumbersIt = entryPayload.FindMember("phoneNumbers");
+        if (phoneNumbersIt != entryPayload.MemberEnd() && !isEmptyNode(phoneNumbersIt->value)) {
+            // Consider phone numbers only when the address book type is CONTACT
+            if (m_addressBookEntity->getType() == AddressBookType::CONTACT) {
+                if (!phoneNumbersIt->value.IsArray()) {
+                    Throw("phoneNumbersFieldIsNotAnArray");
+                }
 
                 int counter = 0;
-                for (auto& postalAddress : entryPayload["postalAddresses"]) {
+                for (auto& phoneNumber : phoneNumbersIt->value.GetArray()) {
                     if (++counter > MAX_ALLOWED_ADDRESSES_PER_ENTRY) {
-                        AACE_WARN(LX(TAG).m("maxAllowedPostalAddressEntriesReached"));
+                        AACE_WARN(LX(TAG).m("maxAllowedPhoneNumberEntriesReached"));
                         success = false;
                         break;  // bail out
                     }
 
-                    // clang-format off
-                    // Sanitize postal address fields types
-                    ThrowIfNot((postalAddress.contains("label") ? postalAddress["label"].is_string() : true), "postalAddressLabelInvalid");
-                    ThrowIfNot((postalAddress.contains("addressLine1") ? postalAddress["addressLine1"].is_string() : true), "postalAddressAddressLine1Invalid");
-                    ThrowIfNot((postalAddress.contains("addressLine2") ? postalAddress["addressLine2"].is_string() : true), "postalAddressAddressLine2Invalid");
-                    ThrowIfNot((postalAddress.contains("city") ? postalAddress["city"].is_string() : true), "postalAddressCityInvalid");
-                    ThrowIfNot((postalAddress.contains("stateOrRegion") ? postalAddress["stateOrRegion"].is_string() : true), "postalAddressStateOrRegionInvalid");
-                    ThrowIfNot((postalAddress.contains("districtOrCounty") ? postalAddress["districtOrCounty"].is_string() : true), "postalAddressDistrictOrCountyInvalid");
-                    ThrowIfNot((postalAddress.contains("postalCode") ? postalAddress["postalCode"].is_string() : true), "postalAddressPostalCodeInvalid");
-                    ThrowIfNot((postalAddress.contains("countryCode") ? postalAddress["countryCode"].is_string() : true), "postalAddressCountryCodeInvalid");
-                    // Geo coordinates (latitude/longitude) are valid only for NAVIGATION, they are usually not available for phone CONTACT
-                    if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
-                        ThrowIfNot(postalAddress.contains("latitudeInDegrees") && postalAddress["latitudeInDegrees"].is_number(), "postalAddressLatitudeInDegreesNotPresetOrInvalid");
-                        ThrowIfNot(postalAddress.contains("longitudeInDegrees") && postalAddress["longitudeInDegrees"].is_number(), "postalAddressLongitudeInDegreesNotPresetOrInvalid");
-                        ThrowIfNot((postalAddress.contains("accuracyInMeters") ? postalAddress["accuracyInMeters"].is_number() : true), "postalAddressAccuracyInMetersInvalid");
-                    }
-                    // clang-format on
-
-                    std::string label = postalAddress.value("label", "");
-                    std::string addressLine1 = postalAddress.value("addressLine1", "");
-                    std::string addressLine2 = postalAddress.value("addressLine2", "");
-                    std::string addressLine3 = postalAddress.value("addressLine3", "");
-                    std::string city = postalAddress.value("city", "");
-                    std::string stateOrRegion = postalAddress.value("stateOrRegion", "");
-                    std::string districtOrCounty = postalAddress.value("districtOrCounty", "");
-                    std::string postalCode = postalAddress.value("postalCode", "");
-                    std::string countryCode = postalAddress.value("countryCode", "");
-                    float latitudeInDegrees = postalAddress.value("latitudeInDegrees", 0.0f);
-                    float longitudeInDegrees = postalAddress.value("longitudeInDegrees", 0.0f);
-                    float accuracyInMeters = postalAddress.value("accuracyInMeters", 0.0f);
-
-                    // Sanitize postal address fields sizes
-                    if (addressLine1.size() > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
+                    // Sanitize phone number field types
+                    ThrowIfNot(phoneNumber.IsObject(), "phoneNumberInvalid");
+                    auto label = findStringMember(phoneNumber, "label", "phoneNumberLabelInvalid");
+                    auto number = findStringMember(phoneNumber, "number", "phoneNumberNumberInvalid");
+
+                    // Sanitize phone number field sizes
+                    totalSize = getStringLength(label) + getStringLength(number);
+                    if (totalSize > MAX_ALLOWED_CHARACTERS) {
                         AACE_WARN(LX(TAG)
-                                      .m("addressLine1ExceedsMaxCharacterSize")
-                                      .d("entryId", entryId)
-                                      .d("size", addressLine1.size())
-                                      .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+                                      .m("phoneNumberFieldExceedsMaxSize")
+                                      .d("size", totalSize)
+                                      .d("maxSize", MAX_ALLOWED_CHARACTERS));
                         success = false;
                         continue;
                     }
-                    if (addressLine2.size() > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
-                        AACE_WARN(LX(TAG)
-                                      .m("addressLine2ExceedsMaxCharacterSize")
-                                      .d("entryId", entryId)
-                                      .d("size", addressLine2.size())
-                                      .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+
+                    rapidjson::Value address(rapidjson::kObjectType);
+                    address.AddMember("addressType", "phonenumber", allocator);
+                    addStringMember(address, "rawType", label, allocator);
+                    addStringMember(address, "value", number, allocator);
+
+                    addresses.PushBack(address, allocator);
+                }
+            } else {
+                AACE_WARN(LX(TAG).m("phoneNumbersNotSupportedInNavigationType"));
+                success = false;
+            }
+        }
+
+        auto postalAddressesIt = entryPayload.FindMember("postalAddresses");
+        if (postalAddressesIt != entryPayload.MemberEnd() && !isEmptyNode(postalAddressesIt->value)) {
+            if (!postalAddressesIt->value.IsArray()) {
+                Throw("postalAddressesFieldIsNotAnArray");
+            }
+
+            int counter = 0;
+            for (auto& postalAddress : postalAddressesIt->value.GetArray()) {
+                if (++counter > MAX_ALLOWED_ADDRESSES_PER_ENTRY) {
+                    AACE_WARN(LX(TAG).m("maxAllowedPostalAddressEntriesReached"));
+                    success = false;
+                    break;  // bail out
+                }
+
+                // clang-format off
+                // Sanitize postal address fields types
+                ThrowIfNot(postalAddress.IsObject(), "postalAddressInvalid");
+                auto label = findStringMember(postalAddress, "label", "postalAddressLabelInvalid");
+                auto addressLine1 = findStringMember(postalAddress, "addressLine1", "postalAddressAddressLine1Invalid");
+                auto addressLine2 = findStringMember(postalAddress, "addressLine2", "postalAddressAddressLine2Invalid");
+                auto addressLine3 = findStringMember(postalAddress, "addressLine3", "postalAddressAddressLine3Invalid");
+                auto city = findStringMember(postalAddress, "city", "postalAddressCityInvalid");
+                auto stateOrRegion = findStringMember(postalAddress, "stateOrRegion", "postalAddressStateOrRegionInvalid");
+                auto districtOrCounty = findStringMember(postalAddress, "districtOrCounty", "postalAddressDistrictOrCountyInvalid");
+                auto postalCode = findStringMember(postalAddress, "postalCode", "postalAddressPostalCodeInvalid");
+                auto countryCode = findStringMember(postalAddress, "countryCode", "postalAddressCountryCodeInvalid");
+                // Geo coordinates (latitude/longitude) are valid only for NAVIGATION, they are usually not available for phone CONTACT
+                if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
+                    ThrowIfNot(postalAddress.HasMember("latitudeInDegrees") && postalAddress["latitudeInDegrees"].IsNumber(), "postalAddressLatitudeInDegreesNotPresetOrInvalid");
+                    ThrowIfNot(postalAddress.HasMember("longitudeInDegrees") && postalAddress["longitudeInDegrees"].IsNumber(), "postalAddressLongitudeInDegreesNotPresetOrInvalid");
+                    ThrowIfNot((postalAddress.HasMember("accuracyInMeters") ? postalAddress["accuracyInMeters"].IsNumber() : true), "postalAddressAccuracyInMetersInvalid");
+                }
+                // clang-format on
+
+                float latitudeInDegrees = getFloatMember(postalAddress, "latitudeInDegrees", 0.0f);
+                float longitudeInDegrees = getFloatMember(postalAddress, "longitudeInDegrees", 0.0f);
+                float accuracyInMeters = getFloatMember(postalAddress, "accuracyInMeters", 0.0f);
+
+                // Sanitize postal address fields sizes
+                if (getStringLength(addressLine1) > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
+                    AACE_WARN(LX(TAG)
+                                  .m("addressLine1ExceedsMaxCharacterSize")
+                                  .d("entryId", entryId)
+                                  .d("size", getStringLength(addressLine1))
+                                  .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+                    success = false;
+                    continue;
+                }
+                if (getStringLength(addressLine2) > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
+                    AACE_WARN(LX(TAG)
+                                  .m("addressLine2ExceedsMaxCharacterSize")
+                                  .d("entryId", entryId)
+                                  .d("size", getStringLength(addressLine2))
+                                  .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+                    success = false;
+                    continue;
+                }
+                if (getStringLength(addressLine3) > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
+                    AACE_WARN(LX(TAG)
+                                  .m("addressLine3ExceedsMaxCharacterSize")
+                                  .d("entryId", entryId)
+                                  .d("size", getStringLength(addressLine3))
+                                  .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+                    success = false;
+                    continue;
+                }
+
+                totalSize = getStringLength(label) + getStringLength(addressLine1) + getStringLength(addressLine2) +
+                            getStringLength(addressLine3) + getStringLength(city) + getStringLength(stateOrRegion) +
+                            getStringLength(districtOrCounty) + getStringLength(postalCode) +
+                            getStringLength(countryCode);
+
+                if (totalSize > MAX_ALLOWED_CHARACTERS) {
+                    AACE_WARN(LX(TAG)
+                                  .m("postalAddressExceedsMaxCharacterSize")
+                                  .d("entryId", entryId)
+                                  .d("size", totalSize)
+                                  .d("maxSize", MAX_ALLOWED_CHARACTERS));
+                    success = false;
+                    continue;
+                }
+
+                if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
+                    if (!(latitudeInDegrees >= -90 && latitudeInDegrees <= 90)) {
+                        AACE_WARN(LX(TAG).m("latitudeInDegreesInvalid").d("latitudeInDegrees", latitudeInDegrees));
                         success = false;
                         continue;
                     }
-                    if (addressLine3.size() > MAX_ALLOWED_ADDRESS_LINE_SIZE) {
-                        AACE_WARN(LX(TAG)
-                                      .m("addressLine3ExceedsMaxCharacterSize")
-                                      .d("entryId", entryId)
-                                      .d("size", addressLine3.size())
-                                      .d("maxSize", MAX_ALLOWED_ADDRESS_LINE_SIZE));
+
+                    if (!(longitudeInDegrees >= -180 && longitudeInDegrees <= 180)) {
+                        AACE_WARN(LX(TAG).m("longitudeInDegreesInvalid").d("longitudeInDegrees", longitudeInDegrees));
                         success = false;
                         continue;
                     }
-
-                    int totalSize = label.size() + addressLine1.size() + addressLine2.size() + addressLine3.size() +
-                                    city.size() + stateOrRegion.size() + districtOrCounty.size() + postalCode.size() +
-                                    countryCode.size();
-
-                    if (totalSize > MAX_ALLOWED_CHARACTERS) {
-                        AACE_WARN(LX(TAG)
-                                      .m("postalAddressExceedsMaxCharacterSize")
-                                      .d("entryId", entryId)
-                                      .d("size", totalSize)
-                                      .d("maxSize", MAX_ALLOWED_CHARACTERS));
+                    if (accuracyInMeters < 0) {
+                        AACE_WARN(LX(TAG).m("accuracyInMetersInvalid").d("accuracyInMeters", accuracyInMeters));
                         success = false;
                         continue;
                     }
+                }
 
-                    if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
-                        if (!(latitudeInDegrees >= -90 && latitudeInDegrees <= 90)) {
-                            AACE_WARN(LX(TAG).m("latitudeInDegreesInvalid").d("latitudeInDegrees", latitudeInDegrees));
-                            success = false;
-                            continue;
-                        }
-
-                        if (!(longitudeInDegrees >= -180 && longitudeInDegrees <= 180)) {
-                            AACE_WARN(
-                                LX(TAG).m("longitudeInDegreesInvalid").d("longitudeInDegrees", longitudeInDegrees));
-                            success = false;
-                            continue;
-                        }
-                        if (accuracyInMeters < 0) {
-                            AACE_WARN(LX(TAG).m("accuracyInMetersInvalid").d("accuracyInMeters", accuracyInMeters));
-                            success = false;
-                            continue;
-                        }
-                    }
+                rapidjson::Value address(rapidjson::kObjectType);
+                address.AddMember("addressType", "postaladdress", allocator);
+                addStringMember(address, "rawType", label, allocator);
+
+                rapidjson::Value postalAddressValue(rapidjson::kObjectType);
+                addStringMember(postalAddressValue, "addressLine1", addressLine1, allocator);
+                addStringMember(postalAddressValue, "addressLine2", addressLine2, allocator);
+                addStringMember(postalAddressValue, "addressLine3", addressLine3, allocator);
+                addStringMember(postalAddressValue, "city", city, allocator);
+                addStringMember(postalAddressValue, "stateOrRegion", stateOrRegion, allocator);
+                addStringMember(postalAddressValue, "districtOrCounty", districtOrCounty, allocator);
+                addStringMember(postalAddressValue, "postalCode", postalCode, allocator);
+                addStringMember(postalAddressValue, "countryCode", countryCode, allocator);
+
+                // coordinates are valid only for NAVIGATION, not applicable when uploading CONTACT addresses
+                if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
+                    rapidjson::Value coordinate(rapidjson::kObjectType);
+                    coordinate.AddMember("latitudeInDegrees", latitudeInDegrees, allocator);
+                    coordinate.AddMember("longitudeInDegrees", longitudeInDegrees, allocator);
+                    coordinate.AddMember("accuracyInMeters", accuracyInMeters, allocator);
+                    postalAddressValue.AddMember("coordinate", coordinate, allocator);
+                } else if (m_addressBookEntity->getType() == AddressBookType::CONTACT) {
+                    // cloud side has a bug which makes coordinates mandatory
+                    // place holder to add some default values TO BE REMOVED when issue is fixed on cloud
+                    rapidjson::Value coordinate(rapidjson::kObjectType);
+                    coordinate.AddMember("latitudeInDegrees", 0.0f, allocator);
+                    coordinate.AddMember("longitudeInDegrees", 0.0f, allocator);
+                    coordinate.AddMember("accuracyInMeters", 0.0f, allocator);
+                    postalAddressValue.AddMember("coordinate", coordinate, allocator);
+                }
 
-                    rapidjson::Value address(rapidjson::kObjectType);
-                    address.AddMember("addressType", "postaladdress", allocator);
-                    if (!label.empty()) address.AddMember("rawType", label, allocator);
-
-                    rapidjson::Value postalAddressValue(rapidjson::kObjectType);
-                    if (!addressLine1.empty()) postalAddressValue.AddMember("addressLine1", addressLine1, allocator);
-                    if (!addressLine2.empty()) postalAddressValue.AddMember("addressLine2", addressLine2, allocator);
-                    if (!addressLine3.empty()) postalAddressValue.AddMember("addressLine3", addressLine3, allocator);
-                    if (!city.empty()) postalAddressValue.AddMember("city", city, allocator);
-                    if (!stateOrRegion.empty()) postalAddressValue.AddMember("stateOrRegion", stateOrRegion, allocator);
-                    if (!districtOrCounty.empty())
-                        postalAddressValue.AddMember("districtOrCounty", districtOrCounty, allocator);
-                    if (!postalCode.empty()) postalAddressValue.AddMember("postalCode", postalCode, allocator);
-                    if (!countryCode.empty()) postalAddressValue.AddMember("countryCode", countryCode, allocator);
-
-                    // coordinates are valid only for NAVIGATION, not applicable when uploading CONTACT addresses
-                    if (m_addressBookEntity->getType() == AddressBookType::NAVIGATION) {
-                        rapidjson::Value coordinate(rapidjson::kObjectType);
-                        coordinate.AddMember("latitudeInDegrees", latitudeInDegrees, allocator);
-                        coordinate.AddMember("longitudeInDegrees", longitudeInDegrees, allocator);
-                        coordinate.AddMember("accuracyInMeters", accuracyInMeters, allocator);
-                        postalAddressValue.AddMember("coordinate", coordinate, allocator);
-                    } else if (m_addressBookEntity->getType() == AddressBookType::CONTACT) {
-                        // cloud side has a bug which makes coordinates mandatory
-                        // place holder to add some default values TO BE REMOVED when issue is fixed on cloud
-                        latitudeInDegrees = 0.0f;
-                        longitudeInDegrees = 0.0f;
-                        accuracyInMeters = 0.0f;
-                        rapidjson::Value coordinate(rapidjson::kObjectType);
-                        coordinate.AddMember("latitudeInDegrees", latitudeInDegrees, allocator);
-                        coordinate.AddMember("longitudeInDegrees", longitudeInDegrees, allocator);
-                        coordinate.AddMember("accuracyInMeters", accuracyInMeters, allocator);
-                        postalAddressValue.AddMember("coordinate", coordinate, allocator);
-                    }
+                address.AddMember("postalAddress", postalAddressValue, allocator);
 
-                    address.AddMember("postalAddress", postalAddressValue, allocator);
+                addresses.PushBack(address, allocator);
+            }
+        }
 
-                    addresses.PushBack(address, allocator);
+        if (!addresses.Empty()) {
+            data.AddMember("addresses", addresses, allocator);
+        }
+
+        appendEntry(entryId, data);
+
+        return success;
+    }
+
+public:
+    bool addEntry(const std::string& payload) {
+        try {
+            ThrowIf(payload.empty(), "payloadEmpty");
+
+            rapidjson::Document entryPayload;
+            if (entryPayload.Parse(payload.c_str(), payload.size()).HasParseError()) {
+                AACE_ERROR(LX(TAG)
+                               .m("payLoadParseError")
+                               .d("error", rapidjson::GetParseError_En(entryPayload.GetParseError()))
+                               .d("offset", entryPayload.GetErrorOffset()));
+                return false;
+            }
+
+            return encodeEntry(entryPayload);
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()));
+            return false;
+        }
+    }
+
+    bool addEntries(const std::string& payload) {
+        try {
+            ThrowIf(payload.empty(), "payloadEmpty");
+
+            // The parsed payload only lives for this call, so the memory needed to ingest an address book is
+            // bounded by the size of the batches passed in by the platform rather than the size of the book.
+            rapidjson::Document entriesPayload;
+            if (entriesPayload.Parse(payload.c_str(), payload.size()).HasParseError()) {
+                AACE_ERROR(LX(TAG)
+                               .m("payLoadParseError")
+                               .d("error", rapidjson::GetParseError_En(entriesPayload.GetParseError()))
+                               .d("offset", entriesPayload.GetErrorOffset()));
+                return false;
+            }
+            ThrowIfNot(entriesPayload.IsArray(), "payloadNotAnArray");
+
+            bool success = true;
+            rapidjson::SizeType index = 0;
+            for (auto& entryPayload : entriesPayload.GetArray()) {
+                if (m_stopped) {
+                    AACE_WARN(LX(TAG).m("uploadStopped").d("index", index));
+                    success = false;
+                    break;
+                }
+                try {
+                    if (!encodeEntry(entryPayload)) {
+                        success = false;
+                    }
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).m("entryDiscarded").d("index", index).d("reason", ex.what()));
+                    success = false;
                 }
+                index++;
             }
+            AACE_DEBUG(LX(TAG).d("numEntries", index).d("success", success));
+
             return success;
-        } catch (json::parse_error& ex) {
-            AACE_ERROR(LX(TAG).m("payLoadParseError").d("exception", ex.what()));
-            return false;
         } catch (std::exception& ex) {
             AACE_ERROR(LX(TAG).d("reason", ex.what()));
             return false;
@@ -740,6 +960,7 @@ public:
                 return false;
             }
 
+            keepEntriesUntilFlush();
             if (!isEntryPresent(entryId)) {
                 createEntryDataField(entryId);
             }
@@ -772,6 +993,7 @@ public:
                 m_addressBookEntity->isAddressTypeSupported(AddressBookEntity::AddressType::PHONE),
                 "addressTypeNotSupported");
 
+            keepEntriesUntilFlush();
             if (!isEntryPresent(entryId)) {
                 createEntryDataField(entryId);
             }
@@ -832,6 +1054,7 @@ public:
                 m_addressBookEntity->isAddressTypeSupported(AddressBookEntity::AddressType::POSTALADDRESS),
                 "addressTypeNotSupported");
 
+            keepEntriesUntilFlush();
             if (!isEntryPresent(entryId)) {
                 createEntryDataField(entryId);
             }
@@ -903,35 +1126,235 @@ public:
 
 private:
     std::shared_ptr<AddressBookEntity> m_addressBookEntity;
-    std::vector<std::shared_ptr<rapidjson::Document>>& m_documents;
-    std::unordered_map<std::string, rapidjson::SizeType> m_ids;
+    BatchHandler m_batchHandler;
+    std::unique_ptr<rapidjson::Document> m_document;
+    std::unordered_map<std::string, size_t> m_ids;
+    size_t m_numHandledEntries;
+    bool m_keepEntries;
+    bool m_stopped;
+};
+
+/**
+ * Uploads the batches of an address book while the address book is still being read. Batches are serialized on
+ * the calling thread while up to @c maxUploaders previously pushed batches are in flight, and @c push() blocks
+ * while all of them are busy, so only the batches in flight are kept in memory.
+ */
+class BatchUploadPipeline {
+public:
+    using UploadBatch = AddressBookCloudUploaderRESTAgent::UploadBatch;
+    using UploadFunction =
+        std::function<AddressBookOperationResultCode(size_t, const UploadBatch&, std::queue<std::string>&)>;
+
+    BatchUploadPipeline(size_t maxUploaders, UploadFunction upload, const std::atomic<bool>& isShuttingDown) :
+            m_maxUploaders(std::max<size_t>(maxUploaders, 1)),
+            m_upload(std::move(upload)),
+            m_isShuttingDown(isShuttingDown),
+            m_pushing(true),
+            m_failed(false),
+            m_numPushed(0),
+            m_numUploaded(0),
+            m_result(AddressBookOperationResultCode::SUCCESS) {
+    }
+
+    ~BatchUploadPipeline() {
+        join();
+    }
+
+    /**
+     * Queues a batch for upload, starting another uploader if fewer than @c maxUploaders are running.
+     *
+     * @return @c false if the upload failed or is shutting down.
+     */
+    bool push(const rapidjson::Document& document) {
+        auto batch = AddressBookCloudUploaderRESTAgent::prepareUploadBatch(document);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_uploaders.size() < m_maxUploaders) {
+            m_uploaders.emplace_back(&BatchUploadPipeline::uploader, this);
+        }
+        m_changed.wait(
+            lock, [this]() { return m_prepared.size() < m_uploaders.size() || m_failed || m_isShuttingDown; });
+        if (m_failed || m_isShuttingDown) {
+            return false;
+        }
+        m_prepared.emplace_back(m_numPushed++, std::move(batch));
+        lock.unlock();
+        m_changed.notify_all();
+        return true;
+    }
+
+    /**
+     * Waits for the pushed batches to be uploaded.
+     *
+     * @param [out] failedEntries The entries rejected by the cloud
+     * @return The result of the upload
+     */
+    AddressBookOperationResultCode finish(std::queue<std::string>& failedEntries) {
+        join();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        AACE_DEBUG(LX(TAG).d("numBatches", m_numPushed).d("numUploaders", m_uploaders.size()));
+        failedEntries = std::move(m_failedEntries);
+        if (m_result == AddressBookOperationResultCode::SUCCESS && m_numUploaded != m_numPushed) {
+            // Interrupted by shutdown.
+            return AddressBookOperationResultCode::ERROR_UNKNOWN;
+        }
+        return m_result;
+    }
+
+private:
+    void join() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pushing = false;
+        }
+        m_changed.notify_all();
+        for (auto& thread : m_uploaders) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    void uploader() {
+        std::queue<std::string> uploaderFailedEntries;
+        while (true) {
+            std::pair<size_t, UploadBatch> next;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock, [this]() { return !m_prepared.empty() || !m_pushing || m_failed; });
+                if (m_failed || m_prepared.empty()) {
+                    break;
+                }
+                next = std::move(m_prepared.front());
+                m_prepared.pop_front();
+            }
+            m_changed.notify_all();
+
+            auto batchResult = m_upload(next.first, next.second, uploaderFailedEntries);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (batchResult != AddressBookOperationResultCode::SUCCESS) {
+                if (!m_failed) {
+                    m_failed = true;
+                    m_result = batchResult;
+                }
+                m_changed.notify_all();
+                break;
+            }
+            m_numUploaded++;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (!uploaderFailedEntries.empty()) {
+            m_failedEntries.push(std::move(uploaderFailedEntries.front()));
+            uploaderFailedEntries.pop();
+        }
+    }
+
+    const size_t m_maxUploaders;
+    UploadFunction m_upload;
+    const std::atomic<bool>& m_isShuttingDown;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::thread> m_uploaders;
+    std::deque<std::pair<size_t, UploadBatch>> m_prepared;
+    std::queue<std::string> m_failedEntries;
+    bool m_pushing;
+    bool m_failed;
+    size_t m_numPushed;
+    size_t m_numUploaded;
+    AddressBookOperationResultCode m_result;
 };
 
 bool AddressBookCloudUploader::handleUpload(
     std::shared_ptr<AddressBookEntity> addressBookEntity,
     int& numBatches,
-    AddressBookOperationResultCode& result) {
+    AddressBookOperationResultCode& result,
+    SyncStats& syncStats) {
     std::string addressBookSourceId = INVALID_ADDRESS_BOOK_SOURCE_ID;
     try {
         result = AddressBookOperationResultCode::SUCCESS;
         addressBookSourceId = addressBookEntity->getSourceId();
 
-        std::vector<std::shared_ptr<rapidjson::Document>> documents;
-        auto factory = std::make_shared<AddressBookEntriesFactory>(addressBookEntity, documents);
+        auto addressBookType = addressBookEntity->toJSONAddressBookType();
+        cancelPendingRemove(addressBookType);
+        SyncState syncState;
+        if (loadSyncState(addressBookType, syncState)) {
+            if (syncState.addressBookSourceId != addressBookSourceId) {
+                AACE_INFO(LX(TAG).m("addressBookSourceChanged").d("addressBookSourceId", addressBookSourceId));
+            } else if (std::chrono::system_clock::now() - syncState.createTime > MAX_SYNC_STATE_AGE) {
+                AACE_INFO(LX(TAG).m("cloudAddressBookRefreshRequired").d("addressBookSourceId", addressBookSourceId));
+            } else if (handleDeltaUpload(addressBookEntity, syncState, numBatches, syncStats)) {
+                saveSyncState(addressBookType, syncState);
+                AACE_INFO(LX(TAG)
+                              .m("SuccessfullySynced")
+                              .d("addressBookSourceId", addressBookSourceId)
+                              .d("entriesUploaded", syncStats.entriesUploaded)
+                              .d("entriesSkipped", syncStats.entriesSkipped));
+                return true;
+            }
+        }
+
+        // The cloud address book is recreated, so whatever was synced before is gone.
+        clearSyncState(addressBookType);
+        syncStats = SyncStats();
+        numBatches = 0;
+
+        // Each batch is uploaded as soon as it is filled. The cloud address book is recreated when the first
+        // batch is ready, so an empty or unavailable address book leaves the cloud address book untouched.
+        std::string cloudAddressBookId;
+        std::unordered_map<std::string, uint64_t> entryHashes;
+        BatchUploadPipeline pipeline(
+            m_maxConcurrentUploads,
+            [this, &cloudAddressBookId](
+                size_t batchIndex,
+                const BatchUploadPipeline::UploadBatch& batch,
+                std::queue<std::string>& failedEntries) {
+                return uploadBatch(cloudAddressBookId, batchIndex, batch, failedEntries);
+            },
+            m_isShuttingDown);
+        auto factory = std::make_shared<AddressBookEntriesFactory>(
+            addressBookEntity, [&](rapidjson::Document& document) {
+                if (cloudAddressBookId.empty()) {
+                    result = prepareForUpload(addressBookEntity, cloudAddressBookId);
+                    if (cloudAddressBookId.empty()) {
+                        return false;
+                    }
+                }
+                for (auto& entry : document["entries"].GetArray()) {
+                    entryHashes[entry["entrySourceId"].GetString()] = hashEntry(entry);
+                }
+                numBatches++;
+                return pipeline.push(document);
+            });
 
         AACE_INFO(LX(TAG).m("GettingAddressBookEntries").d("addressBookSourceId", addressBookSourceId));
 
-        if (!m_addressBookService->getEntries(addressBookSourceId, factory)) {
+        auto gotEntries = m_addressBookService->getEntries(addressBookSourceId, factory) && factory->flush();
+        std::queue<std::string> failedEntries;
+        auto uploadResult = pipeline.finish(failedEntries);
+
+        ThrowIf(numBatches == 0 && result != AddressBookOperationResultCode::SUCCESS, "prepareUploadFailed");
+        if (uploadResult != AddressBookOperationResultCode::SUCCESS) {
+            result = uploadResult;
+            handleError(cloudAddressBookId);
+            Throw("uploadDocumentFailed");
+        }
+        if (!gotEntries) {
             // getEntries can return false, it probably means OEM was not successful in providing all the entries.
             // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
             AACE_WARN(
                 LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
+            if (!cloudAddressBookId.empty()) {
+                // Do not leave a partially uploaded address book behind.
+                handleError(cloudAddressBookId);
+            }
             // Return true to drop this address book from retry.
             return true;
         }
-
-        numBatches = documents.size();
-        if (documents.size() <= 0) {
+        if (numBatches == 0) {
             // Its the empty document.
             AACE_WARN(LX(TAG, "handleUpload")
                           .d("addressBookSourceId", addressBookSourceId)
@@ -939,25 +1362,21 @@ bool AddressBookCloudUploader::handleUpload(
             // Return true to drop this address book from retry.
             return true;
         }
+        unsigned int numberOfEntries = entryHashes.size();
 
-        int numberOfEntries = 0;
-        for (auto document : documents) {
-            auto entries = document->FindMember("entries");
-            if (entries != document->MemberEnd()) {
-                numberOfEntries += entries->value.Size();
-            }
+        // Entries rejected by the cloud are left out of the sync state, so the next sync uploads them again.
+        while (!failedEntries.empty()) {
+            entryHashes.erase(failedEntries.front());
+            failedEntries.pop();
         }
+        syncState.addressBookSourceId = addressBookSourceId;
+        syncState.cloudAddressBookId = cloudAddressBookId;
+        syncState.createTime = std::chrono::system_clock::now();
+        syncState.removeTime = std::chrono::system_clock::time_point();
+        syncState.entryHashes = std::move(entryHashes);
+        saveSyncState(addressBookType, syncState);
 
-        //Preparing for the upload
-        std::string cloudAddressBookId;
-        result = prepareForUpload(addressBookEntity, cloudAddressBookId);
-        ThrowIf(cloudAddressBookId.empty(), "prepareUploadFailed");
-
-        //Upload json document in a loop.
-        for (auto document : documents) {
-            result = uploadEntries(cloudAddressBookId, document);
-            ThrowIfNot(result == AddressBookOperationResultCode::SUCCESS, "uploadDocumentFailed");
-        }
+        syncStats.entriesUploaded = numberOfEntries;
 
         AACE_INFO(LX(TAG)
                       .m("SuccessfullyUploaded")
@@ -971,12 +1390,291 @@ bool AddressBookCloudUploader::handleUpload(
     }
 }
 
+bool AddressBookCloudUploader::handleDeltaUpload(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    SyncState& syncState,
+    int& numBatches,
+    SyncStats& syncStats) {
+    try {
+        auto addressBookSourceId = addressBookEntity->getSourceId();
+
+        ThrowIfNot(m_addressBookCloudUploaderRESTAgent->isAccountProvisioned(), "accountNotProvisioned");
+
+        // The cloud address book may have expired or been deleted since the last sync.
+        std::string cloudAddressBookId;
+        ThrowIfNot(
+            m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(
+                m_deviceInfo->getDeviceSerialNumber(), addressBookEntity->toJSONAddressBookType(), cloudAddressBookId),
+            "getCloudAddressBookIdFailed");
+        ThrowIf(cloudAddressBookId.empty(), "cloudAddressBookNotFound");
+        ThrowIf(cloudAddressBookId != syncState.cloudAddressBookId, "cloudAddressBookChanged");
+
+        // Read the address book once to compare it with the sync state, keeping only the entry hashes.
+        std::unordered_map<std::string, uint64_t> entryHashes;
+        auto hashFactory = std::make_shared<AddressBookEntriesFactory>(
+            addressBookEntity, [&entryHashes](rapidjson::Document& document) {
+                for (auto& entry : document["entries"].GetArray()) {
+                    entryHashes[entry["entrySourceId"].GetString()] = hashEntry(entry);
+                }
+                return true;
+            });
+        ThrowIfNot(
+            m_addressBookService->getEntries(addressBookSourceId, hashFactory) && hashFactory->flush(),
+            "getEntriesFailed");
+
+        // ACMS has no call to delete single entries, so a removed or changed entry requires a full upload.
+        for (auto& previous : syncState.entryHashes) {
+            auto current = entryHashes.find(previous.first);
+            if (current == entryHashes.end() || current->second != previous.second) {
+                AACE_INFO(LX(TAG)
+                              .m("fullUploadRequired")
+                              .d("addressBookSourceId", addressBookSourceId)
+                              .d("reason", "entryRemovedOrChanged"));
+                return false;
+            }
+        }
+        std::unordered_set<std::string> entriesToUpload;
+        for (auto& current : entryHashes) {
+            if (syncState.entryHashes.find(current.first) == syncState.entryHashes.end()) {
+                entriesToUpload.insert(current.first);
+            }
+        }
+
+        syncStats.entriesSkipped = entryHashes.size() - entriesToUpload.size();
+        if (entriesToUpload.empty()) {
+            AACE_INFO(LX(TAG).m("addressBookUnchanged").d("addressBookSourceId", addressBookSourceId));
+            return true;
+        }
+        entryHashes.clear();
+
+        // Read the address book again and upload the added entries, batched the same way the full upload does.
+        BatchUploadPipeline pipeline(
+            m_maxConcurrentUploads,
+            [this, &syncState](
+                size_t batchIndex,
+                const BatchUploadPipeline::UploadBatch& batch,
+                std::queue<std::string>& failedEntries) {
+                return uploadBatch(syncState.cloudAddressBookId, batchIndex, batch, failedEntries);
+            },
+            m_isShuttingDown);
+        std::unique_ptr<rapidjson::Document> deltaDocument;
+        auto pushDeltaDocument = [&]() {
+            if (deltaDocument == nullptr) {
+                return true;
+            }
+            numBatches++;
+            auto pushed = pipeline.push(*deltaDocument);
+            deltaDocument.reset();
+            return pushed;
+        };
+        auto uploadFactory = std::make_shared<AddressBookEntriesFactory>(
+            addressBookEntity, [&](rapidjson::Document& document) {
+                for (auto& entry : document["entries"].GetArray()) {
+                    std::string entrySourceId = entry["entrySourceId"].GetString();
+                    if (entriesToUpload.find(entrySourceId) == entriesToUpload.end()) {
+                        continue;
+                    }
+                    if (deltaDocument == nullptr) {
+                        deltaDocument.reset(new rapidjson::Document());
+                        deltaDocument->SetObject();
+                        deltaDocument->AddMember(
+                            "entries", rapidjson::Value(rapidjson::kArrayType), deltaDocument->GetAllocator());
+                    }
+                    entryHashes[entrySourceId] = hashEntry(entry);
+                    rapidjson::Value entryCopy(entry, deltaDocument->GetAllocator());
+                    (*deltaDocument)["entries"].PushBack(entryCopy, deltaDocument->GetAllocator());
+                    if ((*deltaDocument)["entries"].Size() >= static_cast<rapidjson::SizeType>(UPLOAD_BATCH_SIZE) &&
+                        !pushDeltaDocument()) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+
+        numBatches = 0;
+        auto gotEntries = m_addressBookService->getEntries(addressBookSourceId, uploadFactory) &&
+                          uploadFactory->flush() && pushDeltaDocument();
+        std::queue<std::string> failedEntries;
+        ThrowIfNot(pipeline.finish(failedEntries) == AddressBookOperationResultCode::SUCCESS, "uploadDocumentFailed");
+        ThrowIfNot(gotEntries, "getEntriesFailed");
+
+        syncStats.entriesUploaded = entryHashes.size();
+        for (auto& entry : entryHashes) {
+            syncState.entryHashes[entry.first] = entry.second;
+        }
+        while (!failedEntries.empty()) {
+            syncState.entryHashes.erase(failedEntries.front());
+            failedEntries.pop();
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG, "handleDeltaUpload")
+                      .d("addressBookSourceId", addressBookEntity->getSourceId())
+                      .d("reason", ex.what())
+                      .m("fallingBackToFullUpload"));
+        syncStats = SyncStats();
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::loadSyncState(const std::string& addressBookType, SyncState& syncState) {
+    std::lock_guard<std::mutex> guard(m_syncStateMutex);
+    try {
+        auto it = m_syncStates.find(addressBookType);
+        if (it != m_syncStates.end()) {
+            syncState = it->second;
+            return true;
+        }
+        if (m_localStorage == nullptr || !m_localStorage->containsKey(SYNC_STATE_TABLE, addressBookType)) {
+            return false;
+        }
+
+        auto value = json::parse(m_localStorage->get(SYNC_STATE_TABLE, addressBookType));
+        SyncState loaded;
+        loaded.addressBookSourceId = value.at("addressBookSourceId").get<std::string>();
+        loaded.cloudAddressBookId = value.at("cloudAddressBookId").get<std::string>();
+        std::chrono::milliseconds createTime(value.at("createTime").get<int64_t>());
+        loaded.createTime = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(createTime));
+        for (auto& entry : value.at("entries").items()) {
+            loaded.entryHashes[entry.key()] = entry.value().get<uint64_t>();
+        }
+        if (value.contains("removeTime")) {
+            std::chrono::milliseconds removeTime(value.at("removeTime").get<int64_t>());
+            loaded.removeTime = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(removeTime));
+        }
+
+        syncState = loaded;
+        m_syncStates[addressBookType] = std::move(loaded);
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "loadSyncState").d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void AddressBookCloudUploader::saveSyncState(const std::string& addressBookType, const SyncState& syncState) {
+    std::lock_guard<std::mutex> guard(m_syncStateMutex);
+    m_syncStates[addressBookType] = syncState;
+    if (m_localStorage == nullptr) {
+        return;
+    }
+    try {
+        json entries = json::object();
+        for (auto& entry : syncState.entryHashes) {
+            entries[entry.first] = entry.second;
+        }
+        json value = {{"addressBookSourceId", syncState.addressBookSourceId},
+                      {"cloudAddressBookId", syncState.cloudAddressBookId},
+                      {"createTime",
+                       std::chrono::duration_cast<std::chrono::milliseconds>(syncState.createTime.time_since_epoch())
+                           .count()},
+                      {"entries", entries}};
+        if (syncState.removeTime != std::chrono::system_clock::time_point()) {
+            value["removeTime"] =
+                std::chrono::duration_cast<std::chrono::milliseconds>(syncState.removeTime.time_since_epoch()).count();
+        }
+        ThrowIfNot(m_localStorage->put(SYNC_STATE_TABLE, addressBookType, value.dump()), "putSyncStateFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "saveSyncState").d("addressBookType", addressBookType).d("reason", ex.what()));
+    }
+}
+
+void AddressBookCloudUploader::clearSyncState(const std::string& addressBookType) {
+    std::lock_guard<std::mutex> guard(m_syncStateMutex);
+    m_syncStates.erase(addressBookType);
+    if (m_localStorage != nullptr && m_localStorage->containsKey(SYNC_STATE_TABLE, addressBookType)) {
+        m_localStorage->removeKey(SYNC_STATE_TABLE, addressBookType);
+    }
+}
+
+void AddressBookCloudUploader::clearAllSyncStates() {
+    std::lock_guard<std::mutex> guard(m_syncStateMutex);
+    m_syncStates.clear();
+    if (m_localStorage != nullptr && m_localStorage->containsTable(SYNC_STATE_TABLE)) {
+        m_localStorage->removeTable(SYNC_STATE_TABLE);
+    }
+}
+
+bool AddressBookCloudUploader::deferRemove(std::shared_ptr<AddressBookEntity> addressBookEntity) {
+    if (m_removeGracePeriod == std::chrono::seconds::zero()) {
+        return false;
+    }
+    // Only an address book that is in sync can be brought up to date when it is added again.
+    auto addressBookType = addressBookEntity->toJSONAddressBookType();
+    SyncState syncState;
+    if (!loadSyncState(addressBookType, syncState) ||
+        syncState.addressBookSourceId != addressBookEntity->getSourceId()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_pendingRemoves.find(addressBookType);
+    if (it == m_pendingRemoves.end()) {
+        it = m_pendingRemoves
+                 .emplace(
+                     addressBookType,
+                     PendingRemove{addressBookEntity, std::chrono::system_clock::now() + m_removeGracePeriod})
+                 .first;
+    }
+    syncState.removeTime = it->second.removeTime;
+    saveSyncState(addressBookType, syncState);
+    m_waitForEvent.notify_all();
+
+    AACE_INFO(LX(TAG)
+                  .m("addressBookRemoveDeferred")
+                  .d("addressBookSourceId", addressBookEntity->getSourceId())
+                  .d("gracePeriod", m_removeGracePeriod.count()));
+    return true;
+}
+
+bool AddressBookCloudUploader::takeDueRemove(const std::string& addressBookType) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_pendingRemoves.find(addressBookType);
+    if (it == m_pendingRemoves.end() || it->second.removeTime > std::chrono::system_clock::now()) {
+        return false;
+    }
+    m_pendingRemoves.erase(it);
+    return true;
+}
+
+void AddressBookCloudUploader::cancelPendingRemove(const std::string& addressBookType) {
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_pendingRemoves.erase(addressBookType);
+    }
+    SyncState syncState;
+    if (loadSyncState(addressBookType, syncState) && syncState.removeTime != std::chrono::system_clock::time_point()) {
+        syncState.removeTime = std::chrono::system_clock::time_point();
+        saveSyncState(addressBookType, syncState);
+    }
+}
+
+void AddressBookCloudUploader::restorePendingRemoves() {
+    for (auto type : {AddressBookType::CONTACT, AddressBookType::NAVIGATION}) {
+        auto addressBookEntity = std::make_shared<AddressBookEntity>("", "", type);
+        auto addressBookType = addressBookEntity->toJSONAddressBookType();
+        SyncState syncState;
+        if (loadSyncState(addressBookType, syncState) &&
+            syncState.removeTime != std::chrono::system_clock::time_point()) {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_pendingRemoves[addressBookType] = PendingRemove{
+                std::make_shared<AddressBookEntity>(syncState.addressBookSourceId, "", type), syncState.removeTime};
+        }
+    }
+}
+
 bool AddressBookCloudUploader::handleRemove(
     std::shared_ptr<AddressBookEntity> addressBookEntity,
     AddressBookOperationResultCode& result) {
     std::string addressBookSourceId = INVALID_ADDRESS_BOOK_SOURCE_ID;
     try {
         result = AddressBookOperationResultCode::SUCCESS;
+        if (!takeDueRemove(addressBookEntity->toJSONAddressBookType()) && deferRemove(addressBookEntity)) {
+            return true;
+        }
         if (!m_addressBookCloudUploaderRESTAgent->isAccountProvisioned()) {
             result = AddressBookOperationResultCode::ERROR_ACCOUNT_NOT_PROVISIONED;
             Throw("accountNotProvisioned");
@@ -984,6 +1682,9 @@ bool AddressBookCloudUploader::handleRemove(
 
         addressBookSourceId = addressBookEntity->getSourceId();
 
+        // Forget the synced entries before the cloud address book is deleted, a retry uploads everything.
+        clearSyncState(addressBookEntity->toJSONAddressBookType());
+
         if (!deleteAddressBook(addressBookEntity)) {
             result = AddressBookOperationResultCode::ERROR_DELETE_ADDRESS_BOOK_FAILED;
             Throw("addressBookDeleteFailed");
@@ -1016,6 +1717,8 @@ void AddressBookCloudUploader::eventLoop(bool cleanAllAddressBooksAtStart) {
             Event::Type::REMOVE, std::make_shared<AddressBookEntity>("dummyContact", "", AddressBookType::CONTACT));
         m_addressBookEventQ.emplace_back(
             Event::Type::REMOVE, std::make_shared<AddressBookEntity>("dummyNavFav", "", AddressBookType::NAVIGATION));
+    } else {
+        restorePendingRemoves();
     }
     while (!m_isShuttingDown) {
         AACE_DEBUG(LX(TAG).m("waitingForEvents"));
@@ -1029,9 +1732,10 @@ void AddressBookCloudUploader::eventLoop(bool cleanAllAddressBooksAtStart) {
         Event::Type eventType = event.getType();
         if (Event::Type::INVALID != eventType) {
             int numBatches = 0;
+            SyncStats syncStats;
             AddressBookOperationResultCode resultCode(AddressBookOperationResultCode::SUCCESS);
             if (Event::Type::ADD == eventType) {
-                result = handleUpload(event.getAddressBookEntity(), numBatches, resultCode);
+                result = handleUpload(event.getAddressBookEntity(), numBatches, resultCode, syncStats);
             } else if (Event::Type::REMOVE == eventType) {
                 result = handleRemove(event.getAddressBookEntity(), resultCode);
             }
@@ -1058,7 +1762,8 @@ void AddressBookCloudUploader::eventLoop(bool cleanAllAddressBooksAtStart) {
                             retryCount,
                             numBatches,
                             event.getAddressBookEntity()->getType(),
-                            resultCode);
+                            resultCode,
+                            syncStats);
                         AACE_WARN(LX(TAG, "eventLoop")
                                       .m("Max retry reached. Dropping the event")
                                       .d("addressBookSourceId", event.getAddressBookEntity()->getSourceId())
@@ -1084,7 +1789,8 @@ void AddressBookCloudUploader::eventLoop(bool cleanAllAddressBooksAtStart) {
                     retryCount,
                     numBatches,
                     event.getAddressBookEntity()->getType(),
-                    resultCode);
+                    resultCode,
+                    syncStats);
             }
         } else {
             AACE_WARN(LX(TAG, "eventLoop").m("invalidEventFromQueue"));
@@ -1094,21 +1800,30 @@ void AddressBookCloudUploader::eventLoop(bool cleanAllAddressBooksAtStart) {
 
 const Event AddressBookCloudUploader::popNextEventFromQ() {
     std::unique_lock<std::mutex> queueLock{m_mutex};
-    auto shouldNotWait = [this]() {
-        return (
-            m_isShuttingDown ||
-            (!m_addressBookEventQ.empty() && m_networkStatus == NetworkStatus::CONNECTED && m_isAuthRefreshed));
-    };
-
-    if (!shouldNotWait()) {
-        m_waitForEvent.wait(queueLock, shouldNotWait);
-    }
+    while (!m_isShuttingDown) {
+        bool canUpload = m_networkStatus == NetworkStatus::CONNECTED && m_isAuthRefreshed;
+        if (canUpload && !m_addressBookEventQ.empty()) {
+            auto event = m_addressBookEventQ.front();
+            m_addressBookEventQ.pop_front();
 
-    if (!m_addressBookEventQ.empty()) {
-        auto event = m_addressBookEventQ.front();
-        m_addressBookEventQ.pop_front();
+            return event;
+        }
 
-        return event;
+        // The cloud address book of a removed address book is deleted when its grace period ends.
+        auto next = std::min_element(
+            m_pendingRemoves.begin(),
+            m_pendingRemoves.end(),
+            [](const std::pair<const std::string, PendingRemove>& a,
+               const std::pair<const std::string, PendingRemove>& b) {
+                return a.second.removeTime < b.second.removeTime;
+            });
+        if (!canUpload || next == m_pendingRemoves.end()) {
+            m_waitForEvent.wait(queueLock);
+        } else if (next->second.removeTime <= std::chrono::system_clock::now()) {
+            return Event(Event::Type::REMOVE, next->second.addressBookEntity);
+        } else {
+            m_waitForEvent.wait_until(queueLock, next->second.removeTime);
+        }
     }
 
     return Event::INVALID();
@@ -1136,14 +1851,44 @@ AddressBookOperationResultCode AddressBookCloudUploader::prepareForUpload(
     return AddressBookOperationResultCode::SUCCESS;
 }
 
+AddressBookOperationResultCode AddressBookCloudUploader::uploadBatch(
+    const std::string& cloudAddressBookId,
+    size_t batchIndex,
+    const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
+    std::queue<std::string>& failedEntries) {
+    auto result = uploadEntries(cloudAddressBookId, batch, failedEntries);
+
+    auto retryDelay = BATCH_RETRY_DELAY;
+    for (int retry = 1; retry <= MAX_BATCH_RETRY && result != AddressBookOperationResultCode::SUCCESS &&
+                        isRetryableResult(result) && !m_isShuttingDown;
+         retry++) {
+        AACE_WARN(LX(TAG).m("retryingBatch").d("batchIndex", batchIndex).d("retry", retry).d("result", result));
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waitForEvent.wait_for(lock, retryDelay, [this]() { return m_isShuttingDown ? true : false; });
+        }
+        if (m_isShuttingDown) {
+            break;
+        }
+        retryDelay *= 2;
+        result = uploadEntries(cloudAddressBookId, batch, failedEntries);
+    }
+
+    if (result != AddressBookOperationResultCode::SUCCESS) {
+        AACE_ERROR(LX(TAG).m("batchUploadFailed").d("batchIndex", batchIndex).d("result", result));
+    }
+    return result;
+}
+
 AddressBookOperationResultCode AddressBookCloudUploader::uploadEntries(
     const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
+    const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
+    std::queue<std::string>& failedEntries) {
     try {
-        AACE_DEBUG(LX(TAG).d("numEntries", document->FindMember("entries")->value.Size()));
+        AACE_DEBUG(LX(TAG).d("size", batch.content.size()));
         HTTPResponse httpResponse;
         auto flowState = UploadFlowState::POST;
-        AddressBookOperationResultCode resultCode = AddressBookOperationResultCode::SUCCESS;
+        AddressBookOperationResultCode resultCode = AddressBookOperationResultCode::ERROR_UNKNOWN;
 
         while (!m_isShuttingDown && flowState != UploadFlowState::FINISH) {
             auto nextFlowState = UploadFlowState::ERROR;
@@ -1152,17 +1897,18 @@ AddressBookOperationResultCode AddressBookCloudUploader::uploadEntries(
 
             switch (flowState) {
                 case UploadFlowState::POST:
-                    nextFlowState = handleUploadEntries(cloudAddressBookId, document, httpResponse);
+                    nextFlowState = handleUploadEntries(cloudAddressBookId, batch, httpResponse);
                     resultCode = httpResponseCodeToResult((HTTPResponseCode)httpResponse.code);
                     break;
                 case UploadFlowState::PARSE:
-                    nextFlowState = handleParseHTTPResponse(httpResponse);
+                    nextFlowState = handleParseHTTPResponse(httpResponse, failedEntries);
                     if (nextFlowState == UploadFlowState::ERROR) {
                         resultCode = AddressBookOperationResultCode::ERROR_HTTP_PARSE_RESPONSE_FAILED;
                     }
                     break;
                 case UploadFlowState::ERROR:
-                    nextFlowState = handleError(cloudAddressBookId);
+                    // The batch is retried or the upload given up by the caller.
+                    nextFlowState = UploadFlowState::FINISH;
                     break;
                 case UploadFlowState::FINISH:
                     break;
@@ -1176,7 +1922,7 @@ AddressBookOperationResultCode AddressBookCloudUploader::uploadEntries(
     }
 }
 
-AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleError(const std::string& cloudAddressBookId) {
+void AddressBookCloudUploader::handleError(const std::string& cloudAddressBookId) {
     try {
         ThrowIfNot(
             m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(cloudAddressBookId),
@@ -1184,16 +1930,14 @@ AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleError(
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "handleError").d("reason", ex.what()));
     }
-
-    return UploadFlowState::FINISH;
 }
 
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleUploadEntries(
     const std::string& addressBookId,
-    std::shared_ptr<rapidjson::Document> document,
+    const AddressBookCloudUploaderRESTAgent::UploadBatch& batch,
     HTTPResponse& httpResponse) {
     try {
-        httpResponse = m_addressBookCloudUploaderRESTAgent->uploadDocumentToCloud(document, addressBookId);
+        httpResponse = m_addressBookCloudUploaderRESTAgent->uploadBatchToCloud(batch, addressBookId);
 
         switch (httpResponse.code) {
             case HTTPResponseCode::SUCCESS_OK:
@@ -1210,16 +1954,17 @@ AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleUpload
 }
 
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleParseHTTPResponse(
-    const HTTPResponse& httpResponse) {
+    const HTTPResponse& httpResponse,
+    std::queue<std::string>& failedEntries) {
     try {
-        std::queue<std::string> failedEntries;
+        auto numberOfFailedEntries = failedEntries.size();
         ThrowIfNot(
             m_addressBookCloudUploaderRESTAgent->parseCreateAddressBookEntryResponse(httpResponse, failedEntries),
             "responseJsonParseFailed");
 
         // Continue to upload rest of the entries, even if there are one or more failed entries.
-        if (failedEntries.size()) {
-            AACE_WARN(LX(TAG).d("NumberOfFailedEntries", failedEntries.size()));
+        if (failedEntries.size() > numberOfFailedEntries) {
+            AACE_WARN(LX(TAG).d("NumberOfFailedEntries", failedEntries.size() - numberOfFailedEntries));
         }
 
         return UploadFlowState::FINISH;
@@ -1260,6 +2005,18 @@ AddressBookOperationResultCode AddressBookCloudUploader::httpResponseCodeToResul
     return AddressBookOperationResultCode::ERROR_UNKNOWN;
 }
 
+bool AddressBookCloudUploader::isRetryableResult(AddressBookOperationResultCode result) {
+    switch (result) {
+        case AddressBookOperationResultCode::ERROR_HTTP_PARSE_RESPONSE_FAILED:
+        case AddressBookOperationResultCode::ERROR_HTTP_THROTTLED:
+        case AddressBookOperationResultCode::ERROR_HTTP_SERVER_ERROR:
+        case AddressBookOperationResultCode::ERROR_UNKNOWN:
+            return true;
+        default:
+            return false;
+    }
+}
+
 std::string AddressBookCloudUploader::createAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity) {
     AACE_DEBUG(LX(TAG).d("addressBookSourceId", addressBookEntity->getSourceId()));
     try {
@@ -1314,7 +2071,8 @@ void AddressBookCloudUploader::submitAddressBookRequestResultMetrics(
     unsigned int retryCount,
     unsigned int numBatchesInRequest,
     AddressBookType addressBookType,
-    AddressBookOperationResultCode result) {
+    AddressBookOperationResultCode result,
+    const SyncStats& syncStats) {
     bool wasSuccess = result == AddressBookOperationResultCode::SUCCESS;
     const std::string counterName = wasSuccess ? METRIC_REQUEST_SUCCESS_COUNT : METRIC_REQUEST_FAILURE_COUNT;
 
@@ -1364,6 +2122,12 @@ void AddressBookCloudUploader::submitAddressBookRequestResultMetrics(
                           .increment(numBatchesInRequest)
                           .build());
     }
+    if (eventType == Event::Type::ADD && wasSuccess) {
+        dps.push_back(
+            CounterDataPointBuilder{}.withName(METRIC_ENTRIES_UPLOADED).increment(syncStats.entriesUploaded).build());
+        dps.push_back(
+            CounterDataPointBuilder{}.withName(METRIC_ENTRIES_SKIPPED).increment(syncStats.entriesSkipped).build());
+    }
 
     auto metricBuilder = MetricEventBuilder().withSourceName(METRIC_SOURCE_ADDRESS_BOOK_REQUEST).withAlexaAgentId();
     metricBuilder.addDataPoints(dps);
@@ -19,6 +19,7 @@
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Core/EngineVersion.h>
 #include <AACE/Engine/AddressBook/AddressBookCloudUploaderRESTAgent.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 
 #include "zlib.h"
 
@@ -206,13 +207,15 @@ AddressBookCloudUploaderRESTAgent::AddressBookCloudUploaderRESTAgent(
 std::shared_ptr<AddressBookCloudUploaderRESTAgent> AddressBookCloudUploaderRESTAgent::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     try {
         std::shared_ptr<AddressBookCloudUploaderRESTAgent> addressBookCloudRESTAgent =
             std::shared_ptr<AddressBookCloudUploaderRESTAgent>(
                 new AddressBookCloudUploaderRESTAgent(authDelegate, deviceInfo));
         ThrowIfNot(
-            addressBookCloudRESTAgent->initialize(alexaEndpoints), "initializeAddressBookCloudUploaderRESTAgentFailed");
+            addressBookCloudRESTAgent->initialize(alexaEndpoints, httpClient),
+            "initializeAddressBookCloudUploaderRESTAgentFailed");
 
         return addressBookCloudRESTAgent;
     } catch (std::exception& ex) {
@@ -222,7 +225,14 @@ std::shared_ptr<AddressBookCloudUploaderRESTAgent> AddressBookCloudUploaderRESTA
 }
 
 bool AddressBookCloudUploaderRESTAgent::initialize(
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
+    m_httpClient = httpClient != nullptr ? httpClient : aace::engine::alexa::HttpClientPool::create();
+    if (m_httpClient == nullptr) {
+        AACE_ERROR(LX(TAG).m("nullHttpClient"));
+        return false;
+    }
+
     auto acmsendpoint = alexaEndpoints->getACMSEndpoint();
     if (!acmsendpoint.empty()) {
         m_acmsEndpoint = acmsendpoint;
@@ -270,11 +280,9 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpPost on every doPost ensures most updated curl options set in libCurlUtils are used.
-            auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-            ThrowIfNull(httpPost, "nullHttpPost");
-
-            auto httpResponse = httpPost->doPost(url, headerLines, data, timeout);
+            // The shared client resets pooled handles on checkout, so the most updated curl options set in
+            // libCurlUtils are used while the connection to ACMS is kept alive.
+            auto httpResponse = m_httpClient->doPost(url, headerLines, data, timeout);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -314,11 +322,7 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpGet on every doGet ensures most updated curl options set in libCurlUtils are used.
-            auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-            ThrowIfNull(httpGet, "nullHttpGet");
-
-            auto httpResponse = httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
+            auto httpResponse = m_httpClient->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -358,11 +362,7 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpDelete on every doDelete ensures most updated curl options set in libCurlUtils are used.
-            auto httpDelete = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpDelete::create();
-            ThrowIfNull(httpDelete, "nullHttpDelete");
-
-            auto httpResponse = httpDelete->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
+            auto httpResponse = m_httpClient->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -672,9 +672,31 @@ static int gzip(const std::string& bytes, std::string& gzipped) {
     return Z_OK;
 }
 
+AddressBookCloudUploaderRESTAgent::UploadBatch AddressBookCloudUploaderRESTAgent::prepareUploadBatch(
+    const rapidjson::Document& document) {
+    UploadBatch batch;
+    batch.content = aace::engine::utils::json::toString(document);
+
+    std::string gzipped;
+    int ret = gzip(batch.content, gzipped);
+    if (ret == Z_OK) {
+        batch.content = std::move(gzipped);
+        batch.compressed = true;
+    } else {
+        AACE_ERROR(LX(TAG, "failedToCompressContent").d("error", ret));
+    }
+    return batch;
+}
+
 AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::uploadDocumentToCloud(
     std::shared_ptr<rapidjson::Document> document,
     const std::string& cloudAddressBookId) {
+    return uploadBatchToCloud(prepareUploadBatch(*document), cloudAddressBookId);
+}
+
+AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgent::uploadBatchToCloud(
+    const UploadBatch& batch,
+    const std::string& cloudAddressBookId) {
     AACE_DEBUG(LX(TAG));
     try {
         auto httpHeaderData = buildCommonHTTPHeader();
@@ -684,21 +706,14 @@ AddressBookCloudUploaderRESTAgent::HTTPResponse AddressBookCloudUploaderRESTAgen
             return AddressBookCloudUploaderRESTAgent::HTTPResponse();
         }
         httpHeaderData.insert(httpHeaderData.end(), CONTENT_TYPE_APPLICATION_JSON);
-
-        auto content = aace::engine::utils::json::toString(*document);
-        std::string gzipped;
-        int ret = gzip(content, gzipped);
-        if (ret == Z_OK) {
+        if (batch.compressed) {
             httpHeaderData.insert(httpHeaderData.end(), "Content-Encoding: gzip");
-            content = std::move(gzipped);
-        } else {
-            AACE_ERROR(LX(TAG, "failedToCompressContent").d("error", ret));
         }
 
         auto url = m_acmsEndpoint + FORWARD_SLASH + USERS_PATH + FORWARD_SLASH + getPceId() + FORWARD_SLASH +
                    ADDRESSBOOK_PATH + FORWARD_SLASH + cloudAddressBookId + FORWARD_SLASH + ENTRIES_PATH;
 
-        auto result = doPost(url, httpHeaderData, content, DEFAULT_HTTP_TIMEOUT);
+        auto result = doPost(url, httpHeaderData, batch.content, DEFAULT_HTTP_TIMEOUT);
 
         ThrowIfNot(result.first, "doPostFailed:" + responseCodeToString((HTTPResponseCode)result.second.code));
 
@@ -21,6 +21,7 @@
 #include <AACE/Engine/Alexa/AlexaEngineService.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Network/NetworkEngineService.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 
 #include <AACE/Engine/AddressBook/AddressBookEngineService.h>
 
@@ -35,7 +36,10 @@ static const std::string TAG("aace.addressBook.addressBookEngineService");
 REGISTER_SERVICE(AddressBookEngineService);
 
 AddressBookEngineService::AddressBookEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description), m_cleanAllAddressBooksAtStart(true) {
+        aace::engine::core::EngineService(description),
+        m_cleanAllAddressBooksAtStart(true),
+        m_maxConcurrentUploads(AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS),
+        m_removeGracePeriod(AddressBookCloudUploader::DEFAULT_REMOVE_GRACE_PERIOD) {
 }
 
 AddressBookEngineService::~AddressBookEngineService() = default;
@@ -68,6 +72,17 @@ bool AddressBookEngineService::configure(std::shared_ptr<std::istream> configura
     try {
         auto config = nlohmann::json::parse(*configuration);
         m_cleanAllAddressBooksAtStart = config.value("cleanAllAddressBooksAtStart", m_cleanAllAddressBooksAtStart);
+        m_maxConcurrentUploads = config.value("maxConcurrentUploads", m_maxConcurrentUploads);
+        if (m_maxConcurrentUploads == 0) {
+            AACE_WARN(LX(TAG).m("invalidMaxConcurrentUploads").d("using", 1));
+            m_maxConcurrentUploads = 1;
+        }
+        m_removeGracePeriod =
+            std::chrono::seconds(config.value("removeGracePeriodSeconds", m_removeGracePeriod.count()));
+        if (m_removeGracePeriod < std::chrono::seconds::zero()) {
+            AACE_WARN(LX(TAG).m("invalidRemoveGracePeriodSeconds").d("using", 0));
+            m_removeGracePeriod = std::chrono::seconds::zero();
+        }
     } catch (nlohmann::json::parse_error& ex) {
         AACE_ERROR(LX(TAG).m("configuration is not valid JSON").d("exception", ex.what()));
         return false;
@@ -120,6 +135,13 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::metrics::MetricRecorderServiceInterface>("aace.metrics");
         ThrowIfNull(metricService, "MetricRecorderServiceInterface is null");
 
+        // the shared HTTP client is optional, the REST agent falls back to its own pool
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClientInterface>("aace.alexa");
+
+        // the sync state of uploaded address books is persisted so unchanged entries are not uploaded again
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+
         m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
             m_addressBookEngineImpl,
             authDelegate,
@@ -128,7 +150,11 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             networkObserver,
             alexaEndpoints,
             metricService,
-            m_cleanAllAddressBooksAtStart);
+            m_cleanAllAddressBooksAtStart,
+            httpClient,
+            localStorage,
+            m_maxConcurrentUploads,
+            m_removeGracePeriod);
         ThrowIfNull(m_addressBookCloudUploader, "createAddressBookCloudUploaderFailed");
 
         // set the engine interface reference
@@ -112,6 +112,8 @@ public:
          * 
          * @note For the phone labels recognized by Alexa and for information about disambiguating phone numbers 
          * when multiple labels are associated with a contact, see [Phone number type disambiguation](https://developer.amazon.com/en-US/docs/alexa/alexa-auto/communication.html#phone-number-type-disambiguation).
+         * @note Data can be added to an entry at any time while the address book is read. Once this function is
+         * used, the address book is kept in memory until all of its entries are added, as in earlier versions.
          */
         virtual bool addPhone(const std::string& entryId, const std::string& label, const std::string& number) = 0;
 
@@ -134,6 +136,8 @@ public:
          * @param [in] longitudeInDegrees Geo longitude in degrees.
          * @param [in] accuracyInMeters Accuracy in meters, or zero if not available.
          * @return @c true on successful or @c false when reached the max allowed per id or if entryId is empty.
+         * @note Data can be added to an entry at any time while the address book is read. Once this function is
+         * used, the address book is kept in memory until all of its entries are added, as in earlier versions.
          */
         virtual bool addPostalAddress(
             const std::string& entryId,
@@ -235,6 +239,43 @@ public:
          * Alexa uses the phonetic values for entity resolution and TTS when the device locale setting is "ja-JP".
          */
         virtual bool addEntry(const std::string& payload) = 0;
+
+        /**
+         * Add a batch of address book entries. Use this instead of calling @c addEntry() once per entry when
+         * ingesting large address books.
+         *
+         * @code{.json}
+         * [
+         *      {
+         *          "entryId": "{{STRING}}",
+         *          "name": {
+         *              ...
+         *          },
+         *          "phoneNumbers": [
+         *              ...
+         *          ],
+         *          "postalAddresses": [
+         *              ...
+         *          ]
+         *      }
+         * ]
+         * @endcode
+         * Each element of the array is an entry in the format accepted by @c addEntry(), and is validated with the
+         * same rules.
+         *
+         * @param payload A JSON array of address book entries.
+         * @return @c true if all the entries were added, or @c false when the payload is not a valid JSON array or
+         * the input validation of one or more entries fails.
+         *
+         * @note Entries failing the validation are handled as described for @c addEntry(). The remaining entries of
+         * the batch are added.
+         *
+         * @note The payload is parsed and encoded into the upload batches in a single pass, and is released when
+         * the call returns, and filled upload batches are uploaded while the address book is still being read.
+         * Memory used while ingesting an address book is therefore bounded by the size of the batches passed to
+         * this function; a few hundred entries per call is a good trade-off.
+         */
+        virtual bool addEntries(const std::string& payload) = 0;
     };
 
     /**
@@ -13,8 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 // JSON for Modern C++
 #include <nlohmann/json.hpp>
+#include <zlib.h>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -24,7 +29,10 @@
 
 #include <AACE/AddressBook/AddressBook.h>
 #include <AACE/Engine/AddressBook/AddressBookCloudUploader.h>
+#include <AACE/Test/Unit/Alexa/FakeAlexaEndpoint.h>
+#include <AACE/Test/Unit/Alexa/FakeHttpClient.h>
 #include <AACE/Test/Unit/Metrics/MockMetricRecorderServiceInterface.h>
+#include <AACE/Test/Unit/Storage/FakeLocalStorage.h>
 
 namespace aace {
 namespace test {
@@ -41,6 +49,9 @@ static std::chrono::seconds LARGE_TIMEOUT(60);
 static const std::string AUTH_TOKEN = "MockAuthToken";
 
 using json = nlohmann::json;
+using FakeAlexaEndpoint = aace::test::unit::alexa::FakeAlexaEndpoint;
+using FakeHttpClient = aace::test::unit::alexa::FakeHttpClient;
+using FakeLocalStorage = aace::test::unit::core::FakeLocalStorage;
 
 class MockAuthDelegateInterface : public alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface {
 public:
@@ -79,23 +90,158 @@ public:
     MOCK_METHOD0(servicesEnablementChanged, void());
 };
 
-class DummyAlexaEndpointInterface : public aace::engine::alexa::AlexaEndpointInterface {
+/// ACMS endpoint of the test user
+static const std::string ACMS_ENDPOINT = "https://alexa-comms-mobile-service-na.amazon.com";
+
+static std::shared_ptr<FakeAlexaEndpoint> createAlexaEndpoint() {
+    auto alexaEndpoint = std::make_shared<FakeAlexaEndpoint>();
+    alexaEndpoint->setACMSEndpoint(ACMS_ENDPOINT);
+    return alexaEndpoint;
+}
+
+/// Cloud address book id returned by @c FakeACMSHttpClient
+static const std::string CLOUD_ADDRESS_BOOK_ID = "MockCloudAddressBookId";
+
+/// ACMS URL of the address books of the test user
+static const std::string ADDRESS_BOOKS_URL = ACMS_ENDPOINT + "/users/MockPceId/addressbooks";
+
+/// ACMS URL of the cloud address book created by @c FakeACMSHttpClient
+static const std::string CLOUD_ADDRESS_BOOK_URL = ADDRESS_BOOKS_URL + "/" + CLOUD_ADDRESS_BOOK_ID;
+
+/**
+ * Stand-in for the ACMS service. It keeps track of whether the cloud address book exists and
+ * counts the entries posted. Requests to any other URL than the ACMS calls used by the uploader fail the test.
+ */
+class FakeACMSHttpClient : public FakeHttpClient {
 public:
-    std::string getAVSGateway() override {
-        // Not called.
-        return "";
+    HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (url == ACMS_ENDPOINT + "/accounts") {
+            return response(R"([{"signedInUser":true,"commsId":"MockCommsId","commsProvisionStatus":"PROVISIONED"}])");
+        }
+        if (url == ACMS_ENDPOINT + "/users/MockCommsId/identities?includeUserName=false") {
+            return response(R"({"pceId":"MockPceId"})");
+        }
+        if (url != ADDRESS_BOOKS_URL + "?addressBookSourceIds=MockAddressBookTest") {
+            return unexpectedRequest("GET", url);
+        }
+        json addressBooks = json::array();
+        if (m_addressBookExists) {
+            addressBooks.push_back({{"addressBookId", CLOUD_ADDRESS_BOOK_ID}, {"addressBookType", "automotive"}});
+        }
+        return response(json({{"addressBooks", addressBooks}}).dump());
+    }
+
+    HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (url == ADDRESS_BOOKS_URL) {
+            m_addressBookExists = true;
+            m_addressBooksCreated++;
+            return response(json({{"addressBookId", CLOUD_ADDRESS_BOOK_ID}}).dump());
+        }
+        if (url != CLOUD_ADDRESS_BOOK_URL + "/entries") {
+            return unexpectedRequest("POST", url);
+        }
+
+        // simulate the round trip to the cloud, the uploader may have several batches in flight
+        roundTrip(lock, m_entryPostLatency);
+
+        if (m_entryPostFailures > 0) {
+            m_entryPostFailures--;
+            return response("{}");
+        }
+        auto entries = json::parse(gunzip(data))["entries"];
+        m_entryPosts++;
+        m_entriesPosted += entries.size();
+        json references = json::array();
+        for (auto& entry : entries) {
+            references.push_back({{"entrySourceId", entry["entrySourceId"]}, {"status", "SUCCESS"}});
+        }
+        return response(json({{"references", references}}).dump());
     }
-    std::string getLWAEndpoint() override {
-        // Not called.
-        return "";
+
+    HTTPResponse doDelete(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (url != CLOUD_ADDRESS_BOOK_URL) {
+            return unexpectedRequest("DELETE", url);
+        }
+        m_addressBookExists = false;
+        m_addressBooksDeleted++;
+        return response("");
     }
-    std::string getACMSEndpoint() override {
-        return "https://alexa-comms-mobile-service-na.amazon.com";
+
+    size_t getEntriesPosted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entriesPosted;
     }
 
-    std::string getFeatureDiscoveryEndpoint() override {
-        return "";
+    size_t getEntryPosts() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entryPosts;
     }
+
+    size_t getAddressBooksDeleted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_addressBooksDeleted;
+    }
+
+    size_t getAddressBooksCreated() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_addressBooksCreated;
+    }
+
+    void setEntryPostLatency(std::chrono::milliseconds latency) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entryPostLatency = latency;
+    }
+
+    /// Responds to the next @c count entry posts without the entry references.
+    void failEntryPosts(size_t count) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entryPostFailures = count;
+    }
+
+    void resetCounters() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entriesPosted = 0;
+        m_entryPosts = 0;
+        m_addressBooksCreated = 0;
+        m_addressBooksDeleted = 0;
+        resetMaxRequestsInFlight();
+    }
+
+private:
+    static std::string gunzip(const std::string& data) {
+        z_stream zstr{};
+        inflateInit2(&zstr, MAX_WBITS + 16);
+        zstr.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        zstr.avail_in = data.size();
+        std::string out;
+        char buffer[16384];
+        int ret = Z_OK;
+        while (ret == Z_OK) {
+            zstr.next_out = reinterpret_cast<Bytef*>(buffer);
+            zstr.avail_out = sizeof(buffer);
+            ret = inflate(&zstr, Z_NO_FLUSH);
+            out.append(buffer, sizeof(buffer) - zstr.avail_out);
+        }
+        inflateEnd(&zstr);
+        return out;
+    }
+
+    bool m_addressBookExists = false;
+    size_t m_entriesPosted = 0;
+    size_t m_entryPosts = 0;
+    size_t m_addressBooksCreated = 0;
+    size_t m_addressBooksDeleted = 0;
+    size_t m_entryPostFailures = 0;
+    std::chrono::milliseconds m_entryPostLatency{0};
 };
 
 // clang-format off
@@ -206,6 +352,13 @@ static std::string buildEntryPayloadWithNameAndPostalAddresses(
     return payload.dump();
 }
 
+/// Builds the payload of the contact at @c index of the contact address books used with @c FakeACMSHttpClient.
+static std::string buildContactPayload(int index, const std::string& lastName = "Smith") {
+    auto entryId = std::to_string(index);
+    return buildEntryPayloadWithNameAndPhoneNumbers(
+        entryId, "First" + entryId, lastName, "", {{"Mobile", "+1555" + entryId}});
+}
+
 class AddressBookCloudUploaderTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -215,13 +368,28 @@ public:
         m_mockAuthDelegate = std::make_shared<testing::StrictMock<MockAuthDelegateInterface>>();
         m_mockNetworkObservableInterface = std::make_shared<testing::StrictMock<MockNetworkObservableInterface>>();
         m_mockAddressBookServiceInterface = std::make_shared<testing::StrictMock<MockAddressBookServiceInterface>>();
-        m_alexaEndpointInterface = std::make_shared<DummyAlexaEndpointInterface>();
+        m_alexaEndpointInterface = createAlexaEndpoint();
         m_mockMetricRecorder = std::make_shared<aace::test::unit::core::MockMetricRecorderServiceInterface>();
 
         // create device info
         m_deviceInfo = alexaClientSDK::avsCommon::utils::DeviceInfo::create(
             alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot());
 
+        m_fakeCloud = std::make_shared<FakeACMSHttpClient>();
+        m_fakeCloudAuthDelegate = std::make_shared<testing::NiceMock<MockAuthDelegateInterface>>();
+        m_fakeCloudAddressBookService = std::make_shared<testing::NiceMock<MockAddressBookServiceInterface>>();
+        m_fakeCloudMetricRecorder =
+            std::make_shared<testing::NiceMock<aace::test::unit::core::MockMetricRecorderServiceInterface>>();
+        ON_CALL(*m_fakeCloudAuthDelegate, getAuthToken()).WillByDefault(testing::Return(std::string(AUTH_TOKEN)));
+        ON_CALL(*m_fakeCloudMetricRecorder, recordMetric(testing::_))
+            .WillByDefault(testing::Invoke([this](const aace::engine::metrics::MetricEvent& metricEvent) {
+                {
+                    std::lock_guard<std::mutex> lock(m_uploadMetricMutex);
+                    m_uploadMetric = std::make_shared<aace::engine::metrics::MetricEvent>(metricEvent);
+                }
+                m_uploadMetricEvent.wakeUp();
+            }));
+
         m_mockContactAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
             "1000", "TestAddressBook", aace::engine::addressBook::AddressBookType::CONTACT);
         m_mockNavigationAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
@@ -252,6 +420,68 @@ public:
         }
     }
 
+    /**
+     * Creates an uploader talking to @c m_fakeCloud, with network and authorization available. The upload metrics
+     * of the uploader are captured by @c waitForUploadMetric().
+     */
+    std::shared_ptr<aace::engine::addressBook::AddressBookCloudUploader> createFakeCloudUploader(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage = nullptr,
+        unsigned int maxConcurrentUploads =
+            aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS,
+        std::chrono::seconds removeGracePeriod = std::chrono::seconds::zero()) {
+        auto uploader = aace::engine::addressBook::AddressBookCloudUploader::create(
+            m_fakeCloudAddressBookService,
+            m_fakeCloudAuthDelegate,
+            m_deviceInfo,
+            aace::network::NetworkInfoProvider::NetworkStatus::CONNECTED,
+            nullptr,
+            m_alexaEndpointInterface,
+            m_fakeCloudMetricRecorder,
+            false,
+            m_fakeCloud,
+            localStorage,
+            maxConcurrentUploads,
+            removeGracePeriod);
+        if (uploader != nullptr) {
+            uploader->onAuthStateChange(
+                alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface::State::REFRESHED,
+                alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface::Error::SUCCESS);
+        }
+        return uploader;
+    }
+
+    /// Makes the contact address book "1000" provide @c numEntries contacts built by @c buildContactPayload().
+    void setContactEntries(int numEntries) {
+        ON_CALL(*m_fakeCloudAddressBookService, getEntries("1000", testing::_))
+            .WillByDefault(testing::Invoke(
+                [numEntries](
+                    const std::string& id,
+                    std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                    if (auto sharedRef = factory.lock()) {
+                        for (int i = 0; i < numEntries; i++) {
+                            sharedRef->addEntry(buildContactPayload(i));
+                        }
+                    }
+                    return true;
+                }));
+    }
+
+    /// Waits for the metric recorded at the end of an upload or remove request.
+    bool waitForUploadMetric(std::chrono::seconds timeout) {
+        auto result = m_uploadMetricEvent.wait(timeout);
+        m_uploadMetricEvent.reset();
+        return result;
+    }
+
+    /// Returns a counter of the last metric recorded at the end of a request.
+    std::string getUploadMetricCounter(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_uploadMetricMutex);
+        if (m_uploadMetric == nullptr) {
+            return "";
+        }
+        return m_uploadMetric->getDataPoint(name, aace::engine::metrics::DataType::COUNTER).getValue();
+    }
+
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
     std::shared_ptr<aace::engine::addressBook::AddressBookEntity> m_mockContactAddressBook;
     std::shared_ptr<aace::engine::addressBook::AddressBookEntity> m_mockNavigationAddressBook;
@@ -262,6 +492,16 @@ public:
     std::shared_ptr<testing::StrictMock<MockAddressBookServiceInterface>> m_mockAddressBookServiceInterface;
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> m_alexaEndpointInterface;
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_mockMetricRecorder;
+
+    /// ACMS stand-in and collaborators of the uploaders created by @c createFakeCloudUploader().
+    std::shared_ptr<FakeACMSHttpClient> m_fakeCloud;
+    std::shared_ptr<testing::NiceMock<MockAuthDelegateInterface>> m_fakeCloudAuthDelegate;
+    std::shared_ptr<testing::NiceMock<MockAddressBookServiceInterface>> m_fakeCloudAddressBookService;
+    std::shared_ptr<testing::NiceMock<aace::test::unit::core::MockMetricRecorderServiceInterface>>
+        m_fakeCloudMetricRecorder;
+    alexaClientSDK::avsCommon::utils::WaitEvent m_uploadMetricEvent;
+    std::mutex m_uploadMetricMutex;
+    std::shared_ptr<aace::engine::metrics::MetricEvent> m_uploadMetric;
 };
 
 TEST_F(AddressBookCloudUploaderTest, create) {
@@ -343,7 +583,7 @@ TEST_F(AddressBookCloudUploaderTest, WithNetworkAndAuthRefreshedAddSingleContact
     auto mockAuthDelegate = std::make_shared<testing::StrictMock<MockAuthDelegateInterface>>();
     auto mockNetworkObservableInterface = std::make_shared<testing::StrictMock<MockNetworkObservableInterface>>();
     auto mockAddressBookServiceInterface = std::make_shared<testing::StrictMock<MockAddressBookServiceInterface>>();
-    auto alexaEndpointInterface = std::make_shared<DummyAlexaEndpointInterface>();
+    auto alexaEndpointInterface = createAlexaEndpoint();
 
     EXPECT_CALL(*mockAuthDelegate, addAuthObserver(testing::_)).WillOnce(testing::Return());
     EXPECT_CALL(*mockAuthDelegate, removeAuthObserver(testing::_)).WillOnce(testing::Return());
@@ -1249,6 +1489,296 @@ TEST_F(AddressBookCloudUploaderTest, AddingMaxAllowedPostalAddressForSameEntryId
     EXPECT_TRUE(waitEvent.wait(TIMEOUT));
 }
 
+TEST_F(AddressBookCloudUploaderTest, ReAddingLargeAddressBookSkipsUnchangedAndRecreatesChangedAddressBook) {
+    static const int NUM_ENTRIES = 5000;
+    static const int CHANGED_ENTRY = 1234;
+
+    auto localStorage = std::make_shared<FakeLocalStorage>();
+    int numEntries = NUM_ENTRIES;
+    std::string changedLastName = "Smith";
+    ON_CALL(*m_fakeCloudAddressBookService, getEntries("1000", testing::_))
+        .WillByDefault(testing::Invoke(
+            [&numEntries, &changedLastName](
+                const std::string& id,
+                std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                if (auto sharedRef = factory.lock()) {
+                    for (int i = 0; i < numEntries; i++) {
+                        sharedRef->addEntry(buildContactPayload(i, i == CHANGED_ENTRY ? changedLastName : "Smith"));
+                    }
+                }
+                return true;
+            }));
+
+    // Initial sync uploads every entry.
+    auto uploader = createFakeCloudUploader(localStorage);
+    ASSERT_NE(nullptr, uploader);
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 1u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+    EXPECT_EQ(getUploadMetricCounter("EntriesUploaded"), std::to_string(NUM_ENTRIES));
+    uploader->shutdown();
+
+    // Re-adding the unchanged address book after a restart does not upload anything.
+    m_fakeCloud->resetCounters();
+    uploader = createFakeCloudUploader(localStorage);
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 0u);
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 0u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), 0u);
+    EXPECT_EQ(getUploadMetricCounter("EntriesSkipped"), std::to_string(NUM_ENTRIES));
+
+    // An added contact is the only entry uploaded.
+    m_fakeCloud->resetCounters();
+    numEntries = NUM_ENTRIES + 1;
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 0u);
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 0u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), 1u);
+    EXPECT_EQ(getUploadMetricCounter("EntriesUploaded"), "1");
+    EXPECT_EQ(getUploadMetricCounter("EntriesSkipped"), std::to_string(NUM_ENTRIES));
+
+    // ACMS cannot delete a single entry, so a changed contact recreates the cloud address book.
+    m_fakeCloud->resetCounters();
+    changedLastName = "Jones";
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 1u);
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 1u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES + 1));
+    EXPECT_EQ(getUploadMetricCounter("EntriesUploaded"), std::to_string(NUM_ENTRIES + 1));
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, AddressBookAddedAgainDuringRemoveGracePeriodIsNotUploaded) {
+    static const int NUM_ENTRIES = 200;
+
+    setContactEntries(NUM_ENTRIES);
+    auto uploader = createFakeCloudUploader(
+        nullptr,
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS,
+        std::chrono::seconds(60));
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 1u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+
+    // The phone disconnects and reconnects, the cloud address book is kept.
+    m_fakeCloud->resetCounters();
+    ASSERT_TRUE(uploader->addressBookRemoved(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 0u);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 0u);
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 0u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), 0u);
+    EXPECT_EQ(getUploadMetricCounter("EntriesSkipped"), std::to_string(NUM_ENTRIES));
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, RemovedAddressBookIsDeletedRightAwayByDefault) {
+    static const int NUM_ENTRIES = 200;
+
+    setContactEntries(NUM_ENTRIES);
+    auto uploader = createFakeCloudUploader(
+        nullptr,
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS,
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_REMOVE_GRACE_PERIOD);
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+
+    m_fakeCloud->resetCounters();
+    ASSERT_TRUE(uploader->addressBookRemoved(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 1u);
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, RemovedAddressBookIsDeletedWhenGracePeriodEnds) {
+    static const int NUM_ENTRIES = 200;
+    static const std::chrono::seconds REMOVE_GRACE_PERIOD(1);
+
+    auto localStorage = std::make_shared<FakeLocalStorage>();
+    setContactEntries(NUM_ENTRIES);
+    auto createUploader = [&]() {
+        return createFakeCloudUploader(
+            localStorage,
+            aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS,
+            REMOVE_GRACE_PERIOD);
+    };
+
+    auto uploader = createUploader();
+    ASSERT_NE(nullptr, uploader);
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+
+    // The removal is deferred, and still carried out after a restart.
+    ASSERT_TRUE(uploader->addressBookRemoved(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 0u);
+    uploader->shutdown();
+
+    uploader = createUploader();
+    ASSERT_TRUE(waitForUploadMetric(TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksDeleted(), 1u);
+
+    // Adding the address book after its cloud copy was deleted uploads it again.
+    m_fakeCloud->resetCounters();
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 1u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, AddingEntriesInBatchesUploadsAllValidEntries) {
+    static const int NUM_ENTRIES = 1000;
+    static const int ENTRIES_PER_CALL = 250;
+
+    ON_CALL(*m_fakeCloudAddressBookService, getEntries("1000", testing::_))
+        .WillByDefault(testing::Invoke(
+            [](const std::string& id,
+               std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                if (auto sharedRef = factory.lock()) {
+                    EXPECT_FALSE(sharedRef->addEntries(""));
+                    EXPECT_FALSE(sharedRef->addEntries("{\"entryId\":\"0\"}"));
+                    EXPECT_FALSE(sharedRef->addEntries("[{\"entryId\":\"0\""));
+
+                    for (int start = 0; start < NUM_ENTRIES; start += ENTRIES_PER_CALL) {
+                        json entries = json::array();
+                        for (int i = start; i < start + ENTRIES_PER_CALL; i++) {
+                            entries.push_back(json::parse(buildContactPayload(i)));
+                        }
+                        EXPECT_TRUE(sharedRef->addEntries(entries.dump()));
+                    }
+
+                    // Invalid entries are discarded without affecting the rest of the batch.
+                    json entries = json::array();
+                    entries.push_back(json::parse(buildEntryPayloadJustName("0", "Duplicate", "Entry", "")));
+                    entries.push_back({{"entryId", "no-name"}});
+                    entries.push_back(json::parse(buildEntryPayloadJustName("", "Empty", "Id", "")));
+                    entries.push_back(json::parse(buildEntryPayloadJustName("valid", "Valid", "Entry", "")));
+                    EXPECT_FALSE(sharedRef->addEntries(entries.dump()));
+                }
+                return true;
+            }));
+
+    auto uploader = createFakeCloudUploader();
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES + 1));
+    EXPECT_EQ(getUploadMetricCounter("EntriesUploaded"), std::to_string(NUM_ENTRIES + 1));
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, DeprecatedFunctionsAddToAnyEntryWhileAddressBookIsRead_deprecated) {
+    static const int NUM_ENTRIES = 250;
+
+    ON_CALL(*m_fakeCloudAddressBookService, getEntries("1000", testing::_))
+        .WillByDefault(testing::Invoke(
+            [](const std::string& id,
+               std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                if (auto sharedRef = factory.lock()) {
+                    for (int i = 0; i < NUM_ENTRIES; i++) {
+                        EXPECT_TRUE(sharedRef->addName(std::to_string(i), "First", "Last"));
+                    }
+                    // The first entries would be part of an uploaded batch if the entries were not kept.
+                    EXPECT_TRUE(sharedRef->addPhone("0", "HOME", "123456789"));
+                    EXPECT_TRUE(sharedRef->addPhone("1", "WORK", "987654321"));
+                }
+                return true;
+            }));
+
+    auto uploader = createFakeCloudUploader();
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+    EXPECT_EQ(m_fakeCloud->getEntryPosts(), 3u);
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, LargeAddressBookIsUploadedWithConcurrentBatchesAndRetriedBatch) {
+    static const int NUM_ENTRIES = 2000;
+    static const unsigned int MAX_CONCURRENT_UPLOADS = 4;
+
+    m_fakeCloud->setEntryPostLatency(std::chrono::milliseconds(50));
+    m_fakeCloud->failEntryPosts(1);
+    setContactEntries(NUM_ENTRIES);
+    auto uploader = createFakeCloudUploader(nullptr, MAX_CONCURRENT_UPLOADS);
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+
+    // The failed batch is retried on its own, without recreating the cloud address book.
+    EXPECT_EQ(m_fakeCloud->getAddressBooksCreated(), 1u);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+    EXPECT_EQ(getUploadMetricCounter("EntriesUploaded"), std::to_string(NUM_ENTRIES));
+    EXPECT_GT(m_fakeCloud->getMaxRequestsInFlight(), 1u);
+    EXPECT_LE(m_fakeCloud->getMaxRequestsInFlight(), MAX_CONCURRENT_UPLOADS);
+
+    uploader->shutdown();
+}
+
+TEST_F(AddressBookCloudUploaderTest, BatchesAreUploadedWhileAddressBookIsRead) {
+    static const int NUM_ENTRIES = 1000;
+    static const int ENTRIES_BEFORE_CHECK = 250;
+    static const int ENTRIES_PER_BATCH = 100;
+
+    auto fakeCloud = m_fakeCloud;
+    bool uploadedWhileReading = false;
+    ON_CALL(*m_fakeCloudAddressBookService, getEntries("1000", testing::_))
+        .WillByDefault(testing::Invoke(
+            [fakeCloud, &uploadedWhileReading](
+                const std::string& id,
+                std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                if (auto sharedRef = factory.lock()) {
+                    for (int i = 0; i < NUM_ENTRIES; i++) {
+                        sharedRef->addEntry(buildContactPayload(i));
+                        if (i + 1 == ENTRIES_BEFORE_CHECK) {
+                            auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+                            while (fakeCloud->getEntriesPosted() == 0 && std::chrono::steady_clock::now() < deadline) {
+                                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                            }
+                            uploadedWhileReading = fakeCloud->getEntriesPosted() > 0;
+                        }
+                    }
+                    // A rejected entry right after a full batch does not produce an empty batch.
+                    EXPECT_FALSE(sharedRef->addEntry(R"({"entryId":"no-name"})"));
+                }
+                return true;
+            }));
+
+    auto uploader = createFakeCloudUploader();
+    ASSERT_NE(nullptr, uploader);
+
+    ASSERT_TRUE(uploader->addressBookAdded(m_mockContactAddressBook));
+    ASSERT_TRUE(waitForUploadMetric(LARGE_TIMEOUT));
+    EXPECT_TRUE(uploadedWhileReading);
+    EXPECT_EQ(m_fakeCloud->getEntriesPosted(), static_cast<size_t>(NUM_ENTRIES));
+    EXPECT_EQ(m_fakeCloud->getEntryPosts(), static_cast<size_t>(NUM_ENTRIES / ENTRIES_PER_BATCH));
+
+    uploader->shutdown();
+}
+
 }  // namespace addressBook
 }  // namespace unit
 }  // namespace test
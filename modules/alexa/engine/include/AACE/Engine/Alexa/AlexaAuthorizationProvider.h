@@ -101,7 +101,7 @@ private:
     std::mutex m_mutex;
 
     /// This is the worker thread for the @c AlexaAuthorizationProvider.
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"AlexaAuthorizationProvider"};
 };
 
 }  // namespace alexa
@@ -45,6 +45,7 @@
 #include <Settings/Storage/DeviceSettingStorageInterface.h>
 #include <SpeechSynthesizer/SpeechSynthesizer.h>
 
+#include "AudioInputStreamManager.h"
 #include "AuthorizationManager.h"
 #include "EndpointBuilderFactory.h"
 #include "ExternalMediaPlayer.h"
@@ -102,6 +103,7 @@ public:
     virtual std::shared_ptr<alexaClientSDK::settings::DeviceSettingsManager> getDeviceSettingsManager() = 0;
     virtual std::shared_ptr<alexaClientSDK::acl::PostConnectSequencerFactory> getPostConnectSequencerFactory() = 0;
     virtual std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> getAgentManager() = 0;
+    virtual std::shared_ptr<AudioInputStreamManager> getAudioInputStreamManager() = 0;
 };
 
 }  // namespace alexa
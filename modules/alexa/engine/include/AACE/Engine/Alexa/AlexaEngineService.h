@@ -109,6 +109,7 @@
 #include "AlexaEngineLogger.h"
 #include "AlexaSpeakerEngineImpl.h"
 #include "AssistantInfoManager.h"
+#include "AudioInputStreamManager.h"
 #include "AudioPlayerEngineImpl.h"
 #include "AuthorizationManager.h"
 #include "AuthProviderEngineImpl.h"
@@ -119,6 +120,7 @@
 #include "ExternalMediaPlayerEngineImpl.h"
 #include "FeatureDiscoveryEngineImpl.h"
 #include "GeolocationServiceInterface.h"
+#include "HttpClientPool.h"
 #include "MediaPlaybackRequestorEngineImpl.h"
 #include "NotificationsEngineImpl.h"
 #include "PlaybackControllerEngineImpl.h"
@@ -243,6 +245,7 @@ public:
     std::shared_ptr<alexaClientSDK::settings::DeviceSettingsManager> getDeviceSettingsManager() override;
     std::shared_ptr<alexaClientSDK::acl::PostConnectSequencerFactory> getPostConnectSequencerFactory() override;
     std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> getAgentManager() override;
+    std::shared_ptr<AudioInputStreamManager> getAudioInputStreamManager() override;
     /// @}
 
     /// AlexaEndpointInterface
@@ -419,8 +422,11 @@ private:
     std::shared_ptr<AlexaEngineSoftwareInfoSenderObserver> m_softwareInfoSenderObserver;
     std::shared_ptr<AuthDelegateProxy> m_authDelegateProxy;
     std::shared_ptr<HttpPutDelegate> m_httpPutDelegate;
+    std::shared_ptr<HttpClientPool> m_httpClientPool;
+    HttpClientPool::Config m_httpClientConfig;
     std::shared_ptr<PlaybackRouterDelegate> m_playbackRouterDelegate;
     std::shared_ptr<SystemSoundPlayer> m_systemSoundPlayer;
+    std::shared_ptr<AudioInputStreamManager> m_audioInputStreamManager;
     std::shared_ptr<AudioPlayerObserverDelegate> m_audioPlayerObserverDelegate;
     std::shared_ptr<AlexaAuthorizationProvider> m_alexaAuthorizationProvider;
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricService;
@@ -443,6 +449,8 @@ private:
     std::string m_featureDiscoveryEndpoint;
 
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    std::chrono::seconds m_audioInputBufferDuration = AudioInputStreamManager::DEFAULT_BUFFER_DURATION;
+    size_t m_audioInputMaxReaders = AudioInputStreamManager::DEFAULT_MAX_READERS;
     AuthObserverInterface::State m_authState;
     bool m_capabilitiesConfigured = false;
     /// Whether the AlexaEngineService has already been configured
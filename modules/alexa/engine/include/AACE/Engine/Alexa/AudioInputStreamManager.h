@@ -0,0 +1,145 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_MANAGER_H
+#define AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_MANAGER_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+
+#include <AACE/Engine/Audio/AudioManagerInterface.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Owns one capture ring for each audio input type, shared by every Engine component that consumes that type.
+ * Audio written by the platform is copied once into the ring of its type, and each consumer reads the ring with
+ * its own @c AudioInputStream::Reader. Readers are independent and can seek to any absolute sample index that is
+ * still in the ring, so the wakeword engine, the recognizer, and verifiers can read the same audio without copies.
+ */
+class AudioInputStreamManager : public std::enable_shared_from_this<AudioInputStreamManager> {
+public:
+    using AudioInputType = aace::engine::audio::AudioManagerInterface::AudioInputType;
+    using CaptureId = aace::engine::audio::AudioInputChannelInterface::ChannelId;
+
+    static constexpr CaptureId INVALID_CAPTURE = aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+
+    /// The default amount of audio kept in each ring.
+    static constexpr std::chrono::seconds DEFAULT_BUFFER_DURATION = std::chrono::seconds(15);
+
+    /// The default maximum number of readers of each ring.
+    static constexpr size_t DEFAULT_MAX_READERS = 10;
+
+private:
+    /// The capture ring of one audio input type.
+    struct CaptureRing {
+        std::shared_ptr<aace::engine::audio::AudioInputChannelInterface> channel;
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream;
+        std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> writer;
+        aace::engine::audio::AudioInputChannelInterface::ChannelId channelId =
+            aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+        std::set<CaptureId> captures;
+    };
+
+    AudioInputStreamManager(
+        std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+        std::chrono::seconds bufferDuration,
+        size_t maxReaders);
+
+    std::shared_ptr<CaptureRing> getCaptureRingLocked(AudioInputType type, const std::string& name);
+
+public:
+    /**
+     * Creates an @c AudioInputStreamManager.
+     *
+     * @param audioManager The audio manager used to open the audio input channels.
+     * @param audioFormat The format of the audio in the rings.
+     * @param bufferDuration The amount of audio kept in each ring.
+     * @param maxReaders The maximum number of readers of each ring.
+     */
+    static std::shared_ptr<AudioInputStreamManager> create(
+        std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+        std::chrono::seconds bufferDuration = DEFAULT_BUFFER_DURATION,
+        size_t maxReaders = DEFAULT_MAX_READERS);
+
+    /**
+     * Returns the capture ring of an audio input type. The ring and its audio input channel are created by the
+     * first call for the type.
+     *
+     * @param type The audio input type.
+     * @param name The name of the audio input channel, used if the channel is opened by this call.
+     * @return The ring, or @c nullptr if the audio input channel could not be opened.
+     */
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> getAudioInputStream(
+        AudioInputType type,
+        const std::string& name);
+
+    /**
+     * Requests audio to be captured into the ring of an audio input type. The platform is asked to start audio
+     * input when the first capture of the type starts.
+     *
+     * @return The ID of the capture, or @c INVALID_CAPTURE if audio input could not be started.
+     */
+    CaptureId startCapture(AudioInputType type);
+
+    /**
+     * Cancels a capture started with @c startCapture(). The platform is asked to stop audio input when the last
+     * capture of the type stops.
+     */
+    bool stopCapture(AudioInputType type, CaptureId id);
+
+    /**
+     * Creates a reader of the ring of an audio input type, positioned at an absolute sample index.
+     *
+     * @param type The audio input type.
+     * @param policy The policy of the reader.
+     * @param index The absolute index of the first sample to read. The index must still be in the ring.
+     * @return The reader, or @c nullptr if the ring does not exist, has no free reader, or no longer holds @c index.
+     */
+    std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Reader> createReader(
+        AudioInputType type,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Reader::Policy policy,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index index);
+
+    void shutdown();
+
+private:
+    std::weak_ptr<aace::engine::audio::AudioManagerInterface> m_audioManager;
+    alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    size_t m_wordSize;
+    std::chrono::seconds m_bufferDuration;
+    size_t m_maxReaders;
+
+    std::map<AudioInputType, std::shared_ptr<CaptureRing>> m_captureRings;
+    CaptureId m_nextCaptureId = 1;
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_MANAGER_H
@@ -18,7 +18,6 @@
 
 #include <functional>
 #include <memory>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -44,13 +43,27 @@ enum class DataPointTransformType {
     RENAME_COUNTERS
 };
 
-using DataPointTransformation = std::pair<DataPointTransformType, std::vector<std::string>>;
+/**
+ * A transformation rule compiled for the data points it applies to. The
+ * rule arguments are validated and the dimension of a named data point is
+ * resolved when the rules are configured, so applying a rule to a data point
+ * only builds the output data points.
+ */
+struct DataPointTransformation {
+    DataPointTransformType type;
+    /// Whether the rule arguments are valid for the data points the rule applies to
+    bool valid;
+    /// The name of the data point that takes the value of the source data point
+    std::string valueName;
+    /// The name of the string data point that takes the dimension
+    std::string dimensionName;
+    /// The value of the dimension, resolved for the named data point of the rule
+    std::string dimensionValue;
+};
 
 struct AvsSdkMetricTransformation {
     std::unordered_map<std::string, DataPointTransformation> namedDataPoints;
     std::vector<DataPointTransformation> allCounters;
-    std::vector<DataPointTransformation> allStrings;    // currently unused
-    std::vector<DataPointTransformation> allDurations;  // currently unused
 };
 
 class AvsSdkMetricParser {
@@ -74,25 +87,32 @@ public:
      */
     bool configure();
 
+    /**
+     * Configure the parser with rules in the format of @c AvsSdkMetricRules.h.
+     * @param rules The JSON rules
+     * @return @c true if parsing the rules succeeded, @c false if failed
+     */
+    bool configure(const std::string& rules);
+
     static bool convertWithoutChanges(
         MetricEventBuilder& builder,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp);
     static bool insertDimension(
         MetricEventBuilder& builder,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-        const std::vector<std::string>& args);
+        const DataPointTransformation& transformation);
     static bool swapName(
         MetricEventBuilder& builder,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-        const std::vector<std::string>& args);
+        const DataPointTransformation& transformation);
     static bool splitName(
         MetricEventBuilder& builder,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-        const std::vector<std::string>& args);
+        const DataPointTransformation& transformation);
     static bool renameCounters(
         MetricEventBuilder& builder,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-        const std::vector<std::string>& args);
+        const DataPointTransformation& transformation);
     static bool dropMetricIfCountZero(
         MetricEventBuilder& builder,
         bool& drop,
@@ -101,14 +121,35 @@ public:
         MetricEventBuilder& builder,
         bool& drop,
         const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-        const std::vector<std::string>& args);
+        const DataPointTransformation& transformation);
 
 private:
     /**
-     * Any metric with a source whose prefix is in this set will be allowed and
+     * Compile a rule for the named data point @c dpName, or for all counters
+     * if @c dpName is empty.
+     */
+    static DataPointTransformation compileTransformation(
+        DataPointTransformType type,
+        const std::string& dpName,
+        const std::string& valueName,
+        const std::string& dimensionName,
+        const std::string& delimiter = "");
+
+    /// Apply the transformations of the metric source to a data point
+    static bool transformDataPoint(
+        MetricEventBuilder& builder,
+        bool& drop,
+        const AvsSdkMetricTransformation& transformations,
+        const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp);
+
+    /// @return @c true if the source has a prefix in @c m_prefixOverrides
+    bool hasPrefixOverride(const std::string& source) const;
+
+    /**
+     * Any metric with a source whose prefix is in this list will be allowed and
      * converted with all data points as-is.
      */
-    std::set<std::string> m_prefixOverrides;
+    std::vector<std::string> m_prefixOverrides;
 
     /**
      * Contains the allowed metric events keyed by source name. The value
@@ -0,0 +1,128 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
+#define AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Caches the features discovered for each combination of domain, event type, locale, and limit. Entries expire after
+ * a time to live and are persisted in local storage, so they survive an Engine restart. Concurrent requests for the
+ * same combination are coalesced into one fetch whose result is shared by every caller.
+ */
+class FeatureDiscoveryCache {
+public:
+    /// The parameters that identify a feature discovery request.
+    struct Key {
+        std::string domain;
+        std::string eventType;
+        std::string locale;
+        int limit;
+
+        /// Returns the key used in the cache and in local storage.
+        std::string toString() const;
+    };
+
+    /**
+     * Fetches the features of a request from the cloud.
+     *
+     * @return The serialized JSON array of features, or an empty string if the request failed.
+     */
+    using FetchFunction = std::function<std::string()>;
+
+    /// The default time to live of a cached entry.
+    static constexpr std::chrono::milliseconds DEFAULT_TIME_TO_LIVE = std::chrono::hours(24);
+
+private:
+    /// A cached entry.
+    struct Entry {
+        std::string features;
+        std::chrono::system_clock::time_point expiry;
+    };
+
+    FeatureDiscoveryCache(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        std::chrono::milliseconds timeToLive);
+
+public:
+    /**
+     * Creates a @c FeatureDiscoveryCache.
+     *
+     * @param localStorage The local storage in which entries are persisted, or @c nullptr to keep them in memory.
+     * @param timeToLive The time after which an entry expires.
+     */
+    static std::shared_ptr<FeatureDiscoveryCache> create(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        std::chrono::milliseconds timeToLive = DEFAULT_TIME_TO_LIVE);
+
+    /**
+     * Returns the features of a request. A cached entry that has not expired is returned without calling @c fetch.
+     * If another caller is already fetching the same request, this function waits for its result. Otherwise
+     * @c fetch is called on the calling thread, and a non-empty result is cached.
+     *
+     * @param key The parameters of the request.
+     * @param fetch The function that fetches the features from the cloud.
+     * @param cached Set to whether the result was returned without a new fetch, if not @c nullptr.
+     * @return The serialized JSON array of features, or an empty string if the fetch failed.
+     */
+    std::string get(const Key& key, const FetchFunction& fetch, bool* cached = nullptr);
+
+    /// Removes every entry. Fetches in progress complete, but their result is not cached.
+    void clear();
+
+private:
+    /// Returns the features of an entry that has not expired, or an empty string.
+    std::string getCachedLocked(const std::string& key);
+
+    /// Caches the features of a request.
+    void putLocked(const std::string& key, const std::string& features);
+
+    /// The local storage in which entries are persisted.
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
+    /// The time after which an entry expires.
+    std::chrono::milliseconds m_timeToLive;
+
+    /// The entries read or written since the cache was created.
+    std::unordered_map<std::string, Entry> m_entries;
+
+    /// The results of the fetches in progress.
+    std::unordered_map<std::string, std::shared_future<std::string>> m_fetches;
+
+    /// Incremented by @c clear(), so that fetches started before it do not cache their result.
+    uint64_t m_generation;
+
+    /// Serializes access to the cache.
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_FEATURE_DISCOVERY_CACHE_H
@@ -23,7 +23,9 @@
 #include <AACE/Alexa/FeatureDiscovery.h>
 #include <AACE/Engine/Core/EngineService.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
+#include <AACE/Engine/PropertyManager/PropertyListenerInterface.h>
 #include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
 #include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
@@ -33,6 +35,7 @@ namespace alexa {
 
 class FeatureDiscoveryEngineImpl
         : public aace::alexa::FeatureDiscoveryEngineInterface
+        , public aace::engine::propertyManager::PropertyListenerInterface
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<FeatureDiscoveryEngineImpl> {
 private:
@@ -51,17 +54,26 @@ private:
     bool initialize(std::shared_ptr<aace::engine::core::EngineContext> engineContext);
     void executeOnGetFeatures(const std::string& requestId, const std::string& discoveryRequests);
 
+    /// Requests features from the cloud. Returns the serialized JSON array of features, or an empty string.
+    std::string fetchFeatures(const std::string& queryString, const std::string& locale);
+
 public:
     bool onGetFeatures(const std::string& requestId, const std::string& discoveryRequests) override;
 
+    /// @name PropertyListenerInterface Functions
+    /// @{
+    void propertyChanged(const std::string& name, const std::string& newValue) override;
+    /// @}
+
 private:
     std::weak_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> m_propertyManager;
     std::shared_ptr<aace::alexa::FeatureDiscovery> m_featureDiscoveryPlatformInterface;
     std::shared_ptr<aace::engine::alexa::FeatureDiscoveryRESTAgent> m_featureDiscoveryRESTAgent;
+    std::shared_ptr<aace::engine::alexa::FeatureDiscoveryCache> m_featureDiscoveryCache;
     std::weak_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
     std::string m_tag;
     std::unordered_set<std::string> m_validCombinations;
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"FeatureDiscovery"};
 };
 
 }  // namespace alexa
@@ -20,14 +20,12 @@
 #include <queue>
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpDelete.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
 #include <AVSCommon/Utils/DeviceInfo.h>
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
 #include <AACE/Alexa/AlexaEngineInterfaces.h>
 #include "AACE/Engine/Utils/JSON/JSON.h"
 
@@ -40,7 +38,9 @@ private:
     FeatureDiscoveryRESTAgent(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate);
 
-    bool initialize(std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+    bool initialize(
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<HttpClientInterface> httpClient);
 
 public:
     struct LocalizedFeature {
@@ -50,9 +50,17 @@ public:
 
     using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
 
+    /**
+     * Creates an instance of @c FeatureDiscoveryRESTAgent.
+     *
+     * @param authDelegate The @c AuthDelegateInterface used to get the access token.
+     * @param alexaEndpoints The @c AlexaEndpointInterface used to get the feature discovery endpoint.
+     * @param httpClient The shared engine @c HttpClientInterface. A private pool is created if @c nullptr.
+     */
     static std::shared_ptr<FeatureDiscoveryRESTAgent> create(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<HttpClientInterface> httpClient = nullptr);
 
     virtual ~FeatureDiscoveryRESTAgent() = default;
 
@@ -72,6 +80,7 @@ private:
 
     HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers);
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
+    std::shared_ptr<HttpClientInterface> m_httpClient;
     std::string m_featureDiscoveryEndpoint;
 };
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_HTTP_CLIENT_INTERFACE_H
+#define AACE_ENGINE_ALEXA_HTTP_CLIENT_INTERFACE_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Engine-wide HTTP client shared by the REST agents of the engine modules.
+ * Implementations are expected to reuse connections between calls, so callers should
+ * not cache their own curl handles. The interface is registered by the Alexa engine
+ * service and can be retrieved with @c getServiceInterface<HttpClientInterface>("aace.alexa").
+ */
+class HttpClientInterface {
+public:
+    using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
+
+    virtual ~HttpClientInterface();
+
+    /**
+     * Performs a blocking HTTP GET request.
+     *
+     * @param url The request URL.
+     * @param headers The HTTP header lines to send with the request.
+     * @param timeout The transfer timeout.
+     * @return The @c HTTPResponse. The response code is @c HTTP_RESPONSE_CODE_UNDEFINED if the request failed.
+     */
+    virtual HTTPResponse doGet(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout) = 0;
+
+    /**
+     * Performs a blocking HTTP POST request.
+     *
+     * @param url The request URL.
+     * @param headers The HTTP header lines to send with the request.
+     * @param data The request body.
+     * @param timeout The transfer timeout.
+     * @return The @c HTTPResponse. The response code is @c HTTP_RESPONSE_CODE_UNDEFINED if the request failed.
+     */
+    virtual HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) = 0;
+
+    /**
+     * Performs a blocking HTTP PUT request.
+     *
+     * @param url The request URL.
+     * @param headers The HTTP header lines to send with the request.
+     * @param data The request body.
+     * @param timeout The transfer timeout.
+     * @return The @c HTTPResponse. The response code is @c HTTP_RESPONSE_CODE_UNDEFINED if the request failed.
+     */
+    virtual HTTPResponse doPut(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) = 0;
+
+    /**
+     * Performs a blocking HTTP DELETE request.
+     *
+     * @param url The request URL.
+     * @param headers The HTTP header lines to send with the request.
+     * @param timeout The transfer timeout.
+     * @return The @c HTTPResponse. The response code is @c HTTP_RESPONSE_CODE_UNDEFINED if the request failed.
+     */
+    virtual HTTPResponse doDelete(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout) = 0;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_HTTP_CLIENT_INTERFACE_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
+#define AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+
+#include "HttpClientInterface.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * @c HttpClientInterface implementation that runs the requests of all REST agents on one curl multi handle.
+ *
+ * The multi handle keeps a bounded cache of open connections, so subsequent requests to the same host skip DNS
+ * resolution, TCP connect and the TLS handshake. When a server negotiates HTTP/2, concurrent requests to that host
+ * are multiplexed as streams over a single connection. Otherwise each concurrent request uses its own HTTP/1.1
+ * keep-alive connection. DNS results and TLS sessions are additionally shared through a curl share handle, so they
+ * outlive the connections. The transfers are driven by the pool's transfer thread while the callers block.
+ *
+ * Every request resets its curl easy handle, which re-applies the latest curl options configured in libcurlUtils
+ * (network interface, proxy headers), and @c invalidate() closes the open connections when the network changes.
+ */
+class HttpClientPool : public HttpClientInterface {
+public:
+    /// Pool configuration.
+    struct Config {
+        /**
+         * Maximum number of concurrent requests to a single host. Additional callers wait for one of them to
+         * complete. With HTTP/1.1 this is also the maximum number of connections to the host.
+         */
+        size_t maxConnectionsPerHost = 4;
+
+        /// Maximum number of idle connections kept open across all hosts, and of idle curl handles kept for reuse.
+        size_t maxIdleConnections = 8;
+
+        /// Time a resolved host name is kept in the shared DNS cache.
+        std::chrono::seconds dnsCacheTimeout = std::chrono::seconds(300);
+
+        /// Negotiate HTTP/2 over TLS when the server supports it, and multiplex concurrent requests to a host.
+        bool http2Enabled = true;
+    };
+
+    /**
+     * Creates an instance of @c HttpClientPool with the default configuration.
+     *
+     * @return A new instance of @c HttpClientPool on success, @c nullptr otherwise.
+     */
+    static std::shared_ptr<HttpClientPool> create();
+
+    /**
+     * Creates an instance of @c HttpClientPool.
+     *
+     * @param config The pool configuration.
+     * @return A new instance of @c HttpClientPool on success, @c nullptr otherwise.
+     */
+    static std::shared_ptr<HttpClientPool> create(const Config& config);
+
+    ~HttpClientPool();
+
+    /**
+     * Closes all open connections. Requests that are in flight complete normally, and requests made in the meantime
+     * wait for them before they open new connections. Called when the network interface or the proxy changes.
+     */
+    void invalidate();
+
+    /**
+     * Closes all connections, fails the requests in flight and fails any subsequent request.
+     */
+    void shutdown();
+
+    /**
+     * Gets the number of idle curl handles currently held by the pool.
+     */
+    size_t getIdleHandleCount();
+
+    /// @name HttpClientInterface
+    /// @{
+    HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override;
+    HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) override;
+    HTTPResponse doPut(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) override;
+    HTTPResponse doDelete(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout) override;
+    /// @}
+
+private:
+    using CurlEasyHandleWrapper = alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper;
+
+    /// A request handed to the transfer thread.
+    struct Transfer {
+        /// The prepared curl easy handle of the request.
+        CURL* handle;
+
+        /// Set by the transfer thread to the result of the transfer.
+        std::promise<CURLcode> result;
+    };
+
+    enum class Method { GET, POST, PUT, DELETE };
+
+    HttpClientPool(const Config& config);
+
+    bool initialize();
+
+    HTTPResponse doRequest(
+        Method method,
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout);
+
+    std::unique_ptr<CurlEasyHandleWrapper> acquire(const std::string& host);
+    void release(const std::string& host, std::unique_ptr<CurlEasyHandleWrapper> handle);
+    bool prepareHandle(CurlEasyHandleWrapper& handle);
+    CURLcode perform(CURL* handle);
+    CURLM* createMultiHandle();
+    void runTransfers();
+
+    static std::string getHostKey(const std::string& url);
+    static size_t writeCallback(char* data, size_t size, size_t nmemb, void* userData);
+    static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData);
+    static void unlockShare(CURL* handle, curl_lock_data data, void* userData);
+
+private:
+    /// The pool configuration.
+    const Config m_config;
+
+    /// Curl share handle for the DNS cache and TLS session ids.
+    CURLSH* m_share;
+
+    /// Locks guarding the data shared through @c m_share, indexed by @c curl_lock_data.
+    std::mutex m_shareMutexes[CURL_LOCK_DATA_LAST];
+
+    /// Number of requests in flight per host key ("scheme://host:port").
+    std::unordered_map<std::string, size_t> m_activeRequests;
+
+    /// Idle curl easy handles, reused by subsequent requests to any host.
+    std::vector<std::unique_ptr<CurlEasyHandleWrapper>> m_idleHandles;
+
+    /// Serializes access to the request counts and the idle handles.
+    std::mutex m_mutex;
+
+    /// Notified when a request to a host completes.
+    std::condition_variable m_released;
+
+    /// The curl multi handle that runs the transfers and caches the open connections.
+    CURLM* m_multi;
+
+    /// Transfers waiting to be added to @c m_multi by the transfer thread.
+    std::vector<Transfer*> m_pendingTransfers;
+
+    /// Set by @c invalidate() until the transfer thread has replaced @c m_multi and its connections.
+    bool m_invalidated;
+
+    /// Serializes access to @c m_multi outside the transfer thread, the pending transfers and @c m_invalidated.
+    std::mutex m_transferMutex;
+
+    /// The thread that drives @c m_multi.
+    std::thread m_transferThread;
+
+    /// Set when the pool has been shut down.
+    std::atomic<bool> m_isShuttingDown;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
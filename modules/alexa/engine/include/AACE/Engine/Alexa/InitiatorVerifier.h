@@ -21,6 +21,7 @@
 #include <chrono>
 
 #include <AVSCommon/AVS/AgentInitiator.h>
+#include <AVSCommon/AVS/AudioInputStream.h>
 
 namespace aace {
 namespace engine {
@@ -40,6 +41,24 @@ public:
      */
     virtual bool shouldBlock(const std::string& wakeword, const std::chrono::milliseconds& timeout);
 
+    /**
+     * Function used to verify if the detected wakeword should be blocked, with access to the audio that
+     * contained the wakeword. The default implementation ignores the audio and calls
+     * @c shouldBlock(wakeword,timeout).
+     * @param wakeword The wakeword being detected
+     * @param stream The audio stream in which the wakeword was detected
+     * @param beginIndex The stream index of the beginning of the wakeword
+     * @param endIndex The stream index of the end of the wakeword
+     * @param timeout The timeout for the verification
+     * @return Returns @c true if the wakeword should be blocked, @c false otherwise
+     */
+    virtual bool shouldBlock(
+        const std::string& wakeword,
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+        const std::chrono::milliseconds& timeout);
+
     /**
      * Function used to verify if the initiator should be blocked.
      * @param initiator The initiator being used
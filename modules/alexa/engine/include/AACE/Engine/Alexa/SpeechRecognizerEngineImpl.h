@@ -59,6 +59,7 @@
 #include "AACE/Engine/Wakeword/WakewordManagerDelegateInterface.h"
 #include <AACE/Alexa/AlexaClient.h>
 
+#include "AudioInputStreamManager.h"
 #include "InitiatorVerifier.h"
 #include "WakewordEngineAdapter.h"
 #include "WakewordObserverInterface.h"
@@ -87,7 +88,7 @@ private:
         const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat);
 
     bool initialize(
-        std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+        std::shared_ptr<AudioInputStreamManager> audioInputStreamManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
             capabilitiesRegistrar,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> directiveSequencer,
@@ -119,7 +120,7 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
             capabilitiesRegistrar,
         const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
-        std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+        std::shared_ptr<AudioInputStreamManager> audioInputStreamManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> directiveSequencer,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
@@ -241,43 +242,27 @@ private:
             alexaClientSDK::capabilityAgents::aip::AudioInputProcessor::INVALID_INDEX,
         const std::string& keyword = "");
 
-    bool initializeAudioInputStream();
-
     /**
-     * Blocks up to the specified @a duration until the @ SpeechRecognizerEngineImpl expecting audio state
-     * transitions to the caller's expected state.
+     * Returns whether the SpeechRecognizerEngineImpl is currently capturing audio into the voice capture ring.
      * Do not call this function on a thread holding @c m_expectingAudioMutex.
-     *
-     * @param expectingAudio Whether to expect audio. 
-     *        @c true to wait for @ SpeechRecognizerEngineImpl to be expecting audio from the open audio input channel,
-     *        else @c false to wait for @ SpeechRecognizerEngineImpl to stop expecting audio.
-     * @param duration The duration to wait in seconds.
-     * @return @c true if @a expectingAudio state was reached within @a duration, else @c false
-     */
-    bool waitForExpectingAudioState(bool expectingAudio, const std::chrono::seconds duration = std::chrono::seconds(3));
-
-    /**
-     * Returns whether the SpeechRecognizerEngineImpl is currently expecting audio to be delivered from an input
-     * channel via a call to @c write. Do not call this function on a thread holding @c m_expectingAudioMutex.
      */
     bool isExpectingAudio();
     /**
-     * Returns whether the SpeechRecognizerEngineImpl is currently expecting audio to be delivered from an input
-     * channel via a call to @c write. Only call this function on a thread holding @c m_expectingAudioMutex.
+     * Returns whether the SpeechRecognizerEngineImpl is currently capturing audio into the voice capture ring.
+     * Only call this function on a thread holding @c m_expectingAudioMutex.
      */
     bool isExpectingAudioLocked();
 
     /**
-     * Gets the current audio input channel ID.
+     * Gets the current audio capture ID.
      * Do not call this function on a thread holding @c m_expectingAudioMutex.
      * 
-     * @return @c m_currentChannelId
+     * @return @c m_currentCaptureId
      */
-    aace::engine::audio::AudioInputChannelInterface::ChannelId getCurrentChannelId();
+    AudioInputStreamManager::CaptureId getCurrentCaptureId();
 
     bool startAudioInput();
     bool stopAudioInput();
-    ssize_t write(const int16_t* data, const size_t size);
 
     bool m_wakeWordAdapterEnabled = false;
     bool enable3PWakewordAdapter();
@@ -312,23 +297,19 @@ private:
     std::shared_ptr<alexaClientSDK::capabilityAgents::aip::AudioInputProcessor> m_audioInputProcessor;
 
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    /// The shared capture ring of the @c VOICE audio input type.
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> m_audioInputStream;
-    std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
 
-    std::shared_ptr<aace::engine::audio::AudioInputChannelInterface> m_audioInputChannel;
+    std::shared_ptr<AudioInputStreamManager> m_audioInputStreamManager;
     /**
-     * The current audio input channel ID. Access is serialized by @c m_expectingAudioMutex.
+     * The current audio capture ID. Access is serialized by @c m_expectingAudioMutex.
      */
-    aace::engine::audio::AudioInputChannelInterface::ChannelId m_currentChannelId =
-        aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+    AudioInputStreamManager::CaptureId m_currentCaptureId = AudioInputStreamManager::INVALID_CAPTURE;
     /**
-     * Mutex to serialize access to the expecting audio condition, i.e. @c m_currentChannelId and any functions changing
+     * Mutex to serialize access to the expecting audio condition, i.e. @c m_currentCaptureId and any functions changing
      * the condition.
      */
     std::mutex m_expectingAudioMutex;
-    std::condition_variable m_expectingAudioState_cv;
-
-    unsigned int m_wordSize;
 
     std::shared_ptr<aace::engine::alexa::WakewordEngineAdapter> m_wakewordEngineAdapter;
     bool m_wakewordEnabled = false;
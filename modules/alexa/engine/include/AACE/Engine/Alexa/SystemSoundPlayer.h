@@ -16,13 +16,18 @@
 #ifndef AACE_ENGINE_ALEXA_SYSTEM_SOUND_PLAYER_H
 #define AACE_ENGINE_ALEXA_SYSTEM_SOUND_PLAYER_H
 
+#include <deque>
 #include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <AVSCommon/SDKInterfaces/Audio/SystemSoundAudioFactoryInterface.h>
 #include <AVSCommon/SDKInterfaces/SystemSoundPlayerInterface.h>
 
 #include <AACE/Engine/Audio/AudioManagerInterface.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
 #include <AACE/Audio/AudioEngineInterfaces.h>
 #include <AACE/Audio/AudioFormat.h>
 
@@ -30,11 +35,31 @@ namespace aace {
 namespace engine {
 namespace alexa {
 
+/**
+ * Plays the system tones on the @c EARCON audio output channel. Every tone is read into memory when the player is
+ * created, so a tone starts without reading its resource, and the channel is opened by @c warmUp() before the first
+ * tone is needed.
+ *
+ * The channel plays one tone at a time. A tone requested while another tone is playing is queued and played after
+ * it. A request for a tone that is already waiting in the queue shares the result of that request, and a request
+ * fails if @c MAX_QUEUED_TONES tones are already waiting.
+ */
 class SystemSoundPlayer
         : public aace::audio::AudioOutputEngineInterface
         , public alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface
         , public std::enable_shared_from_this<SystemSoundPlayer> {
+public:
+    /// The maximum number of tones waiting to play after the current tone.
+    static constexpr size_t MAX_QUEUED_TONES = 2;
+
 private:
+    /// A request to play a tone.
+    struct ToneRequest {
+        Tone tone;
+        std::promise<bool> promise;
+        std::shared_future<bool> future;
+    };
+
     SystemSoundPlayer() = default;
 
     bool initialize(
@@ -44,12 +69,26 @@ private:
 
     std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> getAudioChannel();
 
+    /// Prepares and plays the tone of a request on the audio channel.
+    void startTone(std::shared_ptr<ToneRequest> request);
+
+    /// Completes the request that is playing and starts the next queued request.
+    void finishTone(std::shared_ptr<ToneRequest> request, bool result);
+
 public:
     static std::shared_ptr<SystemSoundPlayer> create(
         std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface>
             audioFactory);
 
+    /**
+     * Opens the audio output channel, so that the first tone does not wait for it. This should be called once the
+     * platform audio outputs are registered. If it is not called, the channel is opened by the first tone.
+     *
+     * @return @c true if the channel is open, else @c false.
+     */
+    bool warmUp();
+
     // aace::audio::AudioOutputEngineInterface
     void onMediaStateChanged(MediaState state) override;
     void onMediaError(MediaError error, const std::string& description) override;
@@ -61,11 +100,25 @@ public:
 private:
     std::weak_ptr<aace::engine::audio::AudioManagerInterface> m_audioManager;
     std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> m_audioOutputChannel;
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> m_audioFactory;
 
-    std::shared_future<bool> m_sharedFuture;
-    std::promise<bool> m_playTonePromise;
+    /// The audio of each tone, read from the audio factory.
+    std::map<Tone, std::pair<std::shared_ptr<const std::string>, alexaClientSDK::avsCommon::utils::MediaType>>
+        m_tones;
+
+    /// The request whose tone is playing.
+    std::shared_ptr<ToneRequest> m_currentTone;
+
+    /// The requests waiting for the current tone to finish.
+    std::deque<std::shared_ptr<ToneRequest>> m_queuedTones;
+
+    /// Serializes access to the requests.
     std::mutex m_mutex;
+
+    /// Serializes calls to the audio channel.
+    std::mutex m_channelMutex;
+
+    /// Starts queued tones when the previous tone finishes.
+    aace::engine::utils::threading::Executor m_executor{"SystemSoundPlayer"};
 };
 
 //
@@ -75,23 +128,34 @@ private:
 class SystemSoundAudioStream : public aace::audio::AudioStream {
 private:
     SystemSoundAudioStream(
-        std::shared_ptr<std::istream> stream,
+        std::shared_ptr<const std::string> data,
         alexaClientSDK::avsCommon::utils::MediaType mediaType,
         alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone);
 
 public:
+    /**
+     * Creates a stream that reads a tone from memory.
+     *
+     * @param data The audio of the tone.
+     * @param mediaType The media type of @c data.
+     * @param tone The tone.
+     */
     static std::shared_ptr<SystemSoundAudioStream> create(
-        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> audioFactory,
+        std::shared_ptr<const std::string> data,
+        alexaClientSDK::avsCommon::utils::MediaType mediaType,
         alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone);
 
     // aace::audio::AudioStream
     ssize_t read(char* data, const size_t size) override;
     bool isClosed() override;
+    MediaType getMediaType() override;
     std::vector<aace::audio::AudioStreamProperty> getProperties() override;
 
 private:
-    std::shared_ptr<std::istream> m_stream;
+    std::shared_ptr<const std::string> m_data;
+    alexaClientSDK::avsCommon::utils::MediaType m_mediaType;
     alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone m_tone;
+    size_t m_offset;
     bool m_closed;
 };
 
@@ -293,6 +293,13 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
             registerServiceInterface<aace::engine::metrics::MetricsEmissionInterface>(m_authorizationManager),
             "registerMetricsEmissionInterfaceFailed");
 
+        // Create the shared HTTP client - Keeps connections to the REST endpoints used by the engine modules alive
+        // between requests
+        m_httpClientPool = HttpClientPool::create(m_httpClientConfig);
+        ThrowIfNull(m_httpClientPool, "createHttpClientPoolFailed");
+        ThrowIfNot(
+            registerServiceInterface<HttpClientInterface>(m_httpClientPool), "registerHttpClientInterfaceFailed");
+
         // Create the HTTP put delegate - Creates an HTTPPut handler instance on each put
         m_httpPutDelegate = std::shared_ptr<HttpPutDelegate>(new HttpPutDelegate());
         ThrowIfNull(m_httpPutDelegate, "couldNotCreateHttpPutDelegate");
@@ -394,6 +401,11 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
         m_systemSoundPlayer = SystemSoundPlayer::create(audioManager, m_audioFactory->systemSounds());
         ThrowIfNull(m_systemSoundPlayer, "createSystemSoundPlayerFailed");
 
+        // Create the capture rings shared by the audio input consumers
+        m_audioInputStreamManager = AudioInputStreamManager::create(
+            audioManager, m_audioFormat, m_audioInputBufferDuration, m_audioInputMaxReaders);
+        ThrowIfNull(m_audioInputStreamManager, "createAudioInputStreamManagerFailed");
+
         m_captionManager = nullptr;
         m_captionPresenterHandler = nullptr;
 #ifdef AAC_CAPTIONS
@@ -539,6 +551,27 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
             }
         }
 
+        if (alexaConfigRoot.HasMember("httpClient") && alexaConfigRoot["httpClient"].IsObject()) {
+            auto httpClient = alexaConfigRoot["httpClient"].GetObject();
+
+            if (httpClient.HasMember("maxConnectionsPerHost") && httpClient["maxConnectionsPerHost"].IsUint() &&
+                httpClient["maxConnectionsPerHost"].GetUint() > 0) {
+                m_httpClientConfig.maxConnectionsPerHost = httpClient["maxConnectionsPerHost"].GetUint();
+            }
+
+            if (httpClient.HasMember("maxIdleConnections") && httpClient["maxIdleConnections"].IsUint()) {
+                m_httpClientConfig.maxIdleConnections = httpClient["maxIdleConnections"].GetUint();
+            }
+
+            if (httpClient.HasMember("dnsCacheTimeout") && httpClient["dnsCacheTimeout"].IsUint()) {
+                m_httpClientConfig.dnsCacheTimeout = std::chrono::seconds(httpClient["dnsCacheTimeout"].GetUint());
+            }
+
+            if (httpClient.HasMember("http2Enabled") && httpClient["http2Enabled"].IsBool()) {
+                m_httpClientConfig.http2Enabled = httpClient["http2Enabled"].GetBool();
+            }
+        }
+
         if (alexaConfigRoot.HasMember("externalMediaPlayer") && alexaConfigRoot["externalMediaPlayer"].IsObject()) {
             auto externalMediaPlayer = alexaConfigRoot["externalMediaPlayer"].GetObject();
 
@@ -742,6 +775,15 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
 
         if (alexaConfigRoot.HasMember("audio") && alexaConfigRoot["audio"].IsObject()) {
             auto audio = alexaConfigRoot["audio"].GetObject();
+            if (audio.HasMember("audioInput") && audio["audioInput"].IsObject()) {
+                auto audioInput = audio["audioInput"].GetObject();
+                if (audioInput.HasMember("bufferDuration") && audioInput["bufferDuration"].IsUint()) {
+                    m_audioInputBufferDuration = std::chrono::seconds(audioInput["bufferDuration"].GetUint());
+                }
+                if (audioInput.HasMember("maxReaders") && audioInput["maxReaders"].IsUint()) {
+                    m_audioInputMaxReaders = audioInput["maxReaders"].GetUint();
+                }
+            }
             if (audio.HasMember("audioOutputType.music") && audio["audioOutputType.music"].IsObject()) {
                 auto audioOutMusic = audio["audioOutputType.music"].GetObject();
                 if (audioOutMusic.HasMember("ducking") && audioOutMusic["ducking"].IsObject()) {
@@ -1251,6 +1293,11 @@ bool AlexaEngineService::engineStarted() {
             m_authProviderEngineImpl->startAuthorization();
         }
 
+        // open the system sound channel now, so that the wakeword tone does not wait for it
+        if (m_systemSoundPlayer != nullptr && !m_systemSoundPlayer->warmUp()) {
+            AACE_WARN(LX(TAG, "engineStarted").m("systemSoundPlayerWarmUpFailed"));
+        }
+
         // enable speech recognizer wakeword if enabled by engine/platform implementations
         if (m_speechRecognizerEngineImpl != nullptr && m_speechRecognizerEngineImpl->isWakewordEnabled()) {
             AACE_DEBUG(LX(TAG).d("isWakewordEnabled", m_speechRecognizerEngineImpl->isWakewordEnabled()));
@@ -1305,6 +1352,11 @@ bool AlexaEngineService::shutdown() {
             m_alexaAuthorizationProvider.reset();
         }
 
+        if (m_httpClientPool != nullptr) {
+            AACE_DEBUG(LX(TAG, "shutdown").m("HttpClientPool"));
+            m_httpClientPool->shutdown();
+        }
+
         if (m_authorizationManager != nullptr) {
             AACE_DEBUG(LX(TAG, "shutdown").m("AuthorizationManager"));
             m_authorizationManager->removeAuthObserver(m_alexaClientEngineImpl);
@@ -1368,6 +1420,12 @@ bool AlexaEngineService::shutdown() {
             m_speechRecognizerEngineImpl.reset();
         }
 
+        if (m_audioInputStreamManager != nullptr) {
+            AACE_DEBUG(LX(TAG, "shutdown").m("AudioInputStreamManager"));
+            m_audioInputStreamManager->shutdown();
+            m_audioInputStreamManager.reset();
+        }
+
         if (m_localeAssetManager != nullptr) {
             AACE_DEBUG(LX(TAG, "shutdown").m("LocaleAssetsManager"));
             m_localeAssetManager->shutdown();
@@ -2069,6 +2127,10 @@ void AlexaEngineService::onNetworkInterfaceChangeStatusChanged(
                 if (currentNetworkInterface != networkInterface) {
                     alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper::setInterfaceName(
                         networkInterface);
+                    // pooled connections are bound to the previous interface
+                    if (m_httpClientPool != nullptr) {
+                        m_httpClientPool->invalidate();
+                    }
                 }
             } else if (NetworkInfoObserver::NetworkInterfaceChangeStatus::COMPLETED == status) {
                 // Enable the AVS connection if it was previously disabled at the begin of
@@ -2090,6 +2152,9 @@ void AlexaEngineService::onNetworkProxyHeadersAvailable(const std::vector<std::s
 
         if (isRunning()) {
             alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper::setProxyHeaders(headers);
+            if (m_httpClientPool != nullptr) {
+                m_httpClientPool->invalidate();
+            }
         }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -2153,10 +2218,6 @@ bool AlexaEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_speechRecognizerEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        // get the audio manager interface
-        auto audioManager = getContext()->getServiceInterface<aace::engine::audio::AudioManagerInterface>("aace.audio");
-        ThrowIfNull(audioManager, "invalidAudioManager");
-
         // create the alexa speech recognizer engine implementation
         std::shared_ptr<alexaClientSDK::speechencoder::SpeechEncoder> speechEncoder = nullptr;
         std::shared_ptr<alexaClientSDK::speechencoder::EncoderContext> encoderCtx = nullptr;
@@ -2195,7 +2256,7 @@ bool AlexaEngineService::registerPlatformInterfaceType(
             speechRecognizer,
             m_defaultEndpointBuilder,
             m_audioFormat,
-            audioManager,
+            m_audioInputStreamManager,
             m_directiveSequencer,
             m_connectionManager,
             m_contextManager,
@@ -2810,6 +2871,10 @@ std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> Alex
     return m_agentManager;
 }
 
+std::shared_ptr<AudioInputStreamManager> AlexaEngineService::getAudioInputStreamManager() {
+    return m_audioInputStreamManager;
+}
+
 //
 // AlexaEndpointInterface
 //
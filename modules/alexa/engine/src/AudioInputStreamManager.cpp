@@ -0,0 +1,205 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <climits>
+
+#include "AACE/Engine/Alexa/AudioInputStreamManager.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.AudioInputStreamManager");
+
+using AudioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream;
+
+constexpr AudioInputStreamManager::CaptureId AudioInputStreamManager::INVALID_CAPTURE;
+constexpr std::chrono::seconds AudioInputStreamManager::DEFAULT_BUFFER_DURATION;
+constexpr size_t AudioInputStreamManager::DEFAULT_MAX_READERS;
+
+AudioInputStreamManager::AudioInputStreamManager(
+    std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    std::chrono::seconds bufferDuration,
+    size_t maxReaders) :
+        m_audioManager(audioManager),
+        m_audioFormat(audioFormat),
+        m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT),
+        m_bufferDuration(bufferDuration),
+        m_maxReaders(maxReaders) {
+}
+
+std::shared_ptr<AudioInputStreamManager> AudioInputStreamManager::create(
+    std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    std::chrono::seconds bufferDuration,
+    size_t maxReaders) {
+    try {
+        ThrowIfNull(audioManager, "invalidAudioManager");
+        ThrowIf(bufferDuration.count() <= 0, "invalidBufferDuration");
+        ThrowIf(maxReaders == 0, "invalidMaxReaders");
+
+        return std::shared_ptr<AudioInputStreamManager>(
+            new AudioInputStreamManager(audioManager, audioFormat, bufferDuration, maxReaders));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<AudioInputStreamManager::CaptureRing> AudioInputStreamManager::getCaptureRingLocked(
+    AudioInputType type,
+    const std::string& name) {
+    try {
+        auto it = m_captureRings.find(type);
+        ReturnIf(it != m_captureRings.end(), it->second);
+
+        auto audioManager = m_audioManager.lock();
+        ThrowIfNull(audioManager, "invalidAudioManager");
+
+        auto captureRing = std::make_shared<CaptureRing>();
+        captureRing->channel = audioManager->openAudioInputChannel(name, type);
+        ThrowIfNull(captureRing->channel, "invalidAudioInputChannel");
+
+        size_t size = AudioInputStream::calculateBufferSize(
+            m_audioFormat.sampleRateHz * m_bufferDuration.count(), m_wordSize, m_maxReaders);
+        auto buffer = std::make_shared<AudioInputStream::Buffer>(size);
+        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
+
+        captureRing->stream = AudioInputStream::create(buffer, m_wordSize, m_maxReaders);
+        ThrowIfNull(captureRing->stream, "couldNotCreateAudioInputStream");
+
+        // the ring has a single writer, fed by the audio input channel
+        captureRing->writer = captureRing->stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+        ThrowIfNull(captureRing->writer, "couldNotCreateAudioInputWriter");
+
+        m_captureRings[type] = captureRing;
+
+        AACE_INFO(LX(TAG).d("type", type).d("name", name).d("bufferSize", size).d("maxReaders", m_maxReaders));
+
+        return captureRing;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "getCaptureRingLocked").d("reason", ex.what()).d("type", type));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<AudioInputStream> AudioInputStreamManager::getAudioInputStream(
+    AudioInputType type,
+    const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto captureRing = getCaptureRingLocked(type, name);
+    return captureRing != nullptr ? captureRing->stream : nullptr;
+}
+
+AudioInputStreamManager::CaptureId AudioInputStreamManager::startCapture(AudioInputType type) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_captureRings.find(type);
+        ThrowIf(it == m_captureRings.end(), "audioInputStreamNotCreated");
+        auto captureRing = it->second;
+
+        // start the audio input channel for the first capture of the type
+        if (captureRing->captures.empty()) {
+            std::weak_ptr<CaptureRing> wp = captureRing;
+            captureRing->channelId = captureRing->channel->start([wp](const int16_t* data, const size_t size) {
+                if (auto sp = wp.lock()) {
+                    if (sp->writer->write(data, size) < 0) {
+                        AACE_ERROR(LX(TAG, "write").d("reason", "errorWritingData"));
+                    }
+                }
+            });
+            ThrowIf(
+                captureRing->channelId == aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL,
+                "audioInputChannelStartFailed");
+        }
+
+        auto id = m_nextCaptureId++;
+        captureRing->captures.insert(id);
+
+        return id;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "startCapture").d("reason", ex.what()).d("type", type));
+        return INVALID_CAPTURE;
+    }
+}
+
+bool AudioInputStreamManager::stopCapture(AudioInputType type, CaptureId id) {
+    try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_captureRings.find(type);
+        ThrowIf(it == m_captureRings.end(), "audioInputStreamNotCreated");
+        auto captureRing = it->second;
+
+        ThrowIf(captureRing->captures.erase(id) == 0, "invalidCaptureId");
+
+        // stop the audio input channel when the last capture of the type stops
+        if (captureRing->captures.empty()) {
+            captureRing->channel->stop(captureRing->channelId);
+            captureRing->channelId = aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "stopCapture").d("reason", ex.what()).d("type", type).d("id", id));
+        return false;
+    }
+}
+
+std::unique_ptr<AudioInputStream::Reader> AudioInputStreamManager::createReader(
+    AudioInputType type,
+    AudioInputStream::Reader::Policy policy,
+    AudioInputStream::Index index) {
+    try {
+        std::shared_ptr<AudioInputStream> stream;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_captureRings.find(type);
+            ThrowIf(it == m_captureRings.end(), "audioInputStreamNotCreated");
+            stream = it->second->stream;
+        }
+
+        auto reader = stream->createReader(policy);
+        ThrowIfNull(reader, "couldNotCreateReader");
+        ThrowIfNot(reader->seek(index, AudioInputStream::Reader::Reference::ABSOLUTE), "indexNotInBuffer");
+
+        return reader;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "createReader").d("reason", ex.what()).d("type", type).d("index", index));
+        return nullptr;
+    }
+}
+
+void AudioInputStreamManager::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& next : m_captureRings) {
+        auto& captureRing = next.second;
+        if (!captureRing->captures.empty()) {
+            captureRing->channel->stop(captureRing->channelId);
+            captureRing->captures.clear();
+        }
+        captureRing->writer->close();
+        captureRing->channel->doShutdown();
+    }
+    m_captureRings.clear();
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
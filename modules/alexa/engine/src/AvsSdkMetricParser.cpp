@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <istream>
@@ -58,23 +59,20 @@ std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::metrics::MetricEvent> metricEvent) {
     ThrowIfNull(metricEvent, "MetricEvent is null");
     const std::string activityName = metricEvent->getActivityName();
-    bool useAsIs = false;
 
-    for (const std::string& prefix : m_prefixOverrides) {
-        if (activityName.rfind(prefix, 0) == 0) {
-            AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
-            useAsIs = true;
-            break;
-        }
-    }
-    auto sourceItr = m_allowedSources.find(activityName);
-    if (!useAsIs) {
+    // the transformations of the source, or null if the data points are used without changes. A prefix override
+    // takes precedence over the rules of an allowed source.
+    const AvsSdkMetricTransformation* transformations = nullptr;
+    if (hasPrefixOverride(activityName)) {
+        AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
+    } else {
+        auto sourceItr = m_allowedSources.find(activityName);
         if (sourceItr == m_allowedSources.end()) {
             AACE_VERBOSE(LX(TAG).m("Dropping unused metric").d("source", activityName));
             return nullptr;
         }
-        if (sourceItr->second == nullptr) {
-            useAsIs = true;
+        transformations = sourceItr->second.get();
+        if (transformations == nullptr) {
             AACE_VERBOSE(LX(TAG).m("Metric used without changes").d("source", activityName));
         }
     }
@@ -87,69 +85,22 @@ std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     metricBuilder.withAgentId(metricEvent->getMetricContext().agentId);
 
     for (const auto& datapoint : metricEvent->getDataPoints()) {
-        if (datapoint.isValid()) {
-            auto datatype = datapoint.getDataType();
-            auto name = datapoint.getName();
-            auto value = datapoint.getValue();
-
-            if (sourceItr != m_allowedSources.end() && sourceItr->second != nullptr) {
-                bool success = false;
-                AvsSdkMetricTransformation transformations = *(sourceItr->second);
-                auto iter = transformations.namedDataPoints.find(name);
-                bool dpHasNamedTransformation = iter != transformations.namedDataPoints.end();
-                bool hasAllCounterTransformation = !transformations.allCounters.empty();
-                if (dpHasNamedTransformation) {
-                    const DataPointTransformation transform = iter->second;
-                    DataPointTransformType type = transform.first;
-                    const std::vector<std::string>& args = transform.second;
-                    switch (type) {
-                        case DataPointTransformType::INSERT_DIMENSION:
-                            success = insertDimension(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::SWAP_NAME:
-                            success = swapName(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::SPLIT_NAME:
-                            success = splitName(metricBuilder, datapoint, args);
-                            break;
-                        case DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO: {
-                            bool drop = false;
-                            success = dropMetricIfCountZero(metricBuilder, drop, datapoint);
-                            if (drop) {
-                                return nullptr;
-                            }
-                        }
-                        case DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO: {
-                            bool drop = false;
-                            success = swapNameOrDropMetricIfCountZero(metricBuilder, drop, datapoint, args);
-                            if (drop) {
-                                return nullptr;
-                            }
-                        }
-                        default:
-                            continue;
-                    }
-                } else if (
-                    hasAllCounterTransformation &&
-                    datatype == alexaClientSDK::avsCommon::utils::metrics::DataType::DURATION) {
-                    for (const DataPointTransformation& dpt : transformations.allCounters) {
-                        const auto args = dpt.second;
-                        if (dpt.first == DataPointTransformType::RENAME_COUNTERS) {
-                            success = renameCounters(metricBuilder, datapoint, args);
-                        }
-                    }
-                } else {
-                    success = convertWithoutChanges(metricBuilder, datapoint);
-                }
-                if (!success) {
-                    AACE_WARN(LX(TAG).m("Issue transforming data point").d("source", activityName).d("name", name));
-                    continue;
-                }
-            } else {
-                convertWithoutChanges(metricBuilder, datapoint);
-            }
-        } else {
+        if (!datapoint.isValid()) {
             AACE_WARN(LX(TAG).m("Dropping invalid data point"));
+            continue;
+        }
+        if (transformations == nullptr) {
+            convertWithoutChanges(metricBuilder, datapoint);
+            continue;
+        }
+        bool drop = false;
+        bool success = transformDataPoint(metricBuilder, drop, *transformations, datapoint);
+        if (drop) {
+            return nullptr;
+        }
+        if (!success) {
+            AACE_WARN(
+                LX(TAG).m("Issue transforming data point").d("source", activityName).d("name", datapoint.getName()));
         }
     }
     try {
@@ -160,9 +111,104 @@ std::shared_ptr<MetricEvent> AvsSdkMetricParser::convertMetric(
     }
 }
 
+bool AvsSdkMetricParser::transformDataPoint(
+    MetricEventBuilder& builder,
+    bool& drop,
+    const AvsSdkMetricTransformation& transformations,
+    const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp) {
+    auto iter = transformations.namedDataPoints.find(sourceDp.getName());
+    if (iter != transformations.namedDataPoints.end()) {
+        const DataPointTransformation& transformation = iter->second;
+        switch (transformation.type) {
+            case DataPointTransformType::INSERT_DIMENSION:
+                return insertDimension(builder, sourceDp, transformation);
+            case DataPointTransformType::SWAP_NAME:
+                return swapName(builder, sourceDp, transformation);
+            case DataPointTransformType::SPLIT_NAME:
+                return splitName(builder, sourceDp, transformation);
+            case DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO:
+                return dropMetricIfCountZero(builder, drop, sourceDp);
+            case DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO:
+                return swapNameOrDropMetricIfCountZero(builder, drop, sourceDp, transformation);
+            default:
+                return false;
+        }
+    }
+    if (!transformations.allCounters.empty() &&
+        sourceDp.getDataType() == alexaClientSDK::avsCommon::utils::metrics::DataType::DURATION) {
+        bool success = false;
+        for (const DataPointTransformation& transformation : transformations.allCounters) {
+            if (transformation.type == DataPointTransformType::RENAME_COUNTERS) {
+                success = renameCounters(builder, sourceDp, transformation);
+            }
+        }
+        return success;
+    }
+    return convertWithoutChanges(builder, sourceDp);
+}
+
+bool AvsSdkMetricParser::hasPrefixOverride(const std::string& source) const {
+    for (const std::string& prefix : m_prefixOverrides) {
+        if (source.compare(0, prefix.length(), prefix) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+DataPointTransformation AvsSdkMetricParser::compileTransformation(
+    DataPointTransformType type,
+    const std::string& dpName,
+    const std::string& valueName,
+    const std::string& dimensionName,
+    const std::string& delimiter) {
+    DataPointTransformation transformation{type, true, valueName, dimensionName, dpName};
+    switch (type) {
+        case DataPointTransformType::INSERT_DIMENSION:
+            transformation.valid = !dimensionName.empty();
+            break;
+        case DataPointTransformType::SWAP_NAME:
+        case DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO:
+        case DataPointTransformType::RENAME_COUNTERS:
+            transformation.valid = !valueName.empty() && !dimensionName.empty();
+            break;
+        case DataPointTransformType::SPLIT_NAME: {
+            transformation.valid = false;
+            if (delimiter.empty() || valueName.empty() || dimensionName.empty()) {
+                break;
+            }
+            auto pos = dpName.find(delimiter);
+            if (pos == std::string::npos) {
+                AACE_ERROR(LX(TAG)
+                               .m("Could not find delimeter in data point name")
+                               .d("delimeter", delimiter)
+                               .d("name", dpName));
+                return transformation;
+            }
+            transformation.dimensionValue = dpName.substr(pos + delimiter.length());
+            if (transformation.dimensionValue.empty()) {
+                AACE_ERROR(LX(TAG).m("Empty suffix after delimeter").d("delimeter", delimiter).d("name", dpName));
+                return transformation;
+            }
+            transformation.valid = true;
+            break;
+        }
+        case DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO:
+            break;
+    }
+    if (!transformation.valid) {
+        AACE_ERROR(LX(TAG).m("Invalid rules").d("name", dpName));
+    }
+    return transformation;
+}
+
 bool AvsSdkMetricParser::configure() {
+    return configure(AVS_SDK_METRIC_RULES);
+}
+
+bool AvsSdkMetricParser::configure(const std::string& rules) {
     try {
-        std::stringstream stream(AVS_SDK_METRIC_RULES);
+        std::stringstream stream(rules);
         ThrowIfNot(stream.good(), "invalid stream");
         json j = json::parse(stream);
         if (j.contains("prefixOverride")) {
@@ -170,7 +216,9 @@ bool AvsSdkMetricParser::configure() {
             ThrowIfNot(prefixArray.is_array(), "prefixOverride is not an array");
             for (auto& prefixItr : prefixArray.items()) {
                 std::string prefix = prefixItr.value();
-                m_prefixOverrides.emplace(prefix);
+                if (std::find(m_prefixOverrides.begin(), m_prefixOverrides.end(), prefix) == m_prefixOverrides.end()) {
+                    m_prefixOverrides.push_back(prefix);
+                }
                 AACE_VERBOSE(LX(TAG).m("All metrics with prefix used without changes").d("prefix", prefix));
             }
         }
@@ -204,8 +252,7 @@ bool AvsSdkMetricParser::configure() {
                     const std::string asDimension = args[2];
                     transformations->namedDataPoints.emplace(
                         dpName,
-                        std::make_pair(
-                            DataPointTransformType::SWAP_NAME, std::vector<std::string>{asValueOf, asDimension}));
+                        compileTransformation(DataPointTransformType::SWAP_NAME, dpName, asValueOf, asDimension));
                 }
                 if (ruleObject.contains("insertDimension")) {
                     const json args = ruleObject.at("insertDimension");
@@ -213,8 +260,7 @@ bool AvsSdkMetricParser::configure() {
                     const std::string asDimension = args[1];
                     transformations->namedDataPoints.emplace(
                         dpName,
-                        std::make_pair(
-                            DataPointTransformType::INSERT_DIMENSION, std::vector<std::string>{asDimension}));
+                        compileTransformation(DataPointTransformType::INSERT_DIMENSION, dpName, dpName, asDimension));
                 }
                 if (ruleObject.contains("splitName")) {
                     const json args = ruleObject.at("splitName");
@@ -224,16 +270,15 @@ bool AvsSdkMetricParser::configure() {
                     const std::string suffixAsDimension = args[3];
                     transformations->namedDataPoints.emplace(
                         dpName,
-                        std::make_pair(
-                            DataPointTransformType::SPLIT_NAME,
-                            std::vector<std::string>{delimeter, asValueOf, suffixAsDimension}));
+                        compileTransformation(
+                            DataPointTransformType::SPLIT_NAME, dpName, asValueOf, suffixAsDimension, delimeter));
                 }
                 if (ruleObject.contains("renameCounters")) {
                     const json args = ruleObject.at("renameCounters");
                     const std::string newName = args[0];
                     const std::string asValueOf = args[1];
                     transformations->allCounters.push_back(
-                        {DataPointTransformType::RENAME_COUNTERS, std::vector<std::string>{newName, asValueOf}});
+                        compileTransformation(DataPointTransformType::RENAME_COUNTERS, "", newName, asValueOf));
                     continue;
                 }
                 if (ruleObject.contains("dropMetricIfCountZero")) {
@@ -241,7 +286,7 @@ bool AvsSdkMetricParser::configure() {
                     const std::string dpName = args[0];
                     transformations->namedDataPoints.emplace(
                         dpName,
-                        std::make_pair(DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO, std::vector<std::string>{}));
+                        compileTransformation(DataPointTransformType::DROP_METRIC_IF_COUNT_ZERO, dpName, dpName, ""));
                 }
                 if (ruleObject.contains("swapNameOrDropMetricIfCountZero")) {
                     const json args = ruleObject.at("swapNameOrDropMetricIfCountZero");
@@ -250,9 +295,11 @@ bool AvsSdkMetricParser::configure() {
                     const std::string asDimension = args[2];
                     transformations->namedDataPoints.emplace(
                         dpName,
-                        std::make_pair(
+                        compileTransformation(
                             DataPointTransformType::SWAP_NAME_OR_DROP_METRIC_IF_COUNT_ZERO,
-                            std::vector<std::string>{asValueOf, asDimension}));
+                            dpName,
+                            asValueOf,
+                            asDimension));
                 }
             }
             m_allowedSources.emplace(std::make_pair(source, std::move(transformations)));
@@ -269,9 +316,7 @@ bool AvsSdkMetricParser::convertWithoutChanges(
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp) {
     try {
         DataType type = convertDataType(sourceDp.getDataType());
-        auto name = sourceDp.getName();
-        auto value = sourceDp.getValue();
-        builder.addDataPoint(DataPoint(name, value, type));
+        builder.addDataPoint(DataPoint(sourceDp.getName(), sourceDp.getValue(), type));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "convertWithoutChanges failed").d("reason", ex.what()));
@@ -282,19 +327,18 @@ bool AvsSdkMetricParser::convertWithoutChanges(
 bool AvsSdkMetricParser::insertDimension(
     MetricEventBuilder& metricBuilder,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-    const std::vector<std::string>& args) {
+    const DataPointTransformation& transformation) {
     try {
-        const std::string asDimension = args[0];
-        if (asDimension.empty()) {
-            AACE_ERROR(LX(TAG).m("Invalid rules"));
+        if (!transformation.valid) {
             return false;
         }
         DataType type = convertDataType(sourceDp.getDataType());
-        metricBuilder.addDataPoint(DataPoint(sourceDp.getName(), sourceDp.getValue(), type));
-        metricBuilder.addDataPoint(DataPoint(asDimension, sourceDp.getName(), DataType::STRING));
+        metricBuilder.addDataPoint(DataPoint(transformation.valueName, sourceDp.getValue(), type));
+        metricBuilder.addDataPoint(
+            DataPoint(transformation.dimensionName, transformation.dimensionValue, DataType::STRING));
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "configure failed").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "Data point insertDimension failed").d("reason", ex.what()));
         return false;
     }
 }
@@ -302,17 +346,15 @@ bool AvsSdkMetricParser::insertDimension(
 bool AvsSdkMetricParser::swapName(
     MetricEventBuilder& metricBuilder,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-    const std::vector<std::string>& args) {
+    const DataPointTransformation& transformation) {
     try {
-        const std::string asValueOf = args[0];
-        const std::string asDimension = args[1];
-        if (asValueOf.empty() || asDimension.empty()) {
-            AACE_ERROR(LX(TAG).m("Invalid rules for swapName"));
+        if (!transformation.valid) {
             return false;
         }
         DataType type = convertDataType(sourceDp.getDataType());
-        metricBuilder.addDataPoint(DataPoint(asValueOf, sourceDp.getValue(), type));
-        metricBuilder.addDataPoint(DataPoint(asDimension, sourceDp.getName(), DataType::STRING));
+        metricBuilder.addDataPoint(DataPoint(transformation.valueName, sourceDp.getValue(), type));
+        metricBuilder.addDataPoint(
+            DataPoint(transformation.dimensionName, transformation.dimensionValue, DataType::STRING));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "Data point swapName failed").d("reason", ex.what()));
@@ -323,54 +365,36 @@ bool AvsSdkMetricParser::swapName(
 bool AvsSdkMetricParser::splitName(
     MetricEventBuilder& metricBuilder,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-    const std::vector<std::string>& args) {
+    const DataPointTransformation& transformation) {
     try {
-        const std::string delimeter = args[0];
-        const std::string asValueOf = args[1];
-        const std::string suffixAsDimension = args[2];
-        if (delimeter.empty() || asValueOf.empty() || suffixAsDimension.empty()) {
-            AACE_ERROR(LX(TAG).m("Invalid rules for splitName"));
-            return false;
-        }
-        const std::string name = sourceDp.getName();
-        auto pos = name.find(delimeter);
-        if (pos == std::string::npos) {
-            AACE_ERROR(
-                LX(TAG).m("Could not find delimeter in data point name").d("delimeter", delimeter).d("name", name));
-            return false;
-        }
-        std::string suffix = name.substr(pos + delimeter.length());
-        if (suffix.empty()) {
-            AACE_ERROR(LX(TAG).m("Empty suffix after delimeter").d("delimeter", delimeter).d("name", name));
+        if (!transformation.valid) {
             return false;
         }
         DataType type = convertDataType(sourceDp.getDataType());
-        metricBuilder.addDataPoint(DataPoint(asValueOf, sourceDp.getValue(), type));
-        metricBuilder.addDataPoint(DataPoint(suffixAsDimension, suffix, DataType::STRING));
+        metricBuilder.addDataPoint(DataPoint(transformation.valueName, sourceDp.getValue(), type));
+        metricBuilder.addDataPoint(
+            DataPoint(transformation.dimensionName, transformation.dimensionValue, DataType::STRING));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "Data point splitName failed").d("reason", ex.what()));
         return false;
     }
 }
+
 bool AvsSdkMetricParser::renameCounters(
     MetricEventBuilder& metricBuilder,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-    const std::vector<std::string>& args) {
+    const DataPointTransformation& transformation) {
     try {
-        const std::string newName = args[0];
-        const std::string asValueOf = args[1];
-        if (newName.empty() || asValueOf.empty()) {
-            AACE_ERROR(LX(TAG).m("Invalid rules for renameCounters"));
+        if (!transformation.valid) {
             return false;
         }
-        const std::string name = sourceDp.getName();
         DataType type = convertDataType(sourceDp.getDataType());
         if (type != DataType::COUNTER) {
             return false;
         }
-        metricBuilder.addDataPoint(DataPoint(newName, sourceDp.getValue(), type));
-        metricBuilder.addDataPoint(DataPoint(asValueOf, name, DataType::STRING));
+        metricBuilder.addDataPoint(DataPoint(transformation.valueName, sourceDp.getValue(), type));
+        metricBuilder.addDataPoint(DataPoint(transformation.dimensionName, sourceDp.getName(), DataType::STRING));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "Data point renameCounters failed").d("reason", ex.what()));
@@ -383,7 +407,6 @@ bool AvsSdkMetricParser::dropMetricIfCountZero(
     bool& drop,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp) {
     try {
-        const std::string name = sourceDp.getName();
         DataType type = convertDataType(sourceDp.getDataType());
         if (type != DataType::COUNTER) {
             return false;
@@ -395,7 +418,7 @@ bool AvsSdkMetricParser::dropMetricIfCountZero(
             return true;
         }
         drop = false;
-        metricBuilder.addDataPoint(DataPoint(name, val, type));
+        metricBuilder.addDataPoint(DataPoint(sourceDp.getName(), val, type));
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "Data point dropMetricIfCountZero failed").d("reason", ex.what()));
@@ -407,21 +430,19 @@ bool AvsSdkMetricParser::swapNameOrDropMetricIfCountZero(
     MetricEventBuilder& metricBuilder,
     bool& drop,
     const alexaClientSDK::avsCommon::utils::metrics::DataPoint& sourceDp,
-    const std::vector<std::string>& args) {
+    const DataPointTransformation& transformation) {
     try {
-        const std::string name = sourceDp.getName();
         DataType type = convertDataType(sourceDp.getDataType());
         if (type != DataType::COUNTER) {
             return false;
         }
-        const std::string val = sourceDp.getValue();
-        long count = std::stoul(val);
+        long count = std::stoul(sourceDp.getValue());
         if (count == 0) {
             drop = true;
             return true;
         }
         drop = false;
-        return swapName(metricBuilder, sourceDp, args);
+        return swapName(metricBuilder, sourceDp, transformation);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "Data point swapNameOrDropMetricIfCountZero failed").d("reason", ex.what()));
         return false;
@@ -0,0 +1,178 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+using json = nlohmann::json;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.alexa.FeatureDiscoveryCache");
+
+/// The local storage table of the cached entries.
+static const std::string CACHE_TABLE = "aace.alexa.featureDiscovery";
+
+/// The separator of the request parameters in a key.
+static const std::string KEY_SEPARATOR = ",";
+
+/// The expiry of a stored entry, in milliseconds since the epoch.
+static const std::string STORED_EXPIRY = "expiry";
+
+/// The features of a stored entry.
+static const std::string STORED_FEATURES = "features";
+
+constexpr std::chrono::milliseconds FeatureDiscoveryCache::DEFAULT_TIME_TO_LIVE;
+
+std::string FeatureDiscoveryCache::Key::toString() const {
+    return domain + KEY_SEPARATOR + eventType + KEY_SEPARATOR + locale + KEY_SEPARATOR + std::to_string(limit);
+}
+
+FeatureDiscoveryCache::FeatureDiscoveryCache(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    std::chrono::milliseconds timeToLive) :
+        m_localStorage(localStorage), m_timeToLive(timeToLive), m_generation(0) {
+}
+
+std::shared_ptr<FeatureDiscoveryCache> FeatureDiscoveryCache::create(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    std::chrono::milliseconds timeToLive) {
+    try {
+        ThrowIf(timeToLive.count() < 0, "invalidTimeToLive");
+        return std::shared_ptr<FeatureDiscoveryCache>(new FeatureDiscoveryCache(localStorage, timeToLive));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::string FeatureDiscoveryCache::get(const Key& key, const FetchFunction& fetch, bool* cached) {
+    auto name = key.toString();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto features = getCachedLocked(name);
+    if (!features.empty()) {
+        AACE_DEBUG(LX(TAG, "get").m("cacheHit").d("key", name));
+        if (cached != nullptr) {
+            *cached = true;
+        }
+        return features;
+    }
+
+    // share the result of a fetch of the same request that is already in progress
+    auto it = m_fetches.find(name);
+    if (it != m_fetches.end()) {
+        AACE_DEBUG(LX(TAG, "get").m("waitingForFetch").d("key", name));
+        auto fetchResult = it->second;
+        lock.unlock();
+        if (cached != nullptr) {
+            *cached = true;
+        }
+        return fetchResult.get();
+    }
+
+    std::promise<std::string> promise;
+    m_fetches[name] = promise.get_future().share();
+    auto generation = m_generation;
+    lock.unlock();
+
+    try {
+        features = fetch();
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "get").d("reason", ex.what()).d("key", name));
+        features.clear();
+    }
+
+    lock.lock();
+    m_fetches.erase(name);
+    if (!features.empty() && generation == m_generation) {
+        putLocked(name, features);
+    }
+    lock.unlock();
+
+    promise.set_value(features);
+    if (cached != nullptr) {
+        *cached = false;
+    }
+    return features;
+}
+
+void FeatureDiscoveryCache::clear() {
+    AACE_INFO(LX(TAG));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_generation++;
+    if (m_localStorage != nullptr && m_localStorage->containsTable(CACHE_TABLE)) {
+        m_localStorage->removeTable(CACHE_TABLE);
+    }
+}
+
+std::string FeatureDiscoveryCache::getCachedLocked(const std::string& key) {
+    auto now = std::chrono::system_clock::now();
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        // load the entry persisted by a previous Engine instance
+        if (m_localStorage == nullptr || !m_localStorage->containsKey(CACHE_TABLE, key)) {
+            return "";
+        }
+        try {
+            auto stored = json::parse(m_localStorage->get(CACHE_TABLE, key));
+            Entry entry;
+            entry.features = stored.at(STORED_FEATURES).dump();
+            entry.expiry = std::chrono::system_clock::time_point(
+                std::chrono::milliseconds(stored.at(STORED_EXPIRY).get<int64_t>()));
+            it = m_entries.emplace(key, std::move(entry)).first;
+        } catch (std::exception& ex) {
+            AACE_WARN(LX(TAG, "getCachedLocked").d("reason", ex.what()).d("key", key));
+            m_localStorage->removeKey(CACHE_TABLE, key);
+            return "";
+        }
+    }
+
+    if (it->second.expiry <= now) {
+        AACE_DEBUG(LX(TAG, "getCachedLocked").m("entryExpired").d("key", key));
+        m_entries.erase(it);
+        if (m_localStorage != nullptr) {
+            m_localStorage->removeKey(CACHE_TABLE, key);
+        }
+        return "";
+    }
+    return it->second.features;
+}
+
+void FeatureDiscoveryCache::putLocked(const std::string& key, const std::string& features) {
+    auto expiry = std::chrono::system_clock::now() + m_timeToLive;
+    m_entries[key] = {features, expiry};
+    if (m_localStorage == nullptr) {
+        return;
+    }
+    try {
+        json stored = {
+            {STORED_EXPIRY,
+             std::chrono::duration_cast<std::chrono::milliseconds>(expiry.time_since_epoch()).count()},
+            {STORED_FEATURES, json::parse(features)}};
+        ThrowIfNot(m_localStorage->put(CACHE_TABLE, key, stored.dump()), "putFailed");
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG, "putLocked").d("reason", ex.what()).d("key", key));
+    }
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <future>
 
 #include <AACE/Engine/Alexa/FeatureDiscoveryEngineImpl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
@@ -22,6 +25,7 @@
 #include <AACE/Engine/Metrics/DurationDataPointBuilder.h>
 #include <AACE/Engine/Metrics/StringDataPointBuilder.h>
 #include <AACE/Engine/Metrics/MetricEventBuilder.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 #include <AACE/Engine/Utils/Agent/AgentId.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AACE/Engine/Alexa/AlexaComponentInterface.h>
@@ -49,6 +53,9 @@ static const std::string REQUEST_VERSION_TAG_PREFIX = "AUTO_SDK_";
 static const std::string REQUEST_VERSION_TAG_SEPARATOR = "_";
 static const int REQUEST_LIMIT_DEFAULT = 1;
 
+/// The maximum number of requests sent to the cloud at the same time for one @c onGetFeatures() call.
+static const size_t MAX_CONCURRENT_REQUESTS = 4;
+
 // TODO: Temporary Fix For Hinty Issues With 4.2. Please remove once fixed.
 static const int REQUEST_VERSION_FALLBACK_MAJOR = 4;
 static const int REQUEST_VERSION_FALLBACK_MINOR = 1;
@@ -225,9 +232,18 @@ bool FeatureDiscoveryEngineImpl::initialize(std::shared_ptr<aace::engine::core::
         auto authDelegate = alexaComponents->getAuthDelegate();
         ThrowIfNull(authDelegate, "nullAuthDeleteInterface");
 
-        m_featureDiscoveryRESTAgent = FeatureDiscoveryRESTAgent::create(authDelegate, alexaEndpoints);
+        // the shared HTTP client is optional, the REST agent falls back to its own pool
+        auto httpClient = engineContext->getServiceInterface<aace::engine::alexa::HttpClientInterface>("aace.alexa");
+
+        m_featureDiscoveryRESTAgent = FeatureDiscoveryRESTAgent::create(authDelegate, alexaEndpoints, httpClient);
         ThrowIfNull(m_featureDiscoveryRESTAgent, "nullFeatureDiscoveryRESTAgent");
 
+        // discovered features are cached in memory if local storage is not available
+        auto localStorage =
+            engineContext->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+        m_featureDiscoveryCache = FeatureDiscoveryCache::create(localStorage);
+        ThrowIfNull(m_featureDiscoveryCache, "nullFeatureDiscoveryCache");
+
         // initialize the software version tag
         aace::engine::core::Version engineVersion = aace::engine::core::version::getEngineVersion();
 
@@ -261,6 +277,9 @@ bool FeatureDiscoveryEngineImpl::initialize(std::shared_ptr<aace::engine::core::
             m_validCombinations.insert(domain + "," + EVENT_THINGS_TO_TRY);
         }
         m_validCombinations.insert(DOMAIN_GETTING_STARTED + "," + EVENT_SETUP);
+
+        // cached features are localized, so they are dropped when the locale changes
+        propertyManager->addListener(aace::alexa::property::LOCALE, shared_from_this());
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -308,6 +327,14 @@ void FeatureDiscoveryEngineImpl::executeOnGetFeatures(
             return;
         }
 
+        // resolve the parameters of each request, which default to those of the previous request
+        struct PendingRequest {
+            FeatureDiscoveryCache::Key key;
+            std::string queryString;
+            aace::engine::metrics::DurationDataPointBuilder duration;
+            std::string features;
+        };
+        std::vector<PendingRequest> pendingRequests;
         for (auto& request : discoveryRequestsJson) {
             aace::engine::metrics::DurationDataPointBuilder duration;
             duration.withName(METRIC_FEATURE_REQUEST_LATENCY).startTimer();
@@ -336,35 +363,50 @@ void FeatureDiscoveryEngineImpl::executeOnGetFeatures(
                 AACE_ERROR(LX(TAG).d("reason", "discoveredFeaturesEmpty"));
                 continue;
             }
-            auto response = m_featureDiscoveryRESTAgent->getHTTPResponseFromCloud(queryString, selectedLocale);
-            auto discoveredFeatures =
-                m_featureDiscoveryRESTAgent->getFeaturesFromHTTPResponse(response, selectedLocale);
-            if (discoveredFeatures.empty()) {
-                duration.stopTimer();
+            pendingRequests.push_back({{domain, eventType, selectedLocale, limit}, queryString, duration, ""});
+        }
+
+        // send independent requests concurrently, the cache serves repeated requests and coalesces duplicates
+        std::atomic<size_t> nextRequest{0};
+        auto fetchNext = [&]() {
+            for (size_t i = nextRequest++; i < pendingRequests.size(); i = nextRequest++) {
+                auto& pending = pendingRequests[i];
+                pending.features = m_featureDiscoveryCache->get(pending.key, [this, &pending]() {
+                    return fetchFeatures(pending.queryString, pending.key.locale);
+                });
+                pending.duration.stopTimer();
+            }
+        };
+        std::vector<std::future<void>> workers;
+        for (size_t i = 1; i < std::min(MAX_CONCURRENT_REQUESTS, pendingRequests.size()); i++) {
+            workers.push_back(std::async(std::launch::async, fetchNext));
+        }
+        fetchNext();
+        for (auto& worker : workers) {
+            worker.get();
+        }
+
+        for (auto& pending : pendingRequests) {
+            const auto& key = pending.key;
+            if (pending.features.empty()) {
                 submitHintsRequestResultMetrics(
                     m_metricRecorder.lock(),
                     false,
-                    limit,
-                    eventType,
-                    domain,
-                    duration.build(),
+                    key.limit,
+                    key.eventType,
+                    key.domain,
+                    pending.duration.build(),
                     METRIC_ERROR_EMPTY_RESPONSE);
                 AACE_ERROR(LX(TAG).d("reason", "discoveredFeaturesEmpty"));
                 continue;
             }
-            auto featuresArray = json::array();
-            for (auto& feature : discoveredFeatures) {
-                json featuresJson = {{REQUEST_UTTERANCE, feature.utteranceText},
-                                     {REQUEST_DESCRIPTION, feature.descriptionText}};
-                featuresArray.push_back(featuresJson);
-            }
-            json responseJson = {{REQUEST_DOMAIN, domain},
-                                 {REQUEST_EVENT_TYPE, eventType},
-                                 {REQUEST_LOCALE, selectedLocale},
-                                 {REQUEST_LOCALIZED_CONTENT, featuresArray}};
+            json responseJson = {{REQUEST_DOMAIN, key.domain},
+                                 {REQUEST_EVENT_TYPE, key.eventType},
+                                 {REQUEST_LOCALE, key.locale},
+                                 {REQUEST_LOCALIZED_CONTENT, json::parse(pending.features)}};
             discoveryResponsesJson.push_back(responseJson);
-            duration.stopTimer();
-            submitHintsRequestResultMetrics(m_metricRecorder.lock(), true, limit, eventType, domain, duration.build());
+            submitHintsRequestResultMetrics(
+                m_metricRecorder.lock(), true, key.limit, key.eventType, key.domain, pending.duration.build());
             AACE_DEBUG(LX(TAG, "executeOnGetFeatures")
                            .m("received response")
                            .d("requestId", requestId)
@@ -385,9 +427,34 @@ void FeatureDiscoveryEngineImpl::executeOnGetFeatures(
     });
 }
 
+std::string FeatureDiscoveryEngineImpl::fetchFeatures(const std::string& queryString, const std::string& locale) {
+    auto response = m_featureDiscoveryRESTAgent->getHTTPResponseFromCloud(queryString, locale);
+    auto discoveredFeatures = m_featureDiscoveryRESTAgent->getFeaturesFromHTTPResponse(response, locale);
+    if (discoveredFeatures.empty()) {
+        return "";
+    }
+    auto featuresArray = json::array();
+    for (auto& feature : discoveredFeatures) {
+        json featuresJson = {{REQUEST_UTTERANCE, feature.utteranceText},
+                             {REQUEST_DESCRIPTION, feature.descriptionText}};
+        featuresArray.push_back(featuresJson);
+    }
+    return featuresArray.dump();
+}
+
+void FeatureDiscoveryEngineImpl::propertyChanged(const std::string& name, const std::string& newValue) {
+    if (name == aace::alexa::property::LOCALE) {
+        AACE_INFO(LX(TAG).m("clearingFeatureDiscoveryCache").d("locale", newValue));
+        m_featureDiscoveryCache->clear();
+    }
+}
+
 void FeatureDiscoveryEngineImpl::doShutdown() {
     m_executor.waitForSubmittedTasks();
     m_executor.shutdown();
+    if (auto propertyManager = m_propertyManager.lock()) {
+        propertyManager->removeListener(aace::alexa::property::LOCALE, shared_from_this());
+    }
     m_validCombinations.clear();
     m_platformInterface.reset();
 }
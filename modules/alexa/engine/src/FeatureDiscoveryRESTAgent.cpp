@@ -16,6 +16,7 @@
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Alexa/AlexaEngineInterfaces.h>
 #include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include <nlohmann/json.hpp>
 
 namespace aace {
@@ -74,11 +75,14 @@ FeatureDiscoveryRESTAgent::FeatureDiscoveryRESTAgent(
 
 std::shared_ptr<FeatureDiscoveryRESTAgent> FeatureDiscoveryRESTAgent::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<HttpClientInterface> httpClient) {
     try {
         std::shared_ptr<FeatureDiscoveryRESTAgent> featureDiscoveryRESTAgent =
             std::shared_ptr<FeatureDiscoveryRESTAgent>(new FeatureDiscoveryRESTAgent(authDelegate));
-        ThrowIfNot(featureDiscoveryRESTAgent->initialize(alexaEndpoints), "initializeFeatureDiscoveryRESTAgentFailed");
+        ThrowIfNot(
+            featureDiscoveryRESTAgent->initialize(alexaEndpoints, httpClient),
+            "initializeFeatureDiscoveryRESTAgentFailed");
 
         return featureDiscoveryRESTAgent;
     } catch (std::exception& ex) {
@@ -88,7 +92,14 @@ std::shared_ptr<FeatureDiscoveryRESTAgent> FeatureDiscoveryRESTAgent::create(
 }
 
 bool FeatureDiscoveryRESTAgent::initialize(
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<HttpClientInterface> httpClient) {
+    m_httpClient = httpClient != nullptr ? httpClient : HttpClientPool::create();
+    if (m_httpClient == nullptr) {
+        AACE_ERROR(LX(TAG).m("nullHttpClient"));
+        return false;
+    }
+
     auto featureDiscoveryEndpoint = alexaEndpoints->getFeatureDiscoveryEndpoint();
     if (!featureDiscoveryEndpoint.empty()) {
         m_featureDiscoveryEndpoint = featureDiscoveryEndpoint;
@@ -143,12 +154,8 @@ FeatureDiscoveryRESTAgent::HTTPResponse FeatureDiscoveryRESTAgent::doGet(
     const std::string& url,
     const std::vector<std::string>& headers) {
     try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
+        // The shared client resets pooled handles on checkout, so the latest curl options in libcurlUtils are used.
+        return m_httpClient->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return FeatureDiscoveryRESTAgent::HTTPResponse();
@@ -0,0 +1,441 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AACE/Engine/Alexa/HttpClientPool.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.HttpClientPool");
+
+/// Separator between the scheme and the authority of a URL.
+static const std::string SCHEME_SEPARATOR = "://";
+
+/// Custom request method used for HTTP DELETE.
+static const char* HTTP_DELETE_METHOD = "DELETE";
+
+/// Longest time the transfer thread waits for socket activity before it checks the transfer timeouts again.
+static const int TRANSFER_POLL_TIMEOUT_MS = 1000;
+
+std::shared_ptr<HttpClientPool> HttpClientPool::create() {
+    return create(Config());
+}
+
+std::shared_ptr<HttpClientPool> HttpClientPool::create(const Config& config) {
+    try {
+        ThrowIf(config.maxConnectionsPerHost == 0, "invalidMaxConnectionsPerHost");
+
+        auto httpClientPool = std::shared_ptr<HttpClientPool>(new HttpClientPool(config));
+        ThrowIfNot(httpClientPool->initialize(), "initializeHttpClientPoolFailed");
+
+        return httpClientPool;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+HttpClientPool::HttpClientPool(const Config& config) :
+        m_config(config), m_share(nullptr), m_multi(nullptr), m_invalidated(false), m_isShuttingDown(false) {
+}
+
+HttpClientPool::~HttpClientPool() {
+    shutdown();
+    if (m_multi != nullptr) {
+        curl_multi_cleanup(m_multi);
+        m_multi = nullptr;
+    }
+    if (m_share != nullptr) {
+        curl_share_cleanup(m_share);
+        m_share = nullptr;
+    }
+}
+
+bool HttpClientPool::initialize() {
+    try {
+        m_share = curl_share_init();
+        ThrowIfNull(m_share, "curlShareInitFailed");
+
+        ThrowIfNot(curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lockShare) == CURLSHE_OK, "setLockFuncFailed");
+        ThrowIfNot(curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlockShare) == CURLSHE_OK, "setUnlockFuncFailed");
+        ThrowIfNot(curl_share_setopt(m_share, CURLSHOPT_USERDATA, this) == CURLSHE_OK, "setShareUserDataFailed");
+        ThrowIfNot(curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) == CURLSHE_OK, "shareDnsFailed");
+        ThrowIfNot(
+            curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) == CURLSHE_OK,
+            "shareSslSessionFailed");
+
+        m_multi = createMultiHandle();
+        ThrowIfNull(m_multi, "createMultiHandleFailed");
+
+        m_transferThread = std::thread(&HttpClientPool::runTransfers, this);
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+CURLM* HttpClientPool::createMultiHandle() {
+    CURLM* multi = nullptr;
+    try {
+        multi = curl_multi_init();
+        ThrowIfNull(multi, "curlMultiInitFailed");
+
+        // with CURLPIPE_MULTIPLEX a request to a host at its connection limit joins an open HTTP/2 connection
+        long pipelining = m_config.http2Enabled ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING;
+        long maxHostConnections = static_cast<long>(m_config.maxConnectionsPerHost);
+        long maxConnects = static_cast<long>(m_config.maxIdleConnections);
+        ThrowIfNot(curl_multi_setopt(multi, CURLMOPT_PIPELINING, pipelining) == CURLM_OK, "setPipeliningFailed");
+        ThrowIfNot(
+            curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, maxHostConnections) == CURLM_OK,
+            "setMaxHostConnectionsFailed");
+        ThrowIfNot(curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, maxConnects) == CURLM_OK, "setMaxConnectsFailed");
+
+        return multi;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        if (multi != nullptr) {
+            curl_multi_cleanup(multi);
+        }
+        return nullptr;
+    }
+}
+
+void HttpClientPool::invalidate() {
+    AACE_DEBUG(LX(TAG));
+    std::lock_guard<std::mutex> lock(m_transferMutex);
+    m_invalidated = true;
+    curl_multi_wakeup(m_multi);
+}
+
+void HttpClientPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_transferMutex);
+        m_isShuttingDown = true;
+        if (m_multi != nullptr) {
+            curl_multi_wakeup(m_multi);
+        }
+    }
+    if (m_transferThread.joinable()) {
+        m_transferThread.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_idleHandles.clear();
+    }
+    m_released.notify_all();
+}
+
+size_t HttpClientPool::getIdleHandleCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idleHandles.size();
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doGet(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::GET, url, headers, "", timeout);
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doPost(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::POST, url, headers, data, timeout);
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doPut(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::PUT, url, headers, data, timeout);
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doDelete(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return doRequest(Method::DELETE, url, headers, "", timeout);
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doRequest(
+    Method method,
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    const auto host = getHostKey(url);
+    std::unique_ptr<CurlEasyHandleWrapper> pooledHandle;
+    try {
+        ThrowIf(m_isShuttingDown, "httpClientPoolShutdown");
+        ThrowIf(host.empty(), "invalidUrl");
+
+        pooledHandle = acquire(host);
+        ThrowIfNull(pooledHandle, "acquireHandleFailed");
+        auto& handle = *pooledHandle;
+
+        HTTPResponse httpResponse;
+        ThrowIfNot(prepareHandle(handle), "prepareHandleFailed");
+        ThrowIfNot(handle.setURL(url), "setUrlFailed");
+        for (auto& header : headers) {
+            ThrowIfNot(handle.addHTTPHeader(header), "addHeaderFailed");
+        }
+        ThrowIfNot(handle.setTransferTimeout(static_cast<long>(timeout.count())), "setTimeoutFailed");
+        ThrowIfNot(handle.setWriteCallback(writeCallback, &httpResponse.body), "setWriteCallbackFailed");
+
+        switch (method) {
+            case Method::GET:
+                ThrowIfNot(handle.setTransferType(CurlEasyHandleWrapper::TransferType::kGET), "setGetFailed");
+                break;
+            case Method::POST:
+                ThrowIfNot(handle.setTransferType(CurlEasyHandleWrapper::TransferType::kPOST), "setPostFailed");
+                ThrowIfNot(handle.setPostData(data), "setPostDataFailed");
+                break;
+            case Method::PUT:
+                ThrowIfNot(handle.setTransferType(CurlEasyHandleWrapper::TransferType::kPUT), "setPutFailed");
+                ThrowIfNot(handle.setPostData(data), "setPutDataFailed");
+                break;
+            case Method::DELETE:
+                ThrowIfNot(handle.setopt(CURLOPT_CUSTOMREQUEST, HTTP_DELETE_METHOD), "setDeleteFailed");
+                break;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto result = perform(handle.getCurlHandle());
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        if (result != CURLE_OK) {
+            AACE_ERROR(LX(TAG).d("reason", curl_easy_strerror(result)).d("host", host));
+            release(host, std::move(pooledHandle));
+            return HTTPResponse();
+        }
+
+        long newConnections = 0;
+        long httpVersion = 0;
+        curl_easy_getinfo(handle.getCurlHandle(), CURLINFO_NUM_CONNECTS, &newConnections);
+        curl_easy_getinfo(handle.getCurlHandle(), CURLINFO_HTTP_VERSION, &httpVersion);
+        httpResponse.code = handle.getHTTPResponseCode();
+        AACE_DEBUG(LX(TAG)
+                       .d("host", host)
+                       .d("code", httpResponse.code)
+                       .d("http2", httpVersion == CURL_HTTP_VERSION_2_0)
+                       .d("connectionReused", newConnections == 0)
+                       .d("latencyMs", elapsed.count()));
+
+        release(host, std::move(pooledHandle));
+        return httpResponse;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("host", host));
+        if (pooledHandle != nullptr) {
+            release(host, std::move(pooledHandle));
+        }
+        return HTTPResponse();
+    }
+}
+
+CURLcode HttpClientPool::perform(CURL* handle) {
+    Transfer transfer;
+    transfer.handle = handle;
+    auto result = transfer.result.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_transferMutex);
+        if (m_isShuttingDown) {
+            return CURLE_ABORTED_BY_CALLBACK;
+        }
+        m_pendingTransfers.push_back(&transfer);
+        curl_multi_wakeup(m_multi);
+    }
+    // the transfer thread sets the result once the handle is removed from the multi handle
+    return result.get();
+}
+
+void HttpClientPool::runTransfers() {
+    // transfers added to m_multi, which only this thread accesses without holding m_transferMutex
+    std::vector<Transfer*> running;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(m_transferMutex);
+            if (m_isShuttingDown) {
+                break;
+            }
+            if (m_invalidated && running.empty()) {
+                // the cached connections are closed with the multi handle they belong to
+                auto multi = createMultiHandle();
+                if (multi != nullptr) {
+                    curl_multi_cleanup(m_multi);
+                    m_multi = multi;
+                }
+                m_invalidated = false;
+            }
+            if (!m_invalidated) {
+                for (auto transfer : m_pendingTransfers) {
+                    curl_easy_setopt(transfer->handle, CURLOPT_PRIVATE, transfer);
+                    if (curl_multi_add_handle(m_multi, transfer->handle) == CURLM_OK) {
+                        running.push_back(transfer);
+                    } else {
+                        transfer->result.set_value(CURLE_FAILED_INIT);
+                    }
+                }
+                m_pendingTransfers.clear();
+            }
+        }
+
+        int stillRunning = 0;
+        curl_multi_perform(m_multi, &stillRunning);
+
+        CURLMsg* message = nullptr;
+        int messagesLeft = 0;
+        while ((message = curl_multi_info_read(m_multi, &messagesLeft)) != nullptr) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            // the message is freed when its handle is removed
+            auto handle = message->easy_handle;
+            auto result = message->data.result;
+            Transfer* transfer = nullptr;
+            curl_easy_getinfo(handle, CURLINFO_PRIVATE, &transfer);
+            curl_multi_remove_handle(m_multi, handle);
+            running.erase(std::remove(running.begin(), running.end(), transfer), running.end());
+            transfer->result.set_value(result);
+        }
+
+        curl_multi_poll(m_multi, nullptr, 0, TRANSFER_POLL_TIMEOUT_MS, nullptr);
+    }
+
+    // fail the transfers that did not complete before the shutdown
+    for (auto transfer : running) {
+        curl_multi_remove_handle(m_multi, transfer->handle);
+        transfer->result.set_value(CURLE_ABORTED_BY_CALLBACK);
+    }
+    std::lock_guard<std::mutex> lock(m_transferMutex);
+    for (auto transfer : m_pendingTransfers) {
+        transfer->result.set_value(CURLE_ABORTED_BY_CALLBACK);
+    }
+    m_pendingTransfers.clear();
+}
+
+std::unique_ptr<HttpClientPool::CurlEasyHandleWrapper> HttpClientPool::acquire(const std::string& host) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto& activeRequests = m_activeRequests[host];
+    m_released.wait(lock, [this, &activeRequests] {
+        return m_isShuttingDown || activeRequests < m_config.maxConnectionsPerHost;
+    });
+    if (m_isShuttingDown) {
+        return nullptr;
+    }
+    activeRequests++;
+
+    if (!m_idleHandles.empty()) {
+        auto handle = std::move(m_idleHandles.back());
+        m_idleHandles.pop_back();
+        return handle;
+    }
+
+    lock.unlock();
+    auto handle = std::unique_ptr<CurlEasyHandleWrapper>(new CurlEasyHandleWrapper());
+    if (!handle->isValid()) {
+        release(host, nullptr);
+        return nullptr;
+    }
+    return handle;
+}
+
+void HttpClientPool::release(const std::string& host, std::unique_ptr<CurlEasyHandleWrapper> handle) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& activeRequests = m_activeRequests[host];
+        if (activeRequests > 0) {
+            activeRequests--;
+        }
+        if (handle != nullptr && !m_isShuttingDown && m_idleHandles.size() < m_config.maxIdleConnections) {
+            m_idleHandles.push_back(std::move(handle));
+        }
+    }
+    m_released.notify_all();
+}
+
+bool HttpClientPool::prepareHandle(CurlEasyHandleWrapper& handle) {
+    // reset() re-applies the default libcurlUtils options, so the latest network interface and proxy
+    // settings are used just as with a freshly created handle
+    if (!handle.reset()) {
+        return false;
+    }
+    if (!handle.setopt(CURLOPT_SHARE, m_share)) {
+        AACE_WARN(LX(TAG).m("setShareFailed"));
+    }
+    if (!handle.setopt(CURLOPT_DNS_CACHE_TIMEOUT, static_cast<long>(m_config.dnsCacheTimeout.count()))) {
+        AACE_WARN(LX(TAG).m("setDnsCacheTimeoutFailed"));
+    }
+    if (m_config.http2Enabled) {
+        if (!handle.setopt(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS)) {
+            // libcurl built without nghttp2, HTTP/1.1 keep-alive is used
+            AACE_DEBUG(LX(TAG).m("http2NotSupported"));
+        }
+        // wait for a connection that is being opened to the host, so the request can be multiplexed on it
+        if (!handle.setopt(CURLOPT_PIPEWAIT, 1L)) {
+            AACE_WARN(LX(TAG).m("setPipeWaitFailed"));
+        }
+    } else if (!handle.setopt(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1)) {
+        AACE_WARN(LX(TAG).m("setHttp11Failed"));
+    }
+    return true;
+}
+
+std::string HttpClientPool::getHostKey(const std::string& url) {
+    auto schemeEnd = url.find(SCHEME_SEPARATOR);
+    if (schemeEnd == std::string::npos || schemeEnd == 0) {
+        return "";
+    }
+    auto authorityStart = schemeEnd + SCHEME_SEPARATOR.size();
+    auto authorityEnd = url.find_first_of("/?#", authorityStart);
+    auto authority = url.substr(authorityStart, authorityEnd - authorityStart);
+    if (authority.empty()) {
+        return "";
+    }
+    auto scheme = url.substr(0, schemeEnd);
+    std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+    std::transform(authority.begin(), authority.end(), authority.begin(), ::tolower);
+    return scheme + SCHEME_SEPARATOR + authority;
+}
+
+size_t HttpClientPool::writeCallback(char* data, size_t size, size_t nmemb, void* userData) {
+    auto body = static_cast<std::string*>(userData);
+    body->append(data, size * nmemb);
+    return size * nmemb;
+}
+
+void HttpClientPool::lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData) {
+    auto pool = static_cast<HttpClientPool*>(userData);
+    pool->m_shareMutexes[data].lock();
+}
+
+void HttpClientPool::unlockShare(CURL* handle, curl_lock_data data, void* userData) {
+    auto pool = static_cast<HttpClientPool*>(userData);
+    pool->m_shareMutexes[data].unlock();
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
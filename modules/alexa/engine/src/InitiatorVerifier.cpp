@@ -31,6 +31,15 @@ bool InitiatorVerifier::shouldBlock(const std::string& wakeword, const std::chro
     return false;
 }
 
+bool InitiatorVerifier::shouldBlock(
+    const std::string& wakeword,
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+    const std::chrono::milliseconds& timeout) {
+    return shouldBlock(wakeword, timeout);
+}
+
 bool InitiatorVerifier::shouldBlock(const alexaClientSDK::avsCommon::avs::AgentInitiator& initiator) {
     // Should not block by default if this function is not implemented
     return false;
@@ -13,7 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#include <climits>
 #include <exception>
 
 #include "AACE/Alexa/AlexaProperties.h"
@@ -31,12 +30,6 @@ namespace alexa {
 
 using namespace aace::engine::utils::string;
 
-/// The maximum number of readers of the stream.
-static const size_t MAX_READERS = 10;
-
-/// The amount of audio data to keep in the ring buffer.
-static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(15);
-
 /// The amount of time for wake-word verification
 static const std::chrono::milliseconds VERIFICATION_TIMEOUT = std::chrono::milliseconds(500);
 
@@ -122,12 +115,11 @@ SpeechRecognizerEngineImpl::SpeechRecognizerEngineImpl(
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_speechRecognizerPlatformInterface(speechRecognizerPlatformInterface),
         m_audioFormat(audioFormat),
-        m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT),
         m_state(alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::IDLE) {
 }
 
 bool SpeechRecognizerEngineImpl::initialize(
-    std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+    std::shared_ptr<AudioInputStreamManager> audioInputStreamManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
         capabilitiesRegistrar,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> directiveSequencer,
@@ -152,10 +144,11 @@ bool SpeechRecognizerEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> agentManager,
     std::shared_ptr<aace::engine::arbitrator::ArbitratorServiceInterface> arbitratorService) {
     try {
-        // create the audio channel
-        m_audioInputChannel = audioManager->openAudioInputChannel(
-            "SpeechRecognizer", aace::engine::audio::AudioManagerInterface::AudioInputType::VOICE);
-        ThrowIfNull(m_audioInputChannel, "invalidAudioInputChannel");
+        // get the shared capture ring of the voice audio input
+        m_audioInputStreamManager = audioInputStreamManager;
+        m_audioInputStream = m_audioInputStreamManager->getAudioInputStream(
+            aace::engine::audio::AudioManagerInterface::AudioInputType::VOICE, "SpeechRecognizer");
+        ThrowIfNull(m_audioInputStream, "invalidAudioInputStream");
 
         // create the wakeword confirmation setting
         ThrowIfNot(
@@ -206,7 +199,6 @@ bool SpeechRecognizerEngineImpl::initialize(
             agentManager);
 
         ThrowIfNull(m_audioInputProcessor, "couldNotCreateAudioInputProcessor");
-        ThrowIfNot(initializeAudioInputStream(), "initializeAudioInputStreamFailed");
 
         // add dialog state observer to aip
         m_audioInputProcessor->addObserver(shared_from_this());
@@ -251,7 +243,7 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>
         capabilitiesRegistrar,
     const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
-    std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
+    std::shared_ptr<AudioInputStreamManager> audioInputStreamManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> directiveSequencer,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
@@ -277,7 +269,7 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
 
     try {
         ThrowIfNull(speechRecognizerPlatformInterface, "invlaidSpeechRecognizerPlatformInterface");
-        ThrowIfNull(audioManager, "invalidAudioManager");
+        ThrowIfNull(audioInputStreamManager, "invalidAudioInputStreamManager");
         ThrowIfNull(capabilitiesRegistrar, "invalidCapabilitiesRegistrar");
         ThrowIfNull(directiveSequencer, "invalidDirectiveSequencer");
         ThrowIfNull(messageSender, "invalidMessageSender");
@@ -299,7 +291,7 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
 
         ThrowIfNot(
             speechRecognizerEngineImpl->initialize(
-                audioManager,
+                audioInputStreamManager,
                 capabilitiesRegistrar,
                 directiveSequencer,
                 messageSender,
@@ -340,8 +332,8 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
 void SpeechRecognizerEngineImpl::doShutdown() {
     m_executor.shutdown();
 
-    if (m_audioInputWriter != nullptr) {
-        m_audioInputWriter->close();
+    if (isExpectingAudio()) {
+        stopAudioInput();
     }
 
     if (m_audioInputProcessor != nullptr) {
@@ -358,10 +350,7 @@ void SpeechRecognizerEngineImpl::doShutdown() {
         m_speechRecognizerPlatformInterface->setEngineInterface(nullptr);
     }
 
-    if (m_audioInputChannel != nullptr) {
-        m_audioInputChannel->doShutdown();
-        m_audioInputChannel.reset();
-    }
+    m_audioInputStreamManager.reset();
 
     if (m_agentManager != nullptr) {
         m_agentManager->removeAgentConnectionObserverInterface(
@@ -376,38 +365,6 @@ void SpeechRecognizerEngineImpl::doShutdown() {
     m_initiatorVerifiers.clear();
 }
 
-bool SpeechRecognizerEngineImpl::initializeAudioInputStream() {
-    try {
-        size_t size = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
-            m_audioFormat.sampleRateHz * AMOUNT_OF_AUDIO_DATA_IN_BUFFER.count(), m_wordSize, MAX_READERS);
-        auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(size);
-        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
-
-        // create the audio input stream
-        m_audioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, m_wordSize, MAX_READERS);
-        ThrowIfNull(m_audioInputStream, "couldNotCreateAudioInputStream");
-
-        // create the audio input writer
-        m_audioInputWriter = m_audioInputStream->createWriter(
-            alexaClientSDK::avsCommon::avs::AudioInputStream::Writer::Policy::NONBLOCKABLE);
-        ThrowIfNull(m_audioInputWriter, "couldNotCreateAudioInputWriter");
-
-        return true;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "initializeAudioInputStream").d("reason", ex.what()));
-        m_audioInputStream.reset();
-        m_audioInputWriter.reset();
-        return false;
-    }
-}
-
-bool SpeechRecognizerEngineImpl::waitForExpectingAudioState(bool expectingAudio, const std::chrono::seconds duration) {
-    std::unique_lock<std::mutex> lock(m_expectingAudioMutex);
-
-    return m_expectingAudioState_cv.wait_for(
-        lock, duration, [this, expectingAudio]() { return expectingAudio == isExpectingAudioLocked(); });
-}
-
 bool SpeechRecognizerEngineImpl::startAudioInput() {
     AACE_VERBOSE(LX(TAG));
     std::unique_lock<std::mutex> lock(m_expectingAudioMutex);
@@ -418,29 +375,17 @@ bool SpeechRecognizerEngineImpl::startAudioInput() {
             return true;
         }
 
-        // notify the platform that we are expecting audio... if the platform returns
-        // and error then we reset the expecting audio state and throw an exception
-        std::weak_ptr<SpeechRecognizerEngineImpl> wp = shared_from_this();
-
-        m_currentChannelId = m_audioInputChannel->start([wp](const int16_t* data, const size_t size) {
-            if (auto sp = wp.lock()) {
-                sp->write(data, size);
-            } else {
-                AACE_ERROR(LX(TAG, "startAudioInput").d("reason", "invalidWeakPtrReference"));
-            }
-        });
-
-        // throw an exception if we failed to start the audio input channel
-        ThrowIf(
-            m_currentChannelId == aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL,
-            "audioInputChannelStartFailed");
+        // capture voice audio into the shared ring... the platform is notified that
+        // we are expecting audio if no other component is capturing voice audio
+        m_currentCaptureId =
+            m_audioInputStreamManager->startCapture(aace::engine::audio::AudioManagerInterface::AudioInputType::VOICE);
 
-        // notify mutex that the expecting audio state has changed
-        m_expectingAudioState_cv.notify_all();
+        // throw an exception if we failed to start the audio capture
+        ThrowIf(m_currentCaptureId == AudioInputStreamManager::INVALID_CAPTURE, "audioInputCaptureStartFailed");
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "startAudioInput").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "startAudioInput").d("reason", ex.what()).d("id", m_currentCaptureId));
         return false;
     }
 }
@@ -449,20 +394,16 @@ bool SpeechRecognizerEngineImpl::stopAudioInput() {
     AACE_VERBOSE(LX(TAG));
     std::unique_lock<std::mutex> lock(m_expectingAudioMutex);
     try {
-        ThrowIf(
-            m_currentChannelId == aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL,
-            "invalidAudioChannelId");
-        m_audioInputChannel->stop(m_currentChannelId);
-
-        // reset the channel id
-        m_currentChannelId = aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+        ThrowIf(m_currentCaptureId == AudioInputStreamManager::INVALID_CAPTURE, "invalidAudioCaptureId");
+        m_audioInputStreamManager->stopCapture(
+            aace::engine::audio::AudioManagerInterface::AudioInputType::VOICE, m_currentCaptureId);
 
-        // notify expecting audio wait condition that the state has changed
-        m_expectingAudioState_cv.notify_all();
+        // reset the capture id
+        m_currentCaptureId = AudioInputStreamManager::INVALID_CAPTURE;
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "stopAudioInput").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "stopAudioInput").d("reason", ex.what()).d("id", m_currentCaptureId));
         return false;
     }
 }
@@ -473,12 +414,12 @@ bool SpeechRecognizerEngineImpl::isExpectingAudio() {
 }
 
 bool SpeechRecognizerEngineImpl::isExpectingAudioLocked() {
-    return m_currentChannelId != aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+    return m_currentCaptureId != AudioInputStreamManager::INVALID_CAPTURE;
 }
 
-aace::engine::audio::AudioInputChannelInterface::ChannelId SpeechRecognizerEngineImpl::getCurrentChannelId() {
+AudioInputStreamManager::CaptureId SpeechRecognizerEngineImpl::getCurrentCaptureId() {
     std::unique_lock<std::mutex> lock(m_expectingAudioMutex);
-    return m_currentChannelId;
+    return m_currentCaptureId;
 }
 
 // SpeechRecognizer
@@ -581,7 +522,7 @@ bool SpeechRecognizerEngineImpl::onStartCapture(
                        .d("reason", ex.what())
                        .d("initiator", initiator)
                        .d("state", m_state)
-                       .d("id", getCurrentChannelId()));
+                       .d("id", getCurrentCaptureId()));
         return false;
     }
 }
@@ -592,24 +533,11 @@ bool SpeechRecognizerEngineImpl::onStopCapture() {
         ThrowIfNot(m_audioInputProcessor->stopCapture().get(), "stopCaptureFailed");
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", getCurrentChannelId()));
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", getCurrentCaptureId()));
         return false;
     }
 }
 
-ssize_t SpeechRecognizerEngineImpl::write(const int16_t* data, const size_t size) {
-    try {
-        ThrowIfNot(waitForExpectingAudioState(true), "audioNotExpected");
-        ThrowIfNull(m_audioInputWriter, "nullAudioInputWriter");
-        ssize_t result = m_audioInputWriter->write(data, size);
-        ThrowIf(result < 0, "errorWritingData");
-        return result;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", getCurrentChannelId()));
-        return -1;
-    }
-}
-
 void SpeechRecognizerEngineImpl::addObserver(std::shared_ptr<WakewordObserverInterface> observer) {
     std::lock_guard<std::mutex> lock(m_observerMutex);
     m_observers.insert(observer);
@@ -647,9 +575,10 @@ void SpeechRecognizerEngineImpl::onKeyWordDetected(
         return;
     }
     if (m_state == AudioInputProcessorObserverInterface::State::IDLE) {
-        m_executor.submit([this, beginIndex, endIndex, keyword] {
+        m_executor.submit([this, stream, beginIndex, endIndex, keyword] {
             for (const auto& initiatorVerifier : m_initiatorVerifiers) {
-                if (initiatorVerifier && initiatorVerifier->shouldBlock(keyword, VERIFICATION_TIMEOUT)) {
+                if (initiatorVerifier &&
+                    initiatorVerifier->shouldBlock(keyword, stream, beginIndex, endIndex, VERIFICATION_TIMEOUT)) {
                     AACE_WARN(LX(TAG, "onKeyWordDetected: Cancelled by Initiator Verifier for wakeword"));
                     return;
                 }
@@ -728,7 +657,7 @@ bool SpeechRecognizerEngineImpl::startCapture(
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", getCurrentChannelId()));
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("id", getCurrentCaptureId()));
         m_audioInputProcessor->resetState();
         return false;
     }
@@ -1,17 +1,20 @@
 /*
-* Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
-*
-* Licensed under the Apache License, Version 2.0 (the "License").
-* You may not use this file except in compliance with the License.
-* A copy of the License is located at
-*
-*     http://aws.amazon.com/apache2.0/
-*
-* or in the "license" file accompanying this file. This file is distributed
-* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
-* express or implied. See the License for the specific language governing
-* permissions and limitations under the License.
-*/
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
 
 #include <AACE/Engine/Alexa/SystemSoundPlayer.h>
 #include <AACE/Engine/Core/EngineMacros.h>
@@ -23,6 +26,8 @@ namespace alexa {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.alexa.SystemSoundPlayer");
 
+constexpr size_t SystemSoundPlayer::MAX_QUEUED_TONES;
+
 std::shared_ptr<SystemSoundPlayer> SystemSoundPlayer::create(
     std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> audioFactory) {
@@ -46,7 +51,24 @@ bool SystemSoundPlayer::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> audioFactory) {
     try {
         m_audioManager = audioManager;
-        m_audioFactory = audioFactory;
+
+        // read every tone into memory once, instead of opening its resource each time it plays
+        using ToneFactory = std::function<
+            std::pair<std::unique_ptr<std::istream>, const alexaClientSDK::avsCommon::utils::MediaType>()>;
+        std::vector<std::pair<Tone, ToneFactory>> toneFactories = {
+            {Tone::WAKEWORD_NOTIFICATION, audioFactory->wakeWordNotificationTone()},
+            {Tone::END_SPEECH, audioFactory->endSpeechTone()}};
+        for (auto& toneFactory : toneFactories) {
+            ThrowIfNot(toneFactory.second, "invalidToneFactory");
+            auto tone = toneFactory.second();
+            ThrowIfNull(tone.first, "invalidToneStream");
+            std::ostringstream data;
+            data << tone.first->rdbuf();
+            ThrowIf(data.str().empty(), "emptyTone");
+            m_tones[toneFactory.first] = {std::make_shared<const std::string>(data.str()), tone.second};
+            AACE_DEBUG(LX(TAG).d("tone", static_cast<int>(toneFactory.first)).d("size", data.str().size()));
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -56,6 +78,8 @@ bool SystemSoundPlayer::initialize(
 
 std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> SystemSoundPlayer::getAudioChannel() {
     try {
+        std::lock_guard<std::mutex> lock(m_channelMutex);
+
         // open the EARCON audio channel if it hasn't already been opened
         if (m_audioOutputChannel == nullptr) {
             auto audioManager = m_audioManager.lock();
@@ -75,23 +99,78 @@ std::shared_ptr<aace::engine::audio::AudioOutputChannelInterface> SystemSoundPla
     }
 }
 
+bool SystemSoundPlayer::warmUp() {
+    return getAudioChannel() != nullptr;
+}
+
+void SystemSoundPlayer::startTone(std::shared_ptr<ToneRequest> request) {
+    try {
+        auto audioChannel = getAudioChannel();
+        ThrowIfNull(audioChannel, "invalidAudioChannel");
+
+        auto it = m_tones.find(request->tone);
+        ThrowIf(it == m_tones.end(), "toneNotFound");
+        auto stream = SystemSoundAudioStream::create(it->second.first, it->second.second, request->tone);
+        ThrowIfNull(stream, "invalidAudioStream");
+
+        // prepare the sound to play
+        std::lock_guard<std::mutex> lock(m_channelMutex);
+        ThrowIfNot(audioChannel->prepare(stream, false), "audioOutputChannelPrepareFailed");
+        ThrowIfNot(audioChannel->play(), "audioOutputChannelPlayFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("tone", static_cast<int>(request->tone)));
+        finishTone(request, false);
+    }
+}
+
+void SystemSoundPlayer::finishTone(std::shared_ptr<ToneRequest> request, bool result) {
+    std::shared_ptr<ToneRequest> next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_currentTone != request) {
+            return;
+        }
+        if (!m_queuedTones.empty()) {
+            next = m_queuedTones.front();
+            m_queuedTones.pop_front();
+        }
+        m_currentTone = next;
+    }
+    request->promise.set_value(result);
+
+    // start the next tone from the executor, the channel may be reporting the state of the previous tone
+    if (next != nullptr) {
+        m_executor.submit([this, next]() { startTone(next); });
+    }
+}
+
 //
 // aace::audio::AudioOutputEngineInterface
 //
 
 void SystemSoundPlayer::onMediaStateChanged(MediaState state) {
     if (state == MediaState::STOPPED) {
-        m_playTonePromise.set_value(true);
-        m_playTonePromise = std::promise<bool>();
-        m_sharedFuture = std::shared_future<bool>();
+        std::shared_ptr<ToneRequest> request;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            request = m_currentTone;
+        }
+        if (request != nullptr) {
+            finishTone(request, true);
+        }
     }
 }
 
 void SystemSoundPlayer::onMediaError(MediaError error, const std::string& description) {
     AACE_ERROR(LX(TAG).d("error", error).d("description", description));
-    m_playTonePromise.set_value(false);
-    m_playTonePromise = std::promise<bool>();
-    m_sharedFuture = std::shared_future<bool>();
+    std::shared_ptr<ToneRequest> request;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        request = m_currentTone;
+    }
+    if (request != nullptr) {
+        finishTone(request, false);
+    }
 }
 
 void SystemSoundPlayer::onAudioFocusEvent(FocusAction action) {
@@ -103,24 +182,27 @@ void SystemSoundPlayer::onAudioFocusEvent(FocusAction action) {
 
 std::shared_future<bool> SystemSoundPlayer::playTone(Tone tone) {
     try {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        ThrowIf(m_sharedFuture.valid(), "toneAlreadyPlaying");
-
-        auto audioChannel = getAudioChannel();
-        ThrowIfNull(audioChannel, "invalidAudioChannel");
-
-        // create the audio stream
-        auto stream = SystemSoundAudioStream::create(m_audioFactory, tone);
-        ThrowIfNull(stream, "invalidAudioStream");
-
-        // prepare the sound to play
-        ThrowIfNot(audioChannel->prepare(stream, false), "audioOutputChannelPrepareFailed");
-        ThrowIfNot(audioChannel->play(), "audioOutputChannelPlayFailed");
-
-        m_sharedFuture = m_playTonePromise.get_future();
-
-        return m_sharedFuture;
+        auto request = std::make_shared<ToneRequest>();
+        request->tone = tone;
+        request->future = request->promise.get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_currentTone != nullptr) {
+                // share the result of the same tone if it is already waiting
+                for (auto& queued : m_queuedTones) {
+                    if (queued->tone == tone) {
+                        return queued->future;
+                    }
+                }
+                ThrowIf(m_queuedTones.size() >= MAX_QUEUED_TONES, "toneQueueFull");
+                m_queuedTones.push_back(request);
+                AACE_DEBUG(LX(TAG).m("toneQueued").d("tone", static_cast<int>(tone)).d("queued", m_queuedTones.size()));
+                return request->future;
+            }
+            m_currentTone = request;
+        }
+        startTone(request);
+        return request->future;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         auto errPromise = std::promise<bool>();
@@ -134,69 +216,51 @@ std::shared_future<bool> SystemSoundPlayer::playTone(Tone tone) {
 //
 
 SystemSoundAudioStream::SystemSoundAudioStream(
-    std::shared_ptr<std::istream> stream,
+    std::shared_ptr<const std::string> data,
     alexaClientSDK::avsCommon::utils::MediaType mediaType,
     alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone) :
-        m_stream(stream), m_tone(tone), m_closed(false) {
+        m_data(data), m_mediaType(mediaType), m_tone(tone), m_offset(0), m_closed(false) {
 }
 
 std::shared_ptr<SystemSoundAudioStream> SystemSoundAudioStream::create(
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface> audioFactory,
+    std::shared_ptr<const std::string> data,
+    alexaClientSDK::avsCommon::utils::MediaType mediaType,
     alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone tone) {
-    std::shared_ptr<SystemSoundAudioStream> stream;
-
-    std::shared_ptr<std::istream> iStream;
-    alexaClientSDK::avsCommon::utils::MediaType streamFormat = alexaClientSDK::avsCommon::utils::MediaType::UNKNOWN;
-
-    switch (tone) {
-        case alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone::WAKEWORD_NOTIFICATION:
-            std::tie(iStream, streamFormat) = audioFactory->wakeWordNotificationTone()();
-            stream = std::shared_ptr<SystemSoundAudioStream>(new SystemSoundAudioStream(
-                iStream,
-                streamFormat,
-                alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone::WAKEWORD_NOTIFICATION));
-            break;
-
-        case alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone::END_SPEECH:
-            std::tie(iStream, streamFormat) = audioFactory->endSpeechTone()();
-            stream = std::shared_ptr<SystemSoundAudioStream>(new SystemSoundAudioStream(
-                iStream,
-                streamFormat,
-                alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone::END_SPEECH));
-            break;
+    try {
+        ThrowIfNull(data, "invalidData");
+        return std::shared_ptr<SystemSoundAudioStream>(new SystemSoundAudioStream(data, mediaType, tone));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG + ".SystemSoundAudioStream").d("reason", ex.what()));
+        return nullptr;
     }
-
-    return stream;
 }
 
 ssize_t SystemSoundAudioStream::read(char* data, const size_t size) {
-    try {
-        if (m_stream->eof()) {
-            m_closed = true;
-            return 0;
-        }
-
-        // read the data from the stream
-        m_stream->read(data, size);
-        ThrowIf(m_stream->bad(), "readFailed");
-
-        // get the number of bytes read
-        ssize_t count = m_stream->gcount();
-
-        m_stream->tellg();  // Don't remove. Otherwise the ResourceStream used for Alerts/Timers won't work as expected.
-
-        return count;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG + ".SystemSoundAudioStream").d("reason", ex.what()).d("size", size).d("closed", m_closed));
+    if (m_offset >= m_data->size()) {
         m_closed = true;
         return 0;
     }
+    auto count = std::min(size, m_data->size() - m_offset);
+    std::copy(m_data->data() + m_offset, m_data->data() + m_offset + count, data);
+    m_offset += count;
+    return static_cast<ssize_t>(count);
 }
 
 bool SystemSoundAudioStream::isClosed() {
     return m_closed;
 }
 
+SystemSoundAudioStream::MediaType SystemSoundAudioStream::getMediaType() {
+    switch (m_mediaType) {
+        case alexaClientSDK::avsCommon::utils::MediaType::MPEG:
+            return MediaType::MPEG;
+        case alexaClientSDK::avsCommon::utils::MediaType::WAV:
+            return MediaType::WAV;
+        default:
+            return MediaType::UNKNOWN;
+    }
+}
+
 std::vector<aace::audio::AudioStreamProperty> SystemSoundAudioStream::getProperties() {
     return {{"cache-policy", "ALWAYS"},
             {"cache-id", "aace.alexa.SystemSoundPlayer#" + std::to_string(static_cast<int>(m_tone))}};
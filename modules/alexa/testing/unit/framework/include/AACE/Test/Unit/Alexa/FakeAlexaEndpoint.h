@@ -0,0 +1,63 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_TEST_UNIT_ALEXA_FAKE_ALEXA_ENDPOINT_H
+#define AACE_TEST_UNIT_ALEXA_FAKE_ALEXA_ENDPOINT_H
+
+#include <string>
+
+#include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace alexa {
+
+/**
+ * @c AlexaEndpointInterface that returns the endpoints set by the test, and an empty string for the others.
+ */
+class FakeAlexaEndpoint : public aace::engine::alexa::AlexaEndpointInterface {
+public:
+    void setACMSEndpoint(const std::string& endpoint) {
+        m_acmsEndpoint = endpoint;
+    }
+    void setFeatureDiscoveryEndpoint(const std::string& endpoint) {
+        m_featureDiscoveryEndpoint = endpoint;
+    }
+
+    std::string getAVSGateway() override {
+        return "";
+    }
+    std::string getLWAEndpoint() override {
+        return "";
+    }
+    std::string getACMSEndpoint() override {
+        return m_acmsEndpoint;
+    }
+    std::string getFeatureDiscoveryEndpoint() override {
+        return m_featureDiscoveryEndpoint;
+    }
+
+private:
+    std::string m_acmsEndpoint;
+    std::string m_featureDiscoveryEndpoint;
+};
+
+}  // namespace alexa
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
+
+#endif  // AACE_TEST_UNIT_ALEXA_FAKE_ALEXA_ENDPOINT_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_TEST_UNIT_ALEXA_FAKE_HTTP_CLIENT_H
+#define AACE_TEST_UNIT_ALEXA_FAKE_HTTP_CLIENT_H
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace alexa {
+
+/**
+ * Base for the stand-ins of cloud services behind @c HttpClientInterface. Every request fails the test unless the
+ * derived class overrides its method. The derived class serializes on @c m_mutex and calls @c roundTrip() to
+ * simulate the latency of the requests that the code under test may send concurrently.
+ */
+class FakeHttpClient : public aace::engine::alexa::HttpClientInterface {
+public:
+    HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override {
+        return unexpectedRequest("GET", url);
+    }
+
+    HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) override {
+        return unexpectedRequest("POST", url);
+    }
+
+    HTTPResponse doPut(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        const std::string& data,
+        std::chrono::seconds timeout) override {
+        return unexpectedRequest("PUT", url);
+    }
+
+    HTTPResponse doDelete(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override {
+        return unexpectedRequest("DELETE", url);
+    }
+
+    /// Returns the largest number of requests that were in @c roundTrip() at the same time.
+    size_t getMaxRequestsInFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxRequestsInFlight;
+    }
+
+protected:
+    static HTTPResponse response(const std::string& body, long code = 200) {
+        HTTPResponse httpResponse;
+        httpResponse.code = code;
+        httpResponse.body = body;
+        return httpResponse;
+    }
+
+    static HTTPResponse unexpectedRequest(const std::string& method, const std::string& url) {
+        ADD_FAILURE() << "unexpected request: " << method << " " << url;
+        return response("", 404);
+    }
+
+    /**
+     * Releases @c lock for @c latency to simulate the round trip to the cloud, and counts the requests in flight.
+     *
+     * @param lock The lock on @c m_mutex, held on entry and on return.
+     * @param latency The simulated round trip time.
+     */
+    void roundTrip(std::unique_lock<std::mutex>& lock, std::chrono::milliseconds latency) {
+        m_requestsInFlight++;
+        m_maxRequestsInFlight = std::max(m_maxRequestsInFlight, m_requestsInFlight);
+        lock.unlock();
+        std::this_thread::sleep_for(latency);
+        lock.lock();
+        m_requestsInFlight--;
+    }
+
+    /// Resets the count returned by @c getMaxRequestsInFlight(). Called with @c m_mutex held.
+    void resetMaxRequestsInFlight() {
+        m_maxRequestsInFlight = 0;
+    }
+
+    std::mutex m_mutex;
+
+private:
+    size_t m_requestsInFlight = 0;
+    size_t m_maxRequestsInFlight = 0;
+};
+
+}  // namespace alexa
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
+
+#endif  // AACE_TEST_UNIT_ALEXA_FAKE_HTTP_CLIENT_H
@@ -0,0 +1,142 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AACE/Test/Unit/Audio/MockAudioManagerInterface.h>
+#include <AACE/Test/Unit/Audio/MockAudioInputChannelInterface.h>
+
+#include <AACE/Engine/Alexa/AudioInputStreamManager.h>
+
+using namespace aace::test::unit::audio;
+using AudioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream;
+using AudioInputStreamManager = aace::engine::alexa::AudioInputStreamManager;
+using AudioInputType = aace::engine::audio::AudioManagerInterface::AudioInputType;
+using AudioWriteCallback = aace::engine::audio::AudioInputChannelInterface::AudioWriteCallback;
+
+/// The number of samples written to the ring in the tests.
+static const size_t TEST_SAMPLE_COUNT = 160;
+
+class AudioInputStreamManagerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_mockAudioManager = std::make_shared<MockAudioManagerInterface>();
+        m_mockAudioInputChannel = std::make_shared<testing::NiceMock<MockAudioInputChannelInterface>>();
+
+        m_audioInputStreamManager = AudioInputStreamManager::create(m_mockAudioManager, createAudioFormat());
+        ASSERT_NE(m_audioInputStreamManager, nullptr) << "AudioInputStreamManager pointer expected to be nonnull";
+    }
+
+    void TearDown() override {
+        m_audioInputStreamManager->shutdown();
+    }
+
+protected:
+    alexaClientSDK::avsCommon::utils::AudioFormat createAudioFormat() {
+        alexaClientSDK::avsCommon::utils::AudioFormat format;
+
+        format.sampleRateHz = 16000;
+        format.sampleSizeInBits = 16;
+        format.numChannels = 1;
+        format.endianness = alexaClientSDK::avsCommon::utils::AudioFormat::Endianness::LITTLE;
+        format.encoding = alexaClientSDK::avsCommon::utils::AudioFormat::Encoding::LPCM;
+
+        return format;
+    }
+
+    std::shared_ptr<AudioInputStream> openVoiceStream(const std::string& name) {
+        EXPECT_CALL(*m_mockAudioManager, openAudioInputChannel(name, AudioInputType::VOICE))
+            .WillOnce(testing::Return(m_mockAudioInputChannel));
+        return m_audioInputStreamManager->getAudioInputStream(AudioInputType::VOICE, name);
+    }
+
+protected:
+    std::shared_ptr<MockAudioManagerInterface> m_mockAudioManager;
+    std::shared_ptr<testing::NiceMock<MockAudioInputChannelInterface>> m_mockAudioInputChannel;
+    std::shared_ptr<AudioInputStreamManager> m_audioInputStreamManager;
+};
+
+TEST_F(AudioInputStreamManagerTest, createWithAudioManagerAsNull) {
+    EXPECT_EQ(AudioInputStreamManager::create(nullptr, createAudioFormat()), nullptr);
+}
+
+TEST_F(AudioInputStreamManagerTest, consumersShareOneStreamPerType) {
+    auto stream = openVoiceStream("SpeechRecognizer");
+    ASSERT_NE(stream, nullptr);
+
+    // later consumers of the type get the same ring without opening another channel
+    EXPECT_EQ(m_audioInputStreamManager->getAudioInputStream(AudioInputType::VOICE, "WakewordEngine"), stream);
+}
+
+TEST_F(AudioInputStreamManagerTest, channelStartsForFirstCaptureAndStopsAfterLast) {
+    ASSERT_NE(openVoiceStream("SpeechRecognizer"), nullptr);
+
+    EXPECT_CALL(*m_mockAudioInputChannel, start(testing::_)).Times(1).WillOnce(testing::Return(7));
+    auto first = m_audioInputStreamManager->startCapture(AudioInputType::VOICE);
+    auto second = m_audioInputStreamManager->startCapture(AudioInputType::VOICE);
+    ASSERT_NE(first, AudioInputStreamManager::INVALID_CAPTURE);
+    ASSERT_NE(second, AudioInputStreamManager::INVALID_CAPTURE);
+    EXPECT_NE(first, second);
+
+    EXPECT_CALL(*m_mockAudioInputChannel, stop(7)).Times(1);
+    EXPECT_TRUE(m_audioInputStreamManager->stopCapture(AudioInputType::VOICE, first));
+    EXPECT_TRUE(m_audioInputStreamManager->stopCapture(AudioInputType::VOICE, second));
+    EXPECT_FALSE(m_audioInputStreamManager->stopCapture(AudioInputType::VOICE, second));
+}
+
+TEST_F(AudioInputStreamManagerTest, readersAtSameIndexReadSameAudio) {
+    ASSERT_NE(openVoiceStream("SpeechRecognizer"), nullptr);
+
+    AudioWriteCallback writeCallback;
+    EXPECT_CALL(*m_mockAudioInputChannel, start(testing::_))
+        .WillOnce(testing::DoAll(testing::SaveArg<0>(&writeCallback), testing::Return(7)));
+    ASSERT_NE(m_audioInputStreamManager->startCapture(AudioInputType::VOICE), AudioInputStreamManager::INVALID_CAPTURE);
+
+    std::vector<int16_t> samples(TEST_SAMPLE_COUNT);
+    for (size_t j = 0; j < samples.size(); j++) {
+        samples[j] = static_cast<int16_t>(j);
+    }
+    writeCallback(samples.data(), samples.size());
+
+    // each consumer reads the audio written once, from its own absolute index
+    auto wakewordReader = m_audioInputStreamManager->createReader(
+        AudioInputType::VOICE, AudioInputStream::Reader::Policy::NONBLOCKING, 0);
+    auto recognizerReader = m_audioInputStreamManager->createReader(
+        AudioInputType::VOICE, AudioInputStream::Reader::Policy::NONBLOCKING, TEST_SAMPLE_COUNT / 2);
+    ASSERT_NE(wakewordReader, nullptr);
+    ASSERT_NE(recognizerReader, nullptr);
+
+    std::vector<int16_t> wakewordSamples(TEST_SAMPLE_COUNT);
+    EXPECT_EQ(wakewordReader->read(wakewordSamples.data(), wakewordSamples.size()), (ssize_t)TEST_SAMPLE_COUNT);
+    EXPECT_EQ(wakewordSamples, samples);
+
+    std::vector<int16_t> recognizerSamples(TEST_SAMPLE_COUNT / 2);
+    EXPECT_EQ(
+        recognizerReader->read(recognizerSamples.data(), recognizerSamples.size()), (ssize_t)TEST_SAMPLE_COUNT / 2);
+    EXPECT_TRUE(
+        std::equal(recognizerSamples.begin(), recognizerSamples.end(), samples.begin() + TEST_SAMPLE_COUNT / 2));
+}
+
+TEST_F(AudioInputStreamManagerTest, createReaderBeforeStreamFails) {
+    EXPECT_EQ(
+        m_audioInputStreamManager->createReader(
+            AudioInputType::LOOPBACK, AudioInputStream::Reader::Policy::NONBLOCKING, 0),
+        nullptr);
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Metrics/DataPoint.h>
+#include <AVSCommon/Utils/Metrics/MetricEvent.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+
+#include <AACE/Engine/Alexa/AvsSdkMetricParser.h>
+
+using AvsSdkMetricParser = aace::engine::alexa::AvsSdkMetricParser;
+using AvsDataPoint = alexaClientSDK::avsCommon::utils::metrics::DataPoint;
+using AvsDataType = alexaClientSDK::avsCommon::utils::metrics::DataType;
+using AvsPriority = alexaClientSDK::avsCommon::utils::metrics::Priority;
+using AvsMetricEvent = alexaClientSDK::avsCommon::utils::metrics::MetricEvent;
+using AvsMetricEventBuilder = alexaClientSDK::avsCommon::utils::metrics::MetricEventBuilder;
+
+/// The number of times the benchmark replays the recorded dialog.
+static constexpr int REPLAY_COUNT = 2000;
+
+/// The translated output of a dropped metric.
+static const std::string DROPPED = "<dropped>";
+
+/// A metric recorded from a dialog, and the translation of the metric.
+struct RecordedMetric {
+    std::string source;
+    AvsPriority priority;
+    std::vector<AvsDataPoint> dataPoints;
+    std::string expected;
+};
+
+static AvsDataPoint counter(const std::string& name, const std::string& value) {
+    return AvsDataPoint(name, value, AvsDataType::COUNTER);
+}
+
+static AvsDataPoint duration(const std::string& name, const std::string& value) {
+    return AvsDataPoint(name, value, AvsDataType::DURATION);
+}
+
+static AvsDataPoint string(const std::string& name, const std::string& value) {
+    return AvsDataPoint(name, value, AvsDataType::STRING);
+}
+
+/// The metrics of a wakeword dialog followed by music playback and a volume change.
+static const std::vector<RecordedMetric> RECORDED_DIALOG = {
+    {"AIP-INITIATOR_WAKEWORD",
+     AvsPriority::HIGH,
+     {string("DIALOG_REQUEST_ID", "dialog-1"), duration("WakewordToStopCapture", "1200")},
+     "AIP-INITIATOR_WAKEWORD HIGH DIALOG_REQUEST_ID=STR:dialog-1 WakewordToStopCapture=DUR:1200"},
+    {"AIP-START_OF_UTTERANCE",
+     AvsPriority::NORMAL,
+     {counter("START_OF_UTTERANCE", "1")},
+     DROPPED},
+    {"HybridRouter-RouteSelected",
+     AvsPriority::NORMAL,
+     {counter("CloudRoute", "1")},
+     "HybridRouter-RouteSelected CloudRoute=CT:1"},
+    {"AIP-STOP_CAPTURE_TO_END_OF_SPEECH",
+     AvsPriority::NORMAL,
+     {duration("STOP_CAPTURE_TO_END_OF_SPEECH", "320"), string("DIALOG_REQUEST_ID", "dialog-1")},
+     "AIP-STOP_CAPTURE_TO_END_OF_SPEECH DIALOG_REQUEST_ID=STR:dialog-1 STOP_CAPTURE_TO_END_OF_SPEECH=DUR:320"},
+    {"UPL-TTS",
+     AvsPriority::HIGH,
+     {duration("TTS_LATENCY", "740"), AvsDataPoint()},
+     "UPL-TTS HIGH TTS_LATENCY=DUR:740"},
+    {"SPEECH_SYNTHESIZER-ERROR.TTS_BUFFER_UNDERRUN",
+     AvsPriority::NORMAL,
+     {counter("Error.TTS_BUFFER_UNDERRUN", "1")},
+     "SPEECH_SYNTHESIZER-ERROR.TTS_BUFFER_UNDERRUN "
+     "ErrorType=STR:Error.TTS_BUFFER_UNDERRUN SpeechSynthesizerErrorCount=CT:1"},
+    {"SPEECH_SYNTHESIZER-ERROR.TTS_BUFFER_UNDERRUN",
+     AvsPriority::NORMAL,
+     {string("Error.TTS_BUFFER_UNDERRUN", "underrun")},
+     "SPEECH_SYNTHESIZER-ERROR.TTS_BUFFER_UNDERRUN "
+     "ErrorType=STR:Error.TTS_BUFFER_UNDERRUN SpeechSynthesizerErrorCount=STR:underrun"},
+    {"AUDIO_PLAYER-PLAY_DIRECTIVE_RECEIVED",
+     AvsPriority::NORMAL,
+     {counter("AUDIO_PLAYER-PLAY_DIRECTIVE_RECEIVED", "1")},
+     "AUDIO_PLAYER-PLAY_DIRECTIVE_RECEIVED AudioPlayerCount=CT:1 CountType=STR:AUDIO_PLAYER-PLAY_DIRECTIVE_RECEIVED"},
+    {"UPL-MEDIA_PLAY",
+     AvsPriority::NORMAL,
+     {duration("MediaPlay", "850"), string("MSG_ID", "message-1")},
+     "UPL-MEDIA_PLAY MSG_ID=STR:message-1 MediaLatencyType=STR:MediaPlay MediaPlay=DUR:850"},
+    {"AUDIO_PLAYER-directiveReceiveToPlaying",
+     AvsPriority::NORMAL,
+     {duration("directiveReceiveToPlaying", "910")},
+     "AUDIO_PLAYER-directiveReceiveToPlaying AudioPlayerDuration=DUR:910 DurationType=STR:directiveReceiveToPlaying"},
+    {"AUDIO_PLAYER-MessageSentFailed",
+     AvsPriority::NORMAL,
+     {counter("MessageSentFailed", "0")},
+     DROPPED},
+    {"AUDIO_PLAYER-MessageSentFailed",
+     AvsPriority::NORMAL,
+     {counter("MessageSentFailed", "2")},
+     "AUDIO_PLAYER-MessageSentFailed AudioPlayerErrorCount=CT:2 ErrorType=STR:MessageSentFailed"},
+    {"AUDIO_PLAYER-MessageSentFailed",
+     AvsPriority::NORMAL,
+     {string("MessageSentFailed", "failed")},
+     DROPPED},
+    {"SPEAKER_MANAGER-adjustVolumeSource_LOCAL_API",
+     AvsPriority::NORMAL,
+     {counter("adjustVolumeSource_LOCAL_API", "1")},
+     "SPEAKER_MANAGER-adjustVolumeSource_LOCAL_API AdjustVolumeCount=CT:1 Source=STR:LOCAL_API"},
+    {"SPEAKER_MANAGER-setMuteSource_EXTERNAL_CLIENT",
+     AvsPriority::NORMAL,
+     {counter("setMuteSource_EXTERNAL_CLIENT", "1"), counter("unrelated", "3")},
+     "SPEAKER_MANAGER-setMuteSource_EXTERNAL_CLIENT SetMuteCount=CT:1 Source=STR:EXTERNAL_CLIENT unrelated=CT:3"},
+    {"SETTINGS-AVS_CHANGE",
+     AvsPriority::NORMAL,
+     {counter("AVS_CHANGE", "1")},
+     "SETTINGS-AVS_CHANGE ChangeType=STR:AVS_CHANGE SettingChangeSuccessCount=CT:1"},
+    {"DOWNCHANNEL_HANDLER-RESPONSE_FINISHED",
+     AvsPriority::NORMAL,
+     {counter("SERVER_CLOSED", "1"), duration("StreamDuration", "3600000")},
+     "DOWNCHANNEL_HANDLER-RESPONSE_FINISHED SERVER_CLOSED=CT:1"},
+    {"ACL-ERROR.SEND_DATA_ERROR",
+     AvsPriority::NORMAL,
+     {counter("ERROR.SEND_DATA_ERROR", "0")},
+     DROPPED},
+    {"UPL-MEDIA_STOP",
+     AvsPriority::NORMAL,
+     {duration("MediaStop", "95")},
+     "UPL-MEDIA_STOP MediaLatencyType=STR:MediaStop MediaStop=DUR:95"},
+    {"CUSTOM-THINKING_TIMEOUT_EXPIRES",
+     AvsPriority::NORMAL,
+     {counter("THINKING_TIMEOUT_EXPIRES", "1")},
+     "CUSTOM-THINKING_TIMEOUT_EXPIRES THINKING_TIMEOUT_EXPIRES=CT:1"},
+};
+
+/// Rules where the UPL sources are covered by a prefix override, and one of them is also an allowed source.
+static const std::string OVERLAPPING_RULES = R"({
+    "prefixOverride": ["UPL-"],
+    "allowed": [
+        {
+            "source": "UPL-MEDIA_STOP",
+            "transformRules": [{"insertDimension": ["MediaStop", "MediaLatencyType"]}]
+        },
+        {
+            "source": "AUDIO_PLAYER-directiveReceiveToPlaying",
+            "transformRules": [{"swapName": ["directiveReceiveToPlaying", "AudioPlayerDuration", "DurationType"]}]
+        }
+    ]
+})";
+
+/// The metrics replayed with @c OVERLAPPING_RULES. A prefix override takes precedence over the rules of a source.
+static const std::vector<RecordedMetric> OVERLAPPING_DIALOG = {
+    {"UPL-MEDIA_STOP", AvsPriority::NORMAL, {duration("MediaStop", "95")}, "UPL-MEDIA_STOP MediaStop=DUR:95"},
+    {"UPL-MEDIA_PLAY", AvsPriority::NORMAL, {duration("MediaPlay", "850")}, "UPL-MEDIA_PLAY MediaPlay=DUR:850"},
+    {"AUDIO_PLAYER-directiveReceiveToPlaying",
+     AvsPriority::NORMAL,
+     {duration("directiveReceiveToPlaying", "910")},
+     "AUDIO_PLAYER-directiveReceiveToPlaying AudioPlayerDuration=DUR:910 DurationType=STR:directiveReceiveToPlaying"},
+    {"AUDIO_PLAYER-MessageSentFailed", AvsPriority::NORMAL, {counter("MessageSentFailed", "2")}, DROPPED},
+};
+
+static std::shared_ptr<AvsMetricEvent> buildMetric(const RecordedMetric& recorded) {
+    AvsMetricEventBuilder builder;
+    builder.setActivityName(recorded.source).setPriority(recorded.priority);
+    for (auto& dataPoint : recorded.dataPoints) {
+        builder.addDataPoint(dataPoint);
+    }
+    return builder.build();
+}
+
+/// Returns the translated metric as its source and priority followed by the data points sorted by name.
+static std::string toString(const std::shared_ptr<aace::engine::metrics::MetricEvent>& metric) {
+    if (metric == nullptr) {
+        return DROPPED;
+    }
+    std::vector<std::string> dataPoints;
+    for (auto& dataPoint : metric->getDataPoints()) {
+        dataPoints.push_back(
+            dataPoint.getName() + "=" + aace::engine::metrics::dataTypeToShortString(dataPoint.getDataType()) + ":" +
+            dataPoint.getValue());
+    }
+    std::sort(dataPoints.begin(), dataPoints.end());
+    std::string result = metric->getSourceName();
+    if (metric->getMetricContext().getPriority() == aace::engine::metrics::Priority::HIGH) {
+        result += " HIGH";
+    }
+    for (auto& dataPoint : dataPoints) {
+        result += " " + dataPoint;
+    }
+    return result;
+}
+
+TEST(AvsSdkMetricParserTest, recordedDialogIsTranslated) {
+    AvsSdkMetricParser parser;
+    ASSERT_TRUE(parser.configure());
+    for (auto& recorded : RECORDED_DIALOG) {
+        EXPECT_EQ(toString(parser.convertMetric(buildMetric(recorded))), recorded.expected) << recorded.source;
+    }
+}
+
+TEST(AvsSdkMetricParserTest, prefixOverrideTakesPrecedenceOverAllowedSource) {
+    AvsSdkMetricParser parser;
+    ASSERT_TRUE(parser.configure(OVERLAPPING_RULES));
+    for (auto& recorded : OVERLAPPING_DIALOG) {
+        EXPECT_EQ(toString(parser.convertMetric(buildMetric(recorded))), recorded.expected) << recorded.source;
+    }
+}
+
+TEST(AvsSdkMetricParserTest, nonZeroCountIsKept) {
+    AvsSdkMetricParser parser;
+    ASSERT_TRUE(parser.configure());
+    auto metric = parser.convertMetric(buildMetric(
+        {"ACL-ERROR.SEND_DATA_ERROR", AvsPriority::NORMAL, {counter("ERROR.SEND_DATA_ERROR", "2")}, ""}));
+    EXPECT_EQ(toString(metric), "ACL-ERROR.SEND_DATA_ERROR ERROR.SEND_DATA_ERROR=CT:2");
+}
+
+TEST(AvsSdkMetricParserTest, replayRecordedDialog) {
+    AvsSdkMetricParser parser;
+    ASSERT_TRUE(parser.configure());
+    std::vector<std::shared_ptr<AvsMetricEvent>> metrics;
+    for (auto& recorded : RECORDED_DIALOG) {
+        metrics.push_back(buildMetric(recorded));
+    }
+
+    size_t translated = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int replay = 0; replay < REPLAY_COUNT; replay++) {
+        for (auto& metric : metrics) {
+            if (parser.convertMetric(metric) != nullptr) {
+                translated++;
+            }
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    auto count = static_cast<double>(REPLAY_COUNT * metrics.size());
+    RecordProperty("nanosecondsPerMetric", static_cast<int>(elapsed / count));
+
+    auto expected = std::count_if(RECORDED_DIALOG.begin(), RECORDED_DIALOG.end(), [](const RecordedMetric& recorded) {
+        return recorded.expected != DROPPED;
+    });
+    EXPECT_EQ(translated, static_cast<size_t>(expected * REPLAY_COUNT));
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Test/Unit/Alexa/FakeAlexaEndpoint.h>
+#include <AACE/Test/Unit/Alexa/FakeHttpClient.h>
+#include <AACE/Test/Unit/Storage/FakeLocalStorage.h>
+#include <AACE/Engine/Alexa/FeatureDiscoveryCache.h>
+#include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
+
+#include <nlohmann/json.hpp>
+
+using namespace aace::test::unit::alexa;
+using FakeLocalStorage = aace::test::unit::core::FakeLocalStorage;
+using FeatureDiscoveryCache = aace::engine::alexa::FeatureDiscoveryCache;
+using json = nlohmann::json;
+
+static const std::string TEST_ENDPOINT = "https://api.amazonalexa.com";
+static const std::string TEST_LOCALE_EN_US = "en-US";
+static const std::string TEST_UTTERANCE = "Alexa, what's the weather?";
+
+/// The simulated round trip to the cloud.
+static const std::chrono::milliseconds TEST_LATENCY = std::chrono::milliseconds(200);
+
+/**
+ * Stand-in for the hints service. It answers every request with one hint after a simulated latency, and counts the
+ * requests received.
+ */
+class FakeHintsHttpClient : public FakeHttpClient {
+public:
+    HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout)
+        override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_requests++;
+        roundTrip(lock, TEST_LATENCY);
+        if (m_failing) {
+            return response("", 500);
+        }
+        json hint = {{"localizedContent", {{"en_US", {{"utteranceText", TEST_UTTERANCE}}}}}};
+        return response(json({{"_embedded", {{"hints", {hint}}}}}).dump());
+    }
+
+    int getRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests;
+    }
+
+    void setFailing(bool failing) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failing = failing;
+    }
+
+private:
+    int m_requests = 0;
+    bool m_failing = false;
+};
+
+class FeatureDiscoveryCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
+        m_httpClient = std::make_shared<FakeHintsHttpClient>();
+        m_localStorage = std::make_shared<FakeLocalStorage>();
+        auto alexaEndpoint = std::make_shared<FakeAlexaEndpoint>();
+        alexaEndpoint->setFeatureDiscoveryEndpoint(TEST_ENDPOINT);
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+        m_initialized = true;
+
+        m_restAgent = aace::engine::alexa::FeatureDiscoveryRESTAgent::create(
+            m_alexaMockFactory->getAuthDelegateInterfaceMock(),
+            alexaEndpoint,
+            m_httpClient);
+        ASSERT_NE(m_restAgent, nullptr);
+    }
+
+    void TearDown() override {
+        if (m_initialized) {
+            m_alexaMockFactory->shutdown();
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+            m_initialized = false;
+        }
+    }
+
+protected:
+    /// Fetches the features of a request through the REST agent, as the Engine does.
+    FeatureDiscoveryCache::FetchFunction createFetch(const FeatureDiscoveryCache::Key& key) {
+        return [this, key]() -> std::string {
+            auto url = m_restAgent->createUrlFromParameters(key.domain, key.eventType, key.limit);
+            auto features = m_restAgent->getFeaturesFromHTTPResponse(
+                m_restAgent->getHTTPResponseFromCloud(url, key.locale), key.locale);
+            if (features.empty()) {
+                return "";
+            }
+            json featuresArray = json::array();
+            for (auto& feature : features) {
+                featuresArray.push_back({{"utteranceText", feature.utteranceText}});
+            }
+            return featuresArray.dump();
+        };
+    }
+
+    std::shared_ptr<AlexaMockComponentFactory> m_alexaMockFactory;
+    std::shared_ptr<FakeHintsHttpClient> m_httpClient;
+    std::shared_ptr<FakeLocalStorage> m_localStorage;
+    std::shared_ptr<aace::engine::alexa::FeatureDiscoveryRESTAgent> m_restAgent;
+
+private:
+    bool m_initialized = false;
+};
+
+TEST_F(FeatureDiscoveryCacheTest, repeatedRequestIsServedFromCache) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    ASSERT_NE(cache, nullptr);
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+
+    bool cached = true;
+    auto features = cache->get(key, createFetch(key), &cached);
+    EXPECT_FALSE(cached);
+    EXPECT_EQ(json::parse(features)[0]["utteranceText"], TEST_UTTERANCE);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(cache->get(key, createFetch(key), &cached), features);
+    EXPECT_TRUE(cached);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, TEST_LATENCY);
+    EXPECT_EQ(m_httpClient->getRequests(), 1);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, requestsWithDifferentParametersAreNotShared) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    ASSERT_NE(cache, nullptr);
+    std::vector<FeatureDiscoveryCache::Key> keys = {{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1},
+                                                    {"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 2},
+                                                    {"NEWS", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1}};
+    for (auto& key : keys) {
+        EXPECT_FALSE(cache->get(key, createFetch(key)).empty());
+    }
+    EXPECT_EQ(m_httpClient->getRequests(), 3);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, duplicateInFlightRequestsAreCoalesced) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    ASSERT_NE(cache, nullptr);
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+
+    std::vector<std::future<std::string>> results;
+    for (int i = 0; i < 8; i++) {
+        results.push_back(std::async(std::launch::async, [&]() { return cache->get(key, createFetch(key)); }));
+    }
+    auto features = results[0].get();
+    EXPECT_FALSE(features.empty());
+    for (size_t i = 1; i < results.size(); i++) {
+        EXPECT_EQ(results[i].get(), features);
+    }
+    EXPECT_EQ(m_httpClient->getRequests(), 1);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, independentRequestsRunConcurrently) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    ASSERT_NE(cache, nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<std::string>> results;
+    for (auto& domain : {"WEATHER", "NEWS", "SPORTS", "TRAFFIC"}) {
+        FeatureDiscoveryCache::Key key{domain, "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+        results.push_back(std::async(std::launch::async, [&, key]() { return cache->get(key, createFetch(key)); }));
+    }
+    for (auto& result : results) {
+        EXPECT_FALSE(result.get().empty());
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, TEST_LATENCY * 2);
+    EXPECT_EQ(m_httpClient->getRequests(), 4);
+    EXPECT_EQ(m_httpClient->getMaxRequestsInFlight(), 4u);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, cachedEntriesArePersisted) {
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+    auto features = FeatureDiscoveryCache::create(m_localStorage)->get(key, createFetch(key));
+    ASSERT_FALSE(features.empty());
+
+    // a new cache on the same storage, as after an engine restart
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    bool cached = false;
+    EXPECT_EQ(json::parse(cache->get(key, createFetch(key), &cached)), json::parse(features));
+    EXPECT_TRUE(cached);
+    EXPECT_EQ(m_httpClient->getRequests(), 1);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, expiredEntryIsFetchedAgain) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage, std::chrono::milliseconds(100));
+    ASSERT_NE(cache, nullptr);
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+
+    EXPECT_FALSE(cache->get(key, createFetch(key)).empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_FALSE(cache->get(key, createFetch(key)).empty());
+    EXPECT_EQ(m_httpClient->getRequests(), 2);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, clearInvalidatesEntries) {
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    EXPECT_FALSE(cache->get(key, createFetch(key)).empty());
+
+    // the Engine clears the cache when the locale changes
+    cache->clear();
+    EXPECT_FALSE(FeatureDiscoveryCache::create(m_localStorage)->get(key, createFetch(key)).empty());
+    EXPECT_EQ(m_httpClient->getRequests(), 2);
+}
+
+TEST_F(FeatureDiscoveryCacheTest, failedRequestIsNotCached) {
+    auto cache = FeatureDiscoveryCache::create(m_localStorage);
+    ASSERT_NE(cache, nullptr);
+    FeatureDiscoveryCache::Key key{"WEATHER", "THINGS_TO_TRY", TEST_LOCALE_EN_US, 1};
+
+    m_httpClient->setFailing(true);
+    EXPECT_TRUE(cache->get(key, createFetch(key)).empty());
+    auto failedRequests = m_httpClient->getRequests();
+
+    m_httpClient->setFailing(false);
+    EXPECT_FALSE(cache->get(key, createFetch(key)).empty());
+    EXPECT_EQ(m_httpClient->getRequests(), failedRequests + 1);
+}
@@ -20,6 +20,7 @@
 #include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
 
 #include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Test/Unit/Alexa/FakeAlexaEndpoint.h>
 #include <AACE/Test/Unit/PropertyManager/MockPropertyManagerServiceInterface.h>
 
 #include <AACE/Engine/Alexa/FeatureDiscoveryEngineImpl.h>
@@ -32,23 +33,6 @@ public:
     MOCK_METHOD2(featuresReceived, void(const std::string& requestId, const std::string& discoveryResponses));
 };
 
-class DummyAlexaEndpointInterface : public aace::engine::alexa::AlexaEndpointInterface {
-public:
-    std::string getAVSGateway() override {
-        return "";
-    }
-    std::string getLWAEndpoint() override {
-        return "";
-    }
-    std::string getACMSEndpoint() override {
-        return "";
-    }
-
-    std::string getFeatureDiscoveryEndpoint() override {
-        return "";
-    }
-};
-
 class DummyEngineContext
         : public aace::engine::core::EngineContext
         , public aace::engine::core::EngineService
@@ -63,7 +47,7 @@ public:
                 std::dynamic_pointer_cast<aace::engine::core::EngineService>(shared_from_this())));
         m_mockPropertyManager = std::make_shared<aace::test::unit::core::MockPropertyManagerServiceInterface>();
         m_mockMetricRecorder = std::make_shared<aace::test::unit::core::MockMetricRecorderServiceInterface>();
-        m_mockAlexaEndpoint = std::make_shared<DummyAlexaEndpointInterface>();
+        m_mockAlexaEndpoint = std::make_shared<FakeAlexaEndpoint>();
         registerServiceInterface<aace::engine::propertyManager::PropertyManagerServiceInterface>(m_mockPropertyManager);
         registerServiceInterface<aace::engine::metrics::MetricRecorderServiceInterface>(m_mockMetricRecorder);
         registerServiceInterface<aace::engine::alexa::AlexaEndpointInterface>(m_mockAlexaEndpoint);
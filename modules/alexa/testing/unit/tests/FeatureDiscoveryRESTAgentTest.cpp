@@ -19,6 +19,7 @@
 #include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
 
 #include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Test/Unit/Alexa/FakeAlexaEndpoint.h>
 #include <AACE/Engine/Alexa/FeatureDiscoveryRESTAgent.h>
 #include <regex>
 
@@ -86,27 +87,13 @@ static std::string TEST_RESPONSE = R"(
     }
 })";
 
-class DummyAlexaEndpointInterface : public aace::engine::alexa::AlexaEndpointInterface {
-public:
-    std::string getAVSGateway() override {
-        return "";
-    }
-    std::string getLWAEndpoint() override {
-        return "";
-    }
-    std::string getACMSEndpoint() override {
-        return "";
-    }
-    std::string getFeatureDiscoveryEndpoint() override {
-        return TEST_ENDPOINT;
-    }
-};
-
 class FeatureDiscoveryRESTAgentTest : public ::testing::Test {
 public:
     void SetUp() override {
         m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
-        m_alexaEndpointInterface = std::make_shared<DummyAlexaEndpointInterface>();
+        auto alexaEndpoint = std::make_shared<FakeAlexaEndpoint>();
+        alexaEndpoint->setFeatureDiscoveryEndpoint(TEST_ENDPOINT);
+        m_alexaEndpointInterface = alexaEndpoint;
         TEST_RESPONSE = std::regex_replace(TEST_RESPONSE, std::regex("<TEST_UTTERANCE_1>"), TEST_UTTERANCE_1);
         TEST_RESPONSE = std::regex_replace(TEST_RESPONSE, std::regex("<TEST_UTTERANCE_2>"), TEST_UTTERANCE_2);
 
@@ -0,0 +1,748 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <nghttp2/nghttp2.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
+#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
+
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
+
+using namespace aace::test::unit::alexa;
+using namespace aace::engine::alexa;
+
+static const size_t TEST_REQUEST_COUNT = 20;
+static const std::chrono::seconds TEST_TIMEOUT = std::chrono::seconds(5);
+static const std::string TEST_RESPONSE_BODY = "{\"status\":\"ok\"}";
+
+/// Time the server holds each response, so concurrent requests overlap on the server.
+static const std::chrono::milliseconds TEST_RESPONSE_DELAY = std::chrono::milliseconds(100);
+
+/// Number of requests issued concurrently by the multiplexing and host limit tests.
+static const size_t TEST_CONCURRENT_REQUEST_COUNT = 4;
+
+/// ALPN protocol identifiers in wire format.
+static const unsigned char ALPN_HTTP2[] = {2, 'h', '2'};
+static const unsigned char ALPN_HTTP11[] = {8, 'h', 't', 't', 'p', '/', '1', '.', '1'};
+
+/**
+ * Self-signed certificate for 127.0.0.1, written to a temporary directory in the hashed layout
+ * expected by @c CURLOPT_CAPATH so curl trusts the loopback server.
+ */
+class LoopbackCertificate {
+public:
+    ~LoopbackCertificate() {
+        if (!m_certificatePath.empty()) {
+            ::unlink(m_certificatePath.c_str());
+        }
+        if (!m_directory.empty()) {
+            ::rmdir(m_directory.c_str());
+        }
+        X509_free(m_certificate);
+        EVP_PKEY_free(m_key);
+    }
+
+    bool create() {
+        auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+        bool generated = keyContext != nullptr && EVP_PKEY_keygen_init(keyContext) > 0 &&
+                         EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1) > 0 &&
+                         EVP_PKEY_keygen(keyContext, &m_key) > 0;
+        EVP_PKEY_CTX_free(keyContext);
+        if (!generated) {
+            return false;
+        }
+
+        m_certificate = X509_new();
+        X509_set_version(m_certificate, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(m_certificate), 1);
+        X509_gmtime_adj(X509_getm_notBefore(m_certificate), -60);
+        X509_gmtime_adj(X509_getm_notAfter(m_certificate), 24 * 60 * 60);
+        X509_set_pubkey(m_certificate, m_key);
+        auto name = X509_get_subject_name(m_certificate);
+        X509_NAME_add_entry_by_txt(
+            name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("127.0.0.1"), -1, -1, 0);
+        X509_set_issuer_name(m_certificate, name);
+        X509V3_CTX extensionContext;
+        X509V3_set_ctx_nodb(&extensionContext);
+        X509V3_set_ctx(&extensionContext, m_certificate, m_certificate, nullptr, nullptr, 0);
+        auto subjectAltName =
+            X509V3_EXT_conf_nid(nullptr, &extensionContext, NID_subject_alt_name, const_cast<char*>("IP:127.0.0.1"));
+        if (subjectAltName == nullptr || X509_add_ext(m_certificate, subjectAltName, -1) != 1) {
+            X509_EXTENSION_free(subjectAltName);
+            return false;
+        }
+        X509_EXTENSION_free(subjectAltName);
+        if (X509_sign(m_certificate, m_key, EVP_sha256()) == 0) {
+            return false;
+        }
+
+        char directory[] = "/tmp/HttpClientPoolTestXXXXXX";
+        if (::mkdtemp(directory) == nullptr) {
+            return false;
+        }
+        m_directory = directory;
+        char hashName[16];
+        std::snprintf(hashName, sizeof(hashName), "%08lx.0", X509_subject_name_hash(m_certificate));
+        m_certificatePath = m_directory + "/" + hashName;
+        auto file = std::fopen(m_certificatePath.c_str(), "w");
+        if (file == nullptr) {
+            return false;
+        }
+        bool written = PEM_write_X509(file, m_certificate) == 1;
+        std::fclose(file);
+        return written;
+    }
+
+    /// The AVS SDK configuration that makes libcurlUtils trust the certificate.
+    std::shared_ptr<std::istream> getAVSConfig() const {
+        return std::make_shared<std::stringstream>(
+            "{\"libcurlUtils\":{\"CURLOPT_CAPATH\":\"" + m_directory + "\"}}");
+    }
+
+    X509* getCertificate() const {
+        return m_certificate;
+    }
+
+    EVP_PKEY* getKey() const {
+        return m_key;
+    }
+
+private:
+    EVP_PKEY* m_key = nullptr;
+    X509* m_certificate = nullptr;
+    std::string m_directory;
+    std::string m_certificatePath;
+};
+
+/**
+ * Minimal keep-alive server on the loopback interface. It speaks plain HTTP/1.1, or TLS with HTTP/2 when
+ * the client offers it with ALPN and HTTP/1.1 otherwise. It counts accepted connections and the requests
+ * it holds at the same time, so the tests can verify connection reuse and multiplexing.
+ */
+class LoopbackHttpServer {
+public:
+    enum class Protocol { HTTP, HTTPS };
+
+    LoopbackHttpServer(Protocol protocol = Protocol::HTTP) : m_protocol(protocol) {
+    }
+
+    ~LoopbackHttpServer() {
+        stop();
+    }
+
+    bool start(const LoopbackCertificate* certificate = nullptr) {
+        if (m_protocol != Protocol::HTTP) {
+            if (certificate == nullptr || (m_sslContext = SSL_CTX_new(TLS_server_method())) == nullptr ||
+                SSL_CTX_use_certificate(m_sslContext, certificate->getCertificate()) != 1 ||
+                SSL_CTX_use_PrivateKey(m_sslContext, certificate->getKey()) != 1) {
+                return false;
+            }
+            SSL_CTX_set_alpn_select_cb(m_sslContext, selectProtocol, nullptr);
+        }
+        m_socket = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (m_socket < 0) {
+            return false;
+        }
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (::bind(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(m_socket, 16) != 0 || ::getsockname(m_socket, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            return false;
+        }
+        m_port = ntohs(addr.sin_port);
+        m_acceptThread = std::thread(&LoopbackHttpServer::acceptLoop, this, m_socket);
+        return true;
+    }
+
+    void stop() {
+        if (m_socket >= 0) {
+            m_running = false;
+            ::shutdown(m_socket, SHUT_RDWR);
+            ::close(m_socket);
+            m_socket = -1;
+        }
+        if (m_acceptThread.joinable()) {
+            m_acceptThread.join();
+        }
+        {
+            // unblock connection threads waiting on idle keep-alive connections, the connections
+            // closed by their thread were already removed so each descriptor is still open here
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto client : m_clients) {
+                ::shutdown(client, SHUT_RDWR);
+            }
+        }
+        for (auto& connectionThread : m_connectionThreads) {
+            if (connectionThread.joinable()) {
+                connectionThread.join();
+            }
+        }
+        m_connectionThreads.clear();
+        if (m_sslContext != nullptr) {
+            SSL_CTX_free(m_sslContext);
+            m_sslContext = nullptr;
+        }
+    }
+
+    /// Holds every response for @c delay before sending it.
+    void setResponseDelay(std::chrono::milliseconds delay) {
+        m_responseDelay = delay;
+    }
+
+    std::string getUrl(const std::string& path = "/test") const {
+        auto scheme = m_protocol == Protocol::HTTP ? "http" : "https";
+        return std::string(scheme) + "://127.0.0.1:" + std::to_string(m_port) + path;
+    }
+
+    size_t getConnectionCount() const {
+        return m_connectionCount;
+    }
+
+    size_t getHttp2ConnectionCount() const {
+        return m_http2ConnectionCount;
+    }
+
+    /// The largest number of requests the server held at the same time, over all connections.
+    size_t getMaxConcurrentRequests() const {
+        return m_maxConcurrentRequests;
+    }
+
+private:
+    /// A client connection, read and written through TLS when @c ssl is set.
+    struct Connection {
+        int socket;
+        SSL* ssl;
+
+        ssize_t read(char* data, size_t size) {
+            return ssl != nullptr ? SSL_read(ssl, data, static_cast<int>(size)) : ::recv(socket, data, size, 0);
+        }
+
+        ssize_t write(const char* data, size_t size) {
+            return ssl != nullptr ? SSL_write(ssl, data, static_cast<int>(size))
+                                  : ::send(socket, data, size, MSG_NOSIGNAL);
+        }
+
+        /// Waits up to @c timeout for data to read.
+        bool waitReadable(std::chrono::milliseconds timeout) {
+            if (ssl != nullptr && SSL_pending(ssl) > 0) {
+                return true;
+            }
+            pollfd descriptor{socket, POLLIN, 0};
+            return ::poll(&descriptor, 1, static_cast<int>(timeout.count())) > 0;
+        }
+    };
+
+    /// A request held by an HTTP/2 connection until its response is due.
+    struct PendingResponse {
+        int32_t streamId;
+        std::chrono::steady_clock::time_point due;
+    };
+
+    /// The state of an HTTP/2 connection, passed to the nghttp2 callbacks.
+    struct Http2Connection {
+        LoopbackHttpServer* server;
+        Connection* connection;
+        std::vector<PendingResponse> pending;
+    };
+
+    static int selectProtocol(
+        SSL* ssl,
+        const unsigned char** out,
+        unsigned char* outlen,
+        const unsigned char* in,
+        unsigned int inlen,
+        void* userData) {
+        unsigned char* selected = nullptr;
+        if (SSL_select_next_proto(&selected, outlen, ALPN_HTTP2, sizeof(ALPN_HTTP2), in, inlen) ==
+            OPENSSL_NPN_NEGOTIATED) {
+            *out = selected;
+            return SSL_TLSEXT_ERR_OK;
+        }
+        if (SSL_select_next_proto(&selected, outlen, ALPN_HTTP11, sizeof(ALPN_HTTP11), in, inlen) ==
+            OPENSSL_NPN_NEGOTIATED) {
+            *out = selected;
+            return SSL_TLSEXT_ERR_OK;
+        }
+        return SSL_TLSEXT_ERR_NOACK;
+    }
+
+    void acceptLoop(int listener) {
+        while (m_running) {
+            int client = ::accept(listener, nullptr, nullptr);
+            if (client < 0) {
+                return;
+            }
+            m_connectionCount++;
+            // frames are written separately, so do not let them wait for the client's delayed ACK
+            int noDelay = 1;
+            ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_clients.push_back(client);
+            m_connectionThreads.emplace_back(&LoopbackHttpServer::serve, this, client);
+        }
+    }
+
+    void serve(int client) {
+        Connection connection{client, nullptr};
+        if (m_sslContext != nullptr) {
+            connection.ssl = SSL_new(m_sslContext);
+            SSL_set_fd(connection.ssl, client);
+            if (SSL_accept(connection.ssl) != 1) {
+                closeClient(connection);
+                return;
+            }
+            const unsigned char* protocol = nullptr;
+            unsigned int protocolLength = 0;
+            SSL_get0_alpn_selected(connection.ssl, &protocol, &protocolLength);
+            if (protocolLength == 2 && std::memcmp(protocol, "h2", 2) == 0) {
+                m_http2ConnectionCount++;
+                serveHttp2(connection);
+                closeClient(connection);
+                return;
+            }
+        }
+        serveHttp11(connection);
+        closeClient(connection);
+    }
+
+    void serveHttp11(Connection& connection) {
+        std::string buffer;
+        char chunk[4096];
+        while (m_running) {
+            auto headerEnd = buffer.find("\r\n\r\n");
+            if (headerEnd == std::string::npos) {
+                auto n = connection.read(chunk, sizeof(chunk));
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, n);
+                continue;
+            }
+            // consume the request body if present
+            size_t contentLength = 0;
+            auto pos = buffer.find("Content-Length:");
+            if (pos != std::string::npos && pos < headerEnd) {
+                contentLength = std::stoul(buffer.substr(pos + 15));
+            }
+            while (buffer.size() < headerEnd + 4 + contentLength) {
+                auto n = connection.read(chunk, sizeof(chunk));
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, n);
+            }
+            buffer.erase(0, headerEnd + 4 + contentLength);
+
+            requestStarted();
+            std::this_thread::sleep_for(m_responseDelay);
+            requestFinished();
+            std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                                   std::to_string(TEST_RESPONSE_BODY.size()) + "\r\n\r\n" + TEST_RESPONSE_BODY;
+            if (connection.write(response.data(), response.size()) <= 0) {
+                return;
+            }
+        }
+    }
+
+    void serveHttp2(Connection& connection) {
+        Http2Connection state{this, &connection, {}};
+        nghttp2_session_callbacks* callbacks = nullptr;
+        nghttp2_session_callbacks_new(&callbacks);
+        nghttp2_session_callbacks_set_send_callback(callbacks, sendHttp2);
+        nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks, onHttp2FrameReceived);
+        nghttp2_session* session = nullptr;
+        nghttp2_session_server_new(&session, callbacks, &state);
+        nghttp2_session_callbacks_del(callbacks);
+
+        nghttp2_settings_entry settings[] = {{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, 100}};
+        nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, settings, 1);
+
+        char chunk[4096];
+        while (m_running && nghttp2_session_send(session) == 0 &&
+               (nghttp2_session_want_read(session) || nghttp2_session_want_write(session))) {
+            // wait for the next frame, or until the next held response is due
+            auto timeout = std::chrono::milliseconds(50);
+            auto now = std::chrono::steady_clock::now();
+            for (auto& next : state.pending) {
+                timeout = std::min(
+                    timeout,
+                    std::max(
+                        std::chrono::milliseconds(0),
+                        std::chrono::duration_cast<std::chrono::milliseconds>(next.due - now)));
+            }
+            if (connection.waitReadable(timeout)) {
+                auto n = connection.read(chunk, sizeof(chunk));
+                if (n <= 0 ||
+                    nghttp2_session_mem_recv(session, reinterpret_cast<const uint8_t*>(chunk), n) < 0) {
+                    break;
+                }
+            }
+
+            now = std::chrono::steady_clock::now();
+            auto due = std::partition(state.pending.begin(), state.pending.end(), [now](const PendingResponse& next) {
+                return next.due > now;
+            });
+            for (auto next = due; next != state.pending.end(); ++next) {
+                requestFinished();
+                submitHttp2Response(session, next->streamId);
+            }
+            state.pending.erase(due, state.pending.end());
+        }
+        for (size_t i = 0; i < state.pending.size(); i++) {
+            requestFinished();
+        }
+        nghttp2_session_del(session);
+    }
+
+    static nghttp2_nv makeHttp2Header(const std::string& name, const std::string& value) {
+        return {const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(name.data())),
+                const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(value.data())),
+                name.size(),
+                value.size(),
+                NGHTTP2_NV_FLAG_NONE};
+    }
+
+    static void submitHttp2Response(nghttp2_session* session, int32_t streamId) {
+        static const std::string STATUS_NAME = ":status";
+        static const std::string STATUS_VALUE = "200";
+        static const std::string CONTENT_TYPE_NAME = "content-type";
+        static const std::string CONTENT_TYPE_VALUE = "application/json";
+        nghttp2_nv headers[] = {
+            makeHttp2Header(STATUS_NAME, STATUS_VALUE), makeHttp2Header(CONTENT_TYPE_NAME, CONTENT_TYPE_VALUE)};
+        nghttp2_data_provider body;
+        body.source.ptr = nullptr;
+        body.read_callback = readHttp2Body;
+        nghttp2_submit_response(session, streamId, headers, 2, &body);
+    }
+
+    static ssize_t sendHttp2(nghttp2_session* session, const uint8_t* data, size_t length, int flags, void* userData) {
+        auto state = static_cast<Http2Connection*>(userData);
+        auto n = state->connection->write(reinterpret_cast<const char*>(data), length);
+        return n > 0 ? n : NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+
+    static int onHttp2FrameReceived(nghttp2_session* session, const nghttp2_frame* frame, void* userData) {
+        auto state = static_cast<Http2Connection*>(userData);
+        // a request is complete when its stream is closed by the client, with or without a body
+        if ((frame->hd.type == NGHTTP2_HEADERS || frame->hd.type == NGHTTP2_DATA) &&
+            (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) != 0) {
+            state->server->requestStarted();
+            auto due = std::chrono::steady_clock::now() + state->server->m_responseDelay;
+            state->pending.push_back({frame->hd.stream_id, due});
+        }
+        return 0;
+    }
+
+    static ssize_t readHttp2Body(
+        nghttp2_session* session,
+        int32_t streamId,
+        uint8_t* buffer,
+        size_t length,
+        uint32_t* flags,
+        nghttp2_data_source* source,
+        void* userData) {
+        auto size = std::min(length, TEST_RESPONSE_BODY.size());
+        std::memcpy(buffer, TEST_RESPONSE_BODY.data(), size);
+        *flags |= NGHTTP2_DATA_FLAG_EOF;
+        return static_cast<ssize_t>(size);
+    }
+
+    void requestStarted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_concurrentRequests++;
+        m_maxConcurrentRequests = std::max(m_maxConcurrentRequests.load(), m_concurrentRequests);
+    }
+
+    void requestFinished() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_concurrentRequests--;
+    }
+
+    void closeClient(Connection& connection) {
+        if (connection.ssl != nullptr) {
+            SSL_free(connection.ssl);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_clients.erase(std::remove(m_clients.begin(), m_clients.end(), connection.socket), m_clients.end());
+        ::close(connection.socket);
+    }
+
+private:
+    const Protocol m_protocol;
+    SSL_CTX* m_sslContext = nullptr;
+    std::chrono::milliseconds m_responseDelay{0};
+    int m_socket = -1;
+    uint16_t m_port = 0;
+    std::atomic<bool> m_running{true};
+    std::atomic<size_t> m_connectionCount{0};
+    std::atomic<size_t> m_http2ConnectionCount{0};
+    size_t m_concurrentRequests = 0;
+    std::atomic<size_t> m_maxConcurrentRequests{0};
+    std::thread m_acceptThread;
+    std::vector<std::thread> m_connectionThreads;
+    std::vector<int> m_clients;
+    std::mutex m_mutex;
+};
+
+class HttpClientPoolTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(m_certificate.create()) << "Creating the loopback certificate failed!";
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig(), m_certificate.getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+        m_initialized = true;
+
+        ASSERT_TRUE(m_server.start()) << "Starting loopback HTTP server failed!";
+    }
+
+    void TearDown() override {
+        m_server.stop();
+        if (m_initialized) {
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+            m_initialized = false;
+        }
+    }
+
+protected:
+    /// Issues @c TEST_CONCURRENT_REQUEST_COUNT requests at once and returns the number that succeeded.
+    static size_t doConcurrentRequests(std::shared_ptr<HttpClientPool> pool, const std::string& url) {
+        std::atomic<size_t> successCount{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < TEST_CONCURRENT_REQUEST_COUNT; t++) {
+            threads.emplace_back([&] {
+                auto response = pool->doGet(url, {}, TEST_TIMEOUT);
+                if (response.code == 200 && response.body == TEST_RESPONSE_BODY) {
+                    successCount++;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return successCount;
+    }
+
+    /// Returns the median of the request latencies in microseconds.
+    static int getMedianMicroseconds(std::vector<std::chrono::steady_clock::duration> latencies) {
+        std::sort(latencies.begin(), latencies.end());
+        return static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(latencies[latencies.size() / 2]).count());
+    }
+
+    LoopbackCertificate m_certificate;
+    LoopbackHttpServer m_server;
+
+private:
+    bool m_initialized = false;
+};
+
+TEST_F(HttpClientPoolTest, create) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+    ASSERT_EQ(pool->getIdleHandleCount(), 0u);
+}
+
+TEST_F(HttpClientPoolTest, sequentialRequestsReuseConnection) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    for (size_t i = 0; i < TEST_REQUEST_COUNT; i++) {
+        auto response = pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT);
+        ASSERT_EQ(response.code, 200);
+        ASSERT_EQ(response.body, TEST_RESPONSE_BODY);
+    }
+
+    ASSERT_EQ(m_server.getConnectionCount(), 1u);
+    ASSERT_EQ(pool->getIdleHandleCount(), 1u);
+}
+
+TEST_F(HttpClientPoolTest, unpooledRequestsOpenConnectionPerRequest) {
+    for (size_t i = 0; i < TEST_REQUEST_COUNT; i++) {
+        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
+        ASSERT_NE(httpGet, nullptr);
+        auto response = httpGet->doGet(m_server.getUrl(), {}, TEST_TIMEOUT);
+        ASSERT_EQ(response.code, 200);
+    }
+
+    ASSERT_EQ(m_server.getConnectionCount(), TEST_REQUEST_COUNT);
+}
+
+TEST_F(HttpClientPoolTest, httpsLatencyWithAndWithoutPool) {
+    LoopbackHttpServer server(LoopbackHttpServer::Protocol::HTTPS);
+    ASSERT_TRUE(server.start(&m_certificate)) << "Starting loopback HTTPS server failed!";
+
+    // before: every request creates its own handle, as the REST agents did
+    std::vector<std::chrono::steady_clock::duration> unpooled;
+    for (size_t i = 0; i < TEST_REQUEST_COUNT; i++) {
+        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
+        ASSERT_NE(httpGet, nullptr);
+        auto start = std::chrono::steady_clock::now();
+        auto response = httpGet->doGet(server.getUrl(), {}, TEST_TIMEOUT);
+        unpooled.push_back(std::chrono::steady_clock::now() - start);
+        ASSERT_EQ(response.code, 200);
+    }
+    ASSERT_EQ(server.getConnectionCount(), TEST_REQUEST_COUNT);
+
+    // after: the requests share the pool's connection
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+    std::vector<std::chrono::steady_clock::duration> pooled;
+    for (size_t i = 0; i < TEST_REQUEST_COUNT; i++) {
+        auto start = std::chrono::steady_clock::now();
+        auto response = pool->doGet(server.getUrl(), {}, TEST_TIMEOUT);
+        pooled.push_back(std::chrono::steady_clock::now() - start);
+        ASSERT_EQ(response.code, 200);
+        ASSERT_EQ(response.body, TEST_RESPONSE_BODY);
+    }
+    ASSERT_EQ(server.getConnectionCount(), TEST_REQUEST_COUNT + 1);
+
+    RecordProperty("unpooledMedianMicroseconds", getMedianMicroseconds(unpooled));
+    RecordProperty("pooledMedianMicroseconds", getMedianMicroseconds(pooled));
+}
+
+TEST_F(HttpClientPoolTest, concurrentHttp2RequestsShareConnection) {
+    LoopbackHttpServer server(LoopbackHttpServer::Protocol::HTTPS);
+    server.setResponseDelay(TEST_RESPONSE_DELAY);
+    ASSERT_TRUE(server.start(&m_certificate)) << "Starting loopback HTTPS server failed!";
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    ASSERT_EQ(doConcurrentRequests(pool, server.getUrl()), TEST_CONCURRENT_REQUEST_COUNT);
+
+    ASSERT_EQ(server.getConnectionCount(), 1u);
+    ASSERT_EQ(server.getHttp2ConnectionCount(), 1u);
+    ASSERT_GT(server.getMaxConcurrentRequests(), 1u);
+}
+
+TEST_F(HttpClientPoolTest, http2DisabledUsesHttp11Connections) {
+    LoopbackHttpServer server(LoopbackHttpServer::Protocol::HTTPS);
+    server.setResponseDelay(TEST_RESPONSE_DELAY);
+    ASSERT_TRUE(server.start(&m_certificate)) << "Starting loopback HTTPS server failed!";
+    HttpClientPool::Config config;
+    config.http2Enabled = false;
+    auto pool = HttpClientPool::create(config);
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    ASSERT_EQ(doConcurrentRequests(pool, server.getUrl()), TEST_CONCURRENT_REQUEST_COUNT);
+
+    ASSERT_EQ(server.getHttp2ConnectionCount(), 0u);
+    ASSERT_GT(server.getConnectionCount(), 1u);
+    ASSERT_LE(server.getConnectionCount(), config.maxConnectionsPerHost);
+}
+
+TEST_F(HttpClientPoolTest, postPutDeleteShareConnection) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    ASSERT_EQ(pool->doPost(m_server.getUrl(), {}, "{\"entries\":[]}", TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(pool->doPut(m_server.getUrl(), {}, "{\"name\":\"test\"}", TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(pool->doDelete(m_server.getUrl(), {}, TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT).code, 200);
+
+    ASSERT_EQ(m_server.getConnectionCount(), 1u);
+}
+
+TEST_F(HttpClientPoolTest, invalidateClosesIdleConnections) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    ASSERT_EQ(pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(m_server.getConnectionCount(), 1u);
+
+    pool->invalidate();
+
+    ASSERT_EQ(pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT).code, 200);
+    ASSERT_EQ(m_server.getConnectionCount(), 2u);
+}
+
+TEST_F(HttpClientPoolTest, concurrentRequestsRespectHostLimit) {
+    HttpClientPool::Config config;
+    config.maxConnectionsPerHost = 2;
+    config.maxIdleConnections = 2;
+    auto pool = HttpClientPool::create(config);
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+    m_server.setResponseDelay(TEST_RESPONSE_DELAY);
+
+    ASSERT_EQ(doConcurrentRequests(pool, m_server.getUrl()), TEST_CONCURRENT_REQUEST_COUNT);
+
+    ASSERT_LE(m_server.getConnectionCount(), config.maxConnectionsPerHost);
+    ASSERT_LE(m_server.getMaxConcurrentRequests(), config.maxConnectionsPerHost);
+    ASSERT_LE(pool->getIdleHandleCount(), config.maxIdleConnections);
+}
+
+TEST_F(HttpClientPoolTest, shutdownFailsRequestInFlight) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+    m_server.setResponseDelay(std::chrono::milliseconds(2000));
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread request([&] {
+        auto response = pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT);
+        EXPECT_EQ(
+            response.code, alexaClientSDK::avsCommon::utils::http::HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED);
+    });
+    while (m_server.getMaxConcurrentRequests() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    pool->shutdown();
+    request.join();
+
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(2000));
+}
+
+TEST_F(HttpClientPoolTest, requestsFailAfterShutdown) {
+    auto pool = HttpClientPool::create();
+    ASSERT_NE(pool, nullptr) << "HttpClientPool pointer expected to be not null";
+
+    pool->shutdown();
+    auto response = pool->doGet(m_server.getUrl(), {}, TEST_TIMEOUT);
+    ASSERT_EQ(response.code, alexaClientSDK::avsCommon::utils::http::HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED);
+    ASSERT_EQ(m_server.getConnectionCount(), 0u);
+}
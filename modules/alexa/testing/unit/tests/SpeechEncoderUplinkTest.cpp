@@ -0,0 +1,216 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <SpeechEncoder/OpusEncoderContext.h>
+#include <SpeechEncoder/SpeechEncoder.h>
+
+using namespace alexaClientSDK;
+using AudioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream;
+
+/// Environment variable naming a directory with recorded utterances, such as samples/cpp/assets/inputs.
+static const char* UTTERANCE_DIRECTORY_VARIABLE = "AACE_TEST_UTTERANCE_DIR";
+
+/// The recorded utterances read from the utterance directory, if it is set.
+static const std::vector<std::string> UTTERANCE_FILES = {"alexa_stop.wav",
+                                                         "alexa_tell_me_a_joke.wav",
+                                                         "alexa_what_will_todays_weather_be.wav",
+                                                         "hello.wav"};
+
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// Audio is written to the encoder in real time, one chunk at a time, as the microphone would.
+static const std::chrono::milliseconds CHUNK_DURATION = std::chrono::milliseconds(20);
+static const size_t CHUNK_SAMPLES = SAMPLE_RATE_HZ * CHUNK_DURATION.count() / 1000;
+
+/// The time without encoded output after which the encoder is considered drained.
+static const std::chrono::milliseconds DRAIN_TIMEOUT = std::chrono::milliseconds(500);
+
+/// The ratio by which the encoded upload must be smaller than the LPCM upload.
+static const size_t MIN_COMPRESSION_RATIO = 4;
+
+/// The longest acceptable time from the end of speech to the last encoded byte.
+static const std::chrono::milliseconds MAX_TIME_TO_LAST_BYTE = std::chrono::milliseconds(250);
+
+struct Utterance {
+    std::string name;
+    std::vector<int16_t> samples;
+};
+
+struct UplinkMeasurement {
+    size_t lpcmBytes = 0;
+    size_t encodedBytes = 0;
+    std::chrono::milliseconds timeToLastByte{0};
+};
+
+/// Test harness for the uplink size and latency of the speech encoder used for @c Recognize events
+class SpeechEncoderUplinkTest : public ::testing::Test {
+protected:
+    static avsCommon::utils::AudioFormat createAudioFormat() {
+        avsCommon::utils::AudioFormat audioFormat;
+        audioFormat.encoding = avsCommon::utils::AudioFormat::Encoding::LPCM;
+        audioFormat.endianness = avsCommon::utils::AudioFormat::Endianness::LITTLE;
+        audioFormat.sampleRateHz = SAMPLE_RATE_HZ;
+        audioFormat.sampleSizeInBits = 16;
+        audioFormat.numChannels = 1;
+        audioFormat.dataSigned = true;
+        audioFormat.layout = avsCommon::utils::AudioFormat::Layout::INTERLEAVED;
+        return audioFormat;
+    }
+
+    /// Reads the samples of a 16 kHz 16-bit mono WAV file.
+    static bool readWav(const std::string& path, std::vector<int16_t>& samples) {
+        std::ifstream file(path, std::ios::binary);
+        char riff[12];
+        if (!file.read(riff, sizeof(riff)) || std::memcmp(riff, "RIFF", 4) != 0 ||
+            std::memcmp(riff + 8, "WAVE", 4) != 0) {
+            return false;
+        }
+        char chunk[8];
+        while (file.read(chunk, sizeof(chunk))) {
+            uint32_t size = 0;
+            for (int j = 7; j >= 4; j--) {
+                size = (size << 8) | static_cast<uint8_t>(chunk[j]);
+            }
+            if (std::memcmp(chunk, "data", 4) == 0) {
+                samples.resize(size / sizeof(int16_t));
+                return static_cast<bool>(file.read(reinterpret_cast<char*>(samples.data()), size));
+            }
+            file.seekg(size + (size & 1), std::ios::cur);
+        }
+        return false;
+    }
+
+    /// A two second amplitude modulated noise signal with a syllable-like envelope.
+    static Utterance createSyntheticUtterance() {
+        Utterance utterance{"synthetic", std::vector<int16_t>(SAMPLE_RATE_HZ * 2)};
+        std::mt19937 random(1);
+        std::normal_distribution<float> noise(0, 1);
+        for (size_t j = 0; j < utterance.samples.size(); j++) {
+            float envelope = std::fabs(std::sin(j * 4.0f * 3.14159f / SAMPLE_RATE_HZ));
+            utterance.samples[j] = static_cast<int16_t>(4000 * envelope * noise(random));
+        }
+        return utterance;
+    }
+
+    static std::vector<Utterance> loadUtterances() {
+        std::vector<Utterance> utterances;
+        const char* directory = std::getenv(UTTERANCE_DIRECTORY_VARIABLE);
+        if (directory != nullptr) {
+            for (const auto& name : UTTERANCE_FILES) {
+                Utterance utterance{name, {}};
+                if (readWav(std::string(directory) + "/" + name, utterance.samples)) {
+                    utterances.push_back(std::move(utterance));
+                }
+            }
+        }
+        if (utterances.empty()) {
+            utterances.push_back(createSyntheticUtterance());
+        }
+        return utterances;
+    }
+
+    /**
+     * Writes the utterance into an input stream in real time while the encoder drains its output, as during a
+     * @c Recognize event, and measures the bytes that would be uploaded.
+     */
+    static UplinkMeasurement measure(const Utterance& utterance) {
+        UplinkMeasurement measurement;
+        measurement.lpcmBytes = utterance.samples.size() * sizeof(int16_t);
+
+        size_t bufferSize =
+            AudioInputStream::calculateBufferSize(utterance.samples.size() + SAMPLE_RATE_HZ, sizeof(int16_t), 2);
+        auto buffer = std::make_shared<AudioInputStream::Buffer>(bufferSize);
+        auto inputStream = AudioInputStream::create(buffer, sizeof(int16_t), 2);
+        EXPECT_NE(inputStream, nullptr);
+        if (inputStream == nullptr) {
+            return measurement;
+        }
+        auto writer = inputStream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+
+        auto encoder =
+            std::make_shared<speechencoder::SpeechEncoder>(std::make_shared<speechencoder::OpusEncoderContext>());
+        EXPECT_TRUE(encoder->startEncoding(
+            inputStream, createAudioFormat(), 0, AudioInputStream::Reader::Reference::ABSOLUTE));
+        auto encodedStream = encoder->getEncodedStream();
+        EXPECT_NE(encodedStream, nullptr);
+        if (encodedStream == nullptr) {
+            return measurement;
+        }
+        auto reader = encodedStream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+        auto wordSize = encodedStream->getWordSize();
+
+        std::chrono::steady_clock::time_point endOfSpeech;
+        std::chrono::steady_clock::time_point lastByte;
+        std::thread uplink([&] {
+            std::vector<uint8_t> packet(4096 * wordSize);
+            while (true) {
+                auto words = reader->read(packet.data(), packet.size() / wordSize, DRAIN_TIMEOUT);
+                if (words <= 0) {
+                    break;
+                }
+                measurement.encodedBytes += words * wordSize;
+                lastByte = std::chrono::steady_clock::now();
+            }
+        });
+
+        auto next = std::chrono::steady_clock::now();
+        for (size_t offset = 0; offset < utterance.samples.size(); offset += CHUNK_SAMPLES) {
+            std::this_thread::sleep_until(next);
+            writer->write(&utterance.samples[offset], std::min(CHUNK_SAMPLES, utterance.samples.size() - offset));
+            next += CHUNK_DURATION;
+        }
+        endOfSpeech = std::chrono::steady_clock::now();
+        encoder->stopEncoding();
+
+        uplink.join();
+        writer->close();
+
+        measurement.timeToLastByte = std::chrono::duration_cast<std::chrono::milliseconds>(lastByte - endOfSpeech);
+        return measurement;
+    }
+};
+
+TEST_F(SpeechEncoderUplinkTest, opusReducesUplinkBytes) {
+    for (const auto& utterance : loadUtterances()) {
+        auto measurement = measure(utterance);
+        std::cout << utterance.name << ": lpcmBytes=" << measurement.lpcmBytes
+                  << " opusBytes=" << measurement.encodedBytes
+                  << " timeToLastByteMs=" << measurement.timeToLastByte.count() << std::endl;
+        RecordProperty(utterance.name + ".lpcmBytes", static_cast<int>(measurement.lpcmBytes));
+        RecordProperty(utterance.name + ".opusBytes", static_cast<int>(measurement.encodedBytes));
+        RecordProperty(utterance.name + ".timeToLastByteMs", static_cast<int>(measurement.timeToLastByte.count()));
+
+        EXPECT_GT(measurement.encodedBytes, 0u) << utterance.name;
+        EXPECT_LT(measurement.encodedBytes * MIN_COMPRESSION_RATIO, measurement.lpcmBytes) << utterance.name;
+        EXPECT_LT(measurement.timeToLastByte, MAX_TIME_TO_LAST_BYTE) << utterance.name;
+    }
+}
@@ -66,6 +66,10 @@ public:
 
     void TearDown() override {
         if (m_initialized) {
+            if (m_audioInputStreamManager != nullptr) {
+                m_audioInputStreamManager->shutdown();
+                m_audioInputStreamManager.reset();
+            }
             m_alexaMockFactory->shutdown();
 
             alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
@@ -128,7 +132,7 @@ protected:
                                               m_alexaMockFactory->getSpeechRecognizerMock(),
                                               m_alexaMockFactory->getEndpointBuilderMock(),
                                               createAudioFormat(),
-                                              m_alexaMockFactory->getAudioManagerMock(),
+                                              getAudioInputStreamManager(),
                                               m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                               m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                               m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -154,6 +158,14 @@ protected:
         return speechRecognizerEngineImpl;
     }
 
+    std::shared_ptr<aace::engine::alexa::AudioInputStreamManager> getAudioInputStreamManager() {
+        if (m_audioInputStreamManager == nullptr) {
+            m_audioInputStreamManager = aace::engine::alexa::AudioInputStreamManager::create(
+                m_alexaMockFactory->getAudioManagerMock(), createAudioFormat());
+        }
+        return m_audioInputStreamManager;
+    }
+
     alexaClientSDK::avsCommon::utils::AudioFormat createAudioFormat() {
         alexaClientSDK::avsCommon::utils::AudioFormat format;
 
@@ -177,6 +189,7 @@ protected:
     std::shared_ptr<aace::test::unit::core::MockPropertyManagerServiceInterface> m_mockPropertyManager;
     std::shared_ptr<aace::test::unit::core::MockWakewordManagerServiceInterface> m_mockWakewordService;
     std::shared_ptr<aace::test::unit::core::MockArbitratorServiceInterface> m_mockArbitratorService;
+    std::shared_ptr<aace::engine::alexa::AudioInputStreamManager> m_audioInputStreamManager;
 
 private:
     bool m_initialized = false;
@@ -197,7 +210,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithPlatformInterfaceAsNull) {
                                           nullptr,
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -223,7 +236,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithPlatformInterfaceAsNull) {
     ASSERT_EQ(speechRecognizerEngineImpl, nullptr) << "SpeechRecognizerEngineImpl pointer expected to be null";
 }
 
-TEST_F(SpeechRecognizerEngineImplTest, createWithAudioManagerInterfaceAsNull) {
+TEST_F(SpeechRecognizerEngineImplTest, createWithAudioInputStreamManagerAsNull) {
     EXPECT_CALL(*m_alexaMockFactory->getDirectiveSequencerInterfaceMock(), doShutdown());
 
     auto speechRecognizerEngineImpl = aace::engine::alexa::SpeechRecognizerEngineImpl::create(
@@ -261,7 +274,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithDirectiveSequencerAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           nullptr,
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -294,7 +307,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithMessageSenderAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           nullptr,
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -327,7 +340,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithContextManagerAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           nullptr,
@@ -360,7 +373,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithFocusManagerAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -393,7 +406,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithDialogUXStateAggregatorAsNull)
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -426,7 +439,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithExceptionSenderAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -459,7 +472,7 @@ TEST_F(SpeechRecognizerEngineImplTest, createWithUserInactivityMonitorAsNull) {
                                           m_alexaMockFactory->getSpeechRecognizerMock(),
                                           m_alexaMockFactory->getEndpointBuilderMock(),
                                           createAudioFormat(),
-                                          m_alexaMockFactory->getAudioManagerMock(),
+                                          getAudioInputStreamManager(),
                                           m_alexaMockFactory->getDirectiveSequencerInterfaceMock(),
                                           m_alexaMockFactory->getMessageSenderInterfaceMock(),
                                           m_alexaMockFactory->getContextManagerInterfaceMock(),
@@ -0,0 +1,250 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/Alexa/SystemSoundPlayer.h>
+#include <AACE/Test/Unit/Audio/MockAudioManagerInterface.h>
+#include <AACE/Test/Unit/Audio/MockAudioOutputChannelInterface.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using Tone = alexaClientSDK::avsCommon::sdkInterfaces::SystemSoundPlayerInterface::Tone;
+using MediaType = alexaClientSDK::avsCommon::utils::MediaType;
+using MediaState = aace::audio::AudioOutputEngineInterface::MediaState;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+/// The number of tones played by the latency benchmark.
+static constexpr int BENCHMARK_ITERATIONS = 1000;
+
+/// Tone factory returning in-memory streams and counting how many times each tone is opened.
+class FakeSystemSoundAudioFactory
+        : public alexaClientSDK::avsCommon::sdkInterfaces::audio::SystemSoundAudioFactoryInterface {
+public:
+    std::function<std::pair<std::unique_ptr<std::istream>, const MediaType>()> endSpeechTone() const override {
+        return [this]() { return open(m_endSpeechCount, "end-speech"); };
+    }
+
+    std::function<std::pair<std::unique_ptr<std::istream>, const MediaType>()> wakeWordNotificationTone()
+        const override {
+        return [this]() { return open(m_wakeWordCount, "wakeword-notification"); };
+    }
+
+    mutable std::atomic<int> m_endSpeechCount{0};
+    mutable std::atomic<int> m_wakeWordCount{0};
+
+private:
+    std::pair<std::unique_ptr<std::istream>, const MediaType> open(
+        std::atomic<int>& count,
+        const std::string& data) const {
+        count++;
+        return {std::unique_ptr<std::istream>(new std::istringstream(data)), MediaType::MPEG};
+    }
+};
+
+class SystemSoundPlayerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_audioFactory = std::make_shared<FakeSystemSoundAudioFactory>();
+        m_audioManager = std::make_shared<NiceMock<aace::test::unit::audio::MockAudioManagerInterface>>();
+        m_audioChannel =
+            std::make_shared<NiceMock<aace::test::unit::audio::MockAudioOutputChannelInterface>>();
+
+        ON_CALL(*m_audioManager, openAudioOutputChannel(_, _)).WillByDefault(Return(m_audioChannel));
+        ON_CALL(*m_audioChannel, prepare(::testing::An<std::shared_ptr<aace::audio::AudioStream>>(), _))
+            .WillByDefault(
+                Invoke([this](std::shared_ptr<aace::audio::AudioStream> stream, bool) { return onPrepare(stream); }));
+        ON_CALL(*m_audioChannel, play()).WillByDefault(Return(true));
+
+        m_systemSoundPlayer = aace::engine::alexa::SystemSoundPlayer::create(m_audioManager, m_audioFactory);
+        ASSERT_NE(m_systemSoundPlayer, nullptr);
+    }
+
+    /// Waits for a number of streams to be prepared on the audio channel.
+    bool waitForPreparedStreams(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_preparedCondition.wait_for(
+            lock, std::chrono::seconds(1), [this, count]() { return m_preparedStreams.size() >= count; });
+    }
+
+    /// Records a stream prepared on the audio channel.
+    bool onPrepare(std::shared_ptr<aace::audio::AudioStream> stream) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_preparedStreams.push_back(stream);
+        m_preparedCondition.notify_all();
+        return true;
+    }
+
+    void TearDown() override {
+        m_systemSoundPlayer.reset();
+    }
+
+    /// Returns the content of a prepared stream.
+    static std::string readStream(std::shared_ptr<aace::audio::AudioStream> stream) {
+        std::string content;
+        char buffer[4];
+        ssize_t count;
+        while ((count = stream->read(buffer, sizeof(buffer))) > 0) {
+            content.append(buffer, count);
+        }
+        return content;
+    }
+
+    std::shared_ptr<FakeSystemSoundAudioFactory> m_audioFactory;
+    std::shared_ptr<aace::test::unit::audio::MockAudioManagerInterface> m_audioManager;
+    std::shared_ptr<aace::test::unit::audio::MockAudioOutputChannelInterface> m_audioChannel;
+    std::shared_ptr<aace::engine::alexa::SystemSoundPlayer> m_systemSoundPlayer;
+    std::vector<std::shared_ptr<aace::audio::AudioStream>> m_preparedStreams;
+    std::mutex m_mutex;
+    std::condition_variable m_preparedCondition;
+};
+
+TEST_F(SystemSoundPlayerTest, tonesAreReadOnceWhenCreated) {
+    EXPECT_EQ(m_audioFactory->m_wakeWordCount, 1);
+    EXPECT_EQ(m_audioFactory->m_endSpeechCount, 1);
+
+    for (int i = 0; i < 3; i++) {
+        auto result = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+        m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+        ASSERT_EQ(result.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+        EXPECT_TRUE(result.get());
+    }
+    EXPECT_EQ(m_audioFactory->m_wakeWordCount, 1);
+    ASSERT_EQ(m_preparedStreams.size(), 3u);
+    for (auto& stream : m_preparedStreams) {
+        EXPECT_EQ(readStream(stream), "wakeword-notification");
+        EXPECT_TRUE(stream->isClosed());
+        EXPECT_EQ(stream->getMediaType(), aace::audio::AudioStream::MediaType::MPEG);
+    }
+}
+
+TEST_F(SystemSoundPlayerTest, warmUpOpensChannelOnce) {
+    EXPECT_CALL(*m_audioManager, openAudioOutputChannel(_, _)).Times(1);
+    EXPECT_CALL(*m_audioChannel, setEngineInterface(_)).Times(1);
+
+    EXPECT_TRUE(m_systemSoundPlayer->warmUp());
+    EXPECT_TRUE(m_systemSoundPlayer->warmUp());
+    auto result = m_systemSoundPlayer->playTone(Tone::END_SPEECH);
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    EXPECT_TRUE(result.get());
+}
+
+TEST_F(SystemSoundPlayerTest, toneRequestedWhilePlayingIsQueued) {
+    auto first = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+    auto second = m_systemSoundPlayer->playTone(Tone::END_SPEECH);
+    EXPECT_EQ(second.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    EXPECT_EQ(m_preparedStreams.size(), 1u);
+
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    EXPECT_TRUE(first.get());
+
+    // the queued tone is started by the executor
+    ASSERT_TRUE(waitForPreparedStreams(2));
+    EXPECT_EQ(readStream(m_preparedStreams[1]), "end-speech");
+
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    ASSERT_EQ(second.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_TRUE(second.get());
+}
+
+TEST_F(SystemSoundPlayerTest, queuedToneSharesResultOfSameTone) {
+    auto first = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+    auto second = m_systemSoundPlayer->playTone(Tone::END_SPEECH);
+    auto third = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+
+    // every tone is now waiting, so further requests share the queued results instead of failing
+    auto fourth = m_systemSoundPlayer->playTone(Tone::END_SPEECH);
+    auto fifth = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+    EXPECT_EQ(fourth.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    EXPECT_EQ(fifth.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    m_systemSoundPlayer->onMediaError(
+        aace::audio::AudioOutputEngineInterface::MediaError::MEDIA_ERROR_UNKNOWN, "error");
+    EXPECT_FALSE(first.get());
+    ASSERT_TRUE(waitForPreparedStreams(2));
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    EXPECT_TRUE(second.get());
+    ASSERT_TRUE(waitForPreparedStreams(3));
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    EXPECT_TRUE(third.get());
+    EXPECT_TRUE(fourth.get());
+    EXPECT_TRUE(fifth.get());
+
+    // the shared requests did not play again
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EXPECT_EQ(m_preparedStreams.size(), 3u);
+}
+
+TEST_F(SystemSoundPlayerTest, prepareFailureStartsNextTone) {
+    EXPECT_CALL(*m_audioChannel, prepare(::testing::An<std::shared_ptr<aace::audio::AudioStream>>(), _))
+        .WillOnce(Return(false))
+        .WillRepeatedly(
+            Invoke([this](std::shared_ptr<aace::audio::AudioStream> stream, bool) { return onPrepare(stream); }));
+
+    auto first = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+    ASSERT_EQ(first.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_FALSE(first.get());
+
+    auto second = m_systemSoundPlayer->playTone(Tone::END_SPEECH);
+    EXPECT_EQ(m_preparedStreams.size(), 1u);
+    m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+    EXPECT_TRUE(second.get());
+}
+
+TEST_F(SystemSoundPlayerTest, benchmarkWakewordToneLatency) {
+    std::chrono::steady_clock::time_point playTime;
+    EXPECT_CALL(*m_audioChannel, play()).WillRepeatedly(Invoke([&playTime]() {
+        playTime = std::chrono::steady_clock::now();
+        return true;
+    }));
+    ASSERT_TRUE(m_systemSoundPlayer->warmUp());
+
+    std::vector<int64_t> latencies;
+    latencies.reserve(BENCHMARK_ITERATIONS);
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = m_systemSoundPlayer->playTone(Tone::WAKEWORD_NOTIFICATION);
+        latencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(playTime - start).count());
+        m_systemSoundPlayer->onMediaStateChanged(MediaState::STOPPED);
+        ASSERT_TRUE(result.get());
+    }
+    m_preparedStreams.clear();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto median = latencies[latencies.size() / 2];
+    auto p99 = latencies[latencies.size() * 99 / 100];
+    RecordProperty("medianLatencyMicroseconds", static_cast<int>(median));
+    RecordProperty("p99LatencyMicroseconds", static_cast<int>(p99));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -32,6 +32,7 @@
 #include "AACE/APL/APL.h"
 #include "AACE/APL/APLEngineInterface.h"
 #include "AACE/Engine/APL/APLRuntimePropertyGenerator.h"
+#include "AACE/Engine/APL/APLStateCache.h"
 
 namespace aace {
 namespace engine {
@@ -138,6 +139,9 @@ private:
     /// APL Runtime Property Generator
     APLRuntimePropertyGenerator m_aplRuntimePropertyGenerator;
 
+    /// APL state last sent to the platform
+    APLStateCache m_aplStateCache;
+
     /// Stop dialog channel
     bool m_stopDialog;
 };
@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_APL_APL_RUNTIME_PROPERTY_GENERATOR_H
 #define AACE_ENGINE_APL_APL_RUNTIME_PROPERTY_GENERATOR_H
 
+#include <string>
 #include <unordered_map>
 
 namespace aace {
@@ -31,11 +32,23 @@ class APLRuntimePropertyGenerator {
 public:
     APLRuntimePropertyGenerator();
 
-    void handleProperty(const std::string& name, const std::string& value);
+    /**
+     * Sets a platform property.
+     *
+     * @return @c true if the value of the property changed.
+     */
+    bool handleProperty(const std::string& name, const std::string& value);
+
+    /// Returns the APL runtime properties, generating them again only after a platform property changed.
     std::string getAPLRuntimeProperties();
 
 private:
+    std::string generateAPLRuntimeProperties();
+
     std::unordered_map<std::string, std::string> m_platformProperties;
+
+    /// The runtime properties generated from the current platform properties.
+    std::string m_aplRuntimeProperties;
 };
 
 }  // namespace apl
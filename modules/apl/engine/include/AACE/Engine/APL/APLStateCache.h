@@ -0,0 +1,97 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_APL_APL_STATE_CACHE_H
+#define AACE_ENGINE_APL_APL_STATE_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+/**
+ * This class keeps the APL state last sent to the platform: the runtime
+ * properties, the token of the rendered document, and the versioned data
+ * source updates applied to that document. It is used to suppress updates
+ * that would not change what the platform renders.
+ *
+ * A data source update is only suppressed when it carries a @c listVersion
+ * and is identical to the last versioned update of the same list of the
+ * rendered document. Updates without a version are always passed to the
+ * platform, since two identical payloads may still be meant to be applied
+ * twice.
+ *
+ * Some state is deliberately not cached:
+ * - Rendered documents are not cached by token. A @c RenderDocument directive
+ *   with the token of the rendered document restarts the document, and
+ *   @c APL::renderDocument() requires the complete document each time.
+ * - Data sources are not diffed. The payloads of the dynamic data source
+ *   directives are already deltas of a list, and the complete data source is
+ *   only known to the platform APL runtime.
+ * - Runtime properties are not split into changed values.
+ *   @c APL::updateAPLRuntimeProperties() replaces every property, and the
+ *   driving state, theme and video properties are each a single value.
+ */
+class APLStateCache {
+public:
+    APLStateCache();
+
+    /**
+     * Records the runtime properties sent to the platform.
+     *
+     * @return @c false if the properties are the same as the last ones sent.
+     */
+    bool updateRuntimeProperties(const std::string& properties);
+
+    /// Records the document rendered for a token, dropping the data sources of the previous document.
+    void renderDocument(const std::string& token);
+
+    /// Forgets the document of a token, if it is the rendered document.
+    void clearDocument(const std::string& token);
+
+    /**
+     * Records a data source update for the document of a token.
+     *
+     * @return @c false if the update carries a list version and is the same as the last one applied to its list
+     *     in the rendered document.
+     */
+    bool updateDataSource(const std::string& token, const std::string& sourceType, const std::string& payload);
+
+    /// Returns the number of updates that were suppressed.
+    size_t getSuppressedCount();
+
+    /// Returns the number of payload bytes of the updates that were suppressed.
+    size_t getSuppressedBytes();
+
+private:
+    std::string m_runtimeProperties;
+    std::string m_documentToken;
+
+    /// The last versioned data source update applied to the rendered document, keyed by source type and list id.
+    std::unordered_map<std::string, std::string> m_dataSources;
+
+    size_t m_suppressedCount;
+    size_t m_suppressedBytes;
+    std::mutex m_mutex;
+};
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
+
+#endif
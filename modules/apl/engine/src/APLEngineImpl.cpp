@@ -163,6 +163,7 @@ void APLEngineImpl::renderDocument(
     const std::string& token,
     const std::string& windowId) {
     AACE_INFO(LX(TAG));
+    m_aplStateCache.renderDocument(token);
     if (m_aplPlatformInterface != nullptr) {
         m_executor.submit([this, jsonPayload, token, windowId]() {
             m_aplPlatformInterface->renderDocument(jsonPayload, token, windowId);
@@ -172,6 +173,7 @@ void APLEngineImpl::renderDocument(
 
 void APLEngineImpl::clearDocument(const std::string& token) {
     AACE_INFO(LX(TAG));
+    m_aplStateCache.clearDocument(token);
     if (m_aplPlatformInterface != nullptr) {
         m_aplPlatformInterface->clearDocument(token);
     }
@@ -189,6 +191,14 @@ void APLEngineImpl::dataSourceUpdate(
     const std::string& jsonPayload,
     const std::string& token) {
     AACE_INFO(LX(TAG));
+    if (!m_aplStateCache.updateDataSource(token, sourceType, jsonPayload)) {
+        AACE_DEBUG(LX(TAG)
+                       .m("Data source already applied")
+                       .d("sourceType", sourceType)
+                       .d("suppressedCount", m_aplStateCache.getSuppressedCount())
+                       .d("suppressedBytes", m_aplStateCache.getSuppressedBytes()));
+        return;
+    }
     if (m_aplPlatformInterface != nullptr) {
         m_aplPlatformInterface->dataSourceUpdate(sourceType, jsonPayload, token);
     }
@@ -323,13 +333,21 @@ void APLEngineImpl::onSendDeviceWindowState(const std::string& state) {
 void APLEngineImpl::onSetPlatformProperty(const std::string& name, const std::string& value) {
     AACE_INFO(LX(TAG).d("name", name).d("value", value));
     m_executor.submit([this, name, value]() {
-        m_aplRuntimePropertyGenerator.handleProperty(name, value);
-        executeUpdateRuntimeProperties();
+        if (m_aplRuntimePropertyGenerator.handleProperty(name, value)) {
+            executeUpdateRuntimeProperties();
+        }
     });
 }
 
 void APLEngineImpl::executeUpdateRuntimeProperties() {
     auto properties = m_aplRuntimePropertyGenerator.getAPLRuntimeProperties();
+    if (!m_aplStateCache.updateRuntimeProperties(properties)) {
+        AACE_DEBUG(LX(TAG)
+                       .m("Runtime properties unchanged")
+                       .d("suppressedCount", m_aplStateCache.getSuppressedCount())
+                       .d("suppressedBytes", m_aplStateCache.getSuppressedBytes()));
+        return;
+    }
     m_aplPlatformInterface->updateAPLRuntimeProperties(properties);
     AACE_INFO(LX(TAG).d("aplRuntimeProperties", properties));
 }
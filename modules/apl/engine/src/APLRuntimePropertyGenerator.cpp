@@ -54,11 +54,24 @@ APLRuntimePropertyGenerator::APLRuntimePropertyGenerator() {
     m_platformProperties[THEME_ID] = "";
 }
 
-void APLRuntimePropertyGenerator::handleProperty(const std::string& name, const std::string& value) {
+bool APLRuntimePropertyGenerator::handleProperty(const std::string& name, const std::string& value) {
+    auto it = m_platformProperties.find(name);
+    if (it != m_platformProperties.end() && it->second == value) {
+        return false;
+    }
     m_platformProperties[name] = value;
+    m_aplRuntimeProperties.clear();
+    return true;
 }
 
 std::string APLRuntimePropertyGenerator::getAPLRuntimeProperties() {
+    if (m_aplRuntimeProperties.empty()) {
+        m_aplRuntimeProperties = generateAPLRuntimeProperties();
+    }
+    return m_aplRuntimeProperties;
+}
+
+std::string APLRuntimePropertyGenerator::generateAPLRuntimeProperties() {
     json::Value properties;
 
     std::string drivingState = m_platformProperties.at(DRIVING_STATE);
@@ -67,7 +80,7 @@ std::string APLRuntimePropertyGenerator::getAPLRuntimeProperties() {
     std::string video = drivingState == PARKED ? ENABLED : DISABLED;
 
     // To keep the API flexible warn on unknown values only
-    if (drivingState != PARKED || drivingState != MOVING) {
+    if (drivingState != PARKED && drivingState != MOVING) {
         AACE_WARN(LX(TAG).d("drivingStateUnknownValue", drivingState));
     }
 
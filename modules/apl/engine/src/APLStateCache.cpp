@@ -0,0 +1,112 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <nlohmann/json.hpp>
+
+#include "AACE/Engine/APL/APLStateCache.h"
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.apl.APLStateCache");
+
+// Data source payload keys
+static const std::string LIST_ID("listId");
+static const std::string LIST_VERSION("listVersion");
+
+APLStateCache::APLStateCache() : m_suppressedCount(0), m_suppressedBytes(0) {
+}
+
+bool APLStateCache::updateRuntimeProperties(const std::string& properties) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (properties == m_runtimeProperties) {
+        m_suppressedCount++;
+        m_suppressedBytes += properties.size();
+        return false;
+    }
+    m_runtimeProperties = properties;
+    return true;
+}
+
+void APLStateCache::renderDocument(const std::string& token) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_documentToken = token;
+    m_dataSources.clear();
+}
+
+void APLStateCache::clearDocument(const std::string& token) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (token == m_documentToken) {
+        m_documentToken.clear();
+        m_dataSources.clear();
+    }
+}
+
+bool APLStateCache::updateDataSource(
+    const std::string& token,
+    const std::string& sourceType,
+    const std::string& payload) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // updates of a document that is not rendered are passed through, the platform decides what to do with them
+    if (token.empty() || token != m_documentToken) {
+        return true;
+    }
+
+    auto json = nlohmann::json::parse(payload, nullptr, false);
+    if (!json.is_object()) {
+        return true;
+    }
+    auto listId = json.contains(LIST_ID) && json[LIST_ID].is_string() ? json[LIST_ID].get<std::string>() : "";
+    auto key = sourceType + "/" + listId;
+
+    // only an update that carries a list version can be recognized as a repeat, an update without one may change
+    // the list, so a later repeat of the update before it is applied again
+    if (!json.contains(LIST_VERSION) || !json[LIST_VERSION].is_number_integer()) {
+        m_dataSources.erase(key);
+        return true;
+    }
+
+    auto it = m_dataSources.find(key);
+    if (it != m_dataSources.end() && it->second == payload) {
+        m_suppressedCount++;
+        m_suppressedBytes += payload.size();
+        AACE_DEBUG(LX(TAG)
+                       .m("dataSourceUpdateSuppressed")
+                       .d("sourceType", sourceType)
+                       .d("listId", listId)
+                       .d("listVersion", json[LIST_VERSION].get<int64_t>()));
+        return false;
+    }
+    m_dataSources[key] = payload;
+    return true;
+}
+
+size_t APLStateCache::getSuppressedCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_suppressedCount;
+}
+
+size_t APLStateCache::getSuppressedBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_suppressedBytes;
+}
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,202 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+
+#include <AACE/APL/APL.h>
+#include <AACE/Engine/APL/APLEngineImpl.h>
+
+using namespace aace::test::unit::alexa;
+using ::testing::_;
+using ::testing::Invoke;
+
+static const std::string TEST_TOKEN = "TestToken";
+static const std::string TEST_OTHER_TOKEN = "TestOtherToken";
+static const std::string TEST_WINDOW_ID = "TestWindowId";
+static const std::string TEST_DOCUMENT = R"({"document":{"type":"APL","version":"1.8"}})";
+static const std::string DYNAMIC_INDEX_LIST = "dynamicIndexList";
+
+static const std::string VERSIONED_UPDATE =
+    R"({"listId":"TestList","listVersion":2,"operations":[{"type":"DeleteItem","index":0}]})";
+static const std::string UNVERSIONED_UPDATE = R"({"listId":"TestList","startIndex":0,"items":[{"title":"item"}]})";
+
+/// Time to wait for the Engine to call the platform from its executor.
+static const std::chrono::seconds TIMEOUT = std::chrono::seconds(2);
+
+class MockAPL : public aace::apl::APL {
+public:
+    MOCK_METHOD3(
+        renderDocument,
+        void(const std::string& jsonPayload, const std::string& token, const std::string& windowId));
+    MOCK_METHOD1(clearDocument, void(const std::string& token));
+    MOCK_METHOD2(executeCommands, void(const std::string& jsonPayload, const std::string& token));
+    MOCK_METHOD1(interruptCommandSequence, void(const std::string& token));
+    MOCK_METHOD3(
+        dataSourceUpdate,
+        void(const std::string& sourceType, const std::string& jsonPayload, const std::string& token));
+    MOCK_METHOD1(updateAPLRuntimeProperties, void(const std::string& properties));
+};
+
+/// Counts the calls and payload bytes that reach the platform.
+class PlatformTraffic {
+public:
+    void add(const std::string& payload) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_calls++;
+        m_bytes += payload.size();
+        m_trigger.notify_all();
+    }
+
+    bool waitForCalls(size_t calls) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_trigger.wait_for(lock, TIMEOUT, [this, calls]() { return m_calls >= calls; });
+    }
+
+    size_t getCalls() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calls;
+    }
+
+    size_t getBytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+    size_t m_calls = 0;
+    size_t m_bytes = 0;
+};
+
+class APLEngineImplTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+        m_initialized = true;
+
+        m_aplMock = std::make_shared<::testing::NiceMock<MockAPL>>();
+        ON_CALL(*m_aplMock, updateAPLRuntimeProperties(_)).WillByDefault(Invoke([this](const std::string& properties) {
+            m_runtimePropertyTraffic.add(properties);
+        }));
+        ON_CALL(*m_aplMock, dataSourceUpdate(_, _, _))
+            .WillByDefault(Invoke([this](const std::string&, const std::string& jsonPayload, const std::string&) {
+                m_dataSourceTraffic.add(jsonPayload);
+            }));
+
+        EXPECT_CALL(*m_alexaMockFactory->getDirectiveSequencerInterfaceMock(), doShutdown());
+        m_aplEngineImpl = aace::engine::apl::APLEngineImpl::create(
+            m_aplMock,
+            m_alexaMockFactory->getEndpointBuilderMock(),
+            m_alexaMockFactory->getFocusManagerInterfaceMock(),
+            m_alexaMockFactory->getFocusManagerInterfaceMock(),
+            m_alexaMockFactory->getExceptionEncounteredSenderInterfaceMock(),
+            m_alexaMockFactory->getMessageSenderInterfaceMock(),
+            m_alexaMockFactory->getContextManagerInterfaceMock(),
+            m_alexaMockFactory->getDialogUXStateAggregatorMock());
+        ASSERT_NE(m_aplEngineImpl, nullptr);
+    }
+
+    void TearDown() override {
+        if (m_aplEngineImpl != nullptr) {
+            m_aplEngineImpl->shutdown();
+        }
+        if (m_initialized) {
+            m_alexaMockFactory->shutdown();
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+            m_initialized = false;
+        }
+    }
+
+protected:
+    std::shared_ptr<AlexaMockComponentFactory> m_alexaMockFactory;
+    std::shared_ptr<::testing::NiceMock<MockAPL>> m_aplMock;
+    std::shared_ptr<aace::engine::apl::APLEngineImpl> m_aplEngineImpl;
+    PlatformTraffic m_runtimePropertyTraffic;
+    PlatformTraffic m_dataSourceTraffic;
+
+private:
+    bool m_initialized = false;
+};
+
+TEST_F(APLEngineImplTest, platformPropertySetToCurrentValueIsNotSent) {
+    m_aplEngineImpl->onSetPlatformProperty("themeId", "1");
+    ASSERT_TRUE(m_runtimePropertyTraffic.waitForCalls(1));
+    auto bytes = m_runtimePropertyTraffic.getBytes();
+
+    // the platform properties are handled in order, so the second change is sent after the no-op was dropped
+    m_aplEngineImpl->onSetPlatformProperty("themeId", "1");
+    m_aplEngineImpl->onSetPlatformProperty("themeId", "2");
+    ASSERT_TRUE(m_runtimePropertyTraffic.waitForCalls(2));
+
+    EXPECT_EQ(m_runtimePropertyTraffic.getCalls(), 2u);
+    EXPECT_EQ(m_runtimePropertyTraffic.getBytes(), 2 * bytes);
+}
+
+TEST_F(APLEngineImplTest, platformPropertyWithoutEffectIsNotSent) {
+    m_aplEngineImpl->onSetPlatformProperty("uiMode", "night");
+    ASSERT_TRUE(m_runtimePropertyTraffic.waitForCalls(1));
+
+    // an unknown property and an unknown ui mode generate the same runtime properties as before
+    m_aplEngineImpl->onSetPlatformProperty("unknownProperty", "value");
+    m_aplEngineImpl->onSetPlatformProperty("uiMode", "dusk");
+    m_aplEngineImpl->onSetPlatformProperty("uiMode", "day");
+    ASSERT_TRUE(m_runtimePropertyTraffic.waitForCalls(2));
+
+    EXPECT_EQ(m_runtimePropertyTraffic.getCalls(), 2u);
+}
+
+TEST_F(APLEngineImplTest, repeatedVersionedDataSourceUpdateIsNotSent) {
+    m_aplEngineImpl->renderDocument(TEST_DOCUMENT, TEST_TOKEN, TEST_WINDOW_ID);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, VERSIONED_UPDATE, TEST_TOKEN);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, VERSIONED_UPDATE, TEST_TOKEN);
+
+    EXPECT_EQ(m_dataSourceTraffic.getCalls(), 1u);
+    EXPECT_EQ(m_dataSourceTraffic.getBytes(), VERSIONED_UPDATE.size());
+}
+
+TEST_F(APLEngineImplTest, unversionedDataSourceUpdateIsAlwaysSent) {
+    m_aplEngineImpl->renderDocument(TEST_DOCUMENT, TEST_TOKEN, TEST_WINDOW_ID);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, UNVERSIONED_UPDATE, TEST_TOKEN);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, UNVERSIONED_UPDATE, TEST_TOKEN);
+
+    EXPECT_EQ(m_dataSourceTraffic.getCalls(), 2u);
+    EXPECT_EQ(m_dataSourceTraffic.getBytes(), 2 * UNVERSIONED_UPDATE.size());
+}
+
+TEST_F(APLEngineImplTest, dataSourceUpdateOfNewDocumentIsSent) {
+    m_aplEngineImpl->renderDocument(TEST_DOCUMENT, TEST_TOKEN, TEST_WINDOW_ID);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, VERSIONED_UPDATE, TEST_TOKEN);
+    m_aplEngineImpl->renderDocument(TEST_DOCUMENT, TEST_OTHER_TOKEN, TEST_WINDOW_ID);
+    m_aplEngineImpl->dataSourceUpdate(DYNAMIC_INDEX_LIST, VERSIONED_UPDATE, TEST_OTHER_TOKEN);
+
+    EXPECT_EQ(m_dataSourceTraffic.getCalls(), 2u);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AACE/Engine/APL/APLStateCache.h>
+
+using APLStateCache = aace::engine::apl::APLStateCache;
+
+static const std::string TEST_TOKEN = "TestToken";
+static const std::string TEST_OTHER_TOKEN = "TestOtherToken";
+static const std::string DYNAMIC_INDEX_LIST = "dynamicIndexList";
+static const std::string RUNTIME_PROPERTIES = R"({"drivingState":"moving","theme":"light","video":"disabled"})";
+
+static const std::string VERSIONED_UPDATE =
+    R"({"listId":"TestList","listVersion":2,"operations":[{"type":"DeleteItem","index":0}]})";
+static const std::string UNVERSIONED_UPDATE = R"({"listId":"TestList","startIndex":0,"items":[{"title":"item"}]})";
+static const std::string FIRST_PAGE =
+    R"({"listId":"TestList","listVersion":1,"startIndex":0,"items":[{"title":"a"}]})";
+static const std::string SECOND_PAGE =
+    R"({"listId":"TestList","listVersion":1,"startIndex":1,"items":[{"title":"b"}]})";
+
+TEST(APLStateCacheTest, repeatedRuntimePropertiesAreSuppressed) {
+    APLStateCache cache;
+    EXPECT_TRUE(cache.updateRuntimeProperties(RUNTIME_PROPERTIES));
+    EXPECT_FALSE(cache.updateRuntimeProperties(RUNTIME_PROPERTIES));
+    EXPECT_EQ(cache.getSuppressedCount(), 1u);
+    EXPECT_EQ(cache.getSuppressedBytes(), RUNTIME_PROPERTIES.size());
+}
+
+TEST(APLStateCacheTest, repeatedVersionedUpdateIsSuppressed) {
+    APLStateCache cache;
+    cache.renderDocument(TEST_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+    EXPECT_FALSE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+    EXPECT_EQ(cache.getSuppressedCount(), 1u);
+    EXPECT_EQ(cache.getSuppressedBytes(), VERSIONED_UPDATE.size());
+}
+
+TEST(APLStateCacheTest, unversionedUpdateIsNeverSuppressed) {
+    APLStateCache cache;
+    cache.renderDocument(TEST_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, UNVERSIONED_UPDATE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, UNVERSIONED_UPDATE));
+    EXPECT_EQ(cache.getSuppressedCount(), 0u);
+}
+
+TEST(APLStateCacheTest, pagesSharingListVersionAreNotSuppressed) {
+    APLStateCache cache;
+    cache.renderDocument(TEST_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, FIRST_PAGE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, SECOND_PAGE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, FIRST_PAGE));
+    EXPECT_EQ(cache.getSuppressedCount(), 0u);
+}
+
+TEST(APLStateCacheTest, unversionedUpdateBetweenRepeatsIsNotSkipped) {
+    APLStateCache cache;
+    cache.renderDocument(TEST_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, UNVERSIONED_UPDATE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+}
+
+TEST(APLStateCacheTest, updatesOfAnotherDocumentAreNotSuppressed) {
+    APLStateCache cache;
+    cache.renderDocument(TEST_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+
+    // not the rendered document
+    EXPECT_TRUE(cache.updateDataSource(TEST_OTHER_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+    EXPECT_TRUE(cache.updateDataSource(TEST_OTHER_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+
+    cache.renderDocument(TEST_OTHER_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_OTHER_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+
+    cache.clearDocument(TEST_OTHER_TOKEN);
+    EXPECT_TRUE(cache.updateDataSource(TEST_OTHER_TOKEN, DYNAMIC_INDEX_LIST, VERSIONED_UPDATE));
+    EXPECT_EQ(cache.getSuppressedCount(), 0u);
+}
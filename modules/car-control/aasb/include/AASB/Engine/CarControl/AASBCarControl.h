@@ -18,21 +18,63 @@
 
 #include <AACE/CarControl/CarControl.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+#include <AASB/Message/CarControl/CarControl/ControllerCommand.h>
+#include <chrono>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace aasb {
 namespace engine {
 namespace carControl {
 
+/**
+ * Decides when the car control commands collected into an @c ExecuteBatch message are published. The default
+ * trigger is timed by the command batch window; tests inject their own trigger to flush a batch on demand.
+ */
+class CommandBatchTrigger {
+public:
+    virtual ~CommandBatchTrigger() = default;
+
+    /**
+     * Called for a command issued while no batch is being collected.
+     *
+     * @return @c true to start collecting a batch with the command, or @c false to publish the command right away.
+     */
+    virtual bool startBatch() = 0;
+
+    /**
+     * Called each time a command is added to the batch being collected.
+     *
+     * @param batchSize The number of commands in the batch.
+     */
+    virtual void commandCollected(size_t batchSize) = 0;
+
+    /// Blocks the first command of the batch until the collected commands are to be published.
+    virtual void waitForFlush() = 0;
+};
+
 class AASBCarControl
         : public aace::carControl::CarControl
         , public std::enable_shared_from_this<AASBCarControl> {
 private:
     using CarControlPromise = std::promise<bool>;
-    AASBCarControl(uint32_t asyncReplyTimeout);
+    using BatchPromise = std::promise<std::vector<bool>>;
+    using ControllerCommand = aasb::message::carControl::carControl::ControllerCommand;
+
+    /// The commands collected during one command batch window.
+    struct PendingBatch {
+        std::vector<ControllerCommand> commands;
+        BatchPromise results;
+        std::shared_future<std::vector<bool>> future;
+    };
+
+    AASBCarControl(uint32_t asyncReplyTimeout, std::shared_ptr<CommandBatchTrigger> batchTrigger);
 
     bool initialize(std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker);
     void addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise);
@@ -40,10 +82,37 @@ private:
     bool waitForAsyncReply(const std::string& messageId);
     std::shared_ptr<CarControlPromise> getReplyMessagePromise(const std::string& messageId);
 
+    /**
+     * Executes a command in an @c ExecuteBatch message and waits for its result. With the default trigger, the first
+     * command after an idle period is published right away and opens the command batch window. The commands issued
+     * within the window, such as the commands for the other endpoints targeted by the same utterance, are collected
+     * and published in one @c ExecuteBatch message when the window closes.
+     */
+    bool executeBatched(const ControllerCommand& command);
+
+    /**
+     * Publishes an @c ExecuteBatch message and waits for the reply.
+     *
+     * @return The result of each command, or @c false for every command if the batch failed.
+     */
+    std::vector<bool> sendBatch(const std::vector<ControllerCommand>& commands);
+    std::shared_ptr<BatchPromise> getBatchReplyPromise(const std::string& messageId);
+
 public:
+    /**
+     * Creates an instance of @c AASBCarControl.
+     *
+     * @param messageBroker The message broker used to publish the car control messages.
+     * @param asyncReplyTimeout The time in milliseconds to wait for a reply message.
+     * @param commandBatchWindow The time in milliseconds to collect commands into one @c ExecuteBatch message.
+     *        Commands are published individually if zero and no @c batchTrigger is given.
+     * @param batchTrigger The trigger publishing the collected commands in place of the command batch window.
+     */
     static std::shared_ptr<AASBCarControl> create(
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-        uint32_t asyncReplyTimeout);
+        uint32_t asyncReplyTimeout,
+        uint32_t commandBatchWindow = 0,
+        std::shared_ptr<CommandBatchTrigger> batchTrigger = nullptr);
 
     // aace::carControl
     bool turnPowerControllerOn(const std::string& endpointId) override;
@@ -72,7 +141,13 @@ private:
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
     uint32_t m_replyMessageTimeout;
     std::mutex m_promise_map_access_mutex;
-    std::unordered_map<std::string, std::shared_ptr<CarControlPromise>> m_promiseMap;
+    std::unordered_map<aace::engine::utils::uuid::UUID, std::shared_ptr<CarControlPromise>> m_promiseMap;
+    std::unordered_map<aace::engine::utils::uuid::UUID, std::shared_ptr<BatchPromise>> m_batchPromiseMap;
+
+    /// Command batching, disabled if there is no trigger
+    std::shared_ptr<CommandBatchTrigger> m_batchTrigger;
+    std::mutex m_batchMutex;
+    std::shared_ptr<PendingBatch> m_pendingBatch;
 };
 
 }  // namespace carControl
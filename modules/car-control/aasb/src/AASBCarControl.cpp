@@ -26,6 +26,11 @@
 #include <AASB/Message/CarControl/CarControl/SetPowerControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetToggleControllerValueMessage.h>
 
+#include <AASB/Message/CarControl/CarControl/ExecuteBatchMessage.h>
+#include <AASB/Message/CarControl/CarControl/ReportStateChangeMessage.h>
+
+#include <thread>
+
 namespace aasb {
 namespace engine {
 namespace carControl {
@@ -35,20 +40,95 @@ static const std::string TAG("aasb.carControl.AASBCarControl");
 
 // aliases
 using Message = aace::engine::messageBroker::Message;
+using UUID = aace::engine::utils::uuid::UUID;
+using ControllerCommand = aasb::message::carControl::carControl::ControllerCommand;
+using CapabilityType = aasb::message::carControl::carControl::CapabilityType;
+using ControllerOperation = aasb::message::carControl::carControl::ControllerOperation;
+
+static ControllerCommand createCommand(
+    CapabilityType capabilityType,
+    ControllerOperation operation,
+    const std::string& endpointId,
+    const std::string& instanceId = "") {
+    ControllerCommand command;
+    command.capabilityType = capabilityType;
+    command.operation = operation;
+    command.endpointId = endpointId;
+    command.instanceId = instanceId;
+    return command;
+}
+
+static bool reportStateChange(
+    std::shared_ptr<AASBCarControl> carControl,
+    const aasb::message::carControl::carControl::ReportStateChangeMessage::Payload& payload) {
+    switch (payload.capabilityType) {
+        case CapabilityType::POWER:
+            return carControl->reportPowerControllerState(payload.endpointId, payload.turnOn);
+        case CapabilityType::TOGGLE:
+            return carControl->reportToggleControllerState(payload.endpointId, payload.instanceId, payload.turnOn);
+        case CapabilityType::RANGE:
+            return carControl->reportRangeControllerValue(payload.endpointId, payload.instanceId, payload.value);
+        case CapabilityType::MODE:
+            return carControl->reportModeControllerValue(payload.endpointId, payload.instanceId, payload.mode);
+    }
+    return false;
+}
+
+/// Publishes the first command after an idle period right away, and collects the commands issued within the
+/// command batch window that follows.
+class CommandBatchWindow : public CommandBatchTrigger {
+public:
+    CommandBatchWindow(std::chrono::milliseconds window) : m_window(window) {
+    }
+
+    bool startBatch() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = std::chrono::steady_clock::now();
+        if (now < m_windowEnd) {
+            return true;
+        }
+        m_windowEnd = now + m_window;
+        return false;
+    }
 
-AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout) {
-    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout));
+    void commandCollected(size_t batchSize) override {
+    }
+
+    void waitForFlush() override {
+        std::chrono::steady_clock::time_point windowEnd;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            windowEnd = m_windowEnd;
+        }
+        std::this_thread::sleep_until(windowEnd);
+    }
+
+private:
+    std::chrono::milliseconds m_window;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_windowEnd;
+};
+
+AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout, std::shared_ptr<CommandBatchTrigger> batchTrigger) :
+        m_batchTrigger(std::move(batchTrigger)) {
+    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout).d("batching", m_batchTrigger != nullptr));
     m_replyMessageTimeout = asyncReplyTimeout;
 }
 
 std::shared_ptr<AASBCarControl> AASBCarControl::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-    uint32_t asyncReplyTimeout) {
+    uint32_t asyncReplyTimeout,
+    uint32_t commandBatchWindow,
+    std::shared_ptr<CommandBatchTrigger> batchTrigger) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
+        if (batchTrigger == nullptr && commandBatchWindow > 0) {
+            batchTrigger = std::make_shared<CommandBatchWindow>(std::chrono::milliseconds(commandBatchWindow));
+        }
+
         // create the car control platform handler
-        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout));
+        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout, batchTrigger));
 
         // initialize the platform handler
         ThrowIfNot(carControl->initialize(messageBroker), "initializeAASBCarControlFailed");
@@ -109,6 +189,42 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::messageBroker::Mes
                     AACE_ERROR(LX(TAG, "AdjustControllerValueMessageReply").d("reason", ex.what()));
                 }
             });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::ExecuteBatchMessageReply::topic(),
+            aasb::message::carControl::carControl::ExecuteBatchMessageReply::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    auto promise = sp->getBatchReplyPromise(message.replyTo());
+                    ThrowIfNull(promise, "invalidPromise");
+
+                    aasb::message::carControl::carControl::ExecuteBatchMessageReply::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    promise->set_value(payload.results);
+                    AACE_VERBOSE(LX(TAG, "ExecuteBatchMessageReply").m("executeBatchReplyPromiseSet"));
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ExecuteBatchMessageReply").d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::ReportStateChangeMessage::topic(),
+            aasb::message::carControl::carControl::ReportStateChangeMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::ReportStateChangeMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    ThrowIfNot(reportStateChange(sp, payload), "reportStateChangeFailed");
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ReportStateChangeMessage").d("reason", ex.what()));
+                }
+            });
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -127,6 +243,12 @@ bool AASBCarControl::turnPowerControllerOn(const std::string& endpointId) {
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::POWER, ControllerOperation::SET, endpointId);
+            command.turnOn = true;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -149,6 +271,12 @@ bool AASBCarControl::turnPowerControllerOff(const std::string& endpointId) {
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::POWER, ControllerOperation::SET, endpointId);
+            command.turnOn = false;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -178,6 +306,12 @@ bool AASBCarControl::turnToggleControllerOn(const std::string& endpointId, const
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::TOGGLE, ControllerOperation::SET, endpointId, controllerId);
+            command.turnOn = true;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -202,6 +336,12 @@ bool AASBCarControl::turnToggleControllerOff(const std::string& endpointId, cons
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::TOGGLE, ControllerOperation::SET, endpointId, controllerId);
+            command.turnOn = false;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -235,6 +375,12 @@ bool AASBCarControl::setRangeControllerValue(
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::RANGE, ControllerOperation::SET, endpointId, controllerId);
+            command.value = value;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -262,6 +408,12 @@ bool AASBCarControl::adjustRangeControllerValue(
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::RANGE, ControllerOperation::ADJUST, endpointId, controllerId);
+            command.delta = delta;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -299,6 +451,12 @@ bool AASBCarControl::setModeControllerValue(
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::MODE, ControllerOperation::SET, endpointId, controllerId);
+            command.mode = value;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -326,6 +484,12 @@ bool AASBCarControl::adjustModeControllerValue(
     try {
         AACE_VERBOSE(LX(TAG));
 
+        if (m_batchTrigger != nullptr) {
+            auto command = createCommand(CapabilityType::MODE, ControllerOperation::ADJUST, endpointId, controllerId);
+            command.delta = delta;
+            return executeBatched(command);
+        }
+
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -376,14 +540,116 @@ bool AASBCarControl::waitForAsyncReply(const std::string& messageId) {
     return success;
 }
 
+bool AASBCarControl::executeBatched(const ControllerCommand& command) {
+    try {
+        std::shared_ptr<PendingBatch> batch;
+        size_t index = 0;
+        bool first = false;
+        {
+            std::lock_guard<std::mutex> lock(m_batchMutex);
+            if (m_pendingBatch != nullptr || m_batchTrigger->startBatch()) {
+                if (m_pendingBatch == nullptr) {
+                    m_pendingBatch = std::make_shared<PendingBatch>();
+                    m_pendingBatch->future = m_pendingBatch->results.get_future().share();
+                    first = true;
+                }
+                batch = m_pendingBatch;
+                index = batch->commands.size();
+                batch->commands.push_back(command);
+                m_batchTrigger->commandCollected(batch->commands.size());
+            }
+        }
+
+        if (batch == nullptr) {
+            return sendBatch(std::vector<ControllerCommand>(1, command)).front();
+        }
+
+        if (first) {
+            m_batchTrigger->waitForFlush();
+            {
+                std::lock_guard<std::mutex> lock(m_batchMutex);
+                m_pendingBatch.reset();
+            }
+            batch->results.set_value(sendBatch(batch->commands));
+        }
+
+        auto results = batch->future.get();
+        ThrowIfNot(index < results.size(), "missingCommandResult");
+
+        return results[index];
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+std::vector<bool> AASBCarControl::sendBatch(const std::vector<ControllerCommand>& commands) {
+    std::vector<bool> results;
+    UUID uuid;
+    try {
+        AACE_VERBOSE(LX(TAG).d("commands", commands.size()));
+
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        aasb::message::carControl::carControl::ExecuteBatchMessage message;
+        message.payload.commands = commands;
+        ThrowIfNot(UUID::parse(message.header.id, uuid), "invalidMessageId");
+
+        // add the promise before publishing so a fast reply cannot be missed
+        auto promise = std::make_shared<BatchPromise>();
+        auto future = promise->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+            m_batchPromiseMap[uuid] = promise;
+        }
+
+        m_messageBroker_lock->publish(message.toString()).send();
+
+        ThrowIfNot(
+            future.wait_for(std::chrono::milliseconds(m_replyMessageTimeout)) == std::future_status::ready,
+            "replyMessageTimeout:id=" + message.header.id);
+        results = future.get();
+        ThrowIfNot(results.size() == commands.size(), "invalidResultCount");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        results.assign(commands.size(), false);
+    }
+
+    std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+    m_batchPromiseMap.erase(uuid);
+
+    return results;
+}
+
+std::shared_ptr<AASBCarControl::BatchPromise> AASBCarControl::getBatchReplyPromise(const std::string& messageId) {
+    try {
+        UUID uuid;
+        ThrowIfNot(UUID::parse(messageId, uuid), "invalidMessageId");
+
+        std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+
+        auto it = m_batchPromiseMap.find(uuid);
+        ThrowIf(it == m_batchPromiseMap.end(), "messageIdDoesNotExist");
+
+        return it->second;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("messageId", messageId));
+        return nullptr;
+    }
+}
+
 void AASBCarControl::addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise) {
     try {
+        UUID uuid;
+        ThrowIfNot(UUID::parse(messageId, uuid), "invalidMessageId");
+
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        ThrowIf(m_promiseMap.find(messageId) != m_promiseMap.end(), "messageIdAlreadyExists");
+        ThrowIf(m_promiseMap.find(uuid) != m_promiseMap.end(), "messageIdAlreadyExists");
 
         // add the promise to the promise map
-        m_promiseMap[messageId] = promise;
+        m_promiseMap[uuid] = promise;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "addReplyMessagePromise").d("reason", ex.what()));
     }
@@ -391,13 +657,13 @@ void AASBCarControl::addReplyMessagePromise(const std::string& messageId, std::s
 
 void AASBCarControl::removeReplyMessagePromise(const std::string& messageId) {
     try {
-        std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+        UUID uuid;
+        ThrowIfNot(UUID::parse(messageId, uuid), "invalidMessageId");
 
-        auto it = m_promiseMap.find(messageId);
-        ThrowIf(it == m_promiseMap.end(), "messageIdDoesNotExist");
+        std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
         // remove the promise from the promise map
-        m_promiseMap.erase(messageId);
+        ThrowIf(m_promiseMap.erase(uuid) == 0, "messageIdDoesNotExist");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "removeReplyMessagePromise").d("reason", ex.what()));
     }
@@ -406,9 +672,12 @@ void AASBCarControl::removeReplyMessagePromise(const std::string& messageId) {
 std::shared_ptr<AASBCarControl::CarControlPromise> AASBCarControl::getReplyMessagePromise(
     const std::string& messageId) {
     try {
+        UUID uuid;
+        ThrowIfNot(UUID::parse(messageId, uuid), "invalidMessageId");
+
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        auto it = m_promiseMap.find(messageId);
+        auto it = m_promiseMap.find(uuid);
         ThrowIf(it == m_promiseMap.end(), "messageIdDoesNotExist");
 
         return it->second;
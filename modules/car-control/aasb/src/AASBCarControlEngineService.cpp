@@ -61,6 +61,9 @@ bool AASBCarControlEngineService::configureCarControl(std::istream& configuratio
     try {
         auto root = nlohmann::json::parse(configuration);
         m_asyncReplyTimeout = root["/asyncReplyTimeout"_json_pointer];
+        if (root.contains("commandBatchWindow")) {
+            m_commandBatchWindow = root["/commandBatchWindow"_json_pointer];
+        }
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -77,7 +80,8 @@ bool AASBCarControlEngineService::postRegister() {
 
         // CarControl
         if (isInterfaceEnabled("CarControl")) {
-            auto carControl = AASBCarControl::create(aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout);
+            auto carControl = AASBCarControl::create(
+                aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout, m_commandBatchWindow);
             ThrowIfNull(carControl, "invalidCarControlHandler");
             getContext()->registerPlatformInterface(carControl);
         }
@@ -16,9 +16,8 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 #define AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 
-#include <istream>
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -31,15 +30,32 @@ namespace carControl {
  * locale pairs associated with each asset definition in the file.
  * Friendly name / locale pairs of assets may be retrieved by asset ID when
  * constructing a discovery message with assets expanded to text.
+ *
+ * Each assets file is compiled into a compact image with interned strings
+ * and a sorted asset index. If a cache path is set, the image is written to
+ * disk keyed by a hash of the file contents, and memory-mapped instead of
+ * parsing the JSON when the same file is ingested again. The image of the
+ * previous contents of the file is removed when the contents change.
  */
 class AssetStore {
 public:
     /// Alias for readability. Pair of friendly name literal text to its locale
     using NameLocalePair = std::pair<std::string, std::string>;
 
+    /// Constructor
+    AssetStore();
+
     /// Destructor
     ~AssetStore();
 
+    /**
+     * Set the directory in which compiled assets are cached. Compiled assets
+     * are not cached if the path is empty, which is the default.
+     *
+     * @param path The path of an existing directory
+     */
+    void setCachePath(const std::string& path);
+
     /**
      * Ingest the assets file at the given path and populate the AssetStore
      * with the text/locale pairs. The contents of the file must contain the
@@ -56,9 +72,10 @@ public:
      * asset ID.
      *
      * @param The ID of the asset
-     * @return A list of pairs of friendly name and locale strings for the asset
+     * @return A list of pairs of friendly name and locale strings for the
+     * asset, or an empty list if the asset isn't present in the AssetStore
      */
-    const std::vector<NameLocalePair>& getFriendlyNames(const std::string& assetId) const;
+    std::vector<NameLocalePair> getFriendlyNames(const std::string& assetId) const;
 
     /**
      * Clear the contents of the AssetStore
@@ -66,29 +83,27 @@ public:
     void clear();
 
 private:
+    /// An assets file compiled to its binary image
+    class CompiledAssets;
+
     /**
-     * Ingest the assets from the istream and populate the AssetStore with the
-     * friendly name text / locale pairs. The contents of the stream must 
-     * contain the assets JSON in the expected schema.
+     * Compile the assets JSON. The JSON must be in the expected schema.
      *
-     * @param stream The istream containing the assets to ingest
-     * @return true if the assets were ingested successfully; false if there was
-     * an issue such as malformed or missing values
+     * @param contents The contents of the assets file
+     * @return The compiled assets; @c nullptr if there was an issue such as
+     * malformed or missing values
      */
-    bool addAssets(std::istream& stream);
+    static std::shared_ptr<CompiledAssets> compileAssets(const std::string& contents);
 
     /**
-     * A map of asset ID to a list of friendly name text / locale pairs used to
-     * describe the asset. It contains an entry for all assets ingested by the
-     * AssetStore.
+     * The compiled assets of each ingested file, in the order the files were
+     * ingested. An asset defined in more than one file is taken from the
+     * first file that defines it.
      */
-    std::unordered_map<std::string, std::vector<NameLocalePair>> m_assets;
+    std::vector<std::shared_ptr<const CompiledAssets>> m_compiledAssets;
 
-    /**
-     * An empty list to be returned from @c getFriendlyNames() if the specified ID
-     * isn't present in the AssetStore
-     */
-    std::vector<NameLocalePair> m_empty;
+    /// The directory in which compiled assets are cached, or empty to disable the cache
+    std::string m_cachePath;
 };
 
 }  // namespace carControl
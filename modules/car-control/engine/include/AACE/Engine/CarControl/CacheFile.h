@@ -0,0 +1,109 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CACHE_FILE_H
+#define AACE_ENGINE_CAR_CONTROL_CACHE_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * A compiled image cached in the car control cache directory, memory-mapped read-only. Cache files are named
+ * with a prefix identifying their source and the hash of their contents, so an image is rebuilt when its source
+ * changes and the image of the previous contents can be removed.
+ */
+class CacheFile {
+public:
+    /// The 64-bit FNV-1a offset basis, used to start a hash
+    static const uint64_t HASH_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+    /**
+     * Memory-maps a cache file.
+     *
+     * @param path The path of the cache file
+     * @return The mapped file; @c nullptr if the file does not exist or cannot be mapped
+     */
+    static std::shared_ptr<CacheFile> map(const std::string& path);
+
+    /// Destructor
+    ~CacheFile();
+
+    /// The contents of the file
+    const char* data() const;
+
+    /// The size of the file
+    size_t size() const;
+
+    /**
+     * Writes a cache file. The file is written under a temporary name and renamed, so a partially written file
+     * is never mapped.
+     *
+     * @return @c true if the file was written
+     */
+    static bool save(const std::string& path, const char* data, size_t size);
+
+    /**
+     * Gets the path of a cache file.
+     *
+     * @param directory The cache directory
+     * @param prefix The prefix identifying the source of the file
+     * @param hash The hash of the contents of the file
+     */
+    static std::string getPath(const std::string& directory, const std::string& prefix, uint64_t hash);
+
+    /**
+     * Removes the cache files with the given prefix, other than the file to keep.
+     *
+     * @param directory The cache directory
+     * @param prefix The prefix identifying the source of the files
+     * @param keepPath The path of the cache file to keep
+     */
+    static void removeStale(const std::string& directory, const std::string& prefix, const std::string& keepPath);
+
+    /**
+     * Continues a 64-bit FNV-1a hash with the given bytes.
+     *
+     * @param data The bytes to hash
+     * @param size The number of bytes
+     * @param hash The hash of the preceding bytes, or @c HASH_OFFSET_BASIS
+     */
+    static uint64_t hash(const void* data, size_t size, uint64_t hash = HASH_OFFSET_BASIS);
+
+    /**
+     * Formats a hash as 16 hexadecimal digits.
+     */
+    static std::string toHex(uint64_t hash);
+
+private:
+    CacheFile(void* address, size_t size);
+
+    /// The mapped file
+    void* m_address;
+
+    /// The size of the mapped file
+    size_t m_size;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CACHE_FILE_H
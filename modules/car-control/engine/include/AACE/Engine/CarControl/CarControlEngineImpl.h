@@ -18,11 +18,14 @@
 
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
+#include <functional>
 #include <memory>
 #include <utility>
 
 #include "AACE/CarControl/CarControl.h"
+#include "AACE/CarControl/CarControlEngineInterface.h"
 #include "AACE/Engine/CarControl/CarControlServiceInterface.h"
+#include "AACE/Engine/CarControl/CarControlStateStore.h"
 
 namespace aace {
 namespace engine {
@@ -30,12 +33,23 @@ namespace carControl {
 
 class CarControlEngineImpl
         : public CarControlServiceInterface
+        , public aace::carControl::CarControlEngineInterface
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
 public:
+    /**
+     * Creates a @c CarControlEngineImpl.
+     *
+     * @param [in] platformInterface The @c CarControl platform interface.
+     * @param [in] stateStore The cache of controller state reported by the platform, or @c nullptr to query the
+     * platform for the state of a controller each time it is needed.
+     */
     static std::shared_ptr<CarControlEngineImpl> create(
-        std::shared_ptr<aace::carControl::CarControl> platformInterface);
+        std::shared_ptr<aace::carControl::CarControl> platformInterface,
+        std::shared_ptr<CarControlStateStore> stateStore = nullptr);
 
-    CarControlEngineImpl(std::shared_ptr<aace::carControl::CarControl> platformInterface);
+    CarControlEngineImpl(
+        std::shared_ptr<aace::carControl::CarControl> platformInterface,
+        std::shared_ptr<CarControlStateStore> stateStore);
 
     /// @name @c CarControlServiceInterface methods
     /// @{
@@ -56,13 +70,52 @@ public:
     bool adjustModeControllerValue(const std::string& endpointId, const std::string& instance, int delta) override;
     bool getModeControllerValue(const std::string& endpointId, const std::string& instance, std::string& value)
         override;
+    bool addStateObserver(
+        const std::string& endpointId,
+        const std::string& instance,
+        std::weak_ptr<CarControlStateObserverInterface> observer) override;
+    /// @}
+
+    /// @name @c CarControlEngineInterface methods
+    /// @{
+    bool onReportPowerControllerState(const std::string& endpointId, bool isOn) override;
+    bool onReportToggleControllerState(const std::string& endpointId, const std::string& controllerId, bool isOn)
+        override;
+    bool onReportRangeControllerValue(const std::string& endpointId, const std::string& controllerId, double value)
+        override;
+    bool onReportModeControllerValue(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value) override;
     /// @}
 
 protected:
     void doShutdown() override;
 
+private:
+    /**
+     * Executes an Alexa directive on the platform. When state is cached, state changes reported by the platform
+     * while the directive executes are attributed to Alexa, and the cached state is updated if the directive
+     * succeeds.
+     *
+     * @param [in] directive Calls the platform interface.
+     * @param [in] newState The state of the controller after the directive succeeds, or @c nullptr if it is not
+     * known, in which case the cached state is invalidated.
+     */
+    bool executeDirective(
+        const std::string& endpointId,
+        const std::string& instance,
+        const std::function<bool()>& directive,
+        const CarControlState* newState);
+
+    /// Updates the cached state of a controller with the state reported by the platform.
+    bool reportState(const std::string& endpointId, const std::string& instance, const CarControlState& state);
+
 private:
     std::shared_ptr<aace::carControl::CarControl> m_platformInterface;
+
+    /// The cache of controller state, or @c nullptr if state caching is disabled.
+    std::shared_ptr<CarControlStateStore> m_stateStore;
 };
 
 }  // namespace carControl
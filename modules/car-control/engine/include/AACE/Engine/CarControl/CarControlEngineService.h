@@ -16,14 +16,19 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_ENGINE_SERVICE_H
 
+#include <chrono>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
+#include <vector>
+
+#include <AVSCommon/SDKInterfaces/Endpoints/EndpointRegistrationManagerInterface.h>
 
 #include "AACE/CarControl/CarControl.h"
 #include "AACE/Engine/CarControl/AssetStore.h"
 #include "AACE/Engine/CarControl/CarControlEngineImpl.h"
 #include "AACE/Engine/CarControl/Endpoint.h"
+#include "AACE/Engine/CarControl/EndpointRegistrationTracker.h"
 #include "AACE/Engine/Storage/StorageEngineService.h"
 
 namespace aace {
@@ -61,7 +66,8 @@ public:
 
 protected:
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(const json& configuration) override;
+    json getConfigurationSchema() override;
     bool setup() override;
     bool shutdown() override;
     /// @}
@@ -78,6 +84,23 @@ private:
      */
     void translateConfigForZones(json& jconfiguration);
 
+    /// Alias to improve readability
+    using RegistrationResult =
+        alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface::RegistrationResult;
+
+    /**
+     * Builds the AVS SDK representation of every configured endpoint. Endpoints that fail to build are logged and
+     * left out.
+     *
+     * @return The built endpoints, in the order of @c endpoints
+     */
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface>>
+    buildEndpoints(
+        const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+        std::shared_ptr<aace::engine::alexa::EndpointBuilderFactory> endpointBuilderFactory,
+        const std::string& manufacturerName,
+        const std::string& description);
+
     template <class T>
     bool registerPlatformInterfaceType(std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
         std::shared_ptr<T> typedPlatformInterface = std::dynamic_pointer_cast<T>(platformInterface);
@@ -102,6 +125,19 @@ private:
 
     /// The capability configuration for the Alexa.Automotive.ZoneDefinitions capability generated at translation time
     json m_zonesCapabilityConfig;
+
+    /// Whether controller state reported by the platform is cached in the engine
+    bool m_stateCacheEnabled = false;
+
+    /// The time to wait after a controller state change before reporting it to Alexa
+    std::chrono::milliseconds m_changeReportDelay{0};
+
+    /// The endpoint registration manager the car control endpoints were registered with
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface>
+        m_endpointRegistrationManager;
+
+    /// Logs the time until every car control endpoint is registered
+    std::shared_ptr<EndpointRegistrationTracker> m_registrationTracker;
 };
 
 }  // namespace carControl
@@ -0,0 +1,171 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_MODEL_H
+#define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_MODEL_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * An "ActionsToDirective" action mapping of a capability's semantics.
+ */
+struct ActionMappingModel {
+    /// The actions mapped to the directive
+    std::vector<std::string> actions;
+    /// The name of the directive
+    std::string directiveName;
+    /// The payload of the directive, as serialized JSON
+    std::string directivePayload;
+};
+
+/**
+ * A preset of a RangeController capability.
+ */
+struct PresetModel {
+    /// The range value of the preset
+    double rangeValue = 0;
+    /// The asset IDs of the preset's friendly names
+    std::vector<std::string> assetIds;
+};
+
+/**
+ * A supported mode of a ModeController capability.
+ */
+struct ModeModel {
+    /// The value of the mode
+    std::string value;
+    /// The asset IDs of the mode's friendly names
+    std::vector<std::string> assetIds;
+};
+
+/**
+ * A capability of an endpoint. Only the fields of the capability's interface are used.
+ */
+struct CapabilityModel {
+    /// The capability interface, such as "Alexa.RangeController"
+    std::string interface;
+    /// The instance of a primitive controller
+    std::string instance;
+    /// The asset IDs of the capability's friendly names
+    std::vector<std::string> assetIds;
+    /// Whether the capability has semantics
+    bool hasSemantics = false;
+    /// The action mappings of the capability's semantics
+    std::vector<ActionMappingModel> actionMappings;
+
+    /// The supported range of a RangeController
+    /// @{
+    double minimumValue = 0;
+    double maximumValue = 0;
+    double precision = 0;
+    /// @}
+    /// The unit of measure of a RangeController, if @c hasUnitOfMeasure
+    bool hasUnitOfMeasure = false;
+    std::string unitOfMeasure;
+    /// The presets of a RangeController
+    std::vector<PresetModel> presets;
+
+    /// Whether the modes of a ModeController are ordered, if @c hasOrdered
+    bool hasOrdered = false;
+    bool ordered = false;
+    /// The supported modes of a ModeController
+    std::vector<ModeModel> modes;
+};
+
+/**
+ * An endpoint of the vehicle.
+ */
+struct EndpointModel {
+    /// The configured endpoint ID
+    std::string endpointId;
+    /// The asset IDs of the endpoint's friendly names
+    std::vector<std::string> assetIds;
+    /// The capabilities of the endpoint
+    std::vector<CapabilityModel> capabilities;
+};
+
+/**
+ * The "aace.carControl" configuration compiled to plain data, so the endpoints are created without walking the
+ * configuration JSON. The model is cached as a compact image, in which each distinct string is stored once,
+ * keyed by a hash of the configuration. When the configuration is unchanged, the cached image is memory-mapped
+ * and read instead of the JSON.
+ */
+class CarControlModel {
+public:
+    /**
+     * Compiles the model from the configuration, after the translation of legacy zones.
+     *
+     * @param configuration The "aace.carControl" configuration
+     * @param zonesCapability The ZoneDefinitions capability translated from legacy zones, or @c null
+     * @param internalEndpointId The ID of the internal endpoint holding the ZoneDefinitions capability, which is
+     *        left out of the model
+     * @return The model; @c nullptr if the configuration is invalid
+     */
+    static std::shared_ptr<CarControlModel> create(
+        const nlohmann::json& configuration,
+        const nlohmann::json& zonesCapability,
+        const std::string& internalEndpointId);
+
+    /**
+     * Reads a model from a cached image.
+     *
+     * @param path The path of the image
+     * @return The model; @c nullptr if the image does not exist or is not valid
+     */
+    static std::shared_ptr<CarControlModel> load(const std::string& path);
+
+    /**
+     * Writes the model to an image.
+     *
+     * @return @c true if the image was written
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * Gets the hash used to key the cached model of a configuration. The hash is computed from the configuration
+     * values, so the configuration does not need to be serialized.
+     */
+    static uint64_t getConfigurationHash(const nlohmann::json& configuration);
+
+    /// The endpoints, in the order of the configuration
+    const std::vector<EndpointModel>& getEndpoints() const;
+
+    /// The ZoneDefinitions capability translated from legacy zones, as serialized JSON, or empty
+    const std::string& getZonesCapability() const;
+
+private:
+    CarControlModel() = default;
+
+    /// The endpoints, in the order of the configuration
+    std::vector<EndpointModel> m_endpoints;
+
+    /// The ZoneDefinitions capability translated from legacy zones, as serialized JSON, or empty
+    std::string m_zonesCapability;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_MODEL_H
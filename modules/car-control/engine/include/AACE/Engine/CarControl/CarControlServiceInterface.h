@@ -16,8 +16,11 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_SERVICE_INTERFACE_H
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_SERVICE_INTERFACE_H
 
+#include <memory>
 #include <string>
 
+#include "AACE/Engine/CarControl/CarControlStateStore.h"
+
 namespace aace {
 namespace engine {
 namespace carControl {
@@ -145,6 +148,20 @@ public:
         const std::string& endpointId,
         const std::string& instance,
         std::string& value) = 0;
+
+    /**
+     * Adds an observer of the state of the controller identified by @c endpointId and @c instance. State changes
+     * are only reported when the engine caches controller state.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] instance The instance of the controller, or an empty string for a power controller.
+     * @param [in] observer The observer to notify of state changes.
+     * @return @c true if state changes of the controller will be reported to the observer.
+     */
+    virtual bool addStateObserver(
+        const std::string& endpointId,
+        const std::string& instance,
+        std::weak_ptr<CarControlStateObserverInterface> observer) = 0;
 };
 
 }  // namespace carControl
@@ -0,0 +1,188 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_STATE_STORE_H
+#define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_STATE_STORE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AACE/Engine/Utils/Threading/Executor.h>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * The last known state of a capability controller instance. Only the field matching the controller type is used.
+ */
+struct CarControlState {
+    /// The power or toggle state.
+    bool isOn = false;
+    /// The range value.
+    double rangeValue = 0;
+    /// The mode.
+    std::string mode;
+    /// The version of the state, incremented each time the state of any controller changes.
+    uint64_t version = 0;
+};
+
+/**
+ * Observer notified when the state of a capability controller instance changes.
+ */
+class CarControlStateObserverInterface {
+public:
+    virtual ~CarControlStateObserverInterface() = default;
+
+    /**
+     * Notifies the observer of a state change.
+     *
+     * @param [in] state The new state of the controller.
+     * @param [in] alexaInteraction @c true if the change was made by an Alexa directive.
+     */
+    virtual void onStateChanged(const CarControlState& state, bool alexaInteraction) = 0;
+};
+
+/**
+ * Engine-side cache of the state of each capability controller, keyed by endpoint ID and instance. The platform
+ * pushes state changes, so state queries for context are answered from memory rather than by a blocking call into
+ * the platform. Change notifications are delivered on an internal thread; changes to the same controller within
+ * the change report delay are coalesced into a single notification with the latest state. The changes to all
+ * controllers within the delay are delivered together, in the order of the first change to each controller. Each
+ * controller still reports its change to Alexa on its own, since the capability agents report changes per
+ * capability.
+ */
+class CarControlStateStore {
+public:
+    /**
+     * Creates a @c CarControlStateStore.
+     *
+     * @param [in] changeReportDelay The time to wait after a state change before notifying observers.
+     */
+    static std::shared_ptr<CarControlStateStore> create(std::chrono::milliseconds changeReportDelay);
+
+    ~CarControlStateStore();
+
+    /**
+     * Adds an observer of the state of a controller. The store holds a weak reference to the observer.
+     */
+    void addObserver(
+        const std::string& endpointId,
+        const std::string& instance,
+        std::weak_ptr<CarControlStateObserverInterface> observer);
+
+    /**
+     * Gets the cached state of a controller.
+     *
+     * @return @c false if no state is cached for the controller.
+     */
+    bool getState(const std::string& endpointId, const std::string& instance, CarControlState& state);
+
+    /**
+     * Updates the state of a controller and schedules a change notification if the state changed. The change is
+     * attributed to Alexa if it is made while an Alexa interaction with the controller is in progress.
+     *
+     * @param [in] state The new state. The version is assigned by the store.
+     * @param [in] alexaInteraction @c true if the change was made by an Alexa directive.
+     * @return @c true if the state changed.
+     */
+    bool updateState(
+        const std::string& endpointId,
+        const std::string& instance,
+        const CarControlState& state,
+        bool alexaInteraction = false);
+
+    /**
+     * Caches a state read from the platform without notifying observers. An existing state is not overwritten.
+     */
+    void cacheState(const std::string& endpointId, const std::string& instance, const CarControlState& state);
+
+    /**
+     * Removes the cached state of a controller, so the next state query is answered by the platform.
+     */
+    void invalidateState(const std::string& endpointId, const std::string& instance);
+
+    /**
+     * Marks the start of an Alexa directive on a controller. State changes reported while the directive is in
+     * progress are attributed to Alexa.
+     */
+    void beginAlexaInteraction(const std::string& endpointId, const std::string& instance);
+
+    /**
+     * Marks the end of an Alexa directive on a controller.
+     */
+    void endAlexaInteraction(const std::string& endpointId, const std::string& instance);
+
+    /**
+     * Stops change notifications. Pending notifications are dropped.
+     */
+    void shutdown();
+
+private:
+    CarControlStateStore(std::chrono::milliseconds changeReportDelay);
+
+    static std::string getKey(const std::string& endpointId, const std::string& instance);
+
+    void flushChanges();
+
+private:
+    /// Time to wait after a state change before notifying observers.
+    const std::chrono::milliseconds m_changeReportDelay;
+
+    /// The cached state of each controller.
+    std::unordered_map<std::string, CarControlState> m_states;
+
+    /// The observers of each controller.
+    std::unordered_map<std::string, std::vector<std::weak_ptr<CarControlStateObserverInterface>>> m_observers;
+
+    /// The number of Alexa directives in progress on each controller.
+    std::unordered_map<std::string, int> m_alexaInteractions;
+
+    /// Controllers with a pending change notification, and whether the latest change was made by Alexa.
+    std::unordered_map<std::string, bool> m_pendingChanges;
+
+    /// Controllers with a pending change notification, in the order of their first change.
+    std::vector<std::string> m_pendingChangeOrder;
+
+    /// The last assigned state version.
+    uint64_t m_version;
+
+    /// Whether a notification of the pending changes is scheduled.
+    bool m_flushScheduled;
+
+    /// Whether the store is shut down.
+    bool m_isShutdown;
+
+    /// Serializes access to the store.
+    std::mutex m_mutex;
+
+    /// Wakes up the notification thread on shutdown.
+    std::condition_variable m_wakeTrigger;
+
+    /// Delivers change notifications.
+    aace::engine::utils::threading::Executor m_executor{"CarControlStateStore"};
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_STATE_STORE_H
@@ -16,7 +16,7 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_ENDPOINT_H
 #define AACE_ENGINE_CAR_CONTROL_ENDPOINT_H
 
-#include <AVSCommon/SDKInterfaces/Endpoints/EndpointRegistrationManagerInterface.h>
+#include <AVSCommon/SDKInterfaces/Endpoints/EndpointInterface.h>
 
 #include <nlohmann/json.hpp>
 
@@ -24,6 +24,7 @@
 #include "AACE/Engine/Alexa/EndpointBuilderFactory.h"
 #include "AACE/Engine/CarControl/AssetStore.h"
 #include "AACE/Engine/CarControl/CapabilityController.h"
+#include "AACE/Engine/CarControl/CarControlModel.h"
 
 using json = nlohmann::json;
 
@@ -37,8 +38,7 @@ namespace carControl {
 class Endpoint {
 public:
     /**
-     * Create an @c Endpoint object from the specified JSON configuration.
-     * The provided JSON is expected to follow the format of a single endpoint
+     * Create an @c Endpoint object from the compiled model of a single endpoint
      * entry of the "endpoints" array of "aace.carControl" configuration, e.g.
      * @code
      * {
@@ -77,12 +77,12 @@ public:
      * }
      * @endcode
      *
-     * @param endpointConfig The entry of the "endpoints" array of "aace.carControl" config used to construct
-     *        this endpoint.
+     * @param endpointModel The compiled model of the entry of the "endpoints" array of "aace.carControl" config
+     *        used to construct this endpoint.
      * @param assetStore The @c AssetStore storing the asset friendly name literals used in the configuration
      * @return A pointer to a new @c Endpoint if arguments are valid, otherwise @c nullptr.
      */
-    static std::shared_ptr<Endpoint> create(const json& endpointConfig, const AssetStore& assetStore);
+    static std::shared_ptr<Endpoint> create(const EndpointModel& endpointModel, const AssetStore& assetStore);
 
     /**
      * Endpoint destructor
@@ -110,13 +110,11 @@ public:
      *  @li Creating the internal representation of the capabilities of this endpoint by calling
      *  CapabilityController::build()
      *
-     * @return @c true if successful
+     * @return The AVS SDK endpoint if successful, otherwise @c nullptr
      */
-    bool build(
+    std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface> build(
         std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
         std::shared_ptr<aace::engine::alexa::EndpointBuilderFactory> endpointBuilderFactory,
-        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface>
-            endpointRegistrationManager,
         const AssetStore& assetStore,
         const std::string& manufacturer = "",
         const std::string& description = "");
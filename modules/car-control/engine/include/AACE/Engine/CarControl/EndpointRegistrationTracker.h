@@ -0,0 +1,109 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_ENDPOINT_REGISTRATION_TRACKER_H
+#define AACE_ENGINE_CAR_CONTROL_ENDPOINT_REGISTRATION_TRACKER_H
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include <AVSCommon/SDKInterfaces/Endpoints/EndpointRegistrationObserverInterface.h>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Tracks the registration of the car control endpoints submitted at setup and logs the time until all of them have
+ * completed. Results are reported by the endpoint registration manager, so nothing waits on the registrations.
+ */
+class EndpointRegistrationTracker
+        : public alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationObserverInterface {
+public:
+    /**
+     * Creates a tracker for a set of endpoints.
+     *
+     * @param [in] endpointIds The discovery IDs of the endpoints to track.
+     * @param [in] setupStart The time at which setup started.
+     * @return A new @c EndpointRegistrationTracker, or @c nullptr if the operation failed.
+     */
+    static std::shared_ptr<EndpointRegistrationTracker> create(
+        std::unordered_set<std::string> endpointIds,
+        std::chrono::steady_clock::time_point setupStart);
+
+    /// @name @c EndpointRegistrationObserverInterface methods
+    /// @{
+    void onEndpointRegistration(
+        const alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointIdentifier& endpointId,
+        const alexaClientSDK::avsCommon::avs::AVSDiscoveryEndpointAttributes& attributes,
+        const RegistrationResult result) override;
+    /// @}
+
+    /**
+     * Records a registration that was rejected before the endpoint registration manager processed it. Such
+     * registrations are not reported to observers.
+     *
+     * @param [in] endpointId The discovery ID of the endpoint.
+     */
+    void onRegistrationRejected(const std::string& endpointId);
+
+    /**
+     * @return @c true if the registration of every tracked endpoint has completed.
+     */
+    bool isComplete();
+
+    /**
+     * @return The number of tracked endpoints whose registration failed.
+     */
+    size_t getFailedCount();
+
+private:
+    EndpointRegistrationTracker(
+        std::unordered_set<std::string> endpointIds,
+        std::chrono::steady_clock::time_point setupStart);
+
+    /**
+     * Records the completed registration of a tracked endpoint, and logs the result once every registration has
+     * completed. Endpoints that are not tracked, or already completed, are ignored.
+     *
+     * @note Must be called while holding @c m_mutex.
+     */
+    void completeLocked(const std::string& endpointId, bool succeeded);
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The endpoints whose registration has not completed yet.
+    std::unordered_set<std::string> m_pendingEndpointIds;
+
+    /// The number of tracked endpoints.
+    const size_t m_endpointCount;
+
+    /// The number of registrations that failed.
+    size_t m_failedCount;
+
+    /// The time at which setup started.
+    const std::chrono::steady_clock::time_point m_setupStart;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_ENDPOINT_REGISTRATION_TRACKER_H
@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_MODECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_MODECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/ModeController/ModeControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class ModeController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::modeController::ModeControllerInterface
+        , public CarControlStateObserverInterface
         , public std::enable_shared_from_this<ModeController> {
 public:
     /// Aliases to improve readability
@@ -52,7 +57,7 @@ public:
      * @return A pointer to a new @c ModeController if arguments are valid, otherwise @c nullptr
      */
     static std::shared_ptr<ModeController> create(
-        const json& controllerConfig,
+        const CapabilityModel& capability,
         const std::string& endpointId,
         const std::string& interface,
         const AssetStore& assetStore);
@@ -75,6 +80,11 @@ public:
     void removeObserver(const std::shared_ptr<ModeControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name CarControlStateObserverInterface methods
+    /// @{
+    void onStateChanged(const CarControlState& state, bool alexaInteraction) override;
+    /// @}
+
 private:
     /**
      * ModeController constructor
@@ -90,6 +100,11 @@ private:
 
     /// The list of modes supported by this controller
     std::vector<std::string> m_supportedModes;
+
+    /// The observers notified of state changes reported by the platform
+    std::vector<std::shared_ptr<ModeControllerObserverInterface>> m_observers;
+    /// Serializes access to @c m_observers
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
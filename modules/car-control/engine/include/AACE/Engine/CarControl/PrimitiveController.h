@@ -18,6 +18,7 @@
 
 #include "AACE/Engine/CarControl/AssetStore.h"
 #include <AACE/Engine/CarControl/CapabilityController.h>
+#include <AACE/Engine/CarControl/CarControlModel.h>
 #include <AVSCommon/AVS/CapabilityResources.h>
 #include <AVSCommon/AVS/CapabilitySemantics/CapabilitySemantics.h>
 #include <AVSCommon/Utils/Optional.h>
@@ -57,23 +58,24 @@ public:
     std::string getInstance();
 
     /**
-     * Utility function to create a @c CapabilityResources from a 'capabilityResources' node of a capability definition JSON
+     * Utility function to create a @c CapabilityResources from the asset IDs of a capability's friendly names
      *
-     * @param resources The 'capabilityResources' node of the capability definition JSON
+     * @param assetIds The asset IDs of the friendly names
      * @param assetStore The AssetStore containing asset definitions to expand
-     * @return An @c Optional @c CapabilityResources with an empty value if the object cannot be constructed due to parsing error
+     * @return An @c Optional @c CapabilityResources with an empty value if the object cannot be constructed
      */
     static alexaClientSDK::avsCommon::utils::Optional<CapabilityResources> getResources(
-        const json& resources,
+        const std::vector<std::string>& assetIds,
         const AssetStore& assetStore);
 
     /**
-     * Utility function to create a @c CapabilitySemantics from a 'semantics' node of a capability definition JSON
+     * Utility function to create a @c CapabilitySemantics from the action mappings of a capability's semantics
      *
-     * @param semantics The 'semantics' node of the capability definition JSON
-     * @return An @c Optional @c CapabilitySemantics with an empty value if the object cannot be constructed due to parsing error
+     * @param actionMappings The action mappings of the capability's semantics
+     * @return An @c Optional @c CapabilitySemantics with an empty value if the object cannot be constructed
      */
-    static alexaClientSDK::avsCommon::utils::Optional<CapabilitySemantics> getSemantics(const json& semantics);
+    static alexaClientSDK::avsCommon::utils::Optional<CapabilitySemantics> getSemantics(
+        const std::vector<ActionMappingModel>& actionMappings);
 
 private:
     /// The name of this capability controller instance
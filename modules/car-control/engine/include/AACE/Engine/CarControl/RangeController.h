@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_RANGECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_RANGECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/RangeController/RangeControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class RangeController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::rangeController::RangeControllerInterface
+        , public CarControlStateObserverInterface
         , public std::enable_shared_from_this<RangeController> {
 public:
     /// Aliases to improve readability
@@ -53,7 +58,7 @@ public:
      * @return A pointer to a new @c RangeController if arguments are valid, otherwise @c nullptr
      */
     static std::shared_ptr<RangeController> create(
-        const json& controllerConfig,
+        const CapabilityModel& capability,
         const std::string& endpointId,
         const std::string& interface,
         const AssetStore& assetStore);
@@ -77,6 +82,11 @@ public:
     void removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name CarControlStateObserverInterface methods
+    /// @{
+    void onStateChanged(const CarControlState& state, bool alexaInteraction) override;
+    /// @}
+
 private:
     /**
      * RangeController constructor.
@@ -99,6 +109,11 @@ private:
     double m_maximum;
     /// The precision of range increments allowed for this controller
     double m_precision;
+
+    /// The observers notified of state changes reported by the platform
+    std::vector<std::shared_ptr<RangeControllerObserverInterface>> m_observers;
+    /// Serializes access to @c m_observers
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
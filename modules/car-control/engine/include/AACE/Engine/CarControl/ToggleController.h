@@ -16,6 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_TOGGLECONTROLLER_H
 #define AACE_ENGINE_CAR_CONTROL_TOGGLECONTROLLER_H
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <AVSCommon/SDKInterfaces/ToggleController/ToggleControllerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
@@ -33,6 +37,7 @@ namespace carControl {
 class ToggleController
         : public PrimitiveController
         , public alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerInterface
+        , public CarControlStateObserverInterface
         , public std::enable_shared_from_this<ToggleController> {
 public:
     /// Aliases to improve readability
@@ -54,7 +59,7 @@ public:
      * @return A pointer to a new @c ToggleController if arguments are valid, otherwise @c nullptr
      */
     static std::shared_ptr<ToggleController> create(
-        const json& controllerConfig,
+        const CapabilityModel& capability,
         const std::string& endpointId,
         const std::string& interface,
         const AssetStore& assetStore);
@@ -75,6 +80,11 @@ public:
     void removeObserver(const std::shared_ptr<ToggleControllerObserverInterface>& observer) override;
     /// @}
 
+    /// @name CarControlStateObserverInterface methods
+    /// @{
+    void onStateChanged(const CarControlState& state, bool alexaInteraction) override;
+    /// @}
+
 private:
     /**
      * ToggleController constructor
@@ -87,6 +97,11 @@ private:
 
     /// The attributes of this ToggleController
     ToggleControllerAttributes m_attributes;
+
+    /// The observers notified of state changes reported by the platform
+    std::vector<std::shared_ptr<ToggleControllerObserverInterface>> m_observers;
+    /// Serializes access to @c m_observers
+    std::mutex m_observersMutex;
 };
 
 }  // namespace carControl
@@ -14,9 +14,15 @@
  */
 
 #include <AACE/Engine/CarControl/AssetStore.h>
+#include <AACE/Engine/CarControl/CacheFile.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
-#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
 
 // JSON for Modern C++
 #include <nlohmann/json.hpp>
@@ -29,73 +35,312 @@ namespace carControl {
 /// String to identify log entries originating from this file.
 static const std::string TAG("aace.carControl.AssetStore");
 
+/// Identifies a compiled assets image ("AACA")
+static const uint32_t COMPILED_ASSETS_MAGIC = 0x41434141;
+/// The version of the compiled assets image format. Increment when the format changes.
+static const uint32_t COMPILED_ASSETS_VERSION = 1;
+/// The prefix of compiled assets cache file names
+static const std::string CACHE_FILE_PREFIX = "carControlAssets-";
+
+/**
+ * Compiled assets image layout. All fields are native-endian 32-bit values. The image is a header, followed by
+ * the asset index sorted by asset ID, the friendly names of all assets, the string table, and the string data.
+ * Asset IDs, friendly names and locales are indexes into the string table, so each distinct string is stored once.
+ */
+/// @{
+struct ImageHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t assetCount;
+    uint32_t nameCount;
+    uint32_t stringCount;
+    uint32_t stringDataSize;
+};
+
+struct ImageAsset {
+    uint32_t assetId;
+    uint32_t firstName;
+    uint32_t nameCount;
+};
+
+struct ImageName {
+    uint32_t text;
+    uint32_t locale;
+};
+
+struct ImageString {
+    uint32_t offset;
+    uint32_t length;
+};
+/// @}
+
+/**
+ * Gets the 64-bit FNV-1a hash of the assets file contents, used to key the compiled assets cache.
+ */
+static uint64_t getContentHash(const std::string& contents) {
+    return CacheFile::hash(contents.data(), contents.size(), CacheFile::HASH_OFFSET_BASIS ^ COMPILED_ASSETS_VERSION);
+}
+
+class AssetStore::CompiledAssets {
+public:
+    /**
+     * Creates compiled assets that own the image.
+     */
+    static std::shared_ptr<CompiledAssets> create(std::string image) {
+        auto compiledAssets = std::shared_ptr<CompiledAssets>(new CompiledAssets());
+        compiledAssets->m_image = std::move(image);
+        return compiledAssets->initialize(compiledAssets->m_image.data(), compiledAssets->m_image.size())
+                   ? compiledAssets
+                   : nullptr;
+    }
+
+    /**
+     * Creates compiled assets by memory-mapping a cached image.
+     *
+     * @return @c nullptr if the file does not exist or is not a valid image
+     */
+    static std::shared_ptr<CompiledAssets> map(const std::string& path) {
+        auto file = CacheFile::map(path);
+        if (file == nullptr) {
+            return nullptr;
+        }
+        auto compiledAssets = std::shared_ptr<CompiledAssets>(new CompiledAssets());
+        compiledAssets->m_file = file;
+        return compiledAssets->initialize(file->data(), file->size()) ? compiledAssets : nullptr;
+    }
+
+    /**
+     * Writes the image to a cache file.
+     */
+    bool save(const std::string& path) const {
+        return CacheFile::save(path, m_data, m_size);
+    }
+
+    /**
+     * Finds the friendly names of an asset.
+     *
+     * @return @c false if the asset isn't present
+     */
+    bool getFriendlyNames(const std::string& assetId, std::vector<NameLocalePair>& names) const {
+        auto end = m_assets + m_header->assetCount;
+        auto asset = std::lower_bound(m_assets, end, assetId, [this](const ImageAsset& entry, const std::string& id) {
+            return compare(entry.assetId, id) < 0;
+        });
+        if (asset == end || compare(asset->assetId, assetId) != 0) {
+            return false;
+        }
+        names.reserve(asset->nameCount);
+        for (uint32_t i = asset->firstName; i < asset->firstName + asset->nameCount; i++) {
+            names.emplace_back(getString(m_names[i].text), getString(m_names[i].locale));
+        }
+        return true;
+    }
+
+private:
+    CompiledAssets() = default;
+
+    /**
+     * Locates the sections of the image and checks that every index and offset is in bounds, so a corrupt cache
+     * file is rejected rather than read out of bounds.
+     */
+    bool initialize(const char* data, size_t size) {
+        m_data = data;
+        m_size = size;
+        ReturnIf(size < sizeof(ImageHeader), false);
+        m_header = reinterpret_cast<const ImageHeader*>(data);
+        ReturnIf(m_header->magic != COMPILED_ASSETS_MAGIC || m_header->version != COMPILED_ASSETS_VERSION, false);
+
+        uint64_t expectedSize = sizeof(ImageHeader) + uint64_t(m_header->assetCount) * sizeof(ImageAsset) +
+                                uint64_t(m_header->nameCount) * sizeof(ImageName) +
+                                uint64_t(m_header->stringCount) * sizeof(ImageString) + m_header->stringDataSize;
+        ReturnIf(expectedSize != size, false);
+
+        m_assets = reinterpret_cast<const ImageAsset*>(data + sizeof(ImageHeader));
+        m_names = reinterpret_cast<const ImageName*>(m_assets + m_header->assetCount);
+        m_strings = reinterpret_cast<const ImageString*>(m_names + m_header->nameCount);
+        m_stringData = reinterpret_cast<const char*>(m_strings + m_header->stringCount);
+
+        for (uint32_t i = 0; i < m_header->stringCount; i++) {
+            ReturnIf(uint64_t(m_strings[i].offset) + m_strings[i].length > m_header->stringDataSize, false);
+        }
+        for (uint32_t i = 0; i < m_header->nameCount; i++) {
+            ReturnIf(m_names[i].text >= m_header->stringCount || m_names[i].locale >= m_header->stringCount, false);
+        }
+        for (uint32_t i = 0; i < m_header->assetCount; i++) {
+            ReturnIf(m_assets[i].assetId >= m_header->stringCount, false);
+            ReturnIf(uint64_t(m_assets[i].firstName) + m_assets[i].nameCount > m_header->nameCount, false);
+        }
+        return true;
+    }
+
+    std::string getString(uint32_t index) const {
+        return std::string(m_stringData + m_strings[index].offset, m_strings[index].length);
+    }
+
+    int compare(uint32_t index, const std::string& value) const {
+        return -value.compare(0, value.size(), m_stringData + m_strings[index].offset, m_strings[index].length);
+    }
+
+private:
+    /// The image, if owned
+    std::string m_image;
+    /// The mapped image, if memory-mapped
+    std::shared_ptr<CacheFile> m_file;
+
+    /// The sections of the image
+    /// @{
+    const char* m_data;
+    size_t m_size;
+    const ImageHeader* m_header;
+    const ImageAsset* m_assets;
+    const ImageName* m_names;
+    const ImageString* m_strings;
+    const char* m_stringData;
+    /// @}
+};
+
+AssetStore::AssetStore() = default;
+
 AssetStore::~AssetStore() {
     clear();
 }
 
+void AssetStore::setCachePath(const std::string& path) {
+    m_cachePath = path;
+}
+
 bool AssetStore::addAssets(const std::string& path) {
     try {
-        std::ifstream ifs(path);
-        return addAssets(ifs);
+        std::ifstream ifs(path, std::ios::binary);
+        ThrowIfNot(ifs.good(), "openAssetsFileFailed");
+        std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+        std::shared_ptr<CompiledAssets> compiledAssets;
+        std::string cacheFilePrefix;
+        std::string cacheFilePath;
+        if (!m_cachePath.empty()) {
+            // The images of an assets file are named after its path, so the image of its previous contents can be
+            // removed without removing the images of other assets files
+            cacheFilePrefix = CACHE_FILE_PREFIX + CacheFile::toHex(CacheFile::hash(path.data(), path.size())) + "-";
+            cacheFilePath = CacheFile::getPath(m_cachePath, cacheFilePrefix, getContentHash(contents));
+            compiledAssets = CompiledAssets::map(cacheFilePath);
+            AACE_DEBUG(LX(TAG).d("cached", compiledAssets != nullptr).sensitive("path", path));
+        }
+        if (compiledAssets == nullptr) {
+            compiledAssets = compileAssets(contents);
+            ThrowIfNull(compiledAssets, "compileAssetsFailed");
+            if (!cacheFilePath.empty() && compiledAssets->save(cacheFilePath)) {
+                CacheFile::removeStale(m_cachePath, cacheFilePrefix, cacheFilePath);
+            }
+        }
+        m_compiledAssets.push_back(compiledAssets);
+        return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
     }
 }
 
-bool AssetStore::addAssets(std::istream& stream) {
+std::shared_ptr<AssetStore::CompiledAssets> AssetStore::compileAssets(const std::string& contents) {
     try {
-        if (stream.good()) {
-            json j = json::parse(stream);
-            json assetArray = j.at("assets");
-            for (auto& assetItem : assetArray.items()) {
-                // For each asset, add an entry to the asset map
-                // 'names' will hold all synonyms for all locales for all values
-                std::vector<NameLocalePair> names;
-                auto assetObject = assetItem.value();
-                std::string assetId = assetObject["assetId"];
-                json valuesArray = assetObject["values"];
-                for (auto& valueItem : valuesArray.items()) {
-                    json valueObject = valueItem.value();
-                    std::string defaultValue = valueObject["defaultValue"];
-                    json synonyms = valueObject["synonyms"];
-                    std::vector<std::string> locales = valueObject.at("locales");
-                    // For every locale, add the defaultValue and each synonym
-                    // to the list of names for this assetId
-                    for (auto locale = locales.begin(); locale != locales.end(); ++locale) {
-                        names.push_back({defaultValue, *locale});
-                        for (auto& synonym : synonyms.items()) {
-                            names.push_back({synonym.value(), *locale});
-                        }
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, uint32_t> stringIndex;
+        auto intern = [&strings, &stringIndex](const std::string& value) -> uint32_t {
+            auto result = stringIndex.emplace(value, static_cast<uint32_t>(strings.size()));
+            if (result.second) {
+                strings.push_back(value);
+            }
+            return result.first->second;
+        };
+
+        std::vector<ImageAsset> assets;
+        std::vector<ImageName> names;
+        std::unordered_map<std::string, size_t> assetIndex;
+
+        json j = json::parse(contents);
+        json& assetArray = j.at("assets");
+        for (auto& assetItem : assetArray.items()) {
+            // For each asset, add an entry to the asset index
+            // 'names' will hold all synonyms for all locales for all values
+            auto& assetObject = assetItem.value();
+            std::string assetId = assetObject["assetId"];
+            ImageAsset asset{intern(assetId), static_cast<uint32_t>(names.size()), 0};
+            json& valuesArray = assetObject["values"];
+            for (auto& valueItem : valuesArray.items()) {
+                auto& valueObject = valueItem.value();
+                uint32_t defaultValue = intern(valueObject["defaultValue"]);
+                std::vector<uint32_t> synonyms;
+                for (auto& synonym : valueObject["synonyms"].items()) {
+                    synonyms.push_back(intern(synonym.value()));
+                }
+                std::vector<std::string> locales = valueObject.at("locales");
+                // For every locale, add the defaultValue and each synonym
+                // to the list of names for this assetId
+                for (auto& next : locales) {
+                    uint32_t locale = intern(next);
+                    names.push_back({defaultValue, locale});
+                    for (auto synonym : synonyms) {
+                        names.push_back({synonym, locale});
                     }
                 }
-                ThrowIf(names.empty(), "noAssetFriendlyNameFor " + assetId);
-                m_assets.emplace(assetId, names);
             }
-            return true;
+            asset.nameCount = static_cast<uint32_t>(names.size()) - asset.firstName;
+            ThrowIf(asset.nameCount == 0, "noAssetFriendlyNameFor " + assetId);
+            // The first definition of an asset ID is kept
+            if (assetIndex.emplace(assetId, assets.size()).second) {
+                assets.push_back(asset);
+            } else {
+                names.resize(asset.firstName);
+            }
         }
-        return false;
+        std::sort(assets.begin(), assets.end(), [&strings](const ImageAsset& a, const ImageAsset& b) {
+            return strings[a.assetId] < strings[b.assetId];
+        });
+
+        std::vector<ImageString> stringTable;
+        std::string stringData;
+        for (auto& next : strings) {
+            stringTable.push_back({static_cast<uint32_t>(stringData.size()), static_cast<uint32_t>(next.size())});
+            stringData.append(next);
+        }
+
+        ImageHeader header{COMPILED_ASSETS_MAGIC,
+                           COMPILED_ASSETS_VERSION,
+                           static_cast<uint32_t>(assets.size()),
+                           static_cast<uint32_t>(names.size()),
+                           static_cast<uint32_t>(stringTable.size()),
+                           static_cast<uint32_t>(stringData.size())};
+        std::string image;
+        image.reserve(
+            sizeof(header) + assets.size() * sizeof(ImageAsset) + names.size() * sizeof(ImageName) +
+            stringTable.size() * sizeof(ImageString) + stringData.size());
+        image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        image.append(reinterpret_cast<const char*>(assets.data()), assets.size() * sizeof(ImageAsset));
+        image.append(reinterpret_cast<const char*>(names.data()), names.size() * sizeof(ImageName));
+        image.append(reinterpret_cast<const char*>(stringTable.data()), stringTable.size() * sizeof(ImageString));
+        image.append(stringData);
+
+        auto compiledAssets = CompiledAssets::create(std::move(image));
+        ThrowIfNull(compiledAssets, "invalidCompiledAssets");
+        return compiledAssets;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        clear();
-        return false;
+        return nullptr;
     }
 }
 
-const std::vector<AssetStore::NameLocalePair>& AssetStore::getFriendlyNames(const std::string& assetId) const {
-    auto iter = m_assets.find(assetId);
-    if (iter != m_assets.end()) {
-        return iter->second;
-    } else {
-        return m_empty;
+std::vector<AssetStore::NameLocalePair> AssetStore::getFriendlyNames(const std::string& assetId) const {
+    std::vector<NameLocalePair> names;
+    for (auto& compiledAssets : m_compiledAssets) {
+        if (compiledAssets->getFriendlyNames(assetId, names)) {
+            break;
+        }
     }
+    return names;
 }
 
 void AssetStore::clear() {
-    for (auto value : m_assets) {
-        value.second.clear();
-    }
-    m_assets.clear();
+    m_compiledAssets.clear();
 }
 
 }  // namespace carControl
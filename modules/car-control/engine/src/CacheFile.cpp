@@ -0,0 +1,137 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/CarControl/CacheFile.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.carControl.CacheFile");
+
+/// The extension of cache files
+static const std::string CACHE_FILE_EXTENSION = ".bin";
+/// The suffix of a cache file while it is being written
+static const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+const uint64_t CacheFile::HASH_OFFSET_BASIS;
+
+std::shared_ptr<CacheFile> CacheFile::map(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::shared_ptr<CacheFile>(new CacheFile(address, size));
+}
+
+CacheFile::CacheFile(void* address, size_t size) : m_address(address), m_size(size) {
+}
+
+CacheFile::~CacheFile() {
+    munmap(m_address, m_size);
+}
+
+const char* CacheFile::data() const {
+    return static_cast<const char*>(m_address);
+}
+
+size_t CacheFile::size() const {
+    return m_size;
+}
+
+bool CacheFile::save(const std::string& path, const char* data, size_t size) {
+    try {
+        {
+            std::ofstream file(path + TEMP_FILE_SUFFIX, std::ios::binary | std::ios::trunc);
+            ThrowIfNot(file.good(), "openFileFailed");
+            file.write(data, size);
+            ThrowIfNot(file.good(), "writeFileFailed");
+        }
+        ThrowIf(std::rename((path + TEMP_FILE_SUFFIX).c_str(), path.c_str()) != 0, "renameFileFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        std::remove((path + TEMP_FILE_SUFFIX).c_str());
+        return false;
+    }
+}
+
+std::string CacheFile::getPath(const std::string& directory, const std::string& prefix, uint64_t hash) {
+    return directory + '/' + prefix + toHex(hash) + CACHE_FILE_EXTENSION;
+}
+
+void CacheFile::removeStale(const std::string& directory, const std::string& prefix, const std::string& keepPath) {
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        AACE_WARN(LX(TAG).m("openCacheDirectoryFailed").sensitive("directory", directory));
+        return;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, prefix.size(), prefix) != 0 || name.size() < prefix.size() + CACHE_FILE_EXTENSION.size() ||
+            name.compare(name.size() - CACHE_FILE_EXTENSION.size(), std::string::npos, CACHE_FILE_EXTENSION) != 0) {
+            continue;
+        }
+        std::string path = directory + '/' + name;
+        if (path != keepPath) {
+            AACE_DEBUG(LX(TAG).m("removingStaleCacheFile").sensitive("path", path));
+            std::remove(path.c_str());
+        }
+    }
+    closedir(dir);
+}
+
+uint64_t CacheFile::hash(const void* data, size_t size, uint64_t hash) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string CacheFile::toHex(uint64_t hash) {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
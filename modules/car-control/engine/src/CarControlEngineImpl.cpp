@@ -21,33 +21,91 @@ namespace aace {
 namespace engine {
 namespace carControl {
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.CarControlEngineImpl");
+
 static const std::string MODE_CONTROLLER_TAG("aace.engine.carControl.ModeController");
 static const std::string POWER_CONTROLLER_TAG("aace.engine.carControl.PowerController");
 static const std::string RANGE_CONTROLLER_TAG("aace.engine.carControl.RangeController");
 static const std::string TOGGLE_CONTROLLER_TAG("aace.engine.carControl.ToggleController");
 
+/// The instance used to identify the power controller of an endpoint in the state cache
+static const std::string POWER_CONTROLLER_INSTANCE("");
+
 std::shared_ptr<CarControlEngineImpl> CarControlEngineImpl::create(
-    std::shared_ptr<aace::carControl::CarControl> platformInterface) {
-    return std::make_shared<CarControlEngineImpl>(platformInterface);
+    std::shared_ptr<aace::carControl::CarControl> platformInterface,
+    std::shared_ptr<CarControlStateStore> stateStore) {
+    auto carControlEngineImpl = std::make_shared<CarControlEngineImpl>(platformInterface, stateStore);
+    if (stateStore != nullptr) {
+        // the platform interface reports controller state to the engine only when state is cached
+        platformInterface->setEngineInterface(carControlEngineImpl);
+    }
+    return carControlEngineImpl;
 }
 
-CarControlEngineImpl::CarControlEngineImpl(std::shared_ptr<aace::carControl::CarControl> platformInterface) :
+CarControlEngineImpl::CarControlEngineImpl(
+    std::shared_ptr<aace::carControl::CarControl> platformInterface,
+    std::shared_ptr<CarControlStateStore> stateStore) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown("CarControlEngineImpl"),
-        m_platformInterface(platformInterface) {
+        m_platformInterface(platformInterface),
+        m_stateStore(stateStore) {
+}
+
+bool CarControlEngineImpl::executeDirective(
+    const std::string& endpointId,
+    const std::string& instance,
+    const std::function<bool()>& directive,
+    const CarControlState* newState) {
+    if (m_stateStore == nullptr) {
+        return directive();
+    }
+    m_stateStore->beginAlexaInteraction(endpointId, instance);
+    bool success = directive();
+    if (success) {
+        if (newState != nullptr) {
+            m_stateStore->updateState(endpointId, instance, *newState, true);
+        } else {
+            m_stateStore->invalidateState(endpointId, instance);
+        }
+    }
+    m_stateStore->endAlexaInteraction(endpointId, instance);
+    return success;
 }
 
 bool CarControlEngineImpl::turnPowerControllerOn(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOn"));
-    return m_platformInterface->turnPowerControllerOn(endpointId);
+    CarControlState state;
+    state.isOn = true;
+    return executeDirective(
+        endpointId,
+        POWER_CONTROLLER_INSTANCE,
+        [this, &endpointId] { return m_platformInterface->turnPowerControllerOn(endpointId); },
+        &state);
 }
 
 bool CarControlEngineImpl::turnPowerControllerOff(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOff"));
-    return m_platformInterface->turnPowerControllerOff(endpointId);
+    CarControlState state;
+    state.isOn = false;
+    return executeDirective(
+        endpointId,
+        POWER_CONTROLLER_INSTANCE,
+        [this, &endpointId] { return m_platformInterface->turnPowerControllerOff(endpointId); },
+        &state);
 }
 
 bool CarControlEngineImpl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
-    return m_platformInterface->isPowerControllerOn(endpointId, isOn);
+    CarControlState state;
+    if (m_stateStore != nullptr && m_stateStore->getState(endpointId, POWER_CONTROLLER_INSTANCE, state)) {
+        isOn = state.isOn;
+        return true;
+    }
+    ReturnIfNot(m_platformInterface->isPowerControllerOn(endpointId, isOn), false);
+    if (m_stateStore != nullptr) {
+        state.isOn = isOn;
+        m_stateStore->cacheState(endpointId, POWER_CONTROLLER_INSTANCE, state);
+    }
+    return true;
 }
 
 bool CarControlEngineImpl::turnToggleControllerOn(const std::string& endpointId, const std::string& instance) {
@@ -55,7 +113,13 @@ bool CarControlEngineImpl::turnToggleControllerOn(const std::string& endpointId,
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOn")
                    .sensitive("instance", instance));
-    return m_platformInterface->turnToggleControllerOn(endpointId, instance);
+    CarControlState state;
+    state.isOn = true;
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance] { return m_platformInterface->turnToggleControllerOn(endpointId, instance); },
+        &state);
 }
 
 bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId, const std::string& instance) {
@@ -63,14 +127,30 @@ bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOff")
                    .sensitive("instance", instance));
-    return m_platformInterface->turnToggleControllerOff(endpointId, instance);
+    CarControlState state;
+    state.isOn = false;
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance] { return m_platformInterface->turnToggleControllerOff(endpointId, instance); },
+        &state);
 }
 
 bool CarControlEngineImpl::isToggleControllerOn(
     const std::string& endpointId,
     const std::string& instance,
     bool& isOn) {
-    return m_platformInterface->isToggleControllerOn(endpointId, instance, isOn);
+    CarControlState state;
+    if (m_stateStore != nullptr && m_stateStore->getState(endpointId, instance, state)) {
+        isOn = state.isOn;
+        return true;
+    }
+    ReturnIfNot(m_platformInterface->isToggleControllerOn(endpointId, instance, isOn), false);
+    if (m_stateStore != nullptr) {
+        state.isOn = isOn;
+        m_stateStore->cacheState(endpointId, instance, state);
+    }
+    return true;
 }
 
 bool CarControlEngineImpl::setRangeControllerValue(
@@ -82,7 +162,15 @@ bool CarControlEngineImpl::setRangeControllerValue(
                    .sensitive("name", "SetRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValue", value));
-    return m_platformInterface->setRangeControllerValue(endpointId, instance, value);
+    CarControlState state;
+    state.rangeValue = value;
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance, value] {
+            return m_platformInterface->setRangeControllerValue(endpointId, instance, value);
+        },
+        &state);
 }
 
 bool CarControlEngineImpl::adjustRangeControllerValue(
@@ -94,14 +182,31 @@ bool CarControlEngineImpl::adjustRangeControllerValue(
                    .sensitive("name", "AdjustRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValueDelta", delta));
-    return m_platformInterface->adjustRangeControllerValue(endpointId, instance, delta);
+    // the platform clamps the adjusted value, so the new value is known only when the platform reports it
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance, delta] {
+            return m_platformInterface->adjustRangeControllerValue(endpointId, instance, delta);
+        },
+        nullptr);
 }
 
 bool CarControlEngineImpl::getRangeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     double& value) {
-    return m_platformInterface->getRangeControllerValue(endpointId, instance, value);
+    CarControlState state;
+    if (m_stateStore != nullptr && m_stateStore->getState(endpointId, instance, state)) {
+        value = state.rangeValue;
+        return true;
+    }
+    ReturnIfNot(m_platformInterface->getRangeControllerValue(endpointId, instance, value), false);
+    if (m_stateStore != nullptr) {
+        state.rangeValue = value;
+        m_stateStore->cacheState(endpointId, instance, state);
+    }
+    return true;
 }
 
 bool CarControlEngineImpl::setModeControllerValue(
@@ -113,7 +218,15 @@ bool CarControlEngineImpl::setModeControllerValue(
                    .sensitive("name", "SetMode")
                    .sensitive("instance", instance)
                    .sensitive("mode", value));
-    return m_platformInterface->setModeControllerValue(endpointId, instance, value);
+    CarControlState state;
+    state.mode = value;
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance, &value] {
+            return m_platformInterface->setModeControllerValue(endpointId, instance, value);
+        },
+        &state);
 }
 
 bool CarControlEngineImpl::adjustModeControllerValue(
@@ -125,18 +238,95 @@ bool CarControlEngineImpl::adjustModeControllerValue(
                    .sensitive("name", "AdjustMode")
                    .sensitive("instance", instance)
                    .sensitive("modeDelta", delta));
-    return m_platformInterface->adjustModeControllerValue(endpointId, instance, delta);
+    return executeDirective(
+        endpointId,
+        instance,
+        [this, &endpointId, &instance, delta] {
+            return m_platformInterface->adjustModeControllerValue(endpointId, instance, delta);
+        },
+        nullptr);
 }
 
 bool CarControlEngineImpl::getModeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     std::string& value) {
-    return m_platformInterface->getModeControllerValue(endpointId, instance, value);
+    CarControlState state;
+    if (m_stateStore != nullptr && m_stateStore->getState(endpointId, instance, state)) {
+        value = state.mode;
+        return true;
+    }
+    ReturnIfNot(m_platformInterface->getModeControllerValue(endpointId, instance, value), false);
+    if (m_stateStore != nullptr) {
+        state.mode = value;
+        m_stateStore->cacheState(endpointId, instance, state);
+    }
+    return true;
+}
+
+bool CarControlEngineImpl::addStateObserver(
+    const std::string& endpointId,
+    const std::string& instance,
+    std::weak_ptr<CarControlStateObserverInterface> observer) {
+    ReturnIf(m_stateStore == nullptr, false);
+    m_stateStore->addObserver(endpointId, instance, observer);
+    return true;
+}
+
+bool CarControlEngineImpl::reportState(
+    const std::string& endpointId,
+    const std::string& instance,
+    const CarControlState& state) {
+    try {
+        ThrowIfNull(m_stateStore, "stateCacheDisabled");
+        ThrowIf(endpointId.empty(), "invalidEndpointId");
+        m_stateStore->updateState(endpointId, instance, state);
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", endpointId).sensitive("instance", instance));
+        return false;
+    }
+}
+
+bool CarControlEngineImpl::onReportPowerControllerState(const std::string& endpointId, bool isOn) {
+    CarControlState state;
+    state.isOn = isOn;
+    return reportState(endpointId, POWER_CONTROLLER_INSTANCE, state);
+}
+
+bool CarControlEngineImpl::onReportToggleControllerState(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    CarControlState state;
+    state.isOn = isOn;
+    return reportState(endpointId, controllerId, state);
+}
+
+bool CarControlEngineImpl::onReportRangeControllerValue(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    CarControlState state;
+    state.rangeValue = value;
+    return reportState(endpointId, controllerId, state);
+}
+
+bool CarControlEngineImpl::onReportModeControllerValue(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    CarControlState state;
+    state.mode = value;
+    return reportState(endpointId, controllerId, state);
 }
 
 void CarControlEngineImpl::doShutdown() {
+    if (m_stateStore != nullptr) {
+        m_stateStore->shutdown();
+    }
     if (m_platformInterface != nullptr) {
+        m_platformInterface->setEngineInterface(nullptr);
         m_platformInterface.reset();
     }
 }
@@ -18,10 +18,14 @@
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "AACE/Alexa/AlexaProperties.h"
 #include "AACE/Engine/Alexa/AlexaComponentInterface.h"
+#include "AACE/Engine/CarControl/CacheFile.h"
+#include "AACE/Engine/CarControl/CarControlModel.h"
 #include "AACE/Engine/CarControl/Endpoint.h"
+#include "AACE/Engine/CarControl/EndpointRegistrationTracker.h"
 #include "AACE/Engine/CarControl/ZoneDefinitions.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Storage/StorageEngineService.h"
@@ -42,6 +46,8 @@ static const std::string AACE_STORAGE_SERVICE_KEY = "aace.storage";
 static const std::string CAR_CONTROL_CONFIG_TABLE = "carControl";
 /// The key for the 'configuration' in the database 'carControl' table
 static const std::string CAR_CONTROL_CONFIG_KEY = "configuration";
+/// The key for the hash of the 'configuration' in the database 'carControl' table
+static const std::string CAR_CONTROL_CONFIG_HASH_KEY = "configurationHash";
 
 /// The key for the 'endpoints' node of configuration
 static const std::string CONFIG_KEY_ENDPOINTS = "endpoints";
@@ -51,16 +57,30 @@ static const std::string CONFIG_KEY_ASSETS = "assets";
 static const std::string CONFIG_KEY_DEFAULT_ASSETS_PATH = "defaultAssetsPath";
 /// The key for the 'customAssetsPath' node of configuration
 static const std::string CONFIG_KEY_CUSTOM_ASSETS_PATH = "customAssetsPath";
+/// The key for the 'cachePath' node of the 'assets' configuration
+static const std::string CONFIG_KEY_ASSETS_CACHE_PATH = "cachePath";
+/// The key for the 'stateCache' node of configuration
+static const std::string CONFIG_KEY_STATE_CACHE = "stateCache";
+/// The key for the 'enabled' node of the 'stateCache' configuration
+static const std::string CONFIG_KEY_STATE_CACHE_ENABLED = "enabled";
+/// The key for the 'changeReportDelay' node of the 'stateCache' configuration
+static const std::string CONFIG_KEY_CHANGE_REPORT_DELAY = "changeReportDelay";
+
+/// The default time to wait after a state change before reporting it, in milliseconds
+static const int DEFAULT_CHANGE_REPORT_DELAY_MS = 100;
+
+/// The prefix of compiled model cache file names
+static const std::string MODEL_CACHE_FILE_PREFIX = "carControlModel-";
 
 // The endpoint ID of the internal endpoint created for zones
 static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
 
+/// Alias to improve readability
+using Milliseconds = std::chrono::milliseconds;
+
 // Register the car control service with the Engine
 REGISTER_SERVICE(CarControlEngineService);
 
-using RegistrationResult =
-    alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface::RegistrationResult;
-
 CarControlEngineService::CarControlEngineService(const aace::engine::core::ServiceDescription& description) :
         aace::engine::core::EngineService(description) {
 }
@@ -79,21 +99,24 @@ bool CarControlEngineService::initialize() {
     }
 }
 
-bool CarControlEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool CarControlEngineService::configure(const json& configuration) {
     try {
         AACE_DEBUG(LX(TAG).d("isLocalServiceAvailable", isLocalServiceAvailable()));
         ThrowIf(m_configured, "carControlEngineServiceAlreadyConfigured");
 
-        json jconfiguration;
-        jconfiguration = json::parse(*configuration);
-
         // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore to
         // facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint construction.
         // Note: Default assets may be overridden for legacy backward compatibility, but this results in friendly name/
         // locale pair expansion rather than using asset definitions stored in the cloud.
 
-        if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
-            auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
+        std::string cachePath;
+        if (configuration.contains(CONFIG_KEY_ASSETS) && configuration[CONFIG_KEY_ASSETS].is_object()) {
+            auto& assets = configuration.at(CONFIG_KEY_ASSETS);
+            if (assets.contains(CONFIG_KEY_ASSETS_CACHE_PATH) && assets[CONFIG_KEY_ASSETS_CACHE_PATH].is_string()) {
+                cachePath = assets.at(CONFIG_KEY_ASSETS_CACHE_PATH);
+                AACE_DEBUG(LX(TAG).m("cachingCompiledAssets").sensitive("cachePath", cachePath));
+                m_assetStore.setCachePath(cachePath);
+            }
             if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) && assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
                 std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
                 AACE_WARN(LX(TAG)
@@ -110,25 +133,73 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
             }
         }
 
-        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
-        translateConfigForZones(jconfiguration);
+        // Controller state is cached in the engine only if the platform reports every state change
+        if (configuration.contains(CONFIG_KEY_STATE_CACHE) && configuration[CONFIG_KEY_STATE_CACHE].is_object()) {
+            auto& stateCache = configuration.at(CONFIG_KEY_STATE_CACHE);
+            m_stateCacheEnabled = stateCache.value(CONFIG_KEY_STATE_CACHE_ENABLED, false);
+            int changeReportDelay = stateCache.value(CONFIG_KEY_CHANGE_REPORT_DELAY, DEFAULT_CHANGE_REPORT_DELAY_MS);
+            ThrowIf(changeReportDelay < 0, "invalidChangeReportDelay");
+            m_changeReportDelay = std::chrono::milliseconds(changeReportDelay);
+            AACE_DEBUG(LX(TAG)
+                           .d("stateCacheEnabled", m_stateCacheEnabled)
+                           .d("changeReportDelay", m_changeReportDelay.count()));
+        }
 
-        // Construct an object representation of each endpoint in configuration
-        if (jconfiguration.contains(CONFIG_KEY_ENDPOINTS) && jconfiguration.at(CONFIG_KEY_ENDPOINTS).is_array()) {
-            for (auto& item : jconfiguration.at(CONFIG_KEY_ENDPOINTS).items()) {
-                if (item.value().at("endpointId") == INTERNAL_ENDPOINT_ID) continue;
-                auto endpoint = Endpoint::create(item.value(), m_assetStore);
-                ThrowIfNull(endpoint, "createEndpointFailed");
-                ThrowIfNot(m_endpoints.insert({endpoint->getId(), endpoint}).second, "insertEndpointFailed");
+        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability).
+        // The configuration is only copied and translated when it is compiled or written to storage.
+        json translatedConfiguration;
+        const json* configurationView = nullptr;
+        auto getTranslatedConfiguration = [&]() -> const json& {
+            if (configurationView == nullptr) {
+                configurationView = &configuration;
+                if (configuration.contains("zones") && configuration.at("zones").is_array()) {
+                    translatedConfiguration = configuration;
+                    translateConfigForZones(translatedConfiguration);
+                    configurationView = &translatedConfiguration;
+                }
+            }
+            return *configurationView;
+        };
+
+        // Load the compiled model of the configuration cached with the compiled assets. The configuration is only
+        // compiled when its hash changes.
+        uint64_t configurationHash = CarControlModel::getConfigurationHash(configuration);
+        std::shared_ptr<CarControlModel> model;
+        std::string modelCacheFilePath;
+        if (!cachePath.empty()) {
+            modelCacheFilePath = CacheFile::getPath(cachePath, MODEL_CACHE_FILE_PREFIX, configurationHash);
+            model = CarControlModel::load(modelCacheFilePath);
+            AACE_DEBUG(LX(TAG).d("cachedModel", model != nullptr));
+        }
+        if (model == nullptr) {
+            model =
+                CarControlModel::create(getTranslatedConfiguration(), m_zonesCapabilityConfig, INTERNAL_ENDPOINT_ID);
+            ThrowIfNull(model, "compileCarControlModelFailed");
+            if (!modelCacheFilePath.empty() && model->save(modelCacheFilePath)) {
+                CacheFile::removeStale(cachePath, MODEL_CACHE_FILE_PREFIX, modelCacheFilePath);
             }
+        } else if (!model->getZonesCapability().empty()) {
+            m_zonesCapabilityConfig = json::parse(model->getZonesCapability());
+        }
+
+        // Construct an object representation of each endpoint in configuration
+        for (auto& endpointModel : model->getEndpoints()) {
+            auto endpoint = Endpoint::create(endpointModel, m_assetStore);
+            ThrowIfNull(endpoint, "createEndpointFailed");
+            ThrowIfNot(m_endpoints.insert({endpoint->getId(), endpoint}).second, "insertEndpointFailed");
         }
 
         // Write the configuration to storage for retrieval by the car control local service
         auto localStorage =
             getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
         ThrowIfNull(localStorage, "invalidLocalStorage");
-        std::string s = jconfiguration.dump();
-        localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        // Skip the write if the stored configuration is unchanged, since the configuration can be large
+        std::string hash = CacheFile::toHex(configurationHash);
+        if (localStorage->get(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_HASH_KEY, "") != hash ||
+            !localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY)) {
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, getTranslatedConfiguration().dump());
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_HASH_KEY, hash);
+        }
 
         m_configured = true;
         return true;
@@ -138,9 +209,44 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
     }
 }
 
+json CarControlEngineService::getConfigurationSchema() {
+    // clang-format off
+    json stringSchema = {{"type", "string"}};
+    return {
+        {"type", "object"},
+        {"properties", {
+            {CONFIG_KEY_ENDPOINTS, {
+                {"type", "array"},
+                {"items", {
+                    {"type", "object"},
+                    {"required", {"endpointId"}},
+                    {"properties", {{"endpointId", stringSchema}}}
+                }}
+            }},
+            {CONFIG_KEY_ASSETS, {
+                {"type", "object"},
+                {"properties", {
+                    {CONFIG_KEY_DEFAULT_ASSETS_PATH, stringSchema},
+                    {CONFIG_KEY_CUSTOM_ASSETS_PATH, stringSchema},
+                    {CONFIG_KEY_ASSETS_CACHE_PATH, stringSchema}
+                }}
+            }},
+            {CONFIG_KEY_STATE_CACHE, {
+                {"type", "object"},
+                {"properties", {
+                    {CONFIG_KEY_STATE_CACHE_ENABLED, {{"type", "boolean"}}},
+                    {CONFIG_KEY_CHANGE_REPORT_DELAY, {{"type", "integer"}, {"minimum", 0}}}
+                }}
+            }}
+        }}
+    };
+    // clang-format on
+}
+
 bool CarControlEngineService::setup() {
     try {
         if (m_carControlEngineImpl != nullptr) {
+            auto setupStart = std::chrono::steady_clock::now();
             auto alexaComponents =
                 getContext()->getServiceInterface<aace::engine::alexa::AlexaComponentInterface>(AACE_ALEXA_SERVICE_KEY);
             ThrowIfNull(alexaComponents, "nullAlexaComponentInterface");
@@ -163,23 +269,27 @@ bool CarControlEngineService::setup() {
                 description = deviceInfo->getDeviceDescription();
             }
 
+            // Build all endpoints before registering any of them, so the time spent in each phase is reported
+            // separately. The registration manager still processes and reports each registration individually.
+            std::vector<std::shared_ptr<Endpoint>> endpoints;
+            endpoints.reserve(m_endpoints.size());
+            for (auto& endpoint : m_endpoints) {
+                endpoints.push_back(endpoint.second);
+            }
+            auto builtEndpoints = buildEndpoints(endpoints, endpointBuilderFactory, manufacturerName, description);
+
             // Get the IDs for each endpoint used in discovery. Used for translation for ZoneDefinitions
             std::unordered_map<std::string, std::string> endpointIdMappings;
-
-            for (auto& endpoint : m_endpoints) {
-                endpoint.second->build(
-                    m_carControlEngineImpl,
-                    endpointBuilderFactory,
-                    endpointRegistrationManager,
-                    m_assetStore,
-                    manufacturerName,
-                    description);
-                endpointIdMappings.insert({endpoint.second->getId(), endpoint.second->getDiscoveryId()});
+            for (size_t i = 0; i < endpoints.size(); i++) {
+                if (builtEndpoints[i] != nullptr) {
+                    endpointIdMappings.insert({endpoints[i]->getId(), endpoints[i]->getDiscoveryId()});
+                }
             }
 
             // Add ZoneDefinitions capability to a dummy endpoint
             // Note: Only cloud discovery code path uses this.
             // A dummy endpoint was added to the LVC config already in translateConfigForZones()
+            std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface> internalEndpoint;
             if (m_zonesCapabilityConfig.contains("configuration")) {
                 auto zoneDefinitions = aace::engine::carControl::ZoneDefinitions::create(
                     m_zonesCapabilityConfig, m_assetStore, endpointIdMappings);
@@ -193,16 +303,56 @@ bool CarControlEngineService::setup() {
                 endpointBuilder->withDisplayCategory({"VEHICLE"});
                 endpointBuilder->withCookies({{"createdBy", "AutoSDK"}});
 
-                auto endpoint = endpointBuilder->build();
+                internalEndpoint = endpointBuilder->build();
                 endpointBuilder.reset();
-                ThrowIfNull(endpoint, "couldNotBuildInternalReferenceEndpoint");
-                auto resultFuture = endpointRegistrationManager->registerEndpoint(std::move(endpoint));
+                ThrowIfNull(internalEndpoint, "couldNotBuildInternalReferenceEndpoint");
+            }
+            auto buildEnd = std::chrono::steady_clock::now();
+
+            // The registration manager reports each completed registration to its observers, so the time until
+            // every endpoint is registered is logged without waiting on the registrations
+            std::unordered_set<std::string> endpointIds;
+            for (auto& builtEndpoint : builtEndpoints) {
+                if (builtEndpoint != nullptr) {
+                    endpointIds.insert(builtEndpoint->getEndpointId());
+                }
+            }
+            if (internalEndpoint != nullptr) {
+                endpointIds.insert(internalEndpoint->getEndpointId());
+            }
+            auto registrationTracker = EndpointRegistrationTracker::create(endpointIds, setupStart);
+            ThrowIfNull(registrationTracker, "createEndpointRegistrationTrackerFailed");
+            endpointRegistrationManager->addObserver(registrationTracker);
+            m_endpointRegistrationManager = endpointRegistrationManager;
+            m_registrationTracker = registrationTracker;
+
+            for (auto& builtEndpoint : builtEndpoints) {
+                if (builtEndpoint != nullptr) {
+                    auto endpointId = builtEndpoint->getEndpointId();
+                    auto resultFuture = endpointRegistrationManager->registerEndpoint(std::move(builtEndpoint));
+                    // Only check for immediate errors. Rejected registrations are not reported to observers.
+                    if (resultFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready &&
+                        resultFuture.get() != RegistrationResult::SUCCEEDED) {
+                        registrationTracker->onRegistrationRejected(endpointId);
+                    }
+                }
+            }
+            if (internalEndpoint != nullptr) {
+                auto resultFuture = endpointRegistrationManager->registerEndpoint(std::move(internalEndpoint));
                 // Only wait for immediate errors.
                 if ((resultFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready)) {
                     auto result = resultFuture.get();
                     ThrowIfNot((result == RegistrationResult::SUCCEEDED), "couldNotRegisterInternalReferenceEndpoint");
                 }
             }
+            auto registerEnd = std::chrono::steady_clock::now();
+
+            AACE_INFO(LX(TAG)
+                          .m("endpointsSubmitted")
+                          .d("endpoints", endpoints.size())
+                          .d("registrations", endpointIds.size())
+                          .d("buildMs", std::chrono::duration_cast<Milliseconds>(buildEnd - setupStart).count())
+                          .d("registerMs", std::chrono::duration_cast<Milliseconds>(registerEnd - buildEnd).count()));
 
             // The contents of the AssetStore won't be used again, so we can release the memory
             m_assetStore.clear();
@@ -215,6 +365,27 @@ bool CarControlEngineService::setup() {
     }
 }
 
+std::vector<std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface>>
+CarControlEngineService::buildEndpoints(
+    const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+    std::shared_ptr<aace::engine::alexa::EndpointBuilderFactory> endpointBuilderFactory,
+    const std::string& manufacturerName,
+    const std::string& description) {
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface>>
+        builtEndpoints(endpoints.size());
+
+    // Endpoints are built on the setup thread, since the endpoint builders and the controllers' registration with
+    // the car control service are not safe to use from several threads
+    for (size_t i = 0; i < endpoints.size(); i++) {
+        builtEndpoints[i] = endpoints[i]->build(
+            m_carControlEngineImpl, endpointBuilderFactory, m_assetStore, manufacturerName, description);
+        if (builtEndpoints[i] == nullptr) {
+            AACE_ERROR(LX(TAG).m("couldNotBuildEndpoint").sensitive("endpointId", endpoints[i]->getId()));
+        }
+    }
+    return builtEndpoints;
+}
+
 bool CarControlEngineService::registerPlatformInterface(
     std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
     try {
@@ -231,7 +402,13 @@ bool CarControlEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_carControlEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_carControlEngineImpl = CarControlEngineImpl::create(platformInterface);
+        std::shared_ptr<CarControlStateStore> stateStore;
+        if (m_stateCacheEnabled) {
+            stateStore = CarControlStateStore::create(m_changeReportDelay);
+            ThrowIfNull(stateStore, "createCarControlStateStoreFailed");
+        }
+
+        m_carControlEngineImpl = CarControlEngineImpl::create(platformInterface, stateStore);
         ThrowIfNull(m_carControlEngineImpl, "createCarControlEngineImplFailed");
 
         ThrowIfNot(
@@ -256,6 +433,12 @@ bool CarControlEngineService::isLocalServiceAvailable() {
 bool CarControlEngineService::shutdown() {
     AACE_INFO(LX(TAG));
 
+    if (m_endpointRegistrationManager != nullptr) {
+        m_endpointRegistrationManager->removeObserver(m_registrationTracker);
+        m_endpointRegistrationManager.reset();
+        m_registrationTracker.reset();
+    }
+
     if (m_carControlEngineImpl != nullptr) {
         m_carControlEngineImpl->shutdown();
         m_carControlEngineImpl.reset();
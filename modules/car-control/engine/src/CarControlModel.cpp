@@ -0,0 +1,531 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/CarControl/CarControlModel.h>
+#include <AACE/Engine/CarControl/CacheFile.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <cstring>
+#include <unordered_map>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.carControl.CarControlModel");
+
+/// Identifies a compiled model image ("AACM")
+static const uint32_t COMPILED_MODEL_MAGIC = 0x4d434141;
+/// The version of the compiled model image format. Increment when the format or the compilation changes.
+static const uint32_t COMPILED_MODEL_VERSION = 1;
+
+/// The namespace and name of the ModeController capability interface
+static const std::string CAPABILITY_MODE_CONTROLLER = "Alexa.ModeController";
+/// The namespace and name of the PowerController capability interface
+static const std::string CAPABILITY_POWER_CONTROLLER = "Alexa.PowerController";
+/// The namespace and name of the RangeController capability interface
+static const std::string CAPABILITY_RANGE_CONTROLLER = "Alexa.RangeController";
+/// The namespace and name of the ToggleController capability interface
+static const std::string CAPABILITY_TOGGLE_CONTROLLER = "Alexa.ToggleController";
+
+using json = nlohmann::json;
+
+/**
+ * Compiled model image layout. All fields are native-endian 32-bit values. The image is a header, followed by the
+ * record stream, the string table, and the string data. The record stream holds the endpoints in configuration
+ * order; strings are indexes into the string table, so each distinct string is stored once, and doubles are stored
+ * as two values.
+ */
+/// @{
+struct ImageHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordCount;
+    uint32_t stringCount;
+    uint32_t stringDataSize;
+};
+
+struct ImageString {
+    uint32_t offset;
+    uint32_t length;
+};
+/// @}
+
+/**
+ * Writes the record stream and string table of an image.
+ */
+class ImageWriter {
+public:
+    void writeValue(uint32_t value) {
+        m_records.push_back(value);
+    }
+
+    void writeBool(bool value) {
+        writeValue(value ? 1 : 0);
+    }
+
+    void writeDouble(double value) {
+        uint32_t words[2];
+        static_assert(sizeof(words) == sizeof(value), "unexpectedDoubleSize");
+        std::memcpy(words, &value, sizeof(value));
+        writeValue(words[0]);
+        writeValue(words[1]);
+    }
+
+    void writeString(const std::string& value) {
+        auto result = m_stringIndex.emplace(value, static_cast<uint32_t>(m_strings.size()));
+        if (result.second) {
+            m_strings.push_back({static_cast<uint32_t>(m_stringData.size()), static_cast<uint32_t>(value.size())});
+            m_stringData.append(value);
+        }
+        writeValue(result.first->second);
+    }
+
+    void writeStrings(const std::vector<std::string>& values) {
+        writeValue(static_cast<uint32_t>(values.size()));
+        for (auto& value : values) {
+            writeString(value);
+        }
+    }
+
+    std::string getImage() const {
+        ImageHeader header{COMPILED_MODEL_MAGIC,
+                           COMPILED_MODEL_VERSION,
+                           static_cast<uint32_t>(m_records.size()),
+                           static_cast<uint32_t>(m_strings.size()),
+                           static_cast<uint32_t>(m_stringData.size())};
+        std::string image;
+        image.reserve(
+            sizeof(header) + m_records.size() * sizeof(uint32_t) + m_strings.size() * sizeof(ImageString) +
+            m_stringData.size());
+        image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        image.append(reinterpret_cast<const char*>(m_records.data()), m_records.size() * sizeof(uint32_t));
+        image.append(reinterpret_cast<const char*>(m_strings.data()), m_strings.size() * sizeof(ImageString));
+        image.append(m_stringData);
+        return image;
+    }
+
+private:
+    std::vector<uint32_t> m_records;
+    std::vector<ImageString> m_strings;
+    std::string m_stringData;
+    std::unordered_map<std::string, uint32_t> m_stringIndex;
+};
+
+/**
+ * Reads the record stream of an image. Every index and count is checked against the image, so a corrupt cache file
+ * is rejected rather than read out of bounds.
+ */
+class ImageReader {
+public:
+    ImageReader(const char* data, size_t size) {
+        ThrowIf(size < sizeof(ImageHeader), "imageTooSmall");
+        ImageHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        ThrowIf(header.magic != COMPILED_MODEL_MAGIC, "invalidImageMagic");
+        ThrowIf(header.version != COMPILED_MODEL_VERSION, "unsupportedImageVersion");
+        uint64_t expectedSize = sizeof(ImageHeader) + uint64_t(header.recordCount) * sizeof(uint32_t) +
+                                uint64_t(header.stringCount) * sizeof(ImageString) + header.stringDataSize;
+        ThrowIf(expectedSize != size, "invalidImageSize");
+
+        m_records = data + sizeof(ImageHeader);
+        m_recordCount = header.recordCount;
+        m_strings = m_records + m_recordCount * sizeof(uint32_t);
+        m_stringCount = header.stringCount;
+        m_stringData = m_strings + m_stringCount * sizeof(ImageString);
+        m_stringDataSize = header.stringDataSize;
+    }
+
+    uint32_t readValue() {
+        ThrowIf(m_position >= m_recordCount, "truncatedImage");
+        uint32_t value;
+        std::memcpy(&value, m_records + m_position * sizeof(uint32_t), sizeof(value));
+        m_position++;
+        return value;
+    }
+
+    /**
+     * Reads a count of the records that follow, each at least one value long.
+     */
+    uint32_t readCount() {
+        uint32_t count = readValue();
+        ThrowIf(count > m_recordCount - m_position, "invalidImageCount");
+        return count;
+    }
+
+    bool readBool() {
+        return readValue() != 0;
+    }
+
+    double readDouble() {
+        uint32_t words[2] = {readValue(), readValue()};
+        double value;
+        std::memcpy(&value, words, sizeof(value));
+        return value;
+    }
+
+    std::string readString() {
+        uint32_t index = readValue();
+        ThrowIf(index >= m_stringCount, "invalidImageString");
+        ImageString entry;
+        std::memcpy(&entry, m_strings + index * sizeof(ImageString), sizeof(entry));
+        ThrowIf(uint64_t(entry.offset) + entry.length > m_stringDataSize, "invalidImageString");
+        return std::string(m_stringData + entry.offset, entry.length);
+    }
+
+    std::vector<std::string> readStrings() {
+        std::vector<std::string> values(readCount());
+        for (auto& value : values) {
+            value = readString();
+        }
+        return values;
+    }
+
+    bool atEnd() const {
+        return m_position == m_recordCount;
+    }
+
+private:
+    const char* m_records;
+    uint32_t m_recordCount;
+    uint32_t m_position = 0;
+    const char* m_strings;
+    uint32_t m_stringCount;
+    const char* m_stringData;
+    uint32_t m_stringDataSize;
+};
+
+/**
+ * Gets the asset IDs of a 'friendlyNames' node.
+ */
+static std::vector<std::string> getAssetIds(const json& friendlyNames) {
+    std::vector<std::string> assetIds;
+    for (auto& item : friendlyNames.items()) {
+        auto& type = item.value().at("@type");
+        // aace.carControl config only allows "asset" type labels.
+        // (https://developer.amazon.com/en-US/docs/alexa/device-apis/resources-and-assets.html#label-object)
+        ThrowIfNot(type == "asset", "expectedAssetTypeResource");
+        std::string assetId = item.value().at("value").at("assetId");
+        assetIds.push_back(assetId);
+    }
+    return assetIds;
+}
+
+/**
+ * Gets the asset IDs of a 'capabilityResources', 'presetResources' or 'modeResources' node.
+ */
+static std::vector<std::string> getResourceAssetIds(const json& resources) {
+    ThrowIfNot(resources.contains("friendlyNames"), "missingFriendlyNames");
+    return getAssetIds(resources.at("friendlyNames"));
+}
+
+/**
+ * Gets the action mappings of a 'semantics' node.
+ */
+static std::vector<ActionMappingModel> getActionMappings(const json& semantics) {
+    ThrowIfNot(semantics.contains("actionMappings"), "missingActionMappings");
+    std::vector<ActionMappingModel> actionMappings;
+    for (auto& item : semantics.at("actionMappings").items()) {
+        ThrowIfNot(
+            (item.value().contains("@type") && item.value().at("@type") == "ActionsToDirective"),
+            "expectedActionsToDirectiveType");
+        ActionMappingModel actionMapping;
+
+        ThrowIfNot(item.value().contains("actions"), "actionMappingMissingActions");
+        auto& actions = item.value().at("actions");
+        ThrowIf(actions.empty(), "actionMappingHasEmptyActions");
+        for (auto& action : actions.items()) {
+            actionMapping.actions.push_back(action.value().get<std::string>());
+        }
+
+        ThrowIfNot(item.value().contains("directive"), "actionMappingMissingDirective");
+        auto& directive = item.value().at("directive");
+        ThrowIfNot(directive.contains("name"), "actionMappingDirectiveMissingName");
+        ThrowIfNot(directive.contains("payload"), "actionMappingDirectiveMissingPayload");
+        actionMapping.directiveName = directive.at("name").get<std::string>();
+        actionMapping.directivePayload = directive.at("payload").dump();
+        actionMappings.push_back(std::move(actionMapping));
+    }
+    return actionMappings;
+}
+
+/**
+ * Compiles the fields common to the primitive controllers.
+ */
+static void compilePrimitiveController(const json& capabilityConfig, CapabilityModel& capability) {
+    capability.instance = capabilityConfig.at("instance").get<std::string>();
+    ThrowIf(capability.instance.empty(), "missingInstance");
+    ThrowIfNot(capabilityConfig.contains("capabilityResources"), "missingCapabilityResources");
+    capability.assetIds = getResourceAssetIds(capabilityConfig.at("capabilityResources"));
+    if (capabilityConfig.contains("semantics")) {
+        capability.hasSemantics = true;
+        capability.actionMappings = getActionMappings(capabilityConfig.at("semantics"));
+    }
+}
+
+static CapabilityModel compileCapability(const json& capabilityConfig) {
+    CapabilityModel capability;
+    capability.interface = capabilityConfig.at("interface").get<std::string>();
+    if (capability.interface == CAPABILITY_POWER_CONTROLLER) {
+        return capability;
+    } else if (
+        capability.interface == CAPABILITY_TOGGLE_CONTROLLER || capability.interface == CAPABILITY_RANGE_CONTROLLER ||
+        capability.interface == CAPABILITY_MODE_CONTROLLER) {
+        compilePrimitiveController(capabilityConfig, capability);
+    } else {
+        Throw("unsupportedCapability");
+    }
+
+    if (capability.interface == CAPABILITY_RANGE_CONTROLLER) {
+        auto& configuration = capabilityConfig.at("configuration");
+        if (configuration.contains("presets")) {
+            for (auto& item : configuration.at("presets").items()) {
+                PresetModel preset;
+                preset.rangeValue = item.value().at("rangeValue");
+                ThrowIfNot(item.value().contains("presetResources"), "missingPresetResources");
+                preset.assetIds = getResourceAssetIds(item.value().at("presetResources"));
+                capability.presets.push_back(std::move(preset));
+            }
+        }
+        if (configuration.contains("unitOfMeasure")) {
+            capability.hasUnitOfMeasure = true;
+            capability.unitOfMeasure = configuration.at("unitOfMeasure").get<std::string>();
+        }
+        auto& supportedRange = configuration.at("supportedRange");
+        capability.minimumValue = supportedRange.at("minimumValue");
+        capability.maximumValue = supportedRange.at("maximumValue");
+        capability.precision = supportedRange.at("precision");
+    } else if (capability.interface == CAPABILITY_MODE_CONTROLLER) {
+        auto& configuration = capabilityConfig.at("configuration");
+        if (configuration.contains("ordered")) {
+            capability.hasOrdered = true;
+            capability.ordered = configuration.at("ordered");
+        }
+        for (auto& item : configuration.at("supportedModes").items()) {
+            ModeModel mode;
+            mode.value = item.value().at("value").get<std::string>();
+            ThrowIfNot(item.value().contains("modeResources"), "missingModeResources");
+            mode.assetIds = getResourceAssetIds(item.value().at("modeResources"));
+            capability.modes.push_back(std::move(mode));
+        }
+        ThrowIf(capability.modes.empty(), "emptyModes");
+    }
+    return capability;
+}
+
+static EndpointModel compileEndpoint(const json& endpointConfig) {
+    EndpointModel endpoint;
+    ThrowIfNot(endpointConfig.contains("endpointId"), "noEndpointId");
+    endpoint.endpointId = endpointConfig.at("endpointId").get<std::string>();
+    ThrowIfNot(!endpoint.endpointId.empty(), "emptyEndpointId");
+
+    ThrowIfNot(endpointConfig.contains("endpointResources"), "noEndpointResources");
+    auto& endpointResources = endpointConfig.at("endpointResources");
+    ThrowIfNot(endpointResources.contains("friendlyNames"), "noFriendlyNames");
+    endpoint.assetIds = getAssetIds(endpointResources.at("friendlyNames"));
+
+    ThrowIfNot(endpointConfig.contains("capabilities"), "noCapabilities");
+    for (auto& item : endpointConfig.at("capabilities").items()) {
+        endpoint.capabilities.push_back(compileCapability(item.value()));
+    }
+    return endpoint;
+}
+
+std::shared_ptr<CarControlModel> CarControlModel::create(
+    const json& configuration,
+    const json& zonesCapability,
+    const std::string& internalEndpointId) {
+    try {
+        auto model = std::shared_ptr<CarControlModel>(new CarControlModel());
+        if (configuration.contains("endpoints") && configuration.at("endpoints").is_array()) {
+            for (auto& item : configuration.at("endpoints").items()) {
+                if (item.value().at("endpointId") == internalEndpointId) continue;
+                model->m_endpoints.push_back(compileEndpoint(item.value()));
+            }
+        }
+        if (!zonesCapability.is_null()) {
+            model->m_zonesCapability = zonesCapability.dump();
+        }
+        return model;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<CarControlModel> CarControlModel::load(const std::string& path) {
+    try {
+        auto file = CacheFile::map(path);
+        if (file == nullptr) {
+            return nullptr;
+        }
+        ImageReader reader(file->data(), file->size());
+        auto model = std::shared_ptr<CarControlModel>(new CarControlModel());
+        model->m_zonesCapability = reader.readString();
+        model->m_endpoints.resize(reader.readCount());
+        for (auto& endpoint : model->m_endpoints) {
+            endpoint.endpointId = reader.readString();
+            endpoint.assetIds = reader.readStrings();
+            endpoint.capabilities.resize(reader.readCount());
+            for (auto& capability : endpoint.capabilities) {
+                capability.interface = reader.readString();
+                capability.instance = reader.readString();
+                capability.assetIds = reader.readStrings();
+                capability.hasSemantics = reader.readBool();
+                capability.actionMappings.resize(reader.readCount());
+                for (auto& actionMapping : capability.actionMappings) {
+                    actionMapping.actions = reader.readStrings();
+                    actionMapping.directiveName = reader.readString();
+                    actionMapping.directivePayload = reader.readString();
+                }
+                capability.minimumValue = reader.readDouble();
+                capability.maximumValue = reader.readDouble();
+                capability.precision = reader.readDouble();
+                capability.hasUnitOfMeasure = reader.readBool();
+                capability.unitOfMeasure = reader.readString();
+                capability.presets.resize(reader.readCount());
+                for (auto& preset : capability.presets) {
+                    preset.rangeValue = reader.readDouble();
+                    preset.assetIds = reader.readStrings();
+                }
+                capability.hasOrdered = reader.readBool();
+                capability.ordered = reader.readBool();
+                capability.modes.resize(reader.readCount());
+                for (auto& mode : capability.modes) {
+                    mode.value = reader.readString();
+                    mode.assetIds = reader.readStrings();
+                }
+            }
+        }
+        ThrowIfNot(reader.atEnd(), "unexpectedImageRecords");
+        return model;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+bool CarControlModel::save(const std::string& path) const {
+    ImageWriter writer;
+    writer.writeString(m_zonesCapability);
+    writer.writeValue(static_cast<uint32_t>(m_endpoints.size()));
+    for (auto& endpoint : m_endpoints) {
+        writer.writeString(endpoint.endpointId);
+        writer.writeStrings(endpoint.assetIds);
+        writer.writeValue(static_cast<uint32_t>(endpoint.capabilities.size()));
+        for (auto& capability : endpoint.capabilities) {
+            writer.writeString(capability.interface);
+            writer.writeString(capability.instance);
+            writer.writeStrings(capability.assetIds);
+            writer.writeBool(capability.hasSemantics);
+            writer.writeValue(static_cast<uint32_t>(capability.actionMappings.size()));
+            for (auto& actionMapping : capability.actionMappings) {
+                writer.writeStrings(actionMapping.actions);
+                writer.writeString(actionMapping.directiveName);
+                writer.writeString(actionMapping.directivePayload);
+            }
+            writer.writeDouble(capability.minimumValue);
+            writer.writeDouble(capability.maximumValue);
+            writer.writeDouble(capability.precision);
+            writer.writeBool(capability.hasUnitOfMeasure);
+            writer.writeString(capability.unitOfMeasure);
+            writer.writeValue(static_cast<uint32_t>(capability.presets.size()));
+            for (auto& preset : capability.presets) {
+                writer.writeDouble(preset.rangeValue);
+                writer.writeStrings(preset.assetIds);
+            }
+            writer.writeBool(capability.hasOrdered);
+            writer.writeBool(capability.ordered);
+            writer.writeValue(static_cast<uint32_t>(capability.modes.size()));
+            for (auto& mode : capability.modes) {
+                writer.writeString(mode.value);
+                writer.writeStrings(mode.assetIds);
+            }
+        }
+    }
+    std::string image = writer.getImage();
+    return CacheFile::save(path, image.data(), image.size());
+}
+
+/**
+ * Continues a hash with a JSON value. Each value is tagged with its type, and containers and strings with their
+ * size, so different configurations do not produce the same sequence of hashed bytes.
+ */
+static uint64_t hashValue(const json& value, uint64_t hash) {
+    auto type = static_cast<uint8_t>(value.type());
+    hash = CacheFile::hash(&type, sizeof(type), hash);
+    switch (value.type()) {
+        case json::value_t::object: {
+            uint64_t size = value.size();
+            hash = CacheFile::hash(&size, sizeof(size), hash);
+            for (auto& item : value.items()) {
+                uint64_t length = item.key().size();
+                hash = CacheFile::hash(&length, sizeof(length), hash);
+                hash = CacheFile::hash(item.key().data(), item.key().size(), hash);
+                hash = hashValue(item.value(), hash);
+            }
+            return hash;
+        }
+        case json::value_t::array: {
+            uint64_t size = value.size();
+            hash = CacheFile::hash(&size, sizeof(size), hash);
+            for (auto& item : value) {
+                hash = hashValue(item, hash);
+            }
+            return hash;
+        }
+        case json::value_t::string: {
+            auto& string = value.get_ref<const json::string_t&>();
+            uint64_t length = string.size();
+            hash = CacheFile::hash(&length, sizeof(length), hash);
+            return CacheFile::hash(string.data(), string.size(), hash);
+        }
+        case json::value_t::boolean: {
+            uint8_t boolean = value.get<bool>() ? 1 : 0;
+            return CacheFile::hash(&boolean, sizeof(boolean), hash);
+        }
+        case json::value_t::number_integer: {
+            int64_t number = value.get<int64_t>();
+            return CacheFile::hash(&number, sizeof(number), hash);
+        }
+        case json::value_t::number_unsigned: {
+            uint64_t number = value.get<uint64_t>();
+            return CacheFile::hash(&number, sizeof(number), hash);
+        }
+        case json::value_t::number_float: {
+            double number = value.get<double>();
+            return CacheFile::hash(&number, sizeof(number), hash);
+        }
+        default:
+            return hash;
+    }
+}
+
+uint64_t CarControlModel::getConfigurationHash(const json& configuration) {
+    return hashValue(configuration, CacheFile::HASH_OFFSET_BASIS ^ COMPILED_MODEL_VERSION);
+}
+
+const std::vector<EndpointModel>& CarControlModel::getEndpoints() const {
+    return m_endpoints;
+}
+
+const std::string& CarControlModel::getZonesCapability() const {
+    return m_zonesCapability;
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
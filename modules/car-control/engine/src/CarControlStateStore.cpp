@@ -0,0 +1,191 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/CarControlStateStore.h"
+
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.CarControlStateStore");
+
+std::shared_ptr<CarControlStateStore> CarControlStateStore::create(std::chrono::milliseconds changeReportDelay) {
+    try {
+        ThrowIf(changeReportDelay.count() < 0, "invalidChangeReportDelay");
+        return std::shared_ptr<CarControlStateStore>(new CarControlStateStore(changeReportDelay));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+CarControlStateStore::CarControlStateStore(std::chrono::milliseconds changeReportDelay) :
+        m_changeReportDelay(changeReportDelay), m_version(0), m_flushScheduled(false), m_isShutdown(false) {
+}
+
+CarControlStateStore::~CarControlStateStore() {
+    shutdown();
+}
+
+std::string CarControlStateStore::getKey(const std::string& endpointId, const std::string& instance) {
+    // endpoint IDs cannot contain a null character, so the key is unambiguous
+    std::string key;
+    key.reserve(endpointId.size() + instance.size() + 1);
+    key.append(endpointId).push_back('\0');
+    key.append(instance);
+    return key;
+}
+
+void CarControlStateStore::addObserver(
+    const std::string& endpointId,
+    const std::string& instance,
+    std::weak_ptr<CarControlStateObserverInterface> observer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_observers[getKey(endpointId, instance)].push_back(observer);
+}
+
+bool CarControlStateStore::getState(
+    const std::string& endpointId,
+    const std::string& instance,
+    CarControlState& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_states.find(getKey(endpointId, instance));
+    if (it == m_states.end()) {
+        return false;
+    }
+    state = it->second;
+    return true;
+}
+
+bool CarControlStateStore::updateState(
+    const std::string& endpointId,
+    const std::string& instance,
+    const CarControlState& state,
+    bool alexaInteraction) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto key = getKey(endpointId, instance);
+    auto it = m_states.find(key);
+    if (it != m_states.end() && it->second.isOn == state.isOn && it->second.rangeValue == state.rangeValue &&
+        it->second.mode == state.mode) {
+        return false;
+    }
+    auto& current = m_states[key];
+    current = state;
+    current.version = ++m_version;
+
+    if (!alexaInteraction) {
+        auto interaction = m_alexaInteractions.find(key);
+        alexaInteraction = interaction != m_alexaInteractions.end() && interaction->second > 0;
+    }
+    if (m_isShutdown || m_observers.find(key) == m_observers.end()) {
+        return true;
+    }
+    auto pending = m_pendingChanges.emplace(key, alexaInteraction);
+    if (pending.second) {
+        m_pendingChangeOrder.push_back(key);
+    } else {
+        pending.first->second = alexaInteraction;
+    }
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        m_executor.submit([this] { flushChanges(); });
+    }
+    return true;
+}
+
+void CarControlStateStore::cacheState(
+    const std::string& endpointId,
+    const std::string& instance,
+    const CarControlState& state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto result = m_states.emplace(getKey(endpointId, instance), state);
+    if (result.second) {
+        result.first->second.version = ++m_version;
+    }
+}
+
+void CarControlStateStore::invalidateState(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_states.erase(getKey(endpointId, instance));
+}
+
+void CarControlStateStore::beginAlexaInteraction(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_alexaInteractions[getKey(endpointId, instance)]++;
+}
+
+void CarControlStateStore::endAlexaInteraction(const std::string& endpointId, const std::string& instance) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_alexaInteractions.find(getKey(endpointId, instance));
+    if (it != m_alexaInteractions.end() && --it->second <= 0) {
+        m_alexaInteractions.erase(it);
+    }
+}
+
+void CarControlStateStore::flushChanges() {
+    std::vector<std::pair<std::shared_ptr<CarControlStateObserverInterface>, std::pair<CarControlState, bool>>>
+        notifications;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_changeReportDelay.count() > 0) {
+            m_wakeTrigger.wait_for(lock, m_changeReportDelay, [this] { return m_isShutdown; });
+        }
+        m_flushScheduled = false;
+        if (m_isShutdown) {
+            return;
+        }
+        for (auto& key : m_pendingChangeOrder) {
+            auto state = m_states.find(key);
+            auto observers = m_observers.find(key);
+            if (state == m_states.end() || observers == m_observers.end()) {
+                continue;
+            }
+            for (auto& next : observers->second) {
+                if (auto observer = next.lock()) {
+                    notifications.push_back({observer, {state->second, m_pendingChanges[key]}});
+                }
+            }
+        }
+        m_pendingChanges.clear();
+        m_pendingChangeOrder.clear();
+    }
+
+    // notify observers without holding the lock, since they may query the store
+    for (auto& notification : notifications) {
+        notification.first->onStateChanged(notification.second.first, notification.second.second);
+    }
+}
+
+void CarControlStateStore::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isShutdown) {
+            return;
+        }
+        m_isShutdown = true;
+        m_pendingChanges.clear();
+        m_pendingChangeOrder.clear();
+        m_observers.clear();
+    }
+    m_wakeTrigger.notify_all();
+    m_executor.shutdown();
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -14,7 +14,6 @@
  */
 
 #include <AVSCommon/AVS/EndpointResources.h>
-#include <AVSCommon/SDKInterfaces/Endpoints/EndpointRegistrationManagerInterface.h>
 #include <Endpoints/EndpointBuilder.h>
 
 #include <AACE/Engine/CarControl/AssetStore.h>
@@ -42,75 +41,32 @@ static const std::string CAPABILITY_RANGE_CONTROLLER = "Alexa.RangeController";
 /// The namespace and name of the ToggleController capability interface
 static const std::string CAPABILITY_TOGGLE_CONTROLLER = "Alexa.ToggleController";
 
-/// The 'endpointId' configuration key
-static const std::string CONFIG_KEY_ENDPOINT_ID = "endpointId";
-/// The 'endpointResources' configuration key
-static const std::string CONFIG_KEY_ENDPOINT_RESOURCES = "endpointResources";
-/// The 'friendlyNames' configuration key
-static const std::string CONFIG_KEY_FRIENDLY_NAMES = "friendlyNames";
-/// The 'type' configuration key
-static const std::string CONFIG_KEY_TYPE = "@type";
-/// The 'asset' label type
-static const std::string CONFIG_TYPE_ASSET = "asset";
-/// The 'value' configuration key
-static const std::string CONFIG_KEY_VALUE = "value";
-/// The 'assetId' configuration key
-static const std::string CONFIG_KEY_ASSET_ID = "assetId";
-
-/// The 'capabilities' configuration key
-static const std::string CONFIG_KEY_CAPABILITIES = "capabilities";
-/// The 'interface' configuration key
-static const std::string CONFIG_KEY_INTERFACE = "interface";
-
 /// The display category for the endpoint in the companion app
 static const std::string DISPLAY_CATEGORY = "VEHICLE";
 
-using RegistrationResult =
-    alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface::RegistrationResult;
-
-std::shared_ptr<Endpoint> Endpoint::create(const json& endpointConfig, const AssetStore& assetStore) {
+std::shared_ptr<Endpoint> Endpoint::create(const EndpointModel& endpointModel, const AssetStore& assetStore) {
     try {
-        ThrowIfNot(endpointConfig.contains(CONFIG_KEY_ENDPOINT_ID), "noEndpointId");
-        std::string endpointId = endpointConfig.at(CONFIG_KEY_ENDPOINT_ID);
+        const std::string& endpointId = endpointModel.endpointId;
         ThrowIfNot(!endpointId.empty(), "emptyEndpointId");
 
-        // Get all asset IDs used to identify this endpoint
-        ThrowIfNot(endpointConfig.contains(CONFIG_KEY_ENDPOINT_RESOURCES), "noEndpointResources");
-        auto& endpointResources = endpointConfig.at(CONFIG_KEY_ENDPOINT_RESOURCES);
-        ThrowIfNot(endpointResources.contains(CONFIG_KEY_FRIENDLY_NAMES), "noFriendlyNames");
-        auto friendlyNames = endpointResources.at(CONFIG_KEY_FRIENDLY_NAMES);
-        std::vector<std::string> assetIds;
-        for (auto& item : friendlyNames.items()) {
-            auto& type = item.value().at(CONFIG_KEY_TYPE);
-            // aace.carControl config only allows "asset" type labels.
-            // (https://developer.amazon.com/en-US/docs/alexa/device-apis/resources-and-assets.html#label-object) are
-            ThrowIfNot(type == CONFIG_TYPE_ASSET, "expectedAssetTypeResource");
-            auto& value = item.value().at(CONFIG_KEY_VALUE);
-            std::string assetId = value.at(CONFIG_KEY_ASSET_ID);
-            assetIds.push_back(assetId);
-        }
-
-        auto endpoint = std::shared_ptr<Endpoint>(new Endpoint(endpointId, assetIds));
+        auto endpoint = std::shared_ptr<Endpoint>(new Endpoint(endpointId, endpointModel.assetIds));
         ThrowIfNull(endpoint, "cannotCreateEndpoint");
 
         // Add capability controllers to the Endpoint
-        ThrowIfNot(endpointConfig.contains(CONFIG_KEY_CAPABILITIES), "noCapabilities");
-        auto& capabilities = endpointConfig.at(CONFIG_KEY_CAPABILITIES);
-        for (auto& item : capabilities.items()) {
-            auto& capabilityConfig = item.value();
-            std::string interface = capabilityConfig.at(CONFIG_KEY_INTERFACE);
+        for (auto& capability : endpointModel.capabilities) {
+            const std::string& interface = capability.interface;
             std::shared_ptr<CapabilityController> controller = nullptr;
             if (interface == CAPABILITY_POWER_CONTROLLER) {
                 controller = PowerController::create(endpointId, interface);
                 ThrowIfNull(controller, "createPowerControllerFailed");
             } else if (interface == CAPABILITY_TOGGLE_CONTROLLER) {
-                controller = ToggleController::create(capabilityConfig, endpointId, interface, assetStore);
+                controller = ToggleController::create(capability, endpointId, interface, assetStore);
                 ThrowIfNull(controller, "createToggleControllerFailed");
             } else if (interface == CAPABILITY_RANGE_CONTROLLER) {
-                controller = RangeController::create(capabilityConfig, endpointId, interface, assetStore);
+                controller = RangeController::create(capability, endpointId, interface, assetStore);
                 ThrowIfNull(controller, "createRangeControllerFailed");
             } else if (interface == CAPABILITY_MODE_CONTROLLER) {
-                controller = ModeController::create(capabilityConfig, endpointId, interface, assetStore);
+                controller = ModeController::create(capability, endpointId, interface, assetStore);
                 ThrowIfNull(controller, "createModeControllerFailed");
             } else {
                 Throw("unsupportedCapability");
@@ -149,16 +105,14 @@ std::string Endpoint::getDiscoveryId() {
     return m_discoveryEndpointId;
 }
 
-bool Endpoint::build(
+std::unique_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointInterface> Endpoint::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::shared_ptr<aace::engine::alexa::EndpointBuilderFactory> endpointBuilderFactory,
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointRegistrationManagerInterface>
-        endpointRegistrationManager,
     const AssetStore& assetStore,
     const std::string& manufacturer,
     const std::string& description) {
     try {
-        ThrowIfNull(endpointRegistrationManager, "nullEndpointRegistrationManager");
+        ThrowIfNull(endpointBuilderFactory, "nullEndpointBuilderFactory");
         auto endpointBuilder = endpointBuilderFactory->createEndpointBuilder();
         ThrowIfNull(endpointBuilder, "couldNotCreateEndpointBuilder");
 
@@ -191,16 +145,10 @@ bool Endpoint::build(
         endpointBuilder.reset();
         ThrowIfNull(endpoint, "couldNotBuildEndpoint");
         m_discoveryEndpointId = endpoint->getEndpointId();
-        auto resultFuture = endpointRegistrationManager->registerEndpoint(std::move(endpoint));
-        // Only wait for immediate errors.
-        if ((resultFuture.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready)) {
-            auto result = resultFuture.get();
-            ThrowIfNot((result == RegistrationResult::SUCCEEDED), "couldNotRegisterEndpoint");
-        }
-        return true;
+        return endpoint;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", getId()));
+        return nullptr;
     }
 }
 
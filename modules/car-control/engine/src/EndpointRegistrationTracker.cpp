@@ -0,0 +1,88 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/EndpointRegistrationTracker.h"
+
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.EndpointRegistrationTracker");
+
+std::shared_ptr<EndpointRegistrationTracker> EndpointRegistrationTracker::create(
+    std::unordered_set<std::string> endpointIds,
+    std::chrono::steady_clock::time_point setupStart) {
+    return std::shared_ptr<EndpointRegistrationTracker>(
+        new EndpointRegistrationTracker(std::move(endpointIds), setupStart));
+}
+
+EndpointRegistrationTracker::EndpointRegistrationTracker(
+    std::unordered_set<std::string> endpointIds,
+    std::chrono::steady_clock::time_point setupStart) :
+        m_pendingEndpointIds(std::move(endpointIds)),
+        m_endpointCount(m_pendingEndpointIds.size()),
+        m_failedCount(0),
+        m_setupStart(setupStart) {
+}
+
+void EndpointRegistrationTracker::onEndpointRegistration(
+    const alexaClientSDK::avsCommon::sdkInterfaces::endpoints::EndpointIdentifier& endpointId,
+    const alexaClientSDK::avsCommon::avs::AVSDiscoveryEndpointAttributes& attributes,
+    const RegistrationResult result) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    completeLocked(endpointId, result == RegistrationResult::SUCCEEDED);
+}
+
+void EndpointRegistrationTracker::onRegistrationRejected(const std::string& endpointId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    completeLocked(endpointId, false);
+}
+
+bool EndpointRegistrationTracker::isComplete() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pendingEndpointIds.empty();
+}
+
+size_t EndpointRegistrationTracker::getFailedCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_failedCount;
+}
+
+void EndpointRegistrationTracker::completeLocked(const std::string& endpointId, bool succeeded) {
+    if (m_pendingEndpointIds.erase(endpointId) == 0) {
+        return;
+    }
+    if (!succeeded) {
+        AACE_ERROR(LX(TAG).m("couldNotRegisterEndpoint").sensitive("endpointId", endpointId));
+        m_failedCount++;
+    }
+    if (m_pendingEndpointIds.empty()) {
+        AACE_INFO(LX(TAG)
+                      .m("endpointsRegistered")
+                      .d("succeeded", m_endpointCount - m_failedCount)
+                      .d("failed", m_failedCount)
+                      .d("timeToReadyMs",
+                         std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - m_setupStart)
+                             .count()));
+    }
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -19,6 +19,8 @@
 #include <ModeController/ModeControllerAttributeBuilder.h>
 
 #include "AACE/Engine/CarControl/ModeController.h"
+
+#include <algorithm>
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
@@ -35,44 +37,37 @@ using ModeControllerConfiguration =
 /// @}
 
 std::shared_ptr<ModeController> ModeController::create(
-    const json& controllerConfig,
+    const CapabilityModel& capability,
     const std::string& endpointId,
     const std::string& interface,
     const AssetStore& assetStore) {
     try {
-        std::string instance = controllerConfig.at("instance");
+        const std::string& instance = capability.instance;
         ThrowIf(instance.empty(), "missingInstance");
 
-        ThrowIfNot(controllerConfig.contains("capabilityResources"), "missingCapabilityResources");
         alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
-            capabilityResources = getResources(controllerConfig.at("capabilityResources"), assetStore);
+            capabilityResources = getResources(capability.assetIds, assetStore);
         ThrowIfNot(capabilityResources.hasValue(), "failedToParseCapabilityResourcesConfig");
         auto attributeBuilder =
             alexaClientSDK::capabilityAgents::modeController::ModeControllerAttributeBuilder::create();
         attributeBuilder->withCapabilityResources(capabilityResources.value());
 
-        auto& configuration = controllerConfig.at("configuration");
-        if (configuration.contains("ordered")) {
-            bool ordered = configuration.at("ordered");
-            attributeBuilder->setOrdered(ordered);
+        if (capability.hasOrdered) {
+            attributeBuilder->setOrdered(capability.ordered);
         }
 
-        auto& supportedModes = configuration.at("supportedModes");
-        for (auto& supportedMode : supportedModes.items()) {
-            std::string value = supportedMode.value().at("value");
-            ThrowIfNot(supportedMode.value().contains("modeResources"), "missingModeResources");
+        for (auto& mode : capability.modes) {
             // Note: ModeResources is a type alias for CapabilityResources
             alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
-                modeResources = getResources(supportedMode.value().at("modeResources"), assetStore);
+                modeResources = getResources(mode.assetIds, assetStore);
             ThrowIfNot(modeResources.hasValue(), "failedToParseModeResourcesConfig");
-            attributeBuilder->addMode(value, modeResources.value());
+            attributeBuilder->addMode(mode.value, modeResources.value());
         }
 
-        if (controllerConfig.contains("semantics")) {
-            auto& semanticsJson = controllerConfig.at("semantics");
+        if (capability.hasSemantics) {
             alexaClientSDK::avsCommon::utils::Optional<
                 alexaClientSDK::avsCommon::avs::capabilitySemantics::CapabilitySemantics>
-                semantics = getSemantics(semanticsJson);
+                semantics = getSemantics(capability.actionMappings);
             ThrowIfNot(semantics.hasValue(), "failedToParseSemanticsConfig");
             attributeBuilder->withSemantics(semantics.value());
         }
@@ -105,7 +100,11 @@ void ModeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withModeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    // state is reported proactively, and included in context, only when the engine caches controller state
+    bool isStateReported =
+        carControlServiceInterface->addStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    builder->withModeController(
+        shared_from_this(), getInstance(), m_attributes, isStateReported, isStateReported, false);
 }
 
 ModeControllerConfiguration ModeController::getConfiguration() {
@@ -169,12 +168,30 @@ ModeController::getMode() {
 }
 
 bool ModeController::addObserver(std::shared_ptr<ModeController::ModeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void ModeController::removeObserver(const std::shared_ptr<ModeController::ModeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void ModeController::onStateChanged(const CarControlState& state, bool alexaInteraction) {
+    std::vector<std::shared_ptr<ModeControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    auto cause = alexaInteraction ? AlexaStateChangeCauseType::ALEXA_INTERACTION
+                                  : AlexaStateChangeCauseType::PHYSICAL_INTERACTION;
+    ModeState modeState{
+        state.mode, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)};
+    for (auto& observer : observers) {
+        observer->onModeChanged(modeState, cause);
+    }
 }
 
 }  // namespace carControl
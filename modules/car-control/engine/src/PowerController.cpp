@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/PowerController.h"
 
+#include <algorithm>
+
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
@@ -47,7 +49,9 @@ void PowerController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withPowerController(shared_from_this(), false, false);
+    // state is reported proactively, and included in context, only when the engine caches controller state
+    bool isStateReported = carControlServiceInterface->addStateObserver(getEndpointId(), "", shared_from_this());
+    builder->withPowerController(shared_from_this(), isStateReported, isStateReported);
 }
 
 std::pair<AlexaResponseType, std::string> PowerController::setPowerState(
@@ -89,12 +93,30 @@ PowerController::getPowerState() {
 }
 
 bool PowerController::addObserver(std::shared_ptr<PowerControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void PowerController::removeObserver(const std::shared_ptr<PowerControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void PowerController::onStateChanged(const CarControlState& state, bool alexaInteraction) {
+    std::vector<std::shared_ptr<PowerControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    auto cause = alexaInteraction ? AlexaStateChangeCauseType::ALEXA_INTERACTION
+                                  : AlexaStateChangeCauseType::PHYSICAL_INTERACTION;
+    PowerState powerState{
+        state.isOn, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)};
+    for (auto& observer : observers) {
+        observer->onPowerStateChanged(powerState, cause);
+    }
 }
 
 }  // namespace carControl
@@ -43,19 +43,11 @@ std::string PrimitiveController::getInstance() {
 }
 
 alexaClientSDK::avsCommon::utils::Optional<CapabilityResources> PrimitiveController::getResources(
-    const json& resources,
+    const std::vector<std::string>& assetIds,
     const AssetStore& assetStore) {
     try {
-        ThrowIfNot(resources.contains("friendlyNames"), "missingFriendlyNames");
         alexaClientSDK::avsCommon::avs::CapabilityResources capabilityResources;
-        auto& friendlyNames = resources.at("friendlyNames");
-        for (auto& item : friendlyNames.items()) {
-            auto& type = item.value().at("@type");
-            // aace.carControl config only allows "asset" type labels.
-            // (https://developer.amazon.com/en-US/docs/alexa/device-apis/resources-and-assets.html#label-object)
-            ThrowIfNot(type == "asset", "expectedAssetTypeResource");
-            auto& value = item.value().at("value");
-            std::string assetId = value.at("assetId");
+        for (auto& assetId : assetIds) {
             // Expand assets present in the AssetStore. Use the asset ID for assets that are absent
             const std::vector<AssetStore::NameLocalePair>& names = assetStore.getFriendlyNames(assetId);
             if (names.empty()) {
@@ -75,32 +67,15 @@ alexaClientSDK::avsCommon::utils::Optional<CapabilityResources> PrimitiveControl
 }
 
 alexaClientSDK::avsCommon::utils::Optional<CapabilitySemantics> PrimitiveController::getSemantics(
-    const json& semantics) {
+    const std::vector<ActionMappingModel>& actionMappings) {
     try {
-        ThrowIfNot(semantics.contains("actionMappings"), "missingActionMappings");
         alexaClientSDK::avsCommon::avs::capabilitySemantics::CapabilitySemantics capabilitySemantics;
-        auto& actionMappings = semantics.at("actionMappings");
-        for (auto& item : actionMappings.items()) {
-            ThrowIfNot(
-                (item.value().contains("@type") && item.value().at("@type") == "ActionsToDirective"),
-                "expectedActionsToDirectiveType");
+        for (auto& item : actionMappings) {
             alexaClientSDK::avsCommon::avs::capabilitySemantics::ActionsToDirectiveMapping actionMapping;
-
-            ThrowIfNot(item.value().contains("actions"), "actionMappingMissingActions");
-            auto& actions = item.value().at("actions");
-            ThrowIf(actions.empty(), "actionMappingHasEmptyActions");
-            for (auto& action : actions.items()) {
-                actionMapping.addAction(action.value().get<std::string>());
+            for (auto& action : item.actions) {
+                actionMapping.addAction(action);
             }
-
-            ThrowIfNot(item.value().contains("directive"), "actionMappingMissingDirective");
-            auto& directive = item.value().at("directive");
-            ThrowIfNot(directive.contains("name"), "actionMappingDirectiveMissingName");
-            ThrowIfNot(directive.contains("payload"), "actionMappingDirectiveMissingPayload");
-            std::string name = directive.at("name").get<std::string>();
-            std::string payload = directive.at("payload").dump();
-            actionMapping.setDirective(name, payload);
-
+            actionMapping.setDirective(item.directiveName, item.directivePayload);
             capabilitySemantics.addActionsToDirectiveMapping(actionMapping);
         }
         return alexaClientSDK::avsCommon::utils::Optional<CapabilitySemantics>(capabilitySemantics);
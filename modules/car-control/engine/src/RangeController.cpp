@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/RangeController.h"
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/CapabilitySemantics/CapabilitySemantics.h>
 #include <RangeController/RangeControllerAttributeBuilder.h>
 
@@ -36,45 +38,36 @@ using RangeState = alexaClientSDK::avsCommon::sdkInterfaces::rangeController::Ra
 /// @}
 
 std::shared_ptr<RangeController> RangeController::create(
-    const json& controllerConfig,
+    const CapabilityModel& capability,
     const std::string& endpointId,
     const std::string& interface,
     const AssetStore& assetStore) {
     try {
-        std::string instance = controllerConfig.at("instance");
+        const std::string& instance = capability.instance;
         ThrowIf(instance.empty(), "missingInstance");
 
-        ThrowIfNot(controllerConfig.contains("capabilityResources"), "missingCapabilityResources");
         alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
-            capabilityResources = getResources(controllerConfig.at("capabilityResources"), assetStore);
+            capabilityResources = getResources(capability.assetIds, assetStore);
         ThrowIfNot(capabilityResources.hasValue(), "failedToParseCapabilityResourcesConfig");
         auto attributeBuilder =
             alexaClientSDK::capabilityAgents::rangeController::RangeControllerAttributeBuilder::create();
         attributeBuilder->withCapabilityResources(capabilityResources.value());
 
-        auto& configuration = controllerConfig.at("configuration");
-        if (configuration.contains("presets")) {
-            auto& presets = configuration.at("presets");
-            for (auto& preset : presets.items()) {
-                double rangeValue = preset.value().at("rangeValue");
-                ThrowIfNot(preset.value().contains("presetResources"), "missingPresetResources");
-                // Note: PresetResources is a type alias for CapabilityResources
-                alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
-                    presetResources = getResources(preset.value().at("presetResources"), assetStore);
-                ThrowIfNot(presetResources.hasValue(), "failedToParsePresetResourcesConfig");
-                attributeBuilder->addPreset({rangeValue, presetResources.value()});
-            }
+        for (auto& preset : capability.presets) {
+            // Note: PresetResources is a type alias for CapabilityResources
+            alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
+                presetResources = getResources(preset.assetIds, assetStore);
+            ThrowIfNot(presetResources.hasValue(), "failedToParsePresetResourcesConfig");
+            attributeBuilder->addPreset({preset.rangeValue, presetResources.value()});
         }
-        if (configuration.contains("unitOfMeasure")) {
-            auto unitOfMeasure = configuration.at("unitOfMeasure");
-            attributeBuilder->withUnitOfMeasure(unitOfMeasure);
+        if (capability.hasUnitOfMeasure) {
+            attributeBuilder->withUnitOfMeasure(capability.unitOfMeasure);
         }
 
-        if (controllerConfig.contains("semantics")) {
-            auto& semanticsJson = controllerConfig.at("semantics");
+        if (capability.hasSemantics) {
             alexaClientSDK::avsCommon::utils::Optional<
                 alexaClientSDK::avsCommon::avs::capabilitySemantics::CapabilitySemantics>
-                semantics = getSemantics(semanticsJson);
+                semantics = getSemantics(capability.actionMappings);
             ThrowIfNot(semantics.hasValue(), "failedToParseSemanticsConfig");
             attributeBuilder->withSemantics(semantics.value());
         }
@@ -82,14 +75,14 @@ std::shared_ptr<RangeController> RangeController::create(
         auto attributes = attributeBuilder->build();
         ThrowIfNot(attributes.hasValue(), "invalidAttributes");
 
-        double minimum, maximum, precision;
-        auto& supportedRange = configuration.at("supportedRange");
-        minimum = supportedRange.at("minimumValue");
-        maximum = supportedRange.at("maximumValue");
-        precision = supportedRange.at("precision");
-
-        auto controller = std::shared_ptr<RangeController>(
-            new RangeController(endpointId, interface, instance, attributes.value(), minimum, maximum, precision));
+        auto controller = std::shared_ptr<RangeController>(new RangeController(
+            endpointId,
+            interface,
+            instance,
+            attributes.value(),
+            capability.minimumValue,
+            capability.maximumValue,
+            capability.precision));
         ThrowIfNull(controller, "createRangeControllerFailed");
         return controller;
     } catch (std::exception& ex) {
@@ -117,7 +110,11 @@ void RangeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withRangeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    // state is reported proactively, and included in context, only when the engine caches controller state
+    bool isStateReported =
+        carControlServiceInterface->addStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    builder->withRangeController(
+        shared_from_this(), getInstance(), m_attributes, isStateReported, isStateReported, false);
 }
 
 RangeControllerConfiguration RangeController::getConfiguration() {
@@ -179,12 +176,30 @@ RangeController::getRangeState() {
 }
 
 bool RangeController::addObserver(std::shared_ptr<RangeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
 }
 
 void RangeController::removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void RangeController::onStateChanged(const CarControlState& state, bool alexaInteraction) {
+    std::vector<std::shared_ptr<RangeControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    auto cause = alexaInteraction ? AlexaStateChangeCauseType::ALEXA_INTERACTION
+                                  : AlexaStateChangeCauseType::PHYSICAL_INTERACTION;
+    RangeState rangeState{
+        state.rangeValue, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)};
+    for (auto& observer : observers) {
+        observer->onRangeChanged(rangeState, cause);
+    }
 }
 
 }  // namespace carControl
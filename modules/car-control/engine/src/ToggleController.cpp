@@ -15,6 +15,8 @@
 
 #include "AACE/Engine/CarControl/ToggleController.h"
 
+#include <algorithm>
+
 #include <AVSCommon/AVS/CapabilitySemantics/CapabilitySemantics.h>
 #include <ToggleController/ToggleControllerAttributeBuilder.h>
 
@@ -28,27 +30,25 @@ namespace carControl {
 static const std::string TAG("aace.engine.carControl.ToggleController");
 
 std::shared_ptr<ToggleController> ToggleController::create(
-    const json& controllerConfig,
+    const CapabilityModel& capability,
     const std::string& endpointId,
     const std::string& interface,
     const AssetStore& assetStore) {
     try {
-        std::string instance = controllerConfig.at("instance");
+        const std::string& instance = capability.instance;
         ThrowIf(instance.empty(), "missingInstance");
 
-        ThrowIfNot(controllerConfig.contains("capabilityResources"), "missingCapabilityResources");
         alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::avs::CapabilityResources>
-            capabilityResources = getResources(controllerConfig.at("capabilityResources"), assetStore);
+            capabilityResources = getResources(capability.assetIds, assetStore);
         ThrowIfNot(capabilityResources.hasValue(), "failedToParseCapabilityResourcesConfig");
         auto attributeBuilder =
             alexaClientSDK::capabilityAgents::toggleController::ToggleControllerAttributeBuilder::create();
         attributeBuilder->withCapabilityResources(capabilityResources.value());
 
-        if (controllerConfig.contains("semantics")) {
-            auto& semanticsJson = controllerConfig.at("semantics");
+        if (capability.hasSemantics) {
             alexaClientSDK::avsCommon::utils::Optional<
                 alexaClientSDK::avsCommon::avs::capabilitySemantics::CapabilitySemantics>
-                semantics = getSemantics(semanticsJson);
+                semantics = getSemantics(capability.actionMappings);
             ThrowIfNot(semantics.hasValue(), "failedToParseSemanticsConfig");
             attributeBuilder->withSemantics(semantics.value());
         }
@@ -77,7 +77,11 @@ void ToggleController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
     m_carControlServiceInterface = carControlServiceInterface;
-    builder->withToggleController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    // state is reported proactively, and included in context, only when the engine caches controller state
+    bool isStateReported =
+        carControlServiceInterface->addStateObserver(getEndpointId(), getInstance(), shared_from_this());
+    builder->withToggleController(
+        shared_from_this(), getInstance(), m_attributes, isStateReported, isStateReported, false);
 }
 
 std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> ToggleController::setToggleState(
@@ -121,17 +125,31 @@ ToggleController::getToggleState() {
     }
 }
 
-bool ToggleController::addObserver(
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>
-        observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+bool ToggleController::addObserver(std::shared_ptr<ToggleControllerObserverInterface> observer) {
+    ReturnIf(observer == nullptr, false);
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.push_back(observer);
+    return true;
+}
+
+void ToggleController::removeObserver(const std::shared_ptr<ToggleControllerObserverInterface>& observer) {
+    std::lock_guard<std::mutex> lock(m_observersMutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
 }
 
-void ToggleController::removeObserver(
-    const std::shared_ptr<
-        alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
+void ToggleController::onStateChanged(const CarControlState& state, bool alexaInteraction) {
+    std::vector<std::shared_ptr<ToggleControllerObserverInterface>> observers;
+    {
+        std::lock_guard<std::mutex> lock(m_observersMutex);
+        observers = m_observers;
+    }
+    auto cause = alexaInteraction ? AlexaStateChangeCauseType::ALEXA_INTERACTION
+                                  : AlexaStateChangeCauseType::PHYSICAL_INTERACTION;
+    ToggleState toggleState{
+        state.isOn, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)};
+    for (auto& observer : observers) {
+        observer->onToggleStateChanged(toggleState, cause);
+    }
 }
 
 }  // namespace carControl
@@ -17,6 +17,7 @@
 #define AACE_CAR_CONTROL_CAR_CONTROL_H
 
 #include <iostream>
+#include <memory>
 
 #include "AACE/Core/PlatformInterface.h"
 
@@ -25,6 +26,8 @@
 namespace aace {
 namespace carControl {
 
+class CarControlEngineInterface;
+
 /**
  * CarControl should be extended to interface the elements that can be controlled in the vehicle. Each controllable
  * element is an 'endpoint' with a unique @c endpointId. @c CarControl provides interfaces for four types of
@@ -216,6 +219,63 @@ public:
         const std::string& endpointId,
         const std::string& controllerId,
         std::string& value);
+
+    /**
+     * Notifies the Engine of the current power state of the controller identified by @c endpointId. The platform
+     * implementation should report the state whenever it changes, whether or not the change was requested by Alexa.
+     * Once a state is reported, the Engine answers state queries for the controller from its cached state instead
+     * of calling @c isPowerControllerOn().
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] isOn @c true if the controller is powered on.
+     * @return @c true if the state was accepted by the Engine.
+     */
+    bool reportPowerControllerState(const std::string& endpointId, bool isOn);
+    /**
+     * Notifies the Engine of the current state of the controller identified by @c endpointId and @c controllerId.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] isOn @c true if the controller is turned on.
+     * @return @c true if the state was accepted by the Engine.
+     * @sa reportPowerControllerState
+     */
+    bool reportToggleControllerState(const std::string& endpointId, const std::string& controllerId, bool isOn);
+    /**
+     * Notifies the Engine of the current range value of the controller identified by @c endpointId and
+     * @c controllerId.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current range value.
+     * @return @c true if the value was accepted by the Engine.
+     * @sa reportPowerControllerState
+     */
+    bool reportRangeControllerValue(const std::string& endpointId, const std::string& controllerId, double value);
+    /**
+     * Notifies the Engine of the current mode of the controller identified by @c endpointId and @c controllerId.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current mode.
+     * @return @c true if the mode was accepted by the Engine.
+     * @sa reportPowerControllerState
+     */
+    bool reportModeControllerValue(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value);
+
+    /**
+     * @internal
+     * Sets the Engine interface delegate.
+     *
+     * Should *never* be called by the platform implementation.
+     */
+    void setEngineInterface(std::shared_ptr<aace::carControl::CarControlEngineInterface> engineInterface);
+
+private:
+    std::shared_ptr<aace::carControl::CarControlEngineInterface> m_engineInterface;
 };
 
 }  // namespace carControl
@@ -0,0 +1,46 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACE_H
+#define AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACE_H
+
+#include <string>
+
+namespace aace {
+namespace carControl {
+
+class CarControlEngineInterface {
+public:
+    virtual ~CarControlEngineInterface() = default;
+
+    virtual bool onReportPowerControllerState(const std::string& endpointId, bool isOn) = 0;
+    virtual bool onReportToggleControllerState(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        bool isOn) = 0;
+    virtual bool onReportRangeControllerValue(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        double value) = 0;
+    virtual bool onReportModeControllerValue(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value) = 0;
+};
+
+}  // namespace carControl
+}  // namespace aace
+
+#endif  // AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACE_H
@@ -14,6 +14,7 @@
  */
 
 #include <AACE/CarControl/CarControl.h>
+#include <AACE/CarControl/CarControlEngineInterface.h>
 
 namespace aace {
 namespace carControl {
@@ -89,5 +90,50 @@ bool CarControl::getModeControllerValue(
     return false;
 }
 
+/**
+ * State reporting
+ */
+bool CarControl::reportPowerControllerState(const std::string& endpointId, bool isOn) {
+    if (m_engineInterface != nullptr) {
+        return m_engineInterface->onReportPowerControllerState(endpointId, isOn);
+    }
+    return false;
+}
+
+bool CarControl::reportToggleControllerState(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    if (m_engineInterface != nullptr) {
+        return m_engineInterface->onReportToggleControllerState(endpointId, controllerId, isOn);
+    }
+    return false;
+}
+
+bool CarControl::reportRangeControllerValue(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    if (m_engineInterface != nullptr) {
+        return m_engineInterface->onReportRangeControllerValue(endpointId, controllerId, value);
+    }
+    return false;
+}
+
+bool CarControl::reportModeControllerValue(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    if (m_engineInterface != nullptr) {
+        return m_engineInterface->onReportModeControllerValue(endpointId, controllerId, value);
+    }
+    return false;
+}
+
+// Engine Interface
+void CarControl::setEngineInterface(std::shared_ptr<aace::carControl::CarControlEngineInterface> engineInterface) {
+    m_engineInterface = engineInterface;
+}
+
 }  // namespace carControl
 }  // namespace aace
@@ -0,0 +1,327 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
+#include <AASB/Engine/CarControl/AASBCarControl.h>
+
+using namespace aasb::engine::carControl;
+using aace::engine::messageBroker::Message;
+using aace::engine::messageBroker::MessageBrokerInterface;
+using aace::engine::messageBroker::PublishMessage;
+using json = nlohmann::json;
+
+/// The time in milliseconds to wait for a reply message.
+static const uint32_t REPLY_TIMEOUT = 5000;
+
+/// The time to wait for a message to be published.
+static const std::chrono::seconds PUBLISH_TIMEOUT(2);
+
+/**
+ * Message broker recording the messages published by @c AASBCarControl, and delivering the replies published by
+ * the test to the @c AASBCarControl subscribers.
+ */
+class FakeMessageBroker : public MessageBrokerInterface {
+public:
+    void subscribe(const std::string& topic, MessageHandler handler, Message::Direction direction) override {
+        subscribe(topic, "", handler, direction);
+    }
+
+    void subscribe(
+        const std::string& topic,
+        const std::string& action,
+        MessageHandler handler,
+        Message::Direction direction) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handlers[topic + "/" + action] = handler;
+    }
+
+    PublishMessage publish(const std::string& message, Message::Direction direction) override {
+        return PublishMessage(
+            direction, message, std::chrono::milliseconds(REPLY_TIMEOUT), [this](const PublishMessage& pm, bool) {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_published.push_back(json::parse(pm.msg()));
+                }
+                m_cv.notify_all();
+                return Message::INVALID;
+            });
+    }
+
+    /// Waits for the message at @c index in the published messages.
+    bool waitForPublished(size_t index, json& message) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_cv.wait_for(lock, PUBLISH_TIMEOUT, [this, index] { return m_published.size() > index; })) {
+            return false;
+        }
+        message = m_published[index];
+        return true;
+    }
+
+    size_t getPublishedCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_published.size();
+    }
+
+    /// Delivers an @c ExecuteBatchReply message with @c results to the subscriber.
+    void replyToBatch(const std::string& messageId, const std::vector<bool>& results) {
+        json reply = {{"header",
+                       {{"id", "6f2a6c4e-2d4b-4b7a-9a44-5b0d2c3b6e11"},
+                        {"messageType", "Reply"},
+                        {"version", "4.0"},
+                        {"messageDescription",
+                         {{"topic", "CarControl"}, {"action", "ExecuteBatch"}, {"replyToId", messageId}}}}},
+                      {"payload", {{"results", results}}}};
+        MessageHandler handler;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            handler = m_handlers["CarControl/ExecuteBatch"];
+        }
+        ASSERT_TRUE(handler != nullptr);
+        handler(Message(reply.dump(), Message::Direction::INCOMING));
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::unordered_map<std::string, MessageHandler> m_handlers;
+    std::vector<json> m_published;
+};
+
+/// Command batch trigger collecting commands and flushing the batch when the test asks for it.
+class ManualBatchTrigger : public CommandBatchTrigger {
+public:
+    bool startBatch() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_collecting;
+    }
+
+    void commandCollected(size_t batchSize) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_batchSize = batchSize;
+        }
+        m_cv.notify_all();
+    }
+
+    void waitForFlush() override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_flush; });
+        m_flush = false;
+        m_batchSize = 0;
+    }
+
+    /// Sets whether a command issued while no batch is being collected starts a batch.
+    void setCollecting(bool collecting) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_collecting = collecting;
+    }
+
+    /// Waits for the batch being collected to hold @c batchSize commands.
+    bool waitForBatchSize(size_t batchSize) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cv.wait_for(lock, PUBLISH_TIMEOUT, [this, batchSize] { return m_batchSize == batchSize; });
+    }
+
+    /// Publishes the batch being collected.
+    void flush() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_flush = true;
+        }
+        m_cv.notify_all();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_collecting = false;
+    bool m_flush = false;
+    size_t m_batchSize = 0;
+};
+
+/// Test harness for the command batching of @c AASBCarControl
+class AASBCarControlTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_messageBroker = std::make_shared<FakeMessageBroker>();
+        m_batchTrigger = std::make_shared<ManualBatchTrigger>();
+    }
+
+    std::shared_ptr<AASBCarControl> createCarControl() {
+        return AASBCarControl::create(m_messageBroker, REPLY_TIMEOUT, 0, m_batchTrigger);
+    }
+
+    /// Turns on the power controller of @c endpointId on a separate thread.
+    std::future<bool> turnOn(std::shared_ptr<AASBCarControl> carControl, const std::string& endpointId) {
+        return std::async(std::launch::async, [carControl, endpointId] {
+            return carControl->turnPowerControllerOn(endpointId);
+        });
+    }
+
+    static std::vector<std::string> getEndpointIds(const json& message) {
+        std::vector<std::string> endpointIds;
+        for (auto& command : message.at("payload").at("commands")) {
+            endpointIds.push_back(command.at("endpointId").get<std::string>());
+        }
+        return endpointIds;
+    }
+
+    static std::string getMessageId(const json& message) {
+        return message.at("header").at("id").get<std::string>();
+    }
+
+protected:
+    std::shared_ptr<FakeMessageBroker> m_messageBroker;
+    std::shared_ptr<ManualBatchTrigger> m_batchTrigger;
+};
+
+TEST_F(AASBCarControlTest, LoneCommandIsPublishedWithoutWaitingForTheBatchWindow) {
+    // the batch window outlasts the time the test waits for the message
+    auto carControl = AASBCarControl::create(m_messageBroker, REPLY_TIMEOUT, REPLY_TIMEOUT);
+    ASSERT_NE(carControl, nullptr);
+
+    auto result = turnOn(carControl, "seatHeater");
+
+    json message;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(0, message));
+    EXPECT_EQ(message.at("header").at("messageDescription").at("action"), "ExecuteBatch");
+    EXPECT_EQ(getEndpointIds(message), std::vector<std::string>({"seatHeater"}));
+
+    m_messageBroker->replyToBatch(getMessageId(message), {true});
+    EXPECT_TRUE(result.get());
+}
+
+TEST_F(AASBCarControlTest, CollectedCommandsArePublishedTogether) {
+    auto carControl = createCarControl();
+    ASSERT_NE(carControl, nullptr);
+
+    auto first = turnOn(carControl, "driverSeat");
+    json firstMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(0, firstMessage));
+
+    // the commands for the other endpoints targeted by the same utterance
+    m_batchTrigger->setCollecting(true);
+    auto second = turnOn(carControl, "passengerSeat");
+    auto third = turnOn(carControl, "rearSeat");
+    ASSERT_TRUE(m_batchTrigger->waitForBatchSize(2));
+    EXPECT_EQ(m_messageBroker->getPublishedCount(), 1u);
+    m_batchTrigger->flush();
+
+    json batchMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(1, batchMessage));
+    auto endpointIds = getEndpointIds(batchMessage);
+    std::sort(endpointIds.begin(), endpointIds.end());
+    EXPECT_EQ(endpointIds, std::vector<std::string>({"passengerSeat", "rearSeat"}));
+
+    m_messageBroker->replyToBatch(getMessageId(firstMessage), {true});
+    std::vector<bool> results;
+    for (auto& endpointId : getEndpointIds(batchMessage)) {
+        results.push_back(endpointId == "rearSeat");
+    }
+    m_messageBroker->replyToBatch(getMessageId(batchMessage), results);
+
+    EXPECT_TRUE(first.get());
+    EXPECT_FALSE(second.get());
+    EXPECT_TRUE(third.get());
+    EXPECT_EQ(m_messageBroker->getPublishedCount(), 2u);
+}
+
+TEST_F(AASBCarControlTest, CommandAfterAFlushStartsANewBatch) {
+    auto carControl = createCarControl();
+    ASSERT_NE(carControl, nullptr);
+    m_batchTrigger->setCollecting(true);
+
+    auto first = turnOn(carControl, "driverSeat");
+    auto second = turnOn(carControl, "passengerSeat");
+    ASSERT_TRUE(m_batchTrigger->waitForBatchSize(2));
+    m_batchTrigger->flush();
+    json message;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(0, message));
+    EXPECT_EQ(getEndpointIds(message).size(), 2u);
+    m_messageBroker->replyToBatch(getMessageId(message), {true, true});
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+
+    auto third = turnOn(carControl, "rearSeat");
+    ASSERT_TRUE(m_batchTrigger->waitForBatchSize(1));
+    m_batchTrigger->flush();
+    ASSERT_TRUE(m_messageBroker->waitForPublished(1, message));
+    EXPECT_EQ(getEndpointIds(message), std::vector<std::string>({"rearSeat"}));
+    m_messageBroker->replyToBatch(getMessageId(message), {true});
+    EXPECT_TRUE(third.get());
+}
+
+TEST_F(AASBCarControlTest, RepliesAreMatchedToBatchesByMessageId) {
+    auto carControl = createCarControl();
+    ASSERT_NE(carControl, nullptr);
+
+    auto first = turnOn(carControl, "driverSeat");
+    json firstMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(0, firstMessage));
+    m_batchTrigger->setCollecting(true);
+    auto second = turnOn(carControl, "passengerSeat");
+    ASSERT_TRUE(m_batchTrigger->waitForBatchSize(1));
+    m_batchTrigger->flush();
+    json secondMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(1, secondMessage));
+    ASSERT_NE(getMessageId(firstMessage), getMessageId(secondMessage));
+
+    // replies to unknown messages are ignored
+    m_messageBroker->replyToBatch("9b0a5e1c-3f7d-4e2a-8c61-0d4f7b2e9a35", {true});
+
+    // reply in the opposite order of the messages
+    m_messageBroker->replyToBatch(getMessageId(secondMessage), {true});
+    m_messageBroker->replyToBatch(getMessageId(firstMessage), {false});
+
+    EXPECT_FALSE(first.get());
+    EXPECT_TRUE(second.get());
+}
+
+TEST_F(AASBCarControlTest, MismatchedReplyCountFailsEveryCommand) {
+    auto carControl = createCarControl();
+    ASSERT_NE(carControl, nullptr);
+
+    auto first = turnOn(carControl, "driverSeat");
+    json firstMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(0, firstMessage));
+    m_batchTrigger->setCollecting(true);
+    auto second = turnOn(carControl, "passengerSeat");
+    auto third = turnOn(carControl, "rearSeat");
+    ASSERT_TRUE(m_batchTrigger->waitForBatchSize(2));
+    m_batchTrigger->flush();
+    json batchMessage;
+    ASSERT_TRUE(m_messageBroker->waitForPublished(1, batchMessage));
+    ASSERT_EQ(getEndpointIds(batchMessage).size(), 2u);
+
+    m_messageBroker->replyToBatch(getMessageId(firstMessage), {true, true});
+    m_messageBroker->replyToBatch(getMessageId(batchMessage), {true});
+
+    EXPECT_FALSE(first.get());
+    EXPECT_FALSE(second.get());
+    EXPECT_FALSE(third.get());
+}
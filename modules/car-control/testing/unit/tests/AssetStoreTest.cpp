@@ -0,0 +1,217 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/CarControl/AssetStore.h>
+
+using namespace aace::engine::carControl;
+
+/// The prefix of compiled assets cache file names.
+static const std::string CACHE_FILE_PREFIX = "carControlAssets-";
+
+/// Assets defining the "Fan" asset.
+static const std::string FAN_ASSETS = R"({
+    "assets": [
+        {
+            "assetId": "My.Fan",
+            "values": [
+                {"locales": ["en-US"], "defaultValue": "fan", "synonyms": ["blower"]},
+                {"locales": ["fr-FR"], "defaultValue": "ventilateur"}
+            ]
+        },
+        {
+            "assetId": "My.Heater",
+            "values": [{"locales": ["en-US"], "defaultValue": "heater"}]
+        }
+    ]
+})";
+
+/// The friendly names of the "Fan" asset.
+static const std::vector<AssetStore::NameLocalePair> FAN_NAMES = {
+    {"fan", "en-US"}, {"blower", "en-US"}, {"ventilateur", "fr-FR"}};
+
+/// Assets redefining the "Fan" asset.
+static const std::string CHANGED_FAN_ASSETS = R"({
+    "assets": [
+        {
+            "assetId": "My.Fan",
+            "values": [{"locales": ["en-US"], "defaultValue": "air"}]
+        }
+    ]
+})";
+
+/// Assets defining the "Light" asset.
+static const std::string LIGHT_ASSETS = R"({
+    "assets": [
+        {
+            "assetId": "My.Light",
+            "values": [{"locales": ["en-US"], "defaultValue": "light"}]
+        }
+    ]
+})";
+
+class AssetStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char directory[] = "/tmp/AssetStoreTestXXXXXX";
+        ASSERT_NE(mkdtemp(directory), nullptr);
+        m_directory = directory;
+        m_cachePath = m_directory + "/cache";
+        ASSERT_EQ(mkdir(m_cachePath.c_str(), 0700), 0);
+    }
+
+    void TearDown() override {
+        for (auto& directory : {m_cachePath, m_directory}) {
+            for (auto& name : listFiles(directory)) {
+                unlink((directory + "/" + name).c_str());
+            }
+        }
+        rmdir(m_cachePath.c_str());
+        rmdir(m_directory.c_str());
+    }
+
+    std::string writeAssets(const std::string& name, const std::string& contents) {
+        std::string path = m_directory + "/" + name;
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+        return path;
+    }
+
+    static std::vector<std::string> listFiles(const std::string& directory) {
+        std::vector<std::string> names;
+        if (DIR* dir = opendir(directory.c_str())) {
+            while (struct dirent* entry = readdir(dir)) {
+                std::string name = entry->d_name;
+                if (name != "." && name != "..") {
+                    names.push_back(name);
+                }
+            }
+            closedir(dir);
+        }
+        return names;
+    }
+
+    std::vector<std::string> listCacheFiles() {
+        return listFiles(m_cachePath);
+    }
+
+    ino_t getInode(const std::string& name) {
+        struct stat info;
+        return stat((m_cachePath + "/" + name).c_str(), &info) == 0 ? info.st_ino : 0;
+    }
+
+    std::string m_directory;
+    std::string m_cachePath;
+};
+
+TEST_F(AssetStoreTest, ExpandsFriendlyNamesWithoutCache) {
+    AssetStore assetStore;
+    ASSERT_TRUE(assetStore.addAssets(writeAssets("assets.json", FAN_ASSETS)));
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Fan"), FAN_NAMES);
+    EXPECT_TRUE(assetStore.getFriendlyNames("My.Unknown").empty());
+    EXPECT_TRUE(listCacheFiles().empty());
+}
+
+TEST_F(AssetStoreTest, CachedImageRoundTrip) {
+    std::string path = writeAssets("assets.json", FAN_ASSETS);
+    {
+        AssetStore assetStore;
+        assetStore.setCachePath(m_cachePath);
+        ASSERT_TRUE(assetStore.addAssets(path));
+    }
+    auto files = listCacheFiles();
+    ASSERT_EQ(files.size(), 1u);
+    EXPECT_EQ(files[0].compare(0, CACHE_FILE_PREFIX.size(), CACHE_FILE_PREFIX), 0);
+    ino_t inode = getInode(files[0]);
+
+    // The unchanged file is read from the cached image, which is not rewritten
+    AssetStore assetStore;
+    assetStore.setCachePath(m_cachePath);
+    ASSERT_TRUE(assetStore.addAssets(path));
+    EXPECT_EQ(listCacheFiles(), files);
+    EXPECT_EQ(getInode(files[0]), inode);
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Fan"), FAN_NAMES);
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Heater"), std::vector<AssetStore::NameLocalePair>({{"heater", "en-US"}}));
+}
+
+TEST_F(AssetStoreTest, ChangedContentsReplaceCachedImage) {
+    std::string path = writeAssets("assets.json", FAN_ASSETS);
+    {
+        AssetStore assetStore;
+        assetStore.setCachePath(m_cachePath);
+        ASSERT_TRUE(assetStore.addAssets(path));
+    }
+    auto files = listCacheFiles();
+    ASSERT_EQ(files.size(), 1u);
+
+    writeAssets("assets.json", CHANGED_FAN_ASSETS);
+    AssetStore assetStore;
+    assetStore.setCachePath(m_cachePath);
+    ASSERT_TRUE(assetStore.addAssets(path));
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Fan"), std::vector<AssetStore::NameLocalePair>({{"air", "en-US"}}));
+    EXPECT_TRUE(assetStore.getFriendlyNames("My.Heater").empty());
+
+    // The image of the previous contents is removed
+    auto changedFiles = listCacheFiles();
+    ASSERT_EQ(changedFiles.size(), 1u);
+    EXPECT_NE(changedFiles[0], files[0]);
+}
+
+TEST_F(AssetStoreTest, CorruptCachedImageIsRecompiled) {
+    std::string path = writeAssets("assets.json", FAN_ASSETS);
+    {
+        AssetStore assetStore;
+        assetStore.setCachePath(m_cachePath);
+        ASSERT_TRUE(assetStore.addAssets(path));
+    }
+    auto files = listCacheFiles();
+    ASSERT_EQ(files.size(), 1u);
+    std::ofstream(m_cachePath + "/" + files[0], std::ios::binary | std::ios::trunc) << "corrupt";
+
+    AssetStore assetStore;
+    assetStore.setCachePath(m_cachePath);
+    ASSERT_TRUE(assetStore.addAssets(path));
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Heater"), std::vector<AssetStore::NameLocalePair>({{"heater", "en-US"}}));
+    EXPECT_EQ(listCacheFiles(), files);
+}
+
+TEST_F(AssetStoreTest, AssetsFilesKeepSeparateImages) {
+    std::string fanPath = writeAssets("fan.json", FAN_ASSETS);
+    std::string lightPath = writeAssets("light.json", LIGHT_ASSETS);
+    AssetStore assetStore;
+    assetStore.setCachePath(m_cachePath);
+    ASSERT_TRUE(assetStore.addAssets(fanPath));
+    ASSERT_TRUE(assetStore.addAssets(lightPath));
+    EXPECT_EQ(listCacheFiles().size(), 2u);
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Light"), std::vector<AssetStore::NameLocalePair>({{"light", "en-US"}}));
+    EXPECT_EQ(assetStore.getFriendlyNames("My.Heater"), std::vector<AssetStore::NameLocalePair>({{"heater", "en-US"}}));
+}
+
+TEST_F(AssetStoreTest, InvalidAssetsFileFails) {
+    AssetStore assetStore;
+    assetStore.setCachePath(m_cachePath);
+    EXPECT_FALSE(assetStore.addAssets(m_directory + "/missing.json"));
+    EXPECT_FALSE(assetStore.addAssets(writeAssets("invalid.json", "{\"assets\": [")));
+    EXPECT_TRUE(listCacheFiles().empty());
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/CarControl/CarControlModel.h>
+
+using namespace aace::engine::carControl;
+using json = nlohmann::json;
+
+/// The ID of the internal endpoint left out of the model.
+static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
+
+/// A configuration using every capability interface.
+static const char* CONFIGURATION = R"({
+    "endpoints": [
+        {
+            "endpointId": "default.fan",
+            "endpointResources": {
+                "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Automotive.DeviceName.Fan"}}]
+            },
+            "capabilities": [
+                {"type": "AlexaInterface", "interface": "Alexa.PowerController", "version": "3"},
+                {
+                    "type": "AlexaInterface",
+                    "interface": "Alexa.RangeController",
+                    "instance": "speed",
+                    "capabilityResources": {
+                        "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Setting.FanSpeed"}}]
+                    },
+                    "configuration": {
+                        "supportedRange": {"minimumValue": 1, "maximumValue": 10, "precision": 0.5},
+                        "unitOfMeasure": "Alexa.Unit.Percent",
+                        "presets": [
+                            {
+                                "rangeValue": 10,
+                                "presetResources": {
+                                    "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Value.Maximum"}}]
+                                }
+                            }
+                        ]
+                    },
+                    "semantics": {
+                        "actionMappings": [
+                            {
+                                "@type": "ActionsToDirective",
+                                "actions": ["Alexa.Actions.Raise"],
+                                "directive": {"name": "AdjustRangeValue", "payload": {"rangeValueDelta": 1}}
+                            }
+                        ]
+                    }
+                }
+            ]
+        },
+        {
+            "endpointId": "default.heater",
+            "endpointResources": {
+                "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Automotive.DeviceName.Heater"}}]
+            },
+            "capabilities": [
+                {
+                    "type": "AlexaInterface",
+                    "interface": "Alexa.ModeController",
+                    "instance": "mode",
+                    "capabilityResources": {
+                        "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Setting.Mode"}}]
+                    },
+                    "configuration": {
+                        "ordered": true,
+                        "supportedModes": [
+                            {
+                                "value": "LOW",
+                                "modeResources": {
+                                    "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Value.Low"}}]
+                                }
+                            },
+                            {
+                                "value": "HIGH",
+                                "modeResources": {
+                                    "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Value.High"}}]
+                                }
+                            }
+                        ]
+                    }
+                },
+                {
+                    "type": "AlexaInterface",
+                    "interface": "Alexa.ToggleController",
+                    "instance": "eco",
+                    "capabilityResources": {
+                        "friendlyNames": [{"@type": "asset", "value": {"assetId": "Alexa.Setting.Eco"}}]
+                    }
+                }
+            ]
+        },
+        {
+            "endpointId": "_AutoSDKInternalRoot",
+            "capabilities": []
+        }
+    ]
+})";
+
+/// The ZoneDefinitions capability translated from legacy zones.
+static const char* ZONES_CAPABILITY = R"({
+    "type": "AlexaInterface",
+    "interface": "Alexa.Automotive.ZoneDefinitions",
+    "version": "1.0",
+    "configuration": {"zones": [{"zoneId": "zone.all", "members": [{"endpointId": "default.fan"}]}]}
+})";
+
+class CarControlModelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char directory[] = "/tmp/CarControlModelTestXXXXXX";
+        ASSERT_NE(mkdtemp(directory), nullptr);
+        m_directory = directory;
+        m_path = m_directory + "/model.bin";
+    }
+
+    void TearDown() override {
+        unlink(m_path.c_str());
+        rmdir(m_directory.c_str());
+    }
+
+    static std::shared_ptr<CarControlModel> createModel() {
+        return CarControlModel::create(json::parse(CONFIGURATION), json::parse(ZONES_CAPABILITY), INTERNAL_ENDPOINT_ID);
+    }
+
+    static void expectModel(const CarControlModel& model) {
+        auto& endpoints = model.getEndpoints();
+        ASSERT_EQ(endpoints.size(), 2u);
+
+        auto& fan = endpoints[0];
+        EXPECT_EQ(fan.endpointId, "default.fan");
+        EXPECT_EQ(fan.assetIds, std::vector<std::string>({"Alexa.Automotive.DeviceName.Fan"}));
+        ASSERT_EQ(fan.capabilities.size(), 2u);
+        EXPECT_EQ(fan.capabilities[0].interface, "Alexa.PowerController");
+        auto& range = fan.capabilities[1];
+        EXPECT_EQ(range.interface, "Alexa.RangeController");
+        EXPECT_EQ(range.instance, "speed");
+        EXPECT_EQ(range.assetIds, std::vector<std::string>({"Alexa.Setting.FanSpeed"}));
+        EXPECT_EQ(range.minimumValue, 1);
+        EXPECT_EQ(range.maximumValue, 10);
+        EXPECT_EQ(range.precision, 0.5);
+        EXPECT_TRUE(range.hasUnitOfMeasure);
+        EXPECT_EQ(range.unitOfMeasure, "Alexa.Unit.Percent");
+        ASSERT_EQ(range.presets.size(), 1u);
+        EXPECT_EQ(range.presets[0].rangeValue, 10);
+        EXPECT_EQ(range.presets[0].assetIds, std::vector<std::string>({"Alexa.Value.Maximum"}));
+        EXPECT_TRUE(range.hasSemantics);
+        ASSERT_EQ(range.actionMappings.size(), 1u);
+        EXPECT_EQ(range.actionMappings[0].actions, std::vector<std::string>({"Alexa.Actions.Raise"}));
+        EXPECT_EQ(range.actionMappings[0].directiveName, "AdjustRangeValue");
+        EXPECT_EQ(json::parse(range.actionMappings[0].directivePayload), json({{"rangeValueDelta", 1}}));
+
+        auto& heater = endpoints[1];
+        EXPECT_EQ(heater.endpointId, "default.heater");
+        ASSERT_EQ(heater.capabilities.size(), 2u);
+        auto& mode = heater.capabilities[0];
+        EXPECT_EQ(mode.interface, "Alexa.ModeController");
+        EXPECT_TRUE(mode.hasOrdered);
+        EXPECT_TRUE(mode.ordered);
+        ASSERT_EQ(mode.modes.size(), 2u);
+        EXPECT_EQ(mode.modes[0].value, "LOW");
+        EXPECT_EQ(mode.modes[1].value, "HIGH");
+        EXPECT_EQ(mode.modes[1].assetIds, std::vector<std::string>({"Alexa.Value.High"}));
+        EXPECT_FALSE(mode.hasSemantics);
+        auto& toggle = heater.capabilities[1];
+        EXPECT_EQ(toggle.interface, "Alexa.ToggleController");
+        EXPECT_EQ(toggle.instance, "eco");
+        EXPECT_FALSE(toggle.hasUnitOfMeasure);
+
+        EXPECT_EQ(json::parse(model.getZonesCapability()), json::parse(ZONES_CAPABILITY));
+    }
+
+    std::string m_directory;
+    std::string m_path;
+};
+
+TEST_F(CarControlModelTest, CompilesConfiguration) {
+    auto model = createModel();
+    ASSERT_NE(model, nullptr);
+    expectModel(*model);
+}
+
+TEST_F(CarControlModelTest, CachedImageRoundTrip) {
+    auto model = createModel();
+    ASSERT_NE(model, nullptr);
+    ASSERT_TRUE(model->save(m_path));
+    auto loaded = CarControlModel::load(m_path);
+    ASSERT_NE(loaded, nullptr);
+    expectModel(*loaded);
+}
+
+TEST_F(CarControlModelTest, ConfigurationWithoutZones) {
+    auto model = CarControlModel::create(json::parse(CONFIGURATION), nullptr, INTERNAL_ENDPOINT_ID);
+    ASSERT_NE(model, nullptr);
+    ASSERT_TRUE(model->save(m_path));
+    auto loaded = CarControlModel::load(m_path);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->getZonesCapability().empty());
+    EXPECT_EQ(loaded->getEndpoints().size(), 2u);
+}
+
+TEST_F(CarControlModelTest, MissingOrCorruptImageIsNotLoaded) {
+    EXPECT_EQ(CarControlModel::load(m_path), nullptr);
+
+    auto model = createModel();
+    ASSERT_NE(model, nullptr);
+    ASSERT_TRUE(model->save(m_path));
+    std::ifstream ifs(m_path, std::ios::binary);
+    std::string image((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+
+    // Truncated image
+    std::ofstream(m_path, std::ios::binary | std::ios::trunc) << image.substr(0, image.size() - 1);
+    EXPECT_EQ(CarControlModel::load(m_path), nullptr);
+
+    // Image with a count past the end of the records
+    std::string corrupt = image;
+    corrupt[24] = '\xff';
+    corrupt[25] = '\xff';
+    std::ofstream(m_path, std::ios::binary | std::ios::trunc) << corrupt;
+    EXPECT_EQ(CarControlModel::load(m_path), nullptr);
+
+    // Image of another format version
+    corrupt = image;
+    corrupt[4]++;
+    std::ofstream(m_path, std::ios::binary | std::ios::trunc) << corrupt;
+    EXPECT_EQ(CarControlModel::load(m_path), nullptr);
+}
+
+TEST_F(CarControlModelTest, ConfigurationHashChangesWithConfiguration) {
+    json configuration = json::parse(CONFIGURATION);
+    uint64_t hash = CarControlModel::getConfigurationHash(configuration);
+    EXPECT_EQ(CarControlModel::getConfigurationHash(json::parse(CONFIGURATION)), hash);
+
+    json changed = configuration;
+    changed["endpoints"][0]["capabilities"][1]["configuration"]["supportedRange"]["precision"] = 1;
+    EXPECT_NE(CarControlModel::getConfigurationHash(changed), hash);
+
+    changed = configuration;
+    changed["endpoints"][1]["endpointId"] = "default.heate";
+    EXPECT_NE(CarControlModel::getConfigurationHash(changed), hash);
+
+    // Values are delimited, so moving characters between adjacent strings changes the hash
+    EXPECT_NE(
+        CarControlModel::getConfigurationHash(json::array({"ab", "c"})),
+        CarControlModel::getConfigurationHash(json::array({"a", "bc"})));
+    EXPECT_NE(CarControlModel::getConfigurationHash(json(1)), CarControlModel::getConfigurationHash(json("1")));
+}
+
+TEST_F(CarControlModelTest, InvalidConfigurationFails) {
+    json configuration = json::parse(CONFIGURATION);
+
+    json invalid = configuration;
+    invalid["endpoints"][0].erase("endpointResources");
+    EXPECT_EQ(CarControlModel::create(invalid, nullptr, INTERNAL_ENDPOINT_ID), nullptr);
+
+    invalid = configuration;
+    invalid["endpoints"][0]["capabilities"][0]["interface"] = "Alexa.Unsupported";
+    EXPECT_EQ(CarControlModel::create(invalid, nullptr, INTERNAL_ENDPOINT_ID), nullptr);
+
+    invalid = configuration;
+    invalid["endpoints"][1]["capabilities"][0]["configuration"]["supportedModes"] = json::array();
+    EXPECT_EQ(CarControlModel::create(invalid, nullptr, INTERNAL_ENDPOINT_ID), nullptr);
+
+    invalid = configuration;
+    invalid["endpoints"][1]["capabilities"][1]["capabilityResources"]["friendlyNames"][0]["@type"] = "text";
+    EXPECT_EQ(CarControlModel::create(invalid, nullptr, INTERNAL_ENDPOINT_ID), nullptr);
+
+    invalid = configuration;
+    invalid["endpoints"][0]["capabilities"][1]["semantics"]["actionMappings"][0]["actions"] = json::array();
+    EXPECT_EQ(CarControlModel::create(invalid, nullptr, INTERNAL_ENDPOINT_ID), nullptr);
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/CarControl/CarControlStateStore.h>
+
+using namespace aace::engine::carControl;
+
+/// The change report delay used by the tests.
+static const std::chrono::milliseconds CHANGE_REPORT_DELAY(200);
+
+/// The time to wait for a change notification.
+static const std::chrono::seconds NOTIFICATION_TIMEOUT(2);
+
+/**
+ * Observer recording the change notifications of one controller into a log shared by all observers.
+ */
+class TestStateObserver : public CarControlStateObserverInterface {
+public:
+    struct Notification {
+        std::string name;
+        CarControlState state;
+        bool alexaInteraction;
+    };
+
+    struct Log {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<Notification> notifications;
+
+        bool waitForNotifications(size_t count) {
+            std::unique_lock<std::mutex> lock(mutex);
+            return cv.wait_for(lock, NOTIFICATION_TIMEOUT, [this, count] { return notifications.size() >= count; });
+        }
+
+        std::vector<Notification> getNotifications() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return notifications;
+        }
+    };
+
+    TestStateObserver(const std::string& name, std::shared_ptr<Log> log) : m_name(name), m_log(log) {
+    }
+
+    void onStateChanged(const CarControlState& state, bool alexaInteraction) override {
+        {
+            std::lock_guard<std::mutex> lock(m_log->mutex);
+            m_log->notifications.push_back({m_name, state, alexaInteraction});
+        }
+        m_log->cv.notify_all();
+    }
+
+private:
+    std::string m_name;
+    std::shared_ptr<Log> m_log;
+};
+
+/// Test harness for @c CarControlStateStore class
+class CarControlStateStoreTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_store = CarControlStateStore::create(CHANGE_REPORT_DELAY);
+        ASSERT_NE(m_store, nullptr);
+        m_log = std::make_shared<TestStateObserver::Log>();
+    }
+
+    void TearDown() override {
+        if (m_store != nullptr) {
+            m_store->shutdown();
+        }
+    }
+
+    /// Adds an observer of the @c endpointId controller named after the endpoint.
+    void observe(const std::string& endpointId, const std::string& instance = "") {
+        auto observer = std::make_shared<TestStateObserver>(endpointId, m_log);
+        m_observers.push_back(observer);
+        m_store->addObserver(endpointId, instance, observer);
+    }
+
+    static CarControlState powerState(bool isOn) {
+        CarControlState state;
+        state.isOn = isOn;
+        return state;
+    }
+
+    static CarControlState rangeState(double value) {
+        CarControlState state;
+        state.rangeValue = value;
+        return state;
+    }
+
+protected:
+    std::shared_ptr<CarControlStateStore> m_store;
+    std::shared_ptr<TestStateObserver::Log> m_log;
+    std::vector<std::shared_ptr<TestStateObserver>> m_observers;
+};
+
+TEST_F(CarControlStateStoreTest, CreateWithNegativeDelayFails) {
+    EXPECT_EQ(CarControlStateStore::create(std::chrono::milliseconds(-1)), nullptr);
+}
+
+TEST_F(CarControlStateStoreTest, StateIsCachedAndVersioned) {
+    CarControlState state;
+    EXPECT_FALSE(m_store->getState("fan", "speed", state));
+
+    EXPECT_TRUE(m_store->updateState("fan", "speed", rangeState(2)));
+    ASSERT_TRUE(m_store->getState("fan", "speed", state));
+    EXPECT_EQ(state.rangeValue, 2);
+    auto version = state.version;
+
+    // an unchanged state is not a change
+    EXPECT_FALSE(m_store->updateState("fan", "speed", rangeState(2)));
+    EXPECT_TRUE(m_store->updateState("fan", "speed", rangeState(3)));
+    ASSERT_TRUE(m_store->getState("fan", "speed", state));
+    EXPECT_GT(state.version, version);
+
+    // a state read from the platform does not overwrite a reported state
+    m_store->cacheState("fan", "speed", rangeState(5));
+    ASSERT_TRUE(m_store->getState("fan", "speed", state));
+    EXPECT_EQ(state.rangeValue, 3);
+
+    m_store->invalidateState("fan", "speed");
+    EXPECT_FALSE(m_store->getState("fan", "speed", state));
+    m_store->cacheState("fan", "speed", rangeState(5));
+    ASSERT_TRUE(m_store->getState("fan", "speed", state));
+    EXPECT_EQ(state.rangeValue, 5);
+}
+
+TEST_F(CarControlStateStoreTest, ChangesToTheSameControllerAreCoalesced) {
+    observe("fan", "speed");
+
+    m_store->updateState("fan", "speed", rangeState(1));
+    m_store->updateState("fan", "speed", rangeState(2));
+    m_store->updateState("fan", "speed", rangeState(3));
+
+    ASSERT_TRUE(m_log->waitForNotifications(1));
+    std::this_thread::sleep_for(CHANGE_REPORT_DELAY * 2);
+    auto notifications = m_log->getNotifications();
+    ASSERT_EQ(notifications.size(), 1u);
+    EXPECT_EQ(notifications[0].state.rangeValue, 3);
+    EXPECT_FALSE(notifications[0].alexaInteraction);
+}
+
+TEST_F(CarControlStateStoreTest, ChangesAreDeliveredInTheOrderOfTheFirstChange) {
+    observe("driverSeat");
+    observe("passengerSeat");
+    observe("rearSeat");
+
+    m_store->updateState("passengerSeat", "", powerState(true));
+    m_store->updateState("rearSeat", "", powerState(true));
+    m_store->updateState("driverSeat", "", powerState(true));
+    m_store->updateState("passengerSeat", "", powerState(false));
+
+    ASSERT_TRUE(m_log->waitForNotifications(3));
+    auto notifications = m_log->getNotifications();
+    ASSERT_EQ(notifications.size(), 3u);
+    EXPECT_EQ(notifications[0].name, "passengerSeat");
+    EXPECT_FALSE(notifications[0].state.isOn);
+    EXPECT_EQ(notifications[1].name, "rearSeat");
+    EXPECT_EQ(notifications[2].name, "driverSeat");
+}
+
+TEST_F(CarControlStateStoreTest, ChangesDuringAnAlexaInteractionAreAttributedToAlexa) {
+    observe("driverSeat");
+    observe("passengerSeat");
+
+    m_store->beginAlexaInteraction("driverSeat", "");
+    m_store->updateState("driverSeat", "", powerState(true));
+    m_store->endAlexaInteraction("driverSeat", "");
+    m_store->updateState("passengerSeat", "", powerState(true));
+
+    ASSERT_TRUE(m_log->waitForNotifications(2));
+    auto notifications = m_log->getNotifications();
+    ASSERT_EQ(notifications.size(), 2u);
+    EXPECT_TRUE(notifications[0].alexaInteraction);
+    EXPECT_FALSE(notifications[1].alexaInteraction);
+
+    m_store->updateState("driverSeat", "", powerState(false));
+    ASSERT_TRUE(m_log->waitForNotifications(3));
+    EXPECT_FALSE(m_log->getNotifications()[2].alexaInteraction);
+}
+
+TEST_F(CarControlStateStoreTest, ShutdownDropsPendingChangesWithoutWaitingForTheDelay) {
+    auto store = CarControlStateStore::create(std::chrono::seconds(10));
+    ASSERT_NE(store, nullptr);
+    auto observer = std::make_shared<TestStateObserver>("fan", m_log);
+    store->addObserver("fan", "", observer);
+
+    store->updateState("fan", "", powerState(true));
+    auto start = std::chrono::steady_clock::now();
+    store->shutdown();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+
+    // changes after shutdown are cached but not notified
+    EXPECT_TRUE(store->updateState("fan", "", powerState(false)));
+    CarControlState state;
+    ASSERT_TRUE(store->getState("fan", "", state));
+    EXPECT_FALSE(state.isOn);
+    std::this_thread::sleep_for(CHANGE_REPORT_DELAY);
+    EXPECT_TRUE(m_log->getNotifications().empty());
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <AACE/Engine/CarControl/EndpointRegistrationTracker.h>
+
+using namespace aace::engine::carControl;
+
+using RegistrationResult = EndpointRegistrationTracker::RegistrationResult;
+
+class EndpointRegistrationTrackerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_tracker = EndpointRegistrationTracker::create({"light", "fan", "heater"}, std::chrono::steady_clock::now());
+        ASSERT_NE(m_tracker, nullptr);
+    }
+
+    void report(const std::string& endpointId, RegistrationResult result) {
+        m_tracker->onEndpointRegistration(endpointId, m_attributes, result);
+    }
+
+protected:
+    std::shared_ptr<EndpointRegistrationTracker> m_tracker;
+    alexaClientSDK::avsCommon::avs::AVSDiscoveryEndpointAttributes m_attributes;
+};
+
+TEST_F(EndpointRegistrationTrackerTest, CompletesWhenEveryEndpointIsReported) {
+    report("light", RegistrationResult::SUCCEEDED);
+    report("fan", RegistrationResult::SUCCEEDED);
+    EXPECT_FALSE(m_tracker->isComplete());
+
+    report("heater", RegistrationResult::SUCCEEDED);
+    EXPECT_TRUE(m_tracker->isComplete());
+    EXPECT_EQ(m_tracker->getFailedCount(), 0u);
+}
+
+TEST_F(EndpointRegistrationTrackerTest, CountsFailedAndRejectedRegistrations) {
+    report("light", RegistrationResult::SUCCEEDED);
+    report("fan", RegistrationResult::CONFIGURATION_ERROR);
+    m_tracker->onRegistrationRejected("heater");
+
+    EXPECT_TRUE(m_tracker->isComplete());
+    EXPECT_EQ(m_tracker->getFailedCount(), 2u);
+}
+
+TEST_F(EndpointRegistrationTrackerTest, IgnoresUntrackedAndRepeatedReports) {
+    report("radio", RegistrationResult::SUCCEEDED);
+    report("light", RegistrationResult::SUCCEEDED);
+    report("light", RegistrationResult::INTERNAL_ERROR);
+    m_tracker->onRegistrationRejected("light");
+    EXPECT_FALSE(m_tracker->isComplete());
+    EXPECT_EQ(m_tracker->getFailedCount(), 0u);
+
+    report("fan", RegistrationResult::SUCCEEDED);
+    report("heater", RegistrationResult::SUCCEEDED);
+    EXPECT_TRUE(m_tracker->isComplete());
+}
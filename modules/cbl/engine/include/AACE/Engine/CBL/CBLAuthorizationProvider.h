@@ -25,13 +25,13 @@
 #include <atomic>
 
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
 #include <AACE/Engine/Authorization/AuthorizationProvider.h>
 #include <AACE/Engine/Alexa/AuthorizationAdapterInterface.h>
 #include <AACE/Engine/Alexa/AuthorizationManagerInterface.h>
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Network/NetworkInfoObserver.h>
 #include <AACE/Engine/Network/NetworkObservableInterface.h>
@@ -70,7 +70,8 @@ private:
      */
     bool initialize(
         std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
-        std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver);
+        std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 public:
     static std::shared_ptr<CBLAuthorizationProvider> create(
@@ -81,7 +82,8 @@ public:
         std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
         bool enableUserProfile = false,
-        std::shared_ptr<CBLLegacyEventNotificationInterface> legacyEventNotifier = nullptr);
+        std::shared_ptr<CBLLegacyEventNotificationInterface> legacyEventNotifier = nullptr,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient = nullptr);
 
     /// @name AuthorizationProvider
     /// @{
@@ -229,10 +231,13 @@ private:
     std::mutex m_mutex;
 
     /// This is the worker thread for the @c CBLAuthorizationProvider.
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"CBLAuthorizationProvider"};
 
     /// Reference to the @c NetworkObservableInterface to register the observer
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> m_networkObserver;
+
+    /// The HTTP client used for the LWA requests.
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> m_httpClient;
 };
 
 }  // namespace cbl
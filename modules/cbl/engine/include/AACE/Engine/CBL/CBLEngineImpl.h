@@ -27,6 +27,7 @@
 #include <AACE/CBL/CBL.h>
 #include <AACE/CBL/CBLEngineInterface.h>
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
 #include <AACE/Engine/Alexa/LocaleAssetsManager.h>
 #include <AACE/Engine/Authorization/AuthorizationProviderListenerInterface.h>
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
@@ -61,7 +62,8 @@ private:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool enableUserProfile);
+        bool enableUserProfile,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 public:
     static std::shared_ptr<CBLEngineImpl> create(
@@ -74,7 +76,8 @@ public:
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
         std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-        bool enableUserProfile);
+        bool enableUserProfile,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient = nullptr);
 
     void enable();
     void disable();
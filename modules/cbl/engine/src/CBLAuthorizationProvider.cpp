@@ -14,6 +14,7 @@
  */
 
 #include <algorithm>
+#include <cctype>
 #include <functional>
 #include <iostream>
 #include <random>
@@ -33,6 +34,7 @@
 #include <AVSCommon/Utils/RetryTimer.h>
 
 #include <AACE/Alexa/AlexaProperties.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include <AACE/Engine/CBL/CBLAuthorizationProvider.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Metrics/CounterDataPointBuilder.h>
@@ -382,6 +384,45 @@ static AuthObserverInterface::Error mapHTTPCodeToError(long code) {
     return error;
 }
 
+/**
+ * Percent-encodes a string for use in an application/x-www-form-urlencoded body.
+ *
+ * @param in The string to encode.
+ * @return The encoded string.
+ */
+static std::string urlEncode(const std::string& in) {
+    static const char* HEX_DIGITS = "0123456789ABCDEF";
+    std::string out;
+    out.reserve(in.size() * 3);
+    for (unsigned char c : in) {
+        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            out.push_back(static_cast<char>(c));
+        } else {
+            out.push_back('%');
+            out.push_back(HEX_DIGITS[c >> 4]);
+            out.push_back(HEX_DIGITS[c & 0x0F]);
+        }
+    }
+    return out;
+}
+
+/**
+ * Builds an application/x-www-form-urlencoded body from key value pairs.
+ *
+ * @param data The key value pairs.
+ * @return The encoded body.
+ */
+static std::string buildFormData(const std::vector<std::pair<std::string, std::string>>& data) {
+    std::string body;
+    for (const auto& item : data) {
+        if (!body.empty()) {
+            body.append("&");
+        }
+        body.append(urlEncode(item.first)).append("=").append(urlEncode(item.second));
+    }
+    return body;
+}
+
 /**
  * Perform common parsing of an @c LWA response.
  *
@@ -435,7 +476,8 @@ std::shared_ptr<CBLAuthorizationProvider> CBLAuthorizationProvider::create(
     std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
     bool enableUserProfile,
-    std::shared_ptr<CBLLegacyEventNotificationInterface> legacyEventNotifier) {
+    std::shared_ptr<CBLLegacyEventNotificationInterface> legacyEventNotifier,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     AACE_DEBUG(LX(TAG));
     try {
         ThrowIf(service.empty(), "invalidService");
@@ -453,7 +495,7 @@ std::shared_ptr<CBLAuthorizationProvider> CBLAuthorizationProvider::create(
             legacyEventNotifier));
         ThrowIfNull(cblAuthorizationProvider, "createFailed");
 
-        ThrowIfNot(cblAuthorizationProvider->initialize(propertyManager, networkObserver), "initializeFailed");
+        ThrowIfNot(cblAuthorizationProvider->initialize(propertyManager, networkObserver, httpClient), "initializeFailed");
 
         return cblAuthorizationProvider;
     } catch (std::exception& ex) {
@@ -493,8 +535,12 @@ CBLAuthorizationProvider::CBLAuthorizationProvider(
 
 bool CBLAuthorizationProvider::initialize(
     std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
-    std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver) {
+    std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     try {
+        m_httpClient = httpClient != nullptr ? httpClient : HttpClientPool::create();
+        ThrowIfNull(m_httpClient, "nullHttpClient");
+
         auto authorizationManager_lock = m_authorizationManager.lock();
         ThrowIfNull(authorizationManager_lock, "invalidAuthorizationManagerReference");
         authorizationManager_lock->registerAuthorizationAdapter(m_service, shared_from_this());
@@ -724,12 +770,9 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthorizationPro
     const std::vector<std::pair<std::string, std::string>>& data,
     std::chrono::seconds timeout) {
     try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
+        // The shared client resets pooled handles on checkout, so curl in libcurlUtils uses the latest provided
+        // curl options while the connection to LWA is kept alive.
+        return m_httpClient->doPost(url, headerLines, buildFormData(data), timeout);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -740,12 +783,7 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthorizationPro
     const std::string& url,
     const std::vector<std::string>& headers) {
     try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, m_configuration->getRequestTimeout());
+        return m_httpClient->doGet(url, headers, m_configuration->getRequestTimeout());
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -1526,7 +1564,7 @@ void CBLAuthorizationProvider::onNetworkInfoChanged(NetworkInfoObserver::Network
 void CBLAuthorizationProvider::onNetworkInterfaceChangeStatusChanged(
     const std::string& networkInterface,
     NetworkInterfaceChangeStatus status) {
-    // No action required as we don't create and persist network connection using AVS LibCurlUtils.
+    // No action required, idle connections of the shared HTTP client are closed by the Alexa engine service.
 }
 
 void CBLAuthorizationProvider::propertyChanged(const std::string& name, const std::string& newValue) {
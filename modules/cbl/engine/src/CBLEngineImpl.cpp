@@ -50,7 +50,8 @@ std::shared_ptr<CBLEngineImpl> CBLEngineImpl::create(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool enableUserProfile) {
+    bool enableUserProfile,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     std::shared_ptr<CBLEngineImpl> cblEngineImpl = nullptr;
 
     try {
@@ -68,7 +69,8 @@ std::shared_ptr<CBLEngineImpl> CBLEngineImpl::create(
                 networkObserver,
                 propertyManager,
                 metricRecorder,
-                enableUserProfile),
+                enableUserProfile,
+                httpClient),
             "initializeCBLEngineImplFailed");
 
         // set the cbb engine interface
@@ -93,7 +95,8 @@ bool CBLEngineImpl::initialize(
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::propertyManager::PropertyManagerServiceInterface> propertyManager,
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
-    bool enableUserProfile) {
+    bool enableUserProfile,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     try {
         ThrowIfNull(authorizationManagerInterface, "invalidAuthorizationManagerInterface");
         ThrowIfNull(deviceInfo, "invalidDeviceInfo");
@@ -111,7 +114,8 @@ bool CBLEngineImpl::initialize(
             propertyManager,
             metricRecorder,
             enableUserProfile,
-            shared_from_this());
+            shared_from_this(),
+            httpClient);
         ThrowIfNull(m_cblAuthorizationProvider, "createCBLAuthorizationProviderFailed");
         m_cblAuthorizationProvider->setListener(shared_from_this());
 
@@ -119,7 +119,9 @@ bool CBLEngineService::setup() {
                 networkObserver,
                 propertyManager,
                 metricService,
-                m_enableUserProfile);
+                m_enableUserProfile,
+                nullptr,
+                getContext()->getServiceInterface<aace::engine::alexa::HttpClientInterface>("aace.alexa"));
             authorizationService->registerProvider(m_cblAuthorizationProvider, SERVICE_NAME);
         }
 
@@ -206,7 +208,8 @@ bool CBLEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::cbl::
             networkObserver,
             propertyManager,
             metricService,
-            m_enableUserProfile);
+            m_enableUserProfile,
+            getContext()->getServiceInterface<aace::engine::alexa::HttpClientInterface>("aace.alexa"));
         ThrowIfNull(m_cblEngineImpl, "createCBLEngineImplFailed");
 
         ThrowIfNot(
@@ -16,6 +16,10 @@
 #ifndef AASB_ENGINE_AUDIO_AASB_AUDIO_ENGINE_SERVICE_H
 #define AASB_ENGINE_AUDIO_AASB_AUDIO_ENGINE_SERVICE_H
 
+#include <map>
+
+#include <AACE/Audio/AudioFormat.h>
+#include <AACE/Audio/AudioInputProvider.h>
 #include <AACE/Engine/Audio/AudioEngineService.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerEngineService.h>
 #include <AACE/Engine/MessageBroker/MessageHandlerEngineService.h>
@@ -34,12 +38,18 @@ public:
 
 private:
     AASBAudioEngineService(const aace::engine::core::ServiceDescription& description);
+    bool configureAudioInputProvider(std::istream& configuration);
 
 public:
     virtual ~AASBAudioEngineService() = default;
 
 private:
     bool postRegister() override;
+    bool configureMessageInterface(const std::string& name, bool enabled, std::istream& configuration) override;
+
+private:
+    /// The native audio format of each audio input type, if it is not the Engine format.
+    std::map<aace::audio::AudioInputProvider::AudioInputType, aace::audio::AudioFormat> m_audioInputFormats;
 };
 
 }  // namespace audio
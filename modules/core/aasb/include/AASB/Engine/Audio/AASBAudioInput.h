@@ -19,6 +19,7 @@
 #include <AACE/Audio/AudioInput.h>
 #include <AACE/Audio/AudioInputProvider.h>
 #include <AACE/Core/MessageStream.h>
+#include <AACE/Engine/Audio/AudioInputConverter.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
 #include <AACE/Engine/MessageBroker/StreamManagerInterface.h>
 
@@ -36,7 +37,7 @@ public:
     using AudioInputType = aace::audio::AudioInputProvider::AudioInputType;
 
 private:
-    AASBAudioInput(const std::string& name, AudioInputType type);
+    AASBAudioInput(const std::string& name, AudioInputType type, const aace::audio::AudioFormat& audioFormat);
 
     bool initialize(
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
@@ -49,11 +50,13 @@ public:
         const std::string& name,
         AudioInputType type,
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-        std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager);
+        std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager,
+        const aace::audio::AudioFormat& audioFormat = aace::engine::audio::AudioInputConverter::getEngineFormat());
 
     // aace::audio::AudioInput
     bool startAudioInput() override;
     bool stopAudioInput() override;
+    aace::audio::AudioFormat getAudioFormat() override;
 
     // AudioServerInterface
     void handleAudioInput(const int16_t* data, const size_t size);
@@ -61,6 +64,7 @@ public:
 private:
     const std::string m_name;
     const AudioInputType m_type;
+    const aace::audio::AudioFormat m_audioFormat;
 
     bool m_expectAudio = false;
 
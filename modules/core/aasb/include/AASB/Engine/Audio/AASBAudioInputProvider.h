@@ -22,6 +22,7 @@
 
 #include "AASBAudioInput.h"
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -40,9 +41,16 @@ private:
 public:
     virtual ~AASBAudioInputProvider() = default;
 
+    /**
+     * Creates an @c AASBAudioInputProvider.
+     *
+     * @param audioFormats The native format of the audio written by the platform for each audio input type.
+     *        Types without a format use the Engine format.
+     */
     static std::shared_ptr<AASBAudioInputProvider> create(
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-        std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager);
+        std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager,
+        const std::map<AudioInputType, aace::audio::AudioFormat>& audioFormats = {});
 
     // aace::audio::AudioInputProvider
     std::shared_ptr<aace::audio::AudioInput> openChannel(const std::string& name, AudioInputType type) override;
@@ -50,6 +58,7 @@ public:
 private:
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
     std::weak_ptr<aace::engine::messageBroker::StreamManagerInterface> m_streamManager;
+    std::map<AudioInputType, aace::audio::AudioFormat> m_audioFormats;
 };
 
 }  // namespace audio
@@ -19,6 +19,8 @@
 
 #include <AACE/Engine/Core/EngineMacros.h>
 
+#include <nlohmann/json.hpp>
+
 namespace aasb {
 namespace engine {
 namespace audio {
@@ -39,6 +41,69 @@ AASBAudioEngineService::AASBAudioEngineService(const aace::engine::core::Service
             {"AudioInputProvider", "AudioOutputProvider"}) {
 }
 
+bool AASBAudioEngineService::configureMessageInterface(
+    const std::string& name,
+    bool enabled,
+    std::istream& configuration) {
+    try {
+        // call inherited configure method
+        ThrowIfNot(
+            MessageHandlerEngineService::configureMessageInterface(name, enabled, configuration),
+            "configureMessageInterfaceFailed");
+
+        // handle specific interface configuration options
+        if (enabled && name == "AudioInputProvider") {
+            ThrowIfNot(configureAudioInputProvider(configuration), "configureAudioInputProviderFailed");
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AASBAudioEngineService::configureAudioInputProvider(std::istream& configuration) {
+    try {
+        using AudioFormat = aace::audio::AudioFormat;
+        using AudioInputType = aace::audio::AudioInputProvider::AudioInputType;
+
+        auto root = nlohmann::json::parse(configuration);
+        ReturnIfNot(root.contains("audioFormats"), true);
+
+        static const std::map<std::string, AudioInputType> audioInputTypes = {
+            {"VOICE", AudioInputType::VOICE},
+            {"COMMUNICATION", AudioInputType::COMMUNICATION},
+            {"LOOPBACK", AudioInputType::LOOPBACK}};
+        static const std::map<std::string, AudioFormat::SampleFormat> sampleFormats = {
+            {"SIGNED", AudioFormat::SampleFormat::SIGNED}, {"FLOAT", AudioFormat::SampleFormat::FLOAT}};
+
+        for (auto& next : root["audioFormats"].items()) {
+            auto type = audioInputTypes.find(next.key());
+            ThrowIf(type == audioInputTypes.end(), "invalidAudioInputType");
+
+            auto& format = next.value();
+            auto sampleFormat = sampleFormats.find(format.value("sampleFormat", "SIGNED"));
+            ThrowIf(sampleFormat == sampleFormats.end(), "invalidSampleFormat");
+
+            m_audioInputFormats[type->second] = AudioFormat(
+                AudioFormat::Encoding::LPCM,
+                sampleFormat->second,
+                AudioFormat::Layout::INTERLEAVED,
+                format.value("endianness", "LITTLE") == "BIG" ? AudioFormat::Endianness::BIG
+                                                             : AudioFormat::Endianness::LITTLE,
+                format.value("sampleRate", 16000u),
+                format.value("sampleSize", sampleFormat->second == AudioFormat::SampleFormat::FLOAT ? 32u : 16u),
+                format.value("channels", 1u));
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 bool AASBAudioEngineService::postRegister() {
     try {
         auto aasbServiceInterface =
@@ -49,7 +114,9 @@ bool AASBAudioEngineService::postRegister() {
         // AudioInputProvider
         if (isInterfaceEnabled("AudioInputProvider")) {
             auto inputProvider = AASBAudioInputProvider::create(
-                aasbServiceInterface->getMessageBroker(), aasbServiceInterface->getStreamManager());
+                aasbServiceInterface->getMessageBroker(),
+                aasbServiceInterface->getStreamManager(),
+                m_audioInputFormats);
             ThrowIfNull(inputProvider, "createAASBAudioInputProviderFailed");
             getContext()->registerPlatformInterface(inputProvider);
         }
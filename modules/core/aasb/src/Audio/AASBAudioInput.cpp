@@ -29,19 +29,24 @@ namespace audio {
 // String to identify log entries originating from this file.
 static const std::string TAG("aasb.audio.AASBAudioInput");
 
-AASBAudioInput::AASBAudioInput(const std::string& name, AudioInputType type) : m_name(name), m_type(type) {
+AASBAudioInput::AASBAudioInput(
+    const std::string& name,
+    AudioInputType type,
+    const aace::audio::AudioFormat& audioFormat) :
+        m_name(name), m_type(type), m_audioFormat(audioFormat) {
 }
 
 std::shared_ptr<AASBAudioInput> AASBAudioInput::create(
     const std::string& name,
     AudioInputType type,
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-    std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager) {
+    std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager,
+    const aace::audio::AudioFormat& audioFormat) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBroker");
         ThrowIfNull(streamManager, "invalidStreamManager");
 
-        auto audioInput = std::shared_ptr<AASBAudioInput>(new AASBAudioInput(name, type));
+        auto audioInput = std::shared_ptr<AASBAudioInput>(new AASBAudioInput(name, type, audioFormat));
         ThrowIfNot(audioInput->initialize(messageBroker, streamManager), "initializeAudioInputFailed");
 
         return audioInput;
@@ -68,6 +73,10 @@ bool AASBAudioInput::initialize(
 // aace::audio::AudioInput
 //
 
+aace::audio::AudioFormat AASBAudioInput::getAudioFormat() {
+    return m_audioFormat;
+}
+
 bool AASBAudioInput::startAudioInput() {
     try {
         AACE_VERBOSE(LX(TAG));
@@ -146,7 +155,7 @@ ssize_t AASBAudioInput::AudioInputStreamHandler::read(char* data, const size_t s
 }
 
 ssize_t AASBAudioInput::AudioInputStreamHandler::write(const char* data, const size_t size) {
-    return m_audioInput->write((int16_t*)data, size / 2) * 2;
+    return m_audioInput->writeNative(data, size);
 }
 
 bool AASBAudioInput::AudioInputStreamHandler::isClosed() {
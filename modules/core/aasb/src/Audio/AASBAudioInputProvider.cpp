@@ -25,12 +25,14 @@ static const std::string TAG("aasb.audio.AASBAudioInputProvider");
 
 std::shared_ptr<AASBAudioInputProvider> AASBAudioInputProvider::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-    std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager) {
+    std::shared_ptr<aace::engine::messageBroker::StreamManagerInterface> streamManager,
+    const std::map<AudioInputType, aace::audio::AudioFormat>& audioFormats) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBroker");
         ThrowIfNull(streamManager, "invalidStreamManager");
 
         auto audioInputProvider = std::shared_ptr<AASBAudioInputProvider>(new AASBAudioInputProvider());
+        audioInputProvider->m_audioFormats = audioFormats;
         ThrowIfNot(audioInputProvider->initialize(messageBroker, streamManager), "initializeAudioInputProviderFailed");
 
         return audioInputProvider;
@@ -67,7 +69,11 @@ std::shared_ptr<aace::audio::AudioInput> AASBAudioInputProvider::openChannel(
         auto m_streamManager_lock = m_streamManager.lock();
         ThrowIfNull(m_streamManager_lock, "invalidStreamManagerReference");
 
-        auto audioInput = AASBAudioInput::create(name, type, m_messageBroker_lock, m_streamManager_lock);
+        auto it = m_audioFormats.find(type);
+        auto audioFormat =
+            it != m_audioFormats.end() ? it->second : aace::engine::audio::AudioInputConverter::getEngineFormat();
+
+        auto audioInput = AASBAudioInput::create(name, type, m_messageBroker_lock, m_streamManager_lock, audioFormat);
         ThrowIfNull(audioInput, "createAudioInputFailed");
 
         return audioInput;
@@ -0,0 +1,117 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_AUDIO_AUDIO_INPUT_CONVERTER_H
+#define AACE_ENGINE_AUDIO_AUDIO_INPUT_CONVERTER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <AACE/Audio/AudioFormat.h>
+
+namespace aace {
+namespace engine {
+namespace audio {
+
+/**
+ * Converts audio written by the platform in its native format to the format consumed by the Engine:
+ * 16-bit signed little endian LPCM at 16 kHz with a single channel. Interleaved channels are downmixed,
+ * 16-bit and 32-bit signed integer or 32-bit float samples are converted, and other sample rates are converted
+ * with a polyphase filter.
+ *
+ * @note An @c AudioInputConverter is not thread safe. It keeps the bytes of incomplete frames and the resampler
+ * history between calls to @c convert(), so it must only be used for one stream of audio at a time.
+ */
+class AudioInputConverter {
+private:
+    AudioInputConverter(
+        uint32_t sampleRate,
+        uint8_t sampleSize,
+        uint8_t channels,
+        bool isFloat,
+        bool swapBytes);
+
+public:
+    /**
+     * Creates an @c AudioInputConverter.
+     *
+     * @param inputFormat The format of the audio written by the platform.
+     * @return The converter, or @c nullptr if @c inputFormat is not supported.
+     */
+    static std::shared_ptr<AudioInputConverter> create(aace::audio::AudioFormat inputFormat);
+
+    /// Returns the format consumed by the Engine.
+    static aace::audio::AudioFormat getEngineFormat();
+
+    /// Returns @c true if audio in @c format can be passed to the Engine without conversion.
+    static bool isEngineFormat(aace::audio::AudioFormat format);
+
+    /**
+     * Converts audio in the input format to the Engine format.
+     *
+     * @param data The audio to convert.
+     * @param size The number of bytes of audio. The bytes of a trailing incomplete frame are kept for the next call.
+     * @param [out] output Receives the converted samples. Any previous contents are discarded.
+     */
+    void convert(const void* data, size_t size, std::vector<int16_t>& output);
+
+    /// Discards the kept bytes and the resampler history, for example when the platform restarts audio input.
+    void reset();
+
+private:
+    /// Decodes and downmixes @c frames complete frames, appending them to @c m_samples.
+    void decode(const uint8_t* data, size_t frames);
+
+    /// Converts the pending samples to the Engine sample rate, appending them to @c output.
+    void resample(std::vector<int16_t>& output);
+
+    void createFilter();
+
+private:
+    const uint32_t m_sampleRate;
+    const uint8_t m_sampleSize;
+    const uint8_t m_channels;
+    const bool m_isFloat;
+    const bool m_swapBytes;
+    const size_t m_frameSize;
+
+    /// Bytes of an incomplete frame carried over to the next call.
+    std::vector<uint8_t> m_partialFrame;
+
+    /// Decoded mono samples, preceded by the resampler history.
+    std::vector<float> m_samples;
+
+    /// The resampler interpolates by @c m_interpolation and decimates by @c m_decimation.
+    uint32_t m_interpolation = 1;
+    uint32_t m_decimation = 1;
+    size_t m_tapsPerPhase = 0;
+
+    /// The filter coefficients of each phase, ordered from the oldest to the newest input sample.
+    std::vector<float> m_filter;
+
+    /// The phase and the index of the newest input sample of the next output sample.
+    uint32_t m_phase = 0;
+    size_t m_position = 0;
+
+    /// Converted samples before the conversion to 16-bit integers.
+    std::vector<float> m_resampled;
+};
+
+}  // namespace audio
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_AUDIO_AUDIO_INPUT_CONVERTER_H
@@ -19,9 +19,11 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <AACE/Audio/AudioInput.h>
 #include "AudioInputChannelInterface.h"
+#include "AudioInputConverter.h"
 
 namespace aace {
 namespace engine {
@@ -31,7 +33,9 @@ class AudioInputEngineImpl
         : public aace::audio::AudioInputEngineInterface
         , public AudioInputChannelInterface {
 private:
-    AudioInputEngineImpl(std::shared_ptr<aace::audio::AudioInput> platformAudioInput);
+    AudioInputEngineImpl(
+        std::shared_ptr<aace::audio::AudioInput> platformAudioInput,
+        std::shared_ptr<AudioInputConverter> converter);
 
 public:
     static std::shared_ptr<AudioInputEngineImpl> create(std::shared_ptr<aace::audio::AudioInput> platformAudioInput);
@@ -43,6 +47,7 @@ public:
 
     // AudioInputChannelEngineInterface
     ssize_t write(const int16_t* data, const size_t size) override;
+    ssize_t writeNative(const void* data, const size_t size) override;
 
 private:
     ChannelId getNextChannelId();
@@ -51,6 +56,11 @@ private:
     std::shared_ptr<aace::audio::AudioInput> m_platformAudioInput;
     std::unordered_map<ChannelId, AudioWriteCallback> m_callbackMap;
 
+    /// Converts audio written with writeNative(), or @c nullptr if the platform writes the Engine format.
+    std::shared_ptr<AudioInputConverter> m_converter;
+    std::vector<int16_t> m_convertedSamples;
+    std::mutex m_converterMutex;
+
     ChannelId m_nextChannelId = 1;
 
     std::mutex m_mutex;          // to serialize operations of AudioInputChannelInterface
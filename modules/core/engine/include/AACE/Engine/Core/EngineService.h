@@ -27,6 +27,8 @@
 
 #include <iostream>
 
+#include <nlohmann/json.hpp>
+
 #include "AACE/Engine/Core/ServiceDescription.h"
 #include "AACE/Core/PlatformInterface.h"
 
@@ -83,6 +85,22 @@ protected:
     virtual bool initialize();
     virtual bool configure();
     virtual bool configure(std::shared_ptr<std::istream> configuration);
+
+    /**
+     * Configures the service with a read-only view of its configuration in the merged Engine
+     * configuration. The default implementation serializes the view and calls
+     * @c configure(std::shared_ptr<std::istream>); override it to read the configuration
+     * without parsing it again.
+     */
+    virtual bool configure(const nlohmann::json& configuration);
+
+    /**
+     * Returns the schema the Engine validates the configuration of the service against before
+     * any service is configured, or null if the configuration is not validated. See
+     * @c aace::engine::utils::json::validate() for the supported keywords.
+     */
+    virtual nlohmann::json getConfigurationSchema();
+
     virtual bool preRegister();
     virtual bool postRegister();
     virtual bool setup();
@@ -135,7 +153,7 @@ protected:
 
 private:
     bool handleInitializeEngineEvent(std::shared_ptr<aace::engine::core::EngineContext> context);
-    bool handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration);
+    bool handleConfigureEngineEvent(const nlohmann::json* configuration);
     bool handlePreRegisterEngineEvent();
     bool handlePostRegisterEngineEvent();
     bool handleSetupEngineEvent();
@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef AACE_ENGINE_INTROSPECTION_INTROSPECTION_ENGINE_SERVICE_H
+#define AACE_ENGINE_INTROSPECTION_INTROSPECTION_ENGINE_SERVICE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/Core/EngineService.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerEngineService.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerStats.h>
+
+namespace aace {
+namespace engine {
+namespace introspection {
+
+/**
+ * Reports the queue depth, queue wait and task runtime of every executor, and the handler latency of every message
+ * broker topic. A watchdog checks the executors periodically and reports a task that runs longer than the stall
+ * threshold, with the function that submitted it and the message it handles. The watchdog runs on its own thread
+ * rather than on a @c Timer, so a blocked timer task cannot hide a stall.
+ *
+ * The report is returned in reply to the @c Introspection.GetReport AASB message, and is written to the configured
+ * dump file when a stall is detected and when the engine shuts down.
+ */
+class IntrospectionEngineService
+        : public aace::engine::core::EngineService
+        , public std::enable_shared_from_this<IntrospectionEngineService> {
+public:
+    DESCRIBE("aace.introspection", VERSION("1.0"), DEPENDS(aace::engine::messageBroker::MessageBrokerEngineService))
+
+private:
+    IntrospectionEngineService(const aace::engine::core::ServiceDescription& description);
+
+public:
+    virtual ~IntrospectionEngineService();
+
+    /// Returns the introspection report.
+    nlohmann::json getReport();
+
+protected:
+    bool configure() override;
+    bool configure(const nlohmann::json& configuration) override;
+    nlohmann::json getConfigurationSchema() override;
+    bool setup() override;
+    bool start() override;
+    bool stop() override;
+    bool shutdown() override;
+
+private:
+    /// Checks the executors for a running task that exceeded the stall threshold, and reports it.
+    void checkForStalls();
+
+    /// Calls @c checkForStalls() every watchdog interval until @c stopWatchdog() is called.
+    void runWatchdog();
+    void stopWatchdog();
+
+    void handleGetReport(const std::string& messageId);
+    void dump(const nlohmann::json& report);
+
+    /// The time a task may run before it is reported as stalled.
+    std::chrono::milliseconds m_stallThreshold;
+
+    /// The period of the watchdog.
+    std::chrono::milliseconds m_watchdogInterval;
+
+    /// The file the report is written to, or empty to not write it.
+    std::string m_dumpPath;
+
+    std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
+    std::weak_ptr<aace::engine::messageBroker::MessageBrokerStats> m_messageBrokerStats;
+
+    std::thread m_watchdogThread;
+    std::condition_variable m_watchdogTrigger;
+    bool m_watchdogRunning;
+    std::mutex m_watchdogMutex;
+
+    /// The sequence number of the last task reported as stalled on each executor, keyed by executor id.
+    std::unordered_map<uint64_t, uint64_t> m_reportedStalls;
+
+    /// The total number of stalls and the most recent ones.
+    uint64_t m_stallCount;
+    std::deque<nlohmann::json> m_recentStalls;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace introspection
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_INTROSPECTION_INTROSPECTION_ENGINE_SERVICE_H
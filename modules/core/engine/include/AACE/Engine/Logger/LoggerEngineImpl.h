@@ -59,7 +59,7 @@ private:
     std::shared_ptr<aace::logger::Logger> m_platformLoggerInterface;
 
     // executor
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"Logger"};
 };
 
 }  // namespace logger
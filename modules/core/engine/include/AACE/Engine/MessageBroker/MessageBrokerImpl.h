@@ -23,7 +23,9 @@
 #include <queue>
 
 #include <AACE/Engine/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
 
+#include "MessageBrokerStats.h"
 #include "PublishMessage.h"
 
 namespace aace {
@@ -79,6 +81,9 @@ public:
 
     void setMessageTimeout(const std::chrono::milliseconds& value);
 
+    /// Returns the per-topic handler latency and timeout statistics.
+    std::shared_ptr<MessageBrokerStats> getStats();
+
     // MessageBrokerInterface
     void subscribe(
         const std::string& topic,
@@ -96,8 +101,8 @@ private:
     bool m_isShutdown = false;
 
     // executor for deferred asynchronous message sending
-    aace::engine::utils::threading::Executor m_incomingMessageExecutor;
-    aace::engine::utils::threading::Executor m_outgoingMessageExecutor;
+    aace::engine::utils::threading::Executor m_incomingMessageExecutor{"MessageBroker.incoming"};
+    aace::engine::utils::threading::Executor m_outgoingMessageExecutor{"MessageBroker.outgoing"};
 
     // map of subscribers
     std::unordered_map<std::string, std::vector<MessageHandler>> m_subscriberMap;
@@ -106,10 +111,15 @@ private:
     std::mutex m_pub_sub_mutex;
     std::mutex m_promise_map_access_mutex;
     std::mutex m_wait_for_sync_response_mutex;
-    std::unordered_map<std::string, std::shared_ptr<SyncPromiseType>> m_syncMessagePromiseMap;
+    // promises are keyed by the binary message id; ids that are not UUIDs fall back to the string map
+    std::unordered_map<aace::engine::utils::uuid::UUID, std::shared_ptr<SyncPromiseType>> m_syncMessagePromiseMap;
+    std::unordered_map<std::string, std::shared_ptr<SyncPromiseType>> m_syncMessagePromiseStringMap;
 
     // message time out
     std::chrono::milliseconds m_timeout = std::chrono::milliseconds(500);
+
+    // per-topic statistics
+    std::shared_ptr<MessageBrokerStats> m_stats = std::make_shared<MessageBrokerStats>();
 };
 
 }  // namespace messageBroker
@@ -0,0 +1,62 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_MESSAGE_BROKER_STATS_H
+#define AACE_ENGINE_MESSAGE_BROKER_MESSAGE_BROKER_STATS_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/Engine/Utils/Timing/LatencyHistogram.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * Per-topic statistics of the message broker: how long the subscribers of a topic take to handle a message, and how
+ * many synchronous messages of the topic timed out waiting for a reply.
+ */
+class MessageBrokerStats {
+public:
+    struct TopicStats {
+        /// The time taken by all the subscribers notified of a message.
+        aace::engine::utils::timing::LatencyHistogram handlerLatency;
+
+        /// The number of synchronous messages that were not replied to in time.
+        std::atomic<uint64_t> syncTimeouts{0};
+    };
+
+    /// Returns the statistics of a topic, creating them on first use.
+    std::shared_ptr<TopicStats> getTopicStats(const std::string& topic);
+
+    /// Returns the statistics of all the topics, ordered by topic.
+    std::map<std::string, std::shared_ptr<TopicStats>> getAllTopicStats();
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<TopicStats>> m_topicStats;
+    std::mutex m_mutex;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_MESSAGE_BROKER_STATS_H
@@ -113,7 +113,7 @@ private:
     std::unordered_map<AgentIdType, std::unique_ptr<MetricProcessor>> m_metricProcessors;
 
     /// Executor to process recorded metrics asynchronously
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"Metrics"};
 
     /// Mutex to protect @c m_metricProcessors
     std::mutex m_processorsMutex;
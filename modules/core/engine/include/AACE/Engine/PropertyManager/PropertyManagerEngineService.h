@@ -101,7 +101,7 @@ private:
     std::mutex m_listenerMutex;
     std::shared_ptr<PropertyManagerEngineImpl> m_propertyManagerEngineImpl;
 
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"PropertyManager"};
 };
 
 }  // namespace propertyManager
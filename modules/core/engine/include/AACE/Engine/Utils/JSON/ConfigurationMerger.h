@@ -0,0 +1,64 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef AACE_ENGINE_UTILS_JSON_CONFIGURATION_MERGER_H_
+#define AACE_ENGINE_UTILS_JSON_CONFIGURATION_MERGER_H_
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "AACE/Engine/Utils/JSON/JSON.h"
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace json {
+
+/**
+ * Merges configuration streams into one document while they are parsed, without building
+ * a document for each stream and copying it. Objects specified in more than one stream are
+ * merged recursively. Any other value specified more than once is a conflict; the conflict
+ * is recorded and the value skipped, so every conflict of every stream is reported.
+ */
+class ConfigurationMerger {
+public:
+    ConfigurationMerger();
+
+    /**
+     * Parses a configuration stream and merges it into the document.
+     *
+     * @return @c false if the stream is not a valid JSON object. The document is incomplete in this case.
+     */
+    bool merge(std::istream& stream);
+
+    /// Returns the JSON pointer of each value specified in more than one stream.
+    const std::vector<std::string>& getConflicts() const;
+
+    /// Returns the merged document, or null if no stream was merged.
+    const Value& getDocument() const;
+
+private:
+    Value m_document;
+    std::vector<std::string> m_conflicts;
+};
+
+}  // namespace json
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_JSON_CONFIGURATION_MERGER_H_
@@ -19,6 +19,7 @@
 #include <string>
 #include <istream>
 #include <memory>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 // rapidjson (deprecated)
@@ -41,6 +42,10 @@ std::string toString(const Value& root, bool prettyPrint = true);
 std::shared_ptr<std::stringstream> toStream(const Value& root, bool prettyPrint = true);
 bool merge(Value& into, const Value& from);
 
+// validates a value against a schema with the "type", "enum", "minimum", "maximum", "properties",
+// "required", "additionalProperties" and "items" keywords of JSON Schema, adding every violation to errors
+bool validate(const Value& value, const Value& schema, std::vector<std::string>& errors, const std::string& path = "");
+
 bool has(const Value& root, const std::string& path, Type type = Type::null);
 bool isType(const Value& value, Type type);
 
@@ -17,6 +17,7 @@
 #define AACE_ENGINE_UTILS_THREADING_EXECUTOR_H_
 
 #include <future>
+#include <string>
 #include <utility>
 
 #include "TaskThread.h"
@@ -37,6 +38,13 @@ public:
      */
     Executor();
 
+    /**
+     * Constructs an Executor with a name for the statistics of its queue.
+     *
+     * @param name The name of the executor reported with its statistics.
+     */
+    explicit Executor(const std::string& name);
+
     /**
      * Destructs an Executor.
      */
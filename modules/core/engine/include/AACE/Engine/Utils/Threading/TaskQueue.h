@@ -17,14 +17,19 @@
 #define AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_H_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <typeinfo>
 #include <utility>
 
+#include "TaskQueueStats.h"
+
 namespace aace {
 namespace engine {
 namespace utils {
@@ -40,6 +45,13 @@ public:
      */
     TaskQueue();
 
+    /**
+     * Constructs an empty TaskQueue with a name for its statistics.
+     *
+     * @param name The name of the queue reported with its statistics.
+     */
+    explicit TaskQueue(const std::string& name);
+
     /**
      * Pushes a task on the back of the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
@@ -86,9 +98,23 @@ public:
      */
     bool isShutdown();
 
+    /**
+     * Returns the statistics of the queue.
+     *
+     * @returns The statistics of the queue.
+     */
+    std::shared_ptr<TaskQueueStats> getStats();
+
 private:
+    /// A task with the time it was queued and the type name of the submitted callable.
+    struct QueuedTask {
+        std::unique_ptr<std::function<void()>> task;
+        std::chrono::steady_clock::time_point queuedTime;
+        const char* origin;
+    };
+
     /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::unique_ptr<std::function<void()>>>;
+    using Queue = std::deque<QueuedTask>;
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
@@ -114,6 +140,9 @@ private:
 
     /// A flag for whether or not the queue is expecting more tasks.
     std::atomic_bool m_shutdown;
+
+    /// The statistics of the queue.
+    std::shared_ptr<TaskQueueStats> m_stats;
 };
 
 template <typename Task, typename... Args>
@@ -203,7 +232,11 @@ auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<dec
     {
         std::lock_guard<std::mutex> queueLock{m_queueMutex};
         if (!m_shutdown) {
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), new std::function<void()>(translated_task));
+            QueuedTask queuedTask{std::unique_ptr<std::function<void()>>(new std::function<void()>(translated_task)),
+                                  std::chrono::steady_clock::now(),
+                                  typeid(Task).name()};
+            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), std::move(queuedTask));
+            m_stats->taskQueued();
         } else {
             using FutureType = decltype(task(args...));
             return std::future<FutureType>();
@@ -0,0 +1,142 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_STATS_H_
+#define AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_STATS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Utils/Timing/LatencyHistogram.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+/**
+ * Statistics of a @c TaskQueue: the number of queued tasks, the time tasks wait in the queue, the time they take to
+ * run, and the task that is running. Every statistics object is registered when it is created, so the engine can
+ * report on all executors without knowing who owns them.
+ */
+class TaskQueueStats {
+public:
+    /// Describes the task running on an executor thread.
+    struct RunningTask {
+        /// Whether a task is running.
+        bool running = false;
+
+        /// The demangled type of the submitted callable, which names the function that submitted it.
+        std::string origin;
+
+        /// A description of the work the task is doing, if the task provided one.
+        std::string detail;
+
+        /// How long the task has been running.
+        std::chrono::steady_clock::duration elapsed{0};
+
+        /// The sequence number of the task, which distinguishes consecutive tasks with the same origin.
+        uint64_t sequence = 0;
+    };
+
+    /**
+     * Creates and registers statistics for a task queue.
+     *
+     * @param name The name of the task queue, used in reports.
+     */
+    static std::shared_ptr<TaskQueueStats> create(const std::string& name);
+
+    /// Returns the statistics of all the task queues that still exist.
+    static std::vector<std::shared_ptr<TaskQueueStats>> getAll();
+
+    /**
+     * Describes the work of the task running on the calling thread, e.g. the message it handles. Does nothing if the
+     * calling thread is not an executor thread.
+     */
+    static void setCurrentTaskDetail(const std::string& detail);
+
+    /**
+     * Describes the work of the task running on the calling thread as "<name>:<detail>", without allocating once
+     * the thread has described a task of the same length.
+     */
+    static void setCurrentTaskDetail(const std::string& name, const std::string& detail);
+
+    const std::string& getName() const;
+
+    /// Returns a number that identifies the task queue among those with the same name.
+    uint64_t getId() const;
+
+    /// Called when a task is pushed to the queue.
+    void taskQueued();
+
+    /// Called when queued tasks are dropped without running.
+    void tasksDropped(size_t count);
+
+    /**
+     * Called on the executor thread when a task is taken from the queue to run.
+     *
+     * @param origin The mangled type name of the submitted callable.
+     * @param queuedTime The time the task was pushed to the queue.
+     */
+    void taskStarted(const char* origin, std::chrono::steady_clock::time_point queuedTime);
+
+    /// Called on the executor thread when the running task finished.
+    void taskFinished();
+
+    /// Returns the number of tasks waiting in the queue.
+    size_t getDepth() const;
+
+    /// Returns the largest number of tasks that waited in the queue at the same time.
+    size_t getMaxDepth() const;
+
+    /// Returns the histogram of the time from pushing a task to the queue until it starts running.
+    const aace::engine::utils::timing::LatencyHistogram& getWaitHistogram() const;
+
+    /// Returns the histogram of the time tasks take to run.
+    const aace::engine::utils::timing::LatencyHistogram& getRuntimeHistogram() const;
+
+    /// Returns the task that is running.
+    RunningTask getRunningTask() const;
+
+private:
+    TaskQueueStats(const std::string& name, uint64_t id);
+
+    std::string m_name;
+    uint64_t m_id;
+    std::atomic<size_t> m_depth;
+    std::atomic<size_t> m_maxDepth;
+    aace::engine::utils::timing::LatencyHistogram m_waitHistogram;
+    aace::engine::utils::timing::LatencyHistogram m_runtimeHistogram;
+
+    /// The running task, or @c nullptr if no task is running.
+    const char* m_runningOrigin;
+    std::string m_runningDetail;
+    std::chrono::steady_clock::time_point m_runningStartTime;
+    uint64_t m_taskSequence;
+    mutable std::mutex m_runningMutex;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_THREADING_TASK_QUEUE_STATS_H_
@@ -0,0 +1,71 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_TIMING_LATENCY_HISTOGRAM_H
+#define AACE_ENGINE_UTILS_TIMING_LATENCY_HISTOGRAM_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+/**
+ * A lock-free histogram of durations with power of two microsecond buckets. Recording a duration takes a few atomic
+ * operations, so it can be done on every task or message. Percentiles are reported as the upper bound of the bucket
+ * they fall in.
+ */
+class LatencyHistogram {
+public:
+    /// Bucket @c i counts the durations shorter than 2^i microseconds, the last bucket counts all longer durations.
+    static constexpr size_t BUCKET_COUNT = 28;
+
+    LatencyHistogram();
+
+    /// Records a duration.
+    void record(std::chrono::steady_clock::duration duration);
+
+    /// Returns the number of recorded durations.
+    uint64_t getCount() const;
+
+    /// Returns the longest recorded duration.
+    std::chrono::microseconds getMax() const;
+
+    /// Returns the average recorded duration.
+    std::chrono::microseconds getMean() const;
+
+    /**
+     * Returns an upper bound of a percentile of the recorded durations.
+     *
+     * @param percentile The percentile, between 0 and 1.
+     */
+    std::chrono::microseconds getPercentile(double percentile) const;
+
+private:
+    std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_totalMicroseconds;
+    std::atomic<uint64_t> m_maxMicroseconds;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_TIMING_LATENCY_HISTOGRAM_H
@@ -34,6 +34,9 @@ namespace timing {
 
 /**
  * A @c Timer is used to schedule a callable type to run in the future.
+ *
+ * @note Tasks of all timers are called on the shared @c TimerWheel thread, so a task must not block. A task that
+ *     may wait on a lock, I/O or another thread should hand that work to an executor.
  */
 class Timer {
 public:
@@ -17,16 +17,21 @@
 #define AACE_ENGINE_UTILS_TIMING_TIMER_DELEGATE_H
 
 #include <atomic>
-#include <condition_variable>
-#include <thread>
+#include <memory>
+#include <mutex>
 
 #include <AACE/Engine/Utils/Timing/TimerDelegateInterface.h>
+#include <AACE/Engine/Utils/Timing/TimerWheel.h>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace timing {
 
+/**
+ * A @c TimerDelegateInterface that schedules its task calls on a @c TimerWheel instead of running a thread per timer.
+ * The task is called from the wheel thread, so it should return quickly.
+ */
 class TimerDelegate : public aace::engine::utils::timing::TimerDelegateInterface {
 public:
     /// @name TimerDelegateInterface Functions
@@ -42,57 +47,61 @@ public:
     bool isActive() const override;
     /// @}
 
-    /// Constructor.
-    TimerDelegate();
+    /**
+     * Constructor.
+     *
+     * @param timerWheel The wheel to schedule task calls on, or @c nullptr to use the wheel shared by the Engine.
+     */
+    TimerDelegate(std::shared_ptr<TimerWheel> timerWheel = nullptr);
 
     /// Destructor.
     ~TimerDelegate() override;
 
 private:
-    /**
-     * Main timer loop.
-     *
-     * @param delay The non-negative time to wait before making the first @c task call.
-     * @param period The non-negative time to wait between subsequent @c task calls.
-     * @param periodType The type of period to use when making subsequent task calls.
-     * @param maxCount The desired number of times to call task.
-     * @param task A callable type representing a task.
-     */
-    void timerLoop(
-        std::chrono::nanoseconds delay,
-        std::chrono::nanoseconds period,
-        PeriodType periodType,
-        size_t maxCount,
-        std::function<void()> task);
-
-    /// Cleanup logic which waits for the thread to join if possible. @c m_callMutex must be held before calling.
-    void cleanupLocked();
+    /// Called by the wheel when the deadline expires. Calls the task and schedules the next call.
+    void fire();
 
     /// Internal logic that activates this @c TimerDelegate instance.
     bool activateLocked();
 
-    /// The condition variable used to wait for @c stop() or period timeouts.
-    std::condition_variable m_waitCondition;
+    /// The wheel that calls @c fire().
+    std::shared_ptr<TimerWheel> m_timerWheel;
 
-    /// The mutex for synchronization with the std::condition_variable.
-    mutable std::mutex m_waitMutex;
+    /// The entry scheduled on @c m_timerWheel.
+    TimerWheel::Entry m_entry;
 
     /// The mutex for synchronizing calls into TimerDelegate.
     mutable std::mutex m_callMutex;
 
+    /// The mutex for the schedule of the task, which is also read by @c fire() on the wheel thread.
+    std::mutex m_stateMutex;
+
     /// Flag which indicates that a @c Timer is active.
     std::atomic<bool> m_running;
 
-    /**
-     * Flag which requests that the active @c Timer be stopped.  @c m_waitMutex must be locked when modifying this
-     * variable.
-     */
-    bool m_stopping;
+    /// The task to call.
+    std::function<void()> m_task;
 
-    /**
-     * The thread which this runs on.
-     */
-    std::thread m_thread;
+    /// The time between task calls.
+    std::chrono::nanoseconds m_period;
+
+    /// The type of period.
+    PeriodType m_periodType;
+
+    /// The desired number of task calls.
+    size_t m_maxCount;
+
+    /// The number of task calls made since @c start().
+    size_t m_count;
+
+    /// The time of the next task call.
+    std::chrono::steady_clock::time_point m_deadline;
+
+    /// Whether the previous task call put an @c ABSOLUTE timer off schedule, so that the next call is skipped.
+    bool m_offSchedule;
+
+    /// Incremented by @c start() and @c stop(), so that @c fire() does not reschedule a task that was restarted.
+    uint64_t m_generation;
 };
 
 }  // namespace timing
@@ -0,0 +1,204 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_TIMING_TIMER_WHEEL_H
+#define AACE_ENGINE_UTILS_TIMING_TIMER_WHEEL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+/**
+ * A hierarchical timing wheel that calls scheduled tasks from a single thread. The first level of the wheel holds
+ * one slot per tick, and each higher level holds slots covering 64 slots of the level below. Scheduling and
+ * cancelling a task take constant time, and a task is called within one tick after its deadline unless the wheel
+ * thread is busy calling another task.
+ *
+ * Tasks are called one at a time, so a task must not block: while it runs, every other task due on the wheel is
+ * late. A task that may wait on a lock, I/O or another thread should hand that work to an executor.
+ */
+class TimerWheel {
+private:
+    /// A node of the doubly linked list of entries in a slot.
+    struct Link {
+        Link* prev = nullptr;
+        Link* next = nullptr;
+    };
+
+public:
+    /**
+     * A task that can be scheduled on a @c TimerWheel. The owner of an @c Entry must keep it alive, and must
+     * @c cancel() it before destroying it.
+     */
+    class Entry : private Link {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param task The task to call when the entry expires.
+         */
+        explicit Entry(std::function<void()> task);
+
+    private:
+        friend class TimerWheel;
+
+        /// The task to call when the entry expires.
+        std::function<void()> m_task;
+
+        /// The tick at which the entry expires.
+        uint64_t m_expiry = 0;
+
+        /// Whether a thread is waiting in @c cancel() for a call to the task to return.
+        bool m_cancelling = false;
+    };
+
+    /// The default duration of a tick.
+    static constexpr std::chrono::milliseconds DEFAULT_TICK = std::chrono::milliseconds(1);
+
+    /// Returns the @c TimerWheel shared by the Engine.
+    static std::shared_ptr<TimerWheel> getInstance();
+
+    /**
+     * Constructs a @c TimerWheel and starts its thread.
+     *
+     * @param tick The duration of a tick, which is the resolution of the wheel.
+     */
+    explicit TimerWheel(std::chrono::nanoseconds tick = DEFAULT_TICK);
+
+    /// Destructor. Stops the thread. Entries that are still scheduled are not called.
+    ~TimerWheel();
+
+    /**
+     * Schedules an entry to expire at a point in time, replacing its previous deadline if it is already scheduled.
+     *
+     * @param entry The entry to schedule.
+     * @param deadline The time at which to call the task of @c entry.
+     * @return @c true if the entry was scheduled, or @c false if it is being cancelled.
+     */
+    bool schedule(Entry* entry, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Cancels an entry. If the task of the entry is being called, this function waits for it to return, unless it
+     * is called from the task itself.
+     *
+     * @param entry The entry to cancel.
+     * @return @c true if the entry was scheduled, else @c false.
+     */
+    bool cancel(Entry* entry);
+
+    /// Returns the number of scheduled entries.
+    size_t size() const;
+
+private:
+    /// The number of bits of the tick that index the first level.
+    static constexpr unsigned FIRST_LEVEL_BITS = 8;
+
+    /// The number of bits of the tick that index each higher level.
+    static constexpr unsigned LEVEL_BITS = 6;
+
+    /// The number of levels.
+    static constexpr unsigned LEVEL_COUNT = 4;
+
+    static constexpr size_t FIRST_LEVEL_SIZE = size_t{1} << FIRST_LEVEL_BITS;
+    static constexpr size_t LEVEL_SIZE = size_t{1} << LEVEL_BITS;
+
+    /// The number of ticks covered by the wheel. Entries further in the future wait in the last level.
+    static constexpr uint64_t WHEEL_TICKS = uint64_t{1} << (FIRST_LEVEL_BITS + LEVEL_BITS * (LEVEL_COUNT - 1));
+
+    /// Returns the list of the first level slot or the higher level slot that holds @c tick.
+    Link* getSlot(unsigned level, uint64_t tick);
+
+    /// Links an entry into the slot for its expiry.
+    void insertLocked(Entry* entry);
+
+    /// Unlinks an entry from its list.
+    static void unlink(Link* link);
+
+    /// Appends an entry to a list.
+    static void append(Link* list, Link* link);
+
+    /// Re-inserts the entries of a higher level slot into lower levels.
+    void cascadeLocked(unsigned level, uint64_t tick);
+
+    /// Advances the wheel to @c tick, moving expired entries to @c m_expired.
+    void advanceLocked(uint64_t tick);
+
+    /// Returns the next tick at which an entry may expire or the wheel must cascade.
+    uint64_t getNextWakeTickLocked();
+
+    /// Returns the tick that contains a point in time, rounded up if @c roundUp is set.
+    uint64_t toTick(std::chrono::steady_clock::time_point time, bool roundUp) const;
+
+    /// The thread function that calls expired tasks.
+    void run();
+
+    /// The duration of a tick.
+    const std::chrono::nanoseconds m_tick;
+
+    /// The time of tick 0.
+    const std::chrono::steady_clock::time_point m_start;
+
+    /// The slots of all levels, first level first.
+    Link m_slots[FIRST_LEVEL_SIZE + LEVEL_SIZE * (LEVEL_COUNT - 1)];
+
+    /// The entries that expired and are waiting for their task to be called.
+    Link m_expired;
+
+    /// The last tick processed by the wheel.
+    uint64_t m_currentTick = 0;
+
+    /// The tick at which the wheel thread will wake up.
+    uint64_t m_nextWakeTick = UINT64_MAX;
+
+    /// The number of scheduled entries, including expired entries whose task has not been called.
+    size_t m_size = 0;
+
+    /// The entry whose task is being called.
+    Entry* m_firing = nullptr;
+
+    /// Whether an entry was scheduled before @c m_nextWakeTick.
+    bool m_wakeRequested = false;
+
+    /// Whether the wheel is shutting down.
+    bool m_shutdown = false;
+
+    /// Serializes access to the wheel.
+    mutable std::mutex m_mutex;
+
+    /// Wakes the wheel thread.
+    std::condition_variable m_wakeCondition;
+
+    /// Notified when a call to a task returns.
+    std::condition_variable m_firedCondition;
+
+    /// The thread that calls expired tasks.
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_TIMING_TIMER_WHEEL_H
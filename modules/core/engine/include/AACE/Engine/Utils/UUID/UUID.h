@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_UTILS_UUID_H_
 #define AACE_ENGINE_UTILS_UUID_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace aace {
@@ -23,6 +26,72 @@ namespace engine {
 namespace utils {
 namespace uuid {
 
+/// Number of characters in the text representation of a UUID.
+static constexpr size_t UUID_STRING_LENGTH = 36;
+
+/**
+ * A 128-bit universally unique identifier. Use this in place of the text representation for engine-internal
+ * correlation maps, where comparing and hashing two 64-bit integers is much cheaper than hashing a string.
+ */
+class UUID {
+public:
+    /// Creates the nil UUID.
+    UUID() = default;
+
+    UUID(uint64_t high, uint64_t low);
+
+    /**
+     * Generates a random variant 1, version 4 UUID. Each thread uses its own generator, so concurrent callers
+     * do not contend on a lock.
+     */
+    static UUID generate();
+
+    /**
+     * Parses the text representation of a UUID. Hexadecimal digits are accepted in upper or lower case.
+     *
+     * @param text The text representation in the format xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx.
+     * @param [out] uuid The parsed UUID.
+     * @return @c true if @c text is a valid UUID, @c false otherwise.
+     */
+    static bool parse(const std::string& text, UUID& uuid);
+
+    /**
+     * Writes the lower case text representation of the UUID.
+     *
+     * @param [out] buffer A buffer of at least @c UUID_STRING_LENGTH characters. No null terminator is written.
+     */
+    void format(char* buffer) const;
+
+    /// @return The lower case text representation of the UUID.
+    std::string toString() const;
+
+    /// @return The most significant 64 bits of the UUID.
+    uint64_t high() const {
+        return m_high;
+    }
+
+    /// @return The least significant 64 bits of the UUID.
+    uint64_t low() const {
+        return m_low;
+    }
+
+    bool operator==(const UUID& other) const {
+        return m_high == other.m_high && m_low == other.m_low;
+    }
+
+    bool operator!=(const UUID& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const UUID& other) const {
+        return m_high < other.m_high || (m_high == other.m_high && m_low < other.m_low);
+    }
+
+private:
+    uint64_t m_high = 0;
+    uint64_t m_low = 0;
+};
+
 /**
  * Generates a variant 1, version 4 universally unique identifier (UUID) consisting of 32 hexadecimal digits.
  * The UUID generated is of the format xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx where M indicates the version, and the two
@@ -41,4 +110,16 @@ bool compare(const std::string& uuid1, const std::string& uuid2);
 }  // namespace engine
 }  // namespace aace
 
+namespace std {
+
+template <>
+struct hash<aace::engine::utils::uuid::UUID> {
+    size_t operator()(const aace::engine::utils::uuid::UUID& uuid) const {
+        // the bits of a random UUID are uniformly distributed, so mixing both halves is sufficient
+        return std::hash<uint64_t>()(uuid.high() ^ (uuid.low() * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+}  // namespace std
+
 #endif  // AACE_ENGINE_UTILS_UUID_H_
@@ -0,0 +1,339 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AACE_AUDIO_CONVERTER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define AACE_AUDIO_CONVERTER_NEON
+#endif
+
+#include <AACE/Engine/Audio/AudioInputConverter.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.audio.AudioInputConverter");
+
+namespace aace {
+namespace engine {
+namespace audio {
+
+/// The sample rate consumed by the Engine.
+static const uint32_t ENGINE_SAMPLE_RATE = 16000;
+
+/// The number of filter taps per phase for each multiple of the Engine sample rate in the input sample rate.
+static const size_t TAPS_PER_RATE_MULTIPLE = 32;
+
+/// The filter cutoff relative to the Nyquist frequency of the lower of the two sample rates.
+static const double FILTER_CUTOFF = 0.9;
+
+static const double PI = 3.14159265358979323846;
+
+static bool isHostLittleEndian() {
+    const uint16_t value = 1;
+    uint8_t firstByte;
+    std::memcpy(&firstByte, &value, 1);
+    return firstByte == 1;
+}
+
+static uint32_t greatestCommonDivisor(uint32_t a, uint32_t b) {
+    while (b != 0) {
+        auto remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+template <typename T>
+static T readSample(const uint8_t* data, bool swapBytes) {
+    uint8_t bytes[sizeof(T)];
+    if (swapBytes) {
+        std::reverse_copy(data, data + sizeof(T), bytes);
+    } else {
+        std::memcpy(bytes, data, sizeof(T));
+    }
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+/// Returns the dot product of @c count samples and filter coefficients.
+static float dotProduct(const float* samples, const float* coefficients, size_t count) {
+    size_t j = 0;
+    float sum = 0;
+#if defined(AACE_AUDIO_CONVERTER_SSE2)
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    for (; j + 8 <= count; j += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(samples + j), _mm_loadu_ps(coefficients + j)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(samples + j + 4), _mm_loadu_ps(coefficients + j + 4)));
+    }
+    sum0 = _mm_add_ps(sum0, sum1);
+    sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+    sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 1));
+    sum = _mm_cvtss_f32(sum0);
+#elif defined(AACE_AUDIO_CONVERTER_NEON)
+    float32x4_t sum0 = vdupq_n_f32(0);
+    float32x4_t sum1 = vdupq_n_f32(0);
+    for (; j + 8 <= count; j += 8) {
+        sum0 = vmlaq_f32(sum0, vld1q_f32(samples + j), vld1q_f32(coefficients + j));
+        sum1 = vmlaq_f32(sum1, vld1q_f32(samples + j + 4), vld1q_f32(coefficients + j + 4));
+    }
+    sum0 = vaddq_f32(sum0, sum1);
+    float32x2_t half = vadd_f32(vget_low_f32(sum0), vget_high_f32(sum0));
+    sum = vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+    for (; j < count; j++) {
+        sum += samples[j] * coefficients[j];
+    }
+    return sum;
+}
+
+/// Rounds @c count samples to 16-bit integers with saturation, appending them to @c output.
+static void appendSaturated(const float* samples, size_t count, std::vector<int16_t>& output) {
+    auto offset = output.size();
+    output.resize(offset + count);
+    int16_t* out = output.data() + offset;
+    size_t j = 0;
+#if defined(AACE_AUDIO_CONVERTER_SSE2)
+    // clamp first: out of range conversions produce INT32_MIN, which would saturate to the wrong end
+    const __m128 minimum = _mm_set1_ps(-32768.0f);
+    const __m128 maximum = _mm_set1_ps(32767.0f);
+    for (; j + 8 <= count; j += 8) {
+        __m128 low = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + j), minimum), maximum);
+        __m128 high = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + j + 4), minimum), maximum);
+        __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), packed);
+    }
+#elif defined(AACE_AUDIO_CONVERTER_NEON)
+    for (; j + 8 <= count; j += 8) {
+#if defined(__aarch64__)
+        int32x4_t low = vcvtnq_s32_f32(vld1q_f32(samples + j));
+        int32x4_t high = vcvtnq_s32_f32(vld1q_f32(samples + j + 4));
+#else
+        int32x4_t low = vcvtq_s32_f32(vld1q_f32(samples + j));
+        int32x4_t high = vcvtq_s32_f32(vld1q_f32(samples + j + 4));
+#endif
+        vst1q_s16(out + j, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+    }
+#endif
+    for (; j < count; j++) {
+        float sample = std::round(samples[j]);
+        out[j] = static_cast<int16_t>(std::min(32767.0f, std::max(-32768.0f, sample)));
+    }
+}
+
+AudioInputConverter::AudioInputConverter(
+    uint32_t sampleRate,
+    uint8_t sampleSize,
+    uint8_t channels,
+    bool isFloat,
+    bool swapBytes) :
+        m_sampleRate(sampleRate),
+        m_sampleSize(sampleSize),
+        m_channels(channels),
+        m_isFloat(isFloat),
+        m_swapBytes(swapBytes),
+        m_frameSize(channels * sampleSize / 8) {
+}
+
+std::shared_ptr<AudioInputConverter> AudioInputConverter::create(aace::audio::AudioFormat inputFormat) {
+    try {
+        using AudioFormat = aace::audio::AudioFormat;
+
+        auto encoding = inputFormat.getEncoding();
+        auto sampleFormat = inputFormat.getSampleFormat();
+        auto sampleSize = inputFormat.getSampleSize();
+        auto channels = inputFormat.getNumChannels();
+        auto sampleRate = inputFormat.getSampleRate();
+
+        ThrowIfNot(encoding == AudioFormat::Encoding::LPCM, "unsupportedEncoding");
+        ThrowIfNot(
+            (sampleFormat == AudioFormat::SampleFormat::SIGNED && (sampleSize == 16 || sampleSize == 32)) ||
+                (sampleFormat == AudioFormat::SampleFormat::FLOAT && sampleSize == 32),
+            "unsupportedSampleFormat");
+        ThrowIf(channels == 0, "invalidChannels");
+        ThrowIf(
+            channels > 1 && inputFormat.getLayout() == AudioFormat::Layout::NON_INTERLEAVED,
+            "unsupportedNonInterleavedLayout");
+        ThrowIf(sampleRate == 0, "invalidSampleRate");
+
+        // audio with an unknown byte order is assumed to be little endian
+        bool swapBytes = (inputFormat.getEndianness() == AudioFormat::Endianness::BIG) == isHostLittleEndian();
+
+        auto converter = std::shared_ptr<AudioInputConverter>(new AudioInputConverter(
+            sampleRate, sampleSize, channels, sampleFormat == AudioFormat::SampleFormat::FLOAT, swapBytes));
+        converter->createFilter();
+        converter->reset();
+
+        AACE_INFO(LX(TAG)
+                      .d("sampleFormat", sampleFormat)
+                      .d("sampleSize", static_cast<int>(sampleSize))
+                      .d("channels", static_cast<int>(channels))
+                      .d("sampleRate", sampleRate)
+                      .d("tapsPerPhase", converter->m_tapsPerPhase));
+
+        return converter;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+aace::audio::AudioFormat AudioInputConverter::getEngineFormat() {
+    return aace::audio::AudioFormat(
+        aace::audio::AudioFormat::Encoding::LPCM,
+        aace::audio::AudioFormat::SampleFormat::SIGNED,
+        aace::audio::AudioFormat::Layout::INTERLEAVED,
+        aace::audio::AudioFormat::Endianness::LITTLE,
+        ENGINE_SAMPLE_RATE,
+        16,
+        1);
+}
+
+bool AudioInputConverter::isEngineFormat(aace::audio::AudioFormat format) {
+    return format.getEncoding() == aace::audio::AudioFormat::Encoding::LPCM &&
+           format.getSampleFormat() == aace::audio::AudioFormat::SampleFormat::SIGNED &&
+           format.getEndianness() != aace::audio::AudioFormat::Endianness::BIG && format.getSampleSize() == 16 &&
+           format.getNumChannels() == 1 && format.getSampleRate() == ENGINE_SAMPLE_RATE;
+}
+
+void AudioInputConverter::createFilter() {
+    auto divisor = greatestCommonDivisor(m_sampleRate, ENGINE_SAMPLE_RATE);
+    m_interpolation = ENGINE_SAMPLE_RATE / divisor;
+    m_decimation = m_sampleRate / divisor;
+    if (m_interpolation == 1 && m_decimation == 1) {
+        m_tapsPerPhase = 1;
+        m_filter.assign(1, 1.0f);
+        return;
+    }
+
+    auto rateMultiple = (m_sampleRate + ENGINE_SAMPLE_RATE - 1) / ENGINE_SAMPLE_RATE;
+    m_tapsPerPhase = TAPS_PER_RATE_MULTIPLE * std::max<uint32_t>(1, rateMultiple);
+
+    // windowed sinc prototype at the interpolated rate, cut off below the lower of the two Nyquist frequencies
+    size_t length = m_tapsPerPhase * m_interpolation;
+    double cutoff = FILTER_CUTOFF * 0.5 / std::max(m_interpolation, m_decimation);
+    double center = (length - 1) / 2.0;
+    std::vector<double> prototype(length);
+    double sum = 0;
+    for (size_t n = 0; n < length; n++) {
+        double t = n - center;
+        double sinc = t == 0 ? 2 * cutoff : std::sin(2 * PI * cutoff * t) / (PI * t);
+        double window = 0.42 - 0.5 * std::cos(2 * PI * n / (length - 1)) + 0.08 * std::cos(4 * PI * n / (length - 1));
+        prototype[n] = sinc * window;
+        sum += prototype[n];
+    }
+
+    // each phase uses every m_interpolation'th coefficient, so normalize the phases to unity gain
+    m_filter.resize(length);
+    for (uint32_t phase = 0; phase < m_interpolation; phase++) {
+        for (size_t j = 0; j < m_tapsPerPhase; j++) {
+            auto k = m_tapsPerPhase - 1 - j;
+            m_filter[phase * m_tapsPerPhase + j] = static_cast<float>(prototype[phase + k * m_interpolation] *
+                                                                      m_interpolation / sum);
+        }
+    }
+}
+
+void AudioInputConverter::reset() {
+    m_partialFrame.clear();
+    m_samples.assign(m_tapsPerPhase - 1, 0.0f);
+    m_phase = 0;
+    m_position = m_tapsPerPhase - 1;
+}
+
+void AudioInputConverter::convert(const void* data, size_t size, std::vector<int16_t>& output) {
+    output.clear();
+    auto bytes = static_cast<const uint8_t*>(data);
+
+    // complete a frame left over from the previous call
+    if (!m_partialFrame.empty()) {
+        auto needed = std::min(m_frameSize - m_partialFrame.size(), size);
+        m_partialFrame.insert(m_partialFrame.end(), bytes, bytes + needed);
+        bytes += needed;
+        size -= needed;
+        if (m_partialFrame.size() < m_frameSize) {
+            return;
+        }
+        decode(m_partialFrame.data(), 1);
+        m_partialFrame.clear();
+    }
+
+    auto frames = size / m_frameSize;
+    decode(bytes, frames);
+    m_partialFrame.assign(bytes + frames * m_frameSize, bytes + size);
+
+    resample(output);
+}
+
+void AudioInputConverter::decode(const uint8_t* data, size_t frames) {
+    auto offset = m_samples.size();
+    m_samples.resize(offset + frames);
+    float* out = m_samples.data() + offset;
+    const size_t bytesPerSample = m_sampleSize / 8;
+    const float gain = 1.0f / m_channels;
+
+    for (size_t frame = 0; frame < frames; frame++) {
+        const uint8_t* in = data + frame * m_frameSize;
+        float sum = 0;
+        for (size_t channel = 0; channel < m_channels; channel++, in += bytesPerSample) {
+            if (m_isFloat) {
+                sum += readSample<float>(in, m_swapBytes) * 32768.0f;
+            } else if (m_sampleSize == 16) {
+                sum += readSample<int16_t>(in, m_swapBytes);
+            } else {
+                sum += readSample<int32_t>(in, m_swapBytes) * (1.0f / 65536.0f);
+            }
+        }
+        out[frame] = sum * gain;
+    }
+}
+
+void AudioInputConverter::resample(std::vector<int16_t>& output) {
+    m_resampled.clear();
+    if (m_interpolation == 1 && m_decimation == 1) {
+        appendSaturated(m_samples.data(), m_samples.size(), output);
+        m_samples.clear();
+        return;
+    }
+
+    const size_t history = m_tapsPerPhase - 1;
+    while (m_position < m_samples.size()) {
+        const float* samples = m_samples.data() + m_position - history;
+        const float* coefficients = m_filter.data() + m_phase * m_tapsPerPhase;
+        m_resampled.push_back(dotProduct(samples, coefficients, m_tapsPerPhase));
+
+        m_phase += m_decimation;
+        m_position += m_phase / m_interpolation;
+        m_phase %= m_interpolation;
+    }
+    appendSaturated(m_resampled.data(), m_resampled.size(), output);
+
+    // keep the samples needed by the next output sample
+    auto consumed = std::min(m_position - history, m_samples.size());
+    m_samples.erase(m_samples.begin(), m_samples.begin() + consumed);
+    m_position -= consumed;
+}
+
+}  // namespace audio
+}  // namespace engine
+}  // namespace aace
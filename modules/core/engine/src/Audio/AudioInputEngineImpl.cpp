@@ -23,8 +23,10 @@ namespace aace {
 namespace engine {
 namespace audio {
 
-AudioInputEngineImpl::AudioInputEngineImpl(std::shared_ptr<aace::audio::AudioInput> platformAudioInput) :
-        m_platformAudioInput(platformAudioInput) {
+AudioInputEngineImpl::AudioInputEngineImpl(
+    std::shared_ptr<aace::audio::AudioInput> platformAudioInput,
+    std::shared_ptr<AudioInputConverter> converter) :
+        m_platformAudioInput(platformAudioInput), m_converter(converter) {
 }
 
 std::shared_ptr<AudioInputEngineImpl> AudioInputEngineImpl::create(
@@ -32,7 +34,16 @@ std::shared_ptr<AudioInputEngineImpl> AudioInputEngineImpl::create(
     try {
         ThrowIfNull(platformAudioInput, "invalidAudioInputPlatformInterface");
 
-        auto audioInputEngineImpl = std::shared_ptr<AudioInputEngineImpl>(new AudioInputEngineImpl(platformAudioInput));
+        // create a conversion stage if the platform writes audio in another format
+        std::shared_ptr<AudioInputConverter> converter;
+        auto audioFormat = platformAudioInput->getAudioFormat();
+        if (!AudioInputConverter::isEngineFormat(audioFormat)) {
+            converter = AudioInputConverter::create(audioFormat);
+            ThrowIfNull(converter, "unsupportedAudioFormat");
+        }
+
+        auto audioInputEngineImpl =
+            std::shared_ptr<AudioInputEngineImpl>(new AudioInputEngineImpl(platformAudioInput, converter));
 
         // set the platform engine interface reference
         platformAudioInput->setEngineInterface(audioInputEngineImpl);
@@ -56,6 +67,12 @@ AudioInputChannelInterface::ChannelId AudioInputEngineImpl::start(AudioWriteCall
 
         // call the platform startAudioInput() if there are no observers
         if (m_callbackMap.empty()) {
+            // discard partial frames and resampler history from the previous audio input
+            if (m_converter != nullptr) {
+                std::lock_guard<std::mutex> converterLock(m_converterMutex);
+                m_converter->reset();
+            }
+
             // Release the lock temporarily so that audio data callback can acquire it and prevent deadlock
             callbackLock.unlock();
             ThrowIfNot(m_platformAudioInput->startAudioInput(), "startPlatformAudioInputFailed");
@@ -130,6 +147,28 @@ ssize_t AudioInputEngineImpl::write(const int16_t* data, const size_t size) {
     }
 }
 
+ssize_t AudioInputEngineImpl::writeNative(const void* data, const size_t size) {
+    try {
+        ThrowIfNull(data, "invalidData");
+
+        if (m_converter == nullptr) {
+            auto samples = write(static_cast<const int16_t*>(data), size / sizeof(int16_t));
+            return samples > 0 ? samples * static_cast<ssize_t>(sizeof(int16_t)) : samples;
+        }
+
+        std::lock_guard<std::mutex> converterLock(m_converterMutex);
+        m_converter->convert(data, size, m_convertedSamples);
+        if (!m_convertedSamples.empty()) {
+            write(m_convertedSamples.data(), m_convertedSamples.size());
+        }
+
+        return size;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "writeNative").d("reason", ex.what()));
+        return 0;
+    }
+}
+
 }  // namespace audio
 }  // namespace engine
 }  // namespace aace
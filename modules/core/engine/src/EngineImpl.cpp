@@ -28,6 +28,7 @@
 #include "AACE/Engine/Core/EngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/Core/EngineVersion.h"
+#include "AACE/Engine/Utils/JSON/ConfigurationMerger.h"
 #include "AACE/Engine/Utils/JSON/JSON.h"
 #include "AACE/Core/CoreProperties.h"
 
@@ -273,30 +274,52 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
         ThrowIf(m_configured, "engineAlreadyConfigured");
         ThrowIf(configurationList.empty(), "invalidConfigurationList");
 
-        // create the merged configuration data
-        json::Value mergedConfiguration = {};
-
-        // iterate through configuration objects and get streams for sdk initialization and
-        // merge all configuration stream together before calling service config methods
+        // merge all configuration streams together while they are parsed, before calling service config methods
+        json::ConfigurationMerger merger;
         for (auto nextStream : configurationList) {
             ThrowIfNull(nextStream, "invalidConfigurationStream");
-
-            // parse the next configuration stream
-            auto nextConfig = json::toJson(nextStream->getStream());
-
-            // merge the document with the main configuration
-            ThrowIfNot(json::isType(nextConfig, json::Type::object), "invalidConfigurationStream");
-            ThrowIfNot(aace::engine::utils::json::merge(mergedConfiguration, nextConfig), "mergeConfigurationFailed");
+            auto stream = nextStream->getStream();
+            ThrowIfNull(stream, "invalidConfigurationStream");
+            ThrowIfNot(merger.merge(*stream), "invalidConfigurationStream");
         }
+        for (auto& next : merger.getConflicts()) {
+            AACE_ERROR(LX(TAG).m("configurationAlreadySpecified").d("path", next));
+        }
+        ThrowIfNot(merger.getConflicts().empty(), "mergeConfigurationFailed");
 
-        // iterate through registered engine services and call configure() for each module
-        if (mergedConfiguration.is_null() == false) {
+        const json::Value& mergedConfiguration = merger.getDocument();
+        if (mergedConfiguration.empty() == false) {
+            // find the configuration of each service, and validate all of them before configuring any service
+            std::vector<const json::Value*> serviceConfigList;
+            std::vector<std::string> errors;
             for (auto nextService : m_orderedServiceList) {
-                auto serviceConfig =
-                    json::get(mergedConfiguration, nextService->getDescription().getType(), json::Type::object);
+                auto type = nextService->getDescription().getType();
+                auto serviceConfig = mergedConfiguration.find(type);
+                if (serviceConfig == mergedConfiguration.end()) {
+                    serviceConfigList.push_back(nullptr);
+                    continue;
+                }
+                if (serviceConfig->is_object() == false) {
+                    AACE_ERROR(LX(TAG).m("invalidServiceConfiguration").d("service", type));
+                    serviceConfigList.push_back(nullptr);
+                    continue;
+                }
+                auto schema = nextService->getConfigurationSchema();
+                if (schema.is_null() == false) {
+                    json::validate(*serviceConfig, schema, errors, "/" + type);
+                }
+                serviceConfigList.push_back(&*serviceConfig);
+            }
+            for (auto& next : errors) {
+                AACE_ERROR(LX(TAG).m("invalidConfiguration").d("reason", next));
+            }
+            ThrowIfNot(errors.empty(), "invalidConfiguration");
+
+            // iterate through registered engine services and call configure() for each module
+            for (size_t index = 0; index < m_orderedServiceList.size(); index++) {
+                auto nextService = m_orderedServiceList[index];
                 ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(
-                        serviceConfig != nullptr ? json::toStream(serviceConfig) : nullptr),
+                    nextService->handleConfigureEngineEvent(serviceConfigList[index]),
                     "Service failed to configure: " + nextService->getDescription().getType());
             }
         } else {
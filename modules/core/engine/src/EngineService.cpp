@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <sstream>
+
 #include "AACE/Engine/Core/EngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
@@ -62,10 +64,10 @@ bool EngineService::handleInitializeEngineEvent(std::shared_ptr<aace::engine::co
     }
 }
 
-bool EngineService::handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration) {
+bool EngineService::handleConfigureEngineEvent(const nlohmann::json* configuration) {
     try {
         ThrowIfNot(m_initialized, "serviceNotInitialized");
-        ThrowIfNot(configuration != nullptr ? configure(configuration) : configure(), "configureServiceFailed");
+        ThrowIfNot(configuration != nullptr ? configure(*configuration) : configure(), "configureServiceFailed");
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "handleConfigureEngineEvent").d("reason", ex.what()));
@@ -220,6 +222,14 @@ bool EngineService::configure(std::shared_ptr<std::istream> configuration) {
     return true;
 }
 
+bool EngineService::configure(const nlohmann::json& configuration) {
+    return configure(std::make_shared<std::stringstream>(configuration.dump()));
+}
+
+nlohmann::json EngineService::getConfigurationSchema() {
+    return nullptr;
+}
+
 bool EngineService::preRegister() {
     return true;
 }
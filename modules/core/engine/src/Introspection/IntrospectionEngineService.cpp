@@ -0,0 +1,293 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <cstdio>
+#include <fstream>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Introspection/IntrospectionEngineService.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerServiceInterface.h>
+#include <AACE/Engine/Utils/Threading/TaskQueueStats.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+namespace aace {
+namespace engine {
+namespace introspection {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.introspection.IntrospectionEngineService");
+
+// register the service
+REGISTER_SERVICE(IntrospectionEngineService);
+
+// aliases
+using Message = aace::engine::messageBroker::Message;
+using LatencyHistogram = aace::engine::utils::timing::LatencyHistogram;
+using TaskQueueStats = aace::engine::utils::threading::TaskQueueStats;
+/// The AASB topic and action of the report request.
+static const std::string INTROSPECTION_TOPIC = "Introspection";
+static const std::string GET_REPORT_ACTION = "GetReport";
+
+/// Default configuration values.
+static const std::chrono::milliseconds DEFAULT_STALL_THRESHOLD = std::chrono::milliseconds(5000);
+static const std::chrono::milliseconds DEFAULT_WATCHDOG_INTERVAL = std::chrono::milliseconds(1000);
+
+/// The number of stalls kept in the report.
+static constexpr size_t MAX_RECENT_STALLS = 16;
+
+static nlohmann::json histogramToJson(const LatencyHistogram& histogram) {
+    return {{"count", histogram.getCount()},
+            {"meanUs", histogram.getMean().count()},
+            {"p50Us", histogram.getPercentile(0.5).count()},
+            {"p99Us", histogram.getPercentile(0.99).count()},
+            {"maxUs", histogram.getMax().count()}};
+}
+
+static int64_t toMilliseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
+IntrospectionEngineService::IntrospectionEngineService(const aace::engine::core::ServiceDescription& description) :
+        aace::engine::core::EngineService(description),
+        m_stallThreshold(DEFAULT_STALL_THRESHOLD),
+        m_watchdogInterval(DEFAULT_WATCHDOG_INTERVAL),
+        m_watchdogRunning(false),
+        m_stallCount(0) {
+}
+
+IntrospectionEngineService::~IntrospectionEngineService() {
+    stopWatchdog();
+}
+
+bool IntrospectionEngineService::configure() {
+    return true;
+}
+
+bool IntrospectionEngineService::configure(const nlohmann::json& configuration) {
+    try {
+        if (configuration.contains("stallThresholdMs")) {
+            m_stallThreshold = std::chrono::milliseconds(configuration.at("stallThresholdMs").get<uint32_t>());
+        }
+        if (configuration.contains("watchdogIntervalMs")) {
+            m_watchdogInterval = std::chrono::milliseconds(configuration.at("watchdogIntervalMs").get<uint32_t>());
+        }
+        if (configuration.contains("dumpPath")) {
+            m_dumpPath = configuration.at("dumpPath").get<std::string>();
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+nlohmann::json IntrospectionEngineService::getConfigurationSchema() {
+    return {{"type", "object"},
+            {"properties",
+             {{"stallThresholdMs", {{"type", "integer"}, {"minimum", 0}}},
+              {"watchdogIntervalMs", {{"type", "integer"}, {"minimum", 1}}},
+              {"dumpPath", {{"type", "string"}}}}},
+            {"additionalProperties", false}};
+}
+
+bool IntrospectionEngineService::setup() {
+    try {
+        auto messageBrokerService =
+            getContext()->getServiceInterface<aace::engine::messageBroker::MessageBrokerServiceInterface>(
+                "aace.messageBroker");
+        ThrowIfNull(messageBrokerService, "invalidMessageBrokerServiceInterface");
+
+        auto messageBroker = messageBrokerService->getMessageBroker();
+        ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
+        m_messageBroker = messageBroker;
+        m_messageBrokerStats =
+            getContext()->getServiceInterface<aace::engine::messageBroker::MessageBrokerStats>("aace.messageBroker");
+
+        std::weak_ptr<IntrospectionEngineService> wp = shared_from_this();
+        messageBroker->subscribe(INTROSPECTION_TOPIC, GET_REPORT_ACTION, [wp](const Message& message) {
+            if (auto sp = wp.lock()) {
+                sp->handleGetReport(message.messageId());
+            } else {
+                AACE_ERROR(LX(TAG, "GetReport").d("reason", "invalidWeakPtrReference"));
+            }
+        });
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool IntrospectionEngineService::start() {
+    try {
+        std::lock_guard<std::mutex> lock(m_watchdogMutex);
+        ThrowIf(m_watchdogRunning, "watchdogAlreadyRunning");
+        m_watchdogRunning = true;
+        m_watchdogThread = std::thread(&IntrospectionEngineService::runWatchdog, this);
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool IntrospectionEngineService::stop() {
+    stopWatchdog();
+    return true;
+}
+
+bool IntrospectionEngineService::shutdown() {
+    stopWatchdog();
+    if (!m_dumpPath.empty()) {
+        dump(getReport());
+    }
+    return true;
+}
+
+void IntrospectionEngineService::runWatchdog() {
+    std::unique_lock<std::mutex> lock(m_watchdogMutex);
+    while (!m_watchdogTrigger.wait_for(lock, m_watchdogInterval, [this]() { return !m_watchdogRunning; })) {
+        lock.unlock();
+        checkForStalls();
+        lock.lock();
+    }
+}
+
+void IntrospectionEngineService::stopWatchdog() {
+    {
+        std::lock_guard<std::mutex> lock(m_watchdogMutex);
+        m_watchdogRunning = false;
+    }
+    m_watchdogTrigger.notify_all();
+    if (m_watchdogThread.joinable()) {
+        m_watchdogThread.join();
+    }
+}
+
+nlohmann::json IntrospectionEngineService::getReport() {
+    auto executors = nlohmann::json::array();
+    for (auto& stats : TaskQueueStats::getAll()) {
+        nlohmann::json executor = {{"name", stats->getName()},
+                                   {"id", stats->getId()},
+                                   {"depth", stats->getDepth()},
+                                   {"maxDepth", stats->getMaxDepth()},
+                                   {"wait", histogramToJson(stats->getWaitHistogram())},
+                                   {"runtime", histogramToJson(stats->getRuntimeHistogram())}};
+        auto running = stats->getRunningTask();
+        if (running.running) {
+            executor["running"] = {
+                {"origin", running.origin}, {"detail", running.detail}, {"elapsedMs", toMilliseconds(running.elapsed)}};
+        }
+        executors.push_back(executor);
+    }
+
+    auto topics = nlohmann::json::object();
+    if (auto messageBrokerStats = m_messageBrokerStats.lock()) {
+        for (auto& next : messageBrokerStats->getAllTopicStats()) {
+            auto topic = histogramToJson(next.second->handlerLatency);
+            topic["syncTimeouts"] = next.second->syncTimeouts.load();
+            topics[next.first] = topic;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {{"executors", executors},
+            {"topics", topics},
+            {"stalls", {{"count", m_stallCount}, {"recent", nlohmann::json(m_recentStalls)}}}};
+}
+
+void IntrospectionEngineService::checkForStalls() {
+    bool stalled = false;
+    for (auto& stats : TaskQueueStats::getAll()) {
+        auto running = stats->getRunningTask();
+        if (!running.running || running.elapsed < m_stallThreshold) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& reportedSequence = m_reportedStalls[stats->getId()];
+        if (reportedSequence == running.sequence) {
+            continue;
+        }
+        reportedSequence = running.sequence;
+
+        AACE_WARN(LX(TAG)
+                      .m("executorStalled")
+                      .d("executor", stats->getName())
+                      .d("origin", running.origin)
+                      .d("detail", running.detail)
+                      .d("elapsedMs", toMilliseconds(running.elapsed))
+                      .d("depth", stats->getDepth()));
+
+        m_stallCount++;
+        m_recentStalls.push_back(
+            {{"executor", stats->getName()},
+             {"id", stats->getId()},
+             {"origin", running.origin},
+             {"detail", running.detail},
+             {"elapsedMs", toMilliseconds(running.elapsed)},
+             {"depth", stats->getDepth()}});
+        if (m_recentStalls.size() > MAX_RECENT_STALLS) {
+            m_recentStalls.pop_front();
+        }
+        stalled = true;
+    }
+
+    if (stalled && !m_dumpPath.empty()) {
+        dump(getReport());
+    }
+}
+
+void IntrospectionEngineService::handleGetReport(const std::string& messageId) {
+    try {
+        auto messageBroker = m_messageBroker.lock();
+        ThrowIfNull(messageBroker, "invalidMessageBrokerReference");
+
+        nlohmann::json reply = {{"header",
+                                 {{"id", aace::engine::utils::uuid::generateUUID()},
+                                  {"messageType", "Reply"},
+                                  {"version", "4.0"},
+                                  {"messageDescription",
+                                   {{"topic", INTROSPECTION_TOPIC},
+                                    {"action", GET_REPORT_ACTION},
+                                    {"replyToId", messageId}}}}},
+                                {"payload", {{"report", getReport().dump()}}}};
+        messageBroker->publish(reply.dump()).send();
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+    }
+}
+
+void IntrospectionEngineService::dump(const nlohmann::json& report) {
+    try {
+        // write a temporary file and rename it, so that a reader never sees a partial report
+        auto temporaryPath = m_dumpPath + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::trunc);
+            ThrowIfNot(file.is_open(), "openDumpFileFailed");
+            file << report.dump(2) << std::endl;
+            ThrowIfNot(file.good(), "writeDumpFileFailed");
+        }
+        ThrowIf(std::rename(temporaryPath.c_str(), m_dumpPath.c_str()) != 0, "renameDumpFileFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", m_dumpPath));
+    }
+}
+
+}  // namespace introspection
+}  // namespace engine
+}  // namespace aace
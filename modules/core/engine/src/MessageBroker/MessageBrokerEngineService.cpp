@@ -53,6 +53,11 @@ bool MessageBrokerEngineService::initialize() {
             registerServiceInterface<MessageBrokerServiceInterface>(shared_from_this()),
             "registerMessageBrokerServiceInterfaceFailed");
 
+        // register the message broker statistics
+        ThrowIfNot(
+            registerServiceInterface<MessageBrokerStats>(m_messageBroker->getStats()),
+            "registerMessageBrokerStatsFailed");
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -15,8 +15,7 @@
 
 #include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
-
-#include <sstream>
+#include <AACE/Engine/Utils/Threading/TaskQueueStats.h>
 
 namespace aace {
 namespace engine {
@@ -25,6 +24,9 @@ namespace messageBroker {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.messageBroker.MessageBrokerImpl");
 
+// aliases
+using UUID = aace::engine::utils::uuid::UUID;
+
 class MessageImpl;
 
 std::shared_ptr<MessageBrokerImpl> MessageBrokerImpl::create() {
@@ -45,15 +47,24 @@ void MessageBrokerImpl::setMessageTimeout(const std::chrono::milliseconds& value
     m_timeout = value;
 }
 
+std::shared_ptr<MessageBrokerStats> MessageBrokerImpl::getStats() {
+    return m_stats;
+}
+
 std::string MessageBrokerImpl::getMessageType(
     Message::Direction direction,
     const std::string& topic,
     const std::string& action) {
-    std::stringstream str;
+    // built by appending, since the subscriber types of every message are looked up with it
+    static const std::string ANY = "*";
+    const std::string& typeTopic = topic.empty() ? ANY : topic;
+    const std::string& typeAction = action.empty() ? ANY : action;
 
-    str << direction << ":" << (topic.empty() ? "*" : topic) << ":" << (action.empty() ? "*" : action);
+    std::string type(direction == Message::Direction::INCOMING ? "INCOMING:" : "OUTGOING:");
+    type.reserve(type.size() + typeTopic.size() + typeAction.size() + 1);
+    type.append(typeTopic).append(1, ':').append(typeAction);
 
-    return str.str();
+    return type;
 }
 
 void MessageBrokerImpl::subscribe(const std::string& topic, MessageHandler handler, Message::Direction direction) {
@@ -178,7 +189,11 @@ Message MessageBrokerImpl::publishSync(const PublishMessage& pm, aace::engine::u
             ThrowIf(numSubscribersNotified == 0, "noSubscribers");
 
             // wait for the future
-            ThrowIfNot(future.wait_for(timeout) == std::future_status::ready, "syncMessageTimeout");
+            auto status = future.wait_for(timeout);
+            if (status != std::future_status::ready) {
+                m_stats->getTopicStats(message.topic())->syncTimeouts++;
+            }
+            ThrowIfNot(status == std::future_status::ready, "syncMessageTimeout");
 
             removeSyncMessagePromise(message.messageId());
             return future.get();
@@ -242,6 +257,10 @@ size_t MessageBrokerImpl::notifySubscribers(const std::string& type, const Messa
 size_t MessageBrokerImpl::notifySubscribers(const Message& message) {
     size_t numSubscribersNotified = 0;
 
+    // let the introspection report which message a stalled executor is handling
+    aace::engine::utils::threading::TaskQueueStats::setCurrentTaskDetail(message.topic(), message.action());
+    auto start = std::chrono::steady_clock::now();
+
     // notify the subscribers that are interested in this specific message (topic:action)
     numSubscribersNotified +=
         notifySubscribers(getMessageType(message.direction(), message.topic(), message.action()), message);
@@ -252,6 +271,8 @@ size_t MessageBrokerImpl::notifySubscribers(const Message& message) {
     // notify the subscribers that are interested in all topics and actions (*:*)
     numSubscribersNotified += notifySubscribers(getMessageType(message.direction()), message);
 
+    m_stats->getTopicStats(message.topic())->handlerLatency.record(std::chrono::steady_clock::now() - start);
+
     return numSubscribersNotified;
 }
 
@@ -259,10 +280,17 @@ void MessageBrokerImpl::addSyncMessagePromise(const std::string& messageId, std:
     try {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        ThrowIf(m_syncMessagePromiseMap.find(messageId) != m_syncMessagePromiseMap.end(), "messageIdAlreadyExists");
-
         // add the promise to the promise map
-        m_syncMessagePromiseMap[messageId] = promise;
+        UUID uuid;
+        if (UUID::parse(messageId, uuid)) {
+            ThrowIf(m_syncMessagePromiseMap.find(uuid) != m_syncMessagePromiseMap.end(), "messageIdAlreadyExists");
+            m_syncMessagePromiseMap[uuid] = promise;
+        } else {
+            ThrowIf(
+                m_syncMessagePromiseStringMap.find(messageId) != m_syncMessagePromiseStringMap.end(),
+                "messageIdAlreadyExists");
+            m_syncMessagePromiseStringMap[messageId] = promise;
+        }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
     }
@@ -272,11 +300,13 @@ void MessageBrokerImpl::removeSyncMessagePromise(const std::string& messageId) {
     try {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        auto it = m_syncMessagePromiseMap.find(messageId);
-        ThrowIf(it == m_syncMessagePromiseMap.end(), "messageIdDoesNotExist");
-
         // remove the promise from the promise map
-        m_syncMessagePromiseMap.erase(messageId);
+        UUID uuid;
+        if (UUID::parse(messageId, uuid)) {
+            ThrowIf(m_syncMessagePromiseMap.erase(uuid) == 0, "messageIdDoesNotExist");
+        } else {
+            ThrowIf(m_syncMessagePromiseStringMap.erase(messageId) == 0, "messageIdDoesNotExist");
+        }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
     }
@@ -287,13 +317,22 @@ std::shared_ptr<MessageBrokerImpl::SyncPromiseType> MessageBrokerImpl::getSyncMe
     try {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        auto it = m_syncMessagePromiseMap.find(messageId);
-        ThrowIf(it == m_syncMessagePromiseMap.end(), "messageIdDoesNotExist");
-
-        return it->second;
+        UUID uuid;
+        if (UUID::parse(messageId, uuid)) {
+            auto it = m_syncMessagePromiseMap.find(uuid);
+            ThrowIf(it == m_syncMessagePromiseMap.end(), "messageIdDoesNotExist");
+            return it->second;
+        } else {
+            auto it = m_syncMessagePromiseStringMap.find(messageId);
+            ThrowIf(it == m_syncMessagePromiseStringMap.end(), "messageIdDoesNotExist");
+            return it->second;
+        }
     } catch (std::exception& ex) {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
         for (auto& next : m_syncMessagePromiseMap) {
+            AACE_ERROR(LX(TAG).d("id", next.first.toString()));
+        }
+        for (auto& next : m_syncMessagePromiseStringMap) {
             AACE_ERROR(LX(TAG).d("id", next.first));
         }
 
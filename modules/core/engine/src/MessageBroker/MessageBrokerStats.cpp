@@ -0,0 +1,39 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <AACE/Engine/MessageBroker/MessageBrokerStats.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+std::shared_ptr<MessageBrokerStats::TopicStats> MessageBrokerStats::getTopicStats(const std::string& topic) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& stats = m_topicStats[topic];
+    if (stats == nullptr) {
+        stats = std::make_shared<TopicStats>();
+    }
+    return stats;
+}
+
+std::map<std::string, std::shared_ptr<MessageBrokerStats::TopicStats>> MessageBrokerStats::getAllTopicStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::map<std::string, std::shared_ptr<TopicStats>>(m_topicStats.begin(), m_topicStats.end());
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
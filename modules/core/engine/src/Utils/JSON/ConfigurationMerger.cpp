@@ -0,0 +1,222 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <utility>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/JSON/ConfigurationMerger.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace json {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.utils.json.ConfigurationMerger");
+
+/// Returns the JSON pointer of a member of the object at @c path.
+static std::string memberPath(const std::string& path, const std::string& key) {
+    std::string result = path + "/";
+    for (auto c : key) {
+        if (c == '~') {
+            result += "~0";
+        } else if (c == '/') {
+            result += "~1";
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
+
+/**
+ * SAX handler that adds the values of a stream directly to the merged document. Each open
+ * container of the stream is a frame on a stack; a frame without a container skips the
+ * values of a conflicting container.
+ */
+class MergeHandler {
+public:
+    MergeHandler(Value& document, std::vector<std::string>& conflicts) : m_document(document), m_conflicts(conflicts) {
+    }
+
+    bool null() {
+        return addValue(nullptr);
+    }
+
+    bool boolean(bool value) {
+        return addValue(value);
+    }
+
+    bool number_integer(Value::number_integer_t value) {
+        return addValue(value);
+    }
+
+    bool number_unsigned(Value::number_unsigned_t value) {
+        return addValue(value);
+    }
+
+    bool number_float(Value::number_float_t value, const Value::string_t&) {
+        return addValue(value);
+    }
+
+    bool string(Value::string_t& value) {
+        return addValue(std::move(value));
+    }
+
+    bool binary(Value::binary_t& value) {
+        return addValue(Value::binary(std::move(value)));
+    }
+
+    bool start_object(std::size_t) {
+        return startContainer(Type::object);
+    }
+
+    bool key(Value::string_t& key) {
+        m_frames.back().key = std::move(key);
+        return true;
+    }
+
+    bool end_object() {
+        m_frames.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        return startContainer(Type::array);
+    }
+
+    bool end_array() {
+        m_frames.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) {
+        m_error = ex.what();
+        return false;
+    }
+
+    const std::string& getError() const {
+        return m_error;
+    }
+
+private:
+    struct Frame {
+        /// The container the values are added to, or null if the values are skipped
+        Value* container;
+        /// Whether the container was in the document before this stream, so its members may conflict
+        bool merge;
+        /// The JSON pointer of the container, only kept for containers that may conflict
+        std::string path;
+        /// The key of the next member of an object
+        std::string key;
+    };
+
+    bool startContainer(Type type) {
+        if (m_frames.empty()) {
+            if (type != Type::object) {
+                m_error = "configurationNotAnObject";
+                return false;
+            }
+            bool merge = !m_document.is_null();
+            if (!merge) {
+                m_document = Value(Type::object);
+            }
+            m_frames.push_back({&m_document, merge, "", ""});
+            return true;
+        }
+
+        Frame& parent = m_frames.back();
+        Frame frame{nullptr, false, "", ""};
+        if (parent.container == nullptr) {
+            // nested in a skipped container
+        } else if (parent.container->is_array()) {
+            parent.container->push_back(Value(type));
+            frame.container = &parent.container->back();
+        } else {
+            auto it = parent.container->find(parent.key);
+            if (it == parent.container->end()) {
+                frame.container = &*parent.container->emplace(parent.key, Value(type)).first;
+            } else if (!parent.merge) {
+                // a key repeated in the same stream replaces the previous value, as it does when parsing
+                *it = Value(type);
+                frame.container = &*it;
+            } else if (type == Type::object && it->is_object()) {
+                frame.container = &*it;
+                frame.merge = true;
+                frame.path = memberPath(parent.path, parent.key);
+            } else {
+                m_conflicts.push_back(memberPath(parent.path, parent.key));
+            }
+        }
+        m_frames.push_back(std::move(frame));
+        return true;
+    }
+
+    bool addValue(Value&& value) {
+        if (m_frames.empty()) {
+            m_error = "configurationNotAnObject";
+            return false;
+        }
+        Frame& parent = m_frames.back();
+        if (parent.container == nullptr) {
+            return true;
+        }
+        if (parent.container->is_array()) {
+            parent.container->push_back(std::move(value));
+            return true;
+        }
+        auto it = parent.container->find(parent.key);
+        if (it == parent.container->end()) {
+            parent.container->emplace(parent.key, std::move(value));
+        } else if (!parent.merge) {
+            *it = std::move(value);
+        } else {
+            m_conflicts.push_back(memberPath(parent.path, parent.key));
+        }
+        return true;
+    }
+
+    Value& m_document;
+    std::vector<std::string>& m_conflicts;
+    std::vector<Frame> m_frames;
+    std::string m_error;
+};
+
+ConfigurationMerger::ConfigurationMerger() = default;
+
+bool ConfigurationMerger::merge(std::istream& stream) {
+    try {
+        MergeHandler handler(m_document, m_conflicts);
+        ThrowIfNot(Value::sax_parse(stream, &handler), handler.getError());
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+const std::vector<std::string>& ConfigurationMerger::getConflicts() const {
+    return m_conflicts;
+}
+
+const Value& ConfigurationMerger::getDocument() const {
+    return m_document;
+}
+
+}  // namespace json
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -16,6 +16,7 @@
 #include <AACE/Engine/Utils/JSON/JSON.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
+#include <algorithm>
 #include <sstream>
 
 #define JSON_POINTER(p) nlohmann::json::json_pointer(p.empty() == false && p[0] != '/' ? "/" + p : p)
@@ -93,6 +94,93 @@ bool merge(Value& into, const Value& from) {
     }
 }
 
+static bool matchesType(const Value& value, const std::string& type) {
+    if (type == "object") return value.is_object();
+    if (type == "array") return value.is_array();
+    if (type == "string") return value.is_string();
+    if (type == "integer") return value.is_number_integer();
+    if (type == "number") return value.is_number();
+    if (type == "boolean") return value.is_boolean();
+    if (type == "null") return value.is_null();
+    throw std::invalid_argument("invalidSchemaType:" + type);
+}
+
+bool validate(const Value& value, const Value& schema, std::vector<std::string>& errors, const std::string& path) {
+    try {
+        auto errorCount = errors.size();
+        auto location = path.empty() ? "/" : path;
+
+        auto type = schema.find("type");
+        if (type != schema.end()) {
+            bool matches = false;
+            if (type->is_array()) {
+                for (auto& next : *type) {
+                    matches = matches || matchesType(value, next.get<std::string>());
+                }
+            } else {
+                matches = matchesType(value, type->get<std::string>());
+            }
+            if (!matches) {
+                errors.push_back(location + ": expected " + type->dump() + ", found " + value.type_name());
+                return false;
+            }
+        }
+
+        auto allowed = schema.find("enum");
+        if (allowed != schema.end() && std::find(allowed->begin(), allowed->end(), value) == allowed->end()) {
+            errors.push_back(location + ": " + value.dump() + " is not one of " + allowed->dump());
+        }
+
+        if (value.is_number()) {
+            auto minimum = schema.find("minimum");
+            if (minimum != schema.end() && value.get<double>() < minimum->get<double>()) {
+                errors.push_back(location + ": " + value.dump() + " is less than " + minimum->dump());
+            }
+            auto maximum = schema.find("maximum");
+            if (maximum != schema.end() && value.get<double>() > maximum->get<double>()) {
+                errors.push_back(location + ": " + value.dump() + " is greater than " + maximum->dump());
+            }
+        }
+
+        if (value.is_object()) {
+            auto required = schema.find("required");
+            if (required != schema.end()) {
+                for (auto& next : *required) {
+                    if (!value.contains(next.get<std::string>())) {
+                        errors.push_back(location + ": missing required property " + next.dump());
+                    }
+                }
+            }
+            auto properties = schema.find("properties");
+            auto additionalProperties = schema.find("additionalProperties");
+            for (auto& next : value.items()) {
+                if (properties != schema.end() && properties->contains(next.key())) {
+                    validate(next.value(), properties->at(next.key()), errors, path + "/" + next.key());
+                } else if (additionalProperties != schema.end() && additionalProperties->is_boolean()) {
+                    if (!additionalProperties->get<bool>()) {
+                        errors.push_back(location + ": unexpected property \"" + next.key() + "\"");
+                    }
+                } else if (additionalProperties != schema.end()) {
+                    validate(next.value(), *additionalProperties, errors, path + "/" + next.key());
+                }
+            }
+        }
+
+        auto items = schema.find("items");
+        if (value.is_array() && items != schema.end()) {
+            for (size_t index = 0; index < value.size(); index++) {
+                validate(value[index], *items, errors, path + "/" + std::to_string(index));
+            }
+        }
+
+        return errors.size() == errorCount;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        errors.push_back((path.empty() ? "/" : path) + ": invalid schema");
+        return false;
+    }
+}
+
 bool has(const Value& root, const std::string& path, Type type) {
     try {
         return get(root, path, type) != nullptr;
@@ -20,8 +20,11 @@ namespace engine {
 namespace utils {
 namespace threading {
 
-Executor::Executor() :
-        m_taskQueue{std::make_shared<TaskQueue>()},
+Executor::Executor() : Executor("Executor") {
+}
+
+Executor::Executor(const std::string& name) :
+        m_taskQueue{std::make_shared<TaskQueue>(name)},
         m_taskThread{std::unique_ptr<TaskThread>(new TaskThread(m_taskQueue))} {
     m_taskThread->start();
 }
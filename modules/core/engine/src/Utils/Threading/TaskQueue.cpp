@@ -20,7 +20,10 @@ namespace engine {
 namespace utils {
 namespace threading {
 
-TaskQueue::TaskQueue() : m_shutdown{false} {
+TaskQueue::TaskQueue() : TaskQueue("TaskQueue") {
+}
+
+TaskQueue::TaskQueue(const std::string& name) : m_shutdown{false}, m_stats{TaskQueueStats::create(name)} {
 }
 
 std::unique_ptr<std::function<void()>> TaskQueue::pop() {
@@ -33,7 +36,8 @@ std::unique_ptr<std::function<void()>> TaskQueue::pop() {
     }
 
     if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
+        auto task = std::move(m_queue.front().task);
+        m_stats->taskStarted(m_queue.front().origin, m_queue.front().queuedTime);
 
         m_queue.pop_front();
         return task;
@@ -44,6 +48,7 @@ std::unique_ptr<std::function<void()>> TaskQueue::pop() {
 
 void TaskQueue::shutdown() {
     std::lock_guard<std::mutex> queueLock{m_queueMutex};
+    m_stats->tasksDropped(m_queue.size());
     m_queue.clear();
     m_shutdown = true;
     m_queueChanged.notify_all();
@@ -53,6 +58,10 @@ bool TaskQueue::isShutdown() {
     return m_shutdown;
 }
 
+std::shared_ptr<TaskQueueStats> TaskQueue::getStats() {
+    return m_stats;
+}
+
 }  // namespace threading
 }  // namespace utils
 }  // namespace engine
@@ -0,0 +1,189 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <AACE/Engine/Utils/Threading/TaskQueueStats.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace threading {
+
+/// The statistics of the task queue whose task is running on the calling thread.
+static thread_local TaskQueueStats* s_currentStats = nullptr;
+
+/// The registered statistics. Function statics, so that executors created during static initialization can register.
+static std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<std::weak_ptr<TaskQueueStats>>& registry() {
+    static std::vector<std::weak_ptr<TaskQueueStats>> stats;
+    return stats;
+}
+
+static std::string demangle(const char* name) {
+#ifdef __GNUG__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+std::shared_ptr<TaskQueueStats> TaskQueueStats::create(const std::string& name) {
+    static std::atomic<uint64_t> s_nextId{1};
+    auto stats = std::shared_ptr<TaskQueueStats>(new TaskQueueStats(name, s_nextId++));
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    auto& entries = registry();
+    entries.erase(
+        std::remove_if(
+            entries.begin(),
+            entries.end(),
+            [](const std::weak_ptr<TaskQueueStats>& next) { return next.expired(); }),
+        entries.end());
+    entries.push_back(stats);
+    return stats;
+}
+
+std::vector<std::shared_ptr<TaskQueueStats>> TaskQueueStats::getAll() {
+    std::vector<std::shared_ptr<TaskQueueStats>> result;
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (auto& next : registry()) {
+        if (auto stats = next.lock()) {
+            result.push_back(stats);
+        }
+    }
+    return result;
+}
+
+void TaskQueueStats::setCurrentTaskDetail(const std::string& detail) {
+    if (auto stats = s_currentStats) {
+        std::lock_guard<std::mutex> lock(stats->m_runningMutex);
+        stats->m_runningDetail = detail;
+    }
+}
+
+void TaskQueueStats::setCurrentTaskDetail(const std::string& name, const std::string& detail) {
+    if (auto stats = s_currentStats) {
+        std::lock_guard<std::mutex> lock(stats->m_runningMutex);
+        stats->m_runningDetail.assign(name).append(1, ':').append(detail);
+    }
+}
+
+TaskQueueStats::TaskQueueStats(const std::string& name, uint64_t id) :
+        m_name(name),
+        m_id(id),
+        m_depth{0},
+        m_maxDepth{0},
+        m_runningOrigin(nullptr),
+        m_taskSequence(0) {
+}
+
+const std::string& TaskQueueStats::getName() const {
+    return m_name;
+}
+
+uint64_t TaskQueueStats::getId() const {
+    return m_id;
+}
+
+void TaskQueueStats::taskQueued() {
+    auto depth = ++m_depth;
+    auto max = m_maxDepth.load(std::memory_order_relaxed);
+    while (depth > max && !m_maxDepth.compare_exchange_weak(max, depth, std::memory_order_relaxed)) {
+    }
+}
+
+void TaskQueueStats::tasksDropped(size_t count) {
+    m_depth -= count;
+}
+
+void TaskQueueStats::taskStarted(const char* origin, std::chrono::steady_clock::time_point queuedTime) {
+    auto now = std::chrono::steady_clock::now();
+    m_depth--;
+    m_waitHistogram.record(now - queuedTime);
+    s_currentStats = this;
+
+    std::lock_guard<std::mutex> lock(m_runningMutex);
+    m_runningOrigin = origin;
+    m_runningDetail.clear();
+    m_runningStartTime = now;
+    m_taskSequence++;
+}
+
+void TaskQueueStats::taskFinished() {
+    auto now = std::chrono::steady_clock::now();
+    s_currentStats = nullptr;
+
+    std::lock_guard<std::mutex> lock(m_runningMutex);
+    if (m_runningOrigin != nullptr) {
+        m_runtimeHistogram.record(now - m_runningStartTime);
+        m_runningOrigin = nullptr;
+    }
+}
+
+size_t TaskQueueStats::getDepth() const {
+    return m_depth;
+}
+
+size_t TaskQueueStats::getMaxDepth() const {
+    return m_maxDepth;
+}
+
+const aace::engine::utils::timing::LatencyHistogram& TaskQueueStats::getWaitHistogram() const {
+    return m_waitHistogram;
+}
+
+const aace::engine::utils::timing::LatencyHistogram& TaskQueueStats::getRuntimeHistogram() const {
+    return m_runtimeHistogram;
+}
+
+TaskQueueStats::RunningTask TaskQueueStats::getRunningTask() const {
+    RunningTask task;
+    const char* origin = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_runningMutex);
+        if (m_runningOrigin == nullptr) {
+            return task;
+        }
+        origin = m_runningOrigin;
+        task.detail = m_runningDetail;
+        task.elapsed = std::chrono::steady_clock::now() - m_runningStartTime;
+        task.sequence = m_taskSequence;
+    }
+    // demangle outside of the lock, the executor thread must not wait for the report
+    task.running = true;
+    task.origin = demangle(origin);
+    return task;
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -48,6 +48,7 @@ void TaskThread::processTasksLoop() {
 
             if (task) {
                 task->operator()();
+                m_actualTaskQueue->getStats()->taskFinished();
             }
         } else {
             // Since we could not get a shared pointer to the the TaskQueue, it must have been destroyed.
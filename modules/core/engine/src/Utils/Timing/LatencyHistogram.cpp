@@ -0,0 +1,91 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Timing/LatencyHistogram.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+constexpr size_t LatencyHistogram::BUCKET_COUNT;
+
+LatencyHistogram::LatencyHistogram() : m_count{0}, m_totalMicroseconds{0}, m_maxMicroseconds{0} {
+    for (auto& bucket : m_buckets) {
+        bucket = 0;
+    }
+}
+
+void LatencyHistogram::record(std::chrono::steady_clock::duration duration) {
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    uint64_t value = microseconds > 0 ? static_cast<uint64_t>(microseconds) : 0;
+
+    // the bucket index is the number of significant bits of the value
+    size_t index = 0;
+    while (index < BUCKET_COUNT - 1 && (value >> index) != 0) {
+        index++;
+    }
+    m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_totalMicroseconds.fetch_add(value, std::memory_order_relaxed);
+
+    auto max = m_maxMicroseconds.load(std::memory_order_relaxed);
+    while (value > max && !m_maxMicroseconds.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    return m_count.load(std::memory_order_relaxed);
+}
+
+std::chrono::microseconds LatencyHistogram::getMax() const {
+    return std::chrono::microseconds(m_maxMicroseconds.load(std::memory_order_relaxed));
+}
+
+std::chrono::microseconds LatencyHistogram::getMean() const {
+    auto count = getCount();
+    return std::chrono::microseconds(count > 0 ? m_totalMicroseconds.load(std::memory_order_relaxed) / count : 0);
+}
+
+std::chrono::microseconds LatencyHistogram::getPercentile(double percentile) const {
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return std::chrono::microseconds(0);
+    }
+
+    auto target = static_cast<uint64_t>(std::ceil(std::min(std::max(percentile, 0.0), 1.0) * total));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT - 1; i++) {
+        seen += counts[i];
+        if (seen >= std::max<uint64_t>(target, 1)) {
+            // the longest recorded duration is a tighter bound than the bucket limit
+            return std::min(std::chrono::microseconds(uint64_t{1} << i), getMax());
+        }
+    }
+    return getMax();
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -24,7 +24,16 @@ namespace engine {
 namespace utils {
 namespace timing {
 
-TimerDelegate::TimerDelegate() : m_running{false}, m_stopping{false} {
+TimerDelegate::TimerDelegate(std::shared_ptr<TimerWheel> timerWheel) :
+        m_timerWheel(timerWheel ? std::move(timerWheel) : TimerWheel::getInstance()),
+        m_entry([this]() { fire(); }),
+        m_running{false},
+        m_period{0},
+        m_periodType{PeriodType::ABSOLUTE},
+        m_maxCount{0},
+        m_count{0},
+        m_offSchedule{false},
+        m_generation{0} {
 }
 
 TimerDelegate::~TimerDelegate() {
@@ -38,75 +47,81 @@ void TimerDelegate::start(
     size_t maxCount,
     std::function<void()> task) {
     std::lock_guard<std::mutex> lock(m_callMutex);
-    cleanupLocked();
+    m_timerWheel->cancel(&m_entry);
     activateLocked();
-    m_thread = std::thread(&TimerDelegate::timerLoop, this, delay, period, periodType, maxCount, task);
+    auto deadline = std::chrono::steady_clock::now() + delay;
+    {
+        std::lock_guard<std::mutex> stateLock(m_stateMutex);
+        m_task = std::move(task);
+        m_period = period;
+        m_periodType = periodType;
+        m_maxCount = maxCount;
+        m_count = 0;
+        m_offSchedule = false;
+        m_generation++;
+        m_deadline = deadline;
+    }
+    if (!m_timerWheel->schedule(&m_entry, deadline)) {
+        AACE_ERROR(LX(TAG, "start").d("reason", "scheduleFailed"));
+        m_running = false;
+    }
 }
 
-void TimerDelegate::timerLoop(
-    std::chrono::nanoseconds delay,
-    std::chrono::nanoseconds period,
-    PeriodType periodType,
-    size_t maxCount,
-    std::function<void()> task) {
-    // Timepoint to measure delay/period against.
-    auto now = std::chrono::steady_clock::now();
-
-    // Flag indicating whether we've drifted off schedule.
-    bool offSchedule = false;
-
-    for (size_t count = 0; maxCount == FOREVER || count < maxCount; ++count) {
-        auto waitTime = (0 == count) ? delay : period;
-        {
-            std::unique_lock<std::mutex> lock(m_waitMutex);
-
-            // Wait for stop() or a delay/period to elapse.
-            if (m_waitCondition.wait_until(lock, now + waitTime, [this]() { return m_stopping; })) {
-                m_stopping = false;
-                m_running = false;
-                return;
-            }
-        }
+void TimerDelegate::fire() {
+    std::function<void()> task;
+    uint64_t generation;
+    bool skip;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        task = m_task;
+        generation = m_generation;
+        skip = m_periodType == PeriodType::ABSOLUTE && m_offSchedule;
+    }
 
-        switch (periodType) {
-            case PeriodType::ABSOLUTE:
-                // Update our estimate of where we should be after the delay.
-                now += waitTime;
+    // Run the task if we're still on schedule.
+    if (!skip) {
+        task();
+    }
 
-                // Run the task if we're still on schedule.
-                if (!offSchedule) {
-                    task();
-                }
+    std::chrono::steady_clock::time_point deadline;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        if (generation != m_generation) {
+            // The task was stopped or restarted from inside the task.
+            return;
+        }
+        if (m_maxCount != FOREVER && ++m_count >= m_maxCount) {
+            m_running = false;
+            return;
+        }
 
+        auto now = std::chrono::steady_clock::now();
+        switch (m_periodType) {
+            case PeriodType::ABSOLUTE:
                 // If the task runtime put us off schedule, skip the next task run.
-                if (now + period < std::chrono::steady_clock::now()) {
-                    offSchedule = true;
-                } else {
-                    offSchedule = false;
-                }
+                m_offSchedule = m_deadline + m_period < now;
+                m_deadline += m_period;
                 break;
 
             case PeriodType::RELATIVE:
-                task();
-                now = std::chrono::steady_clock::now();
+                m_deadline = now + m_period;
                 break;
         }
+        deadline = m_deadline;
+    }
+
+    // The wheel refuses the entry while stop() is waiting for this call to return.
+    if (!m_timerWheel->schedule(&m_entry, deadline)) {
+        m_running = false;
     }
-    std::lock_guard<std::mutex> lockGuard(m_waitMutex);
-    m_stopping = false;
-    m_running = false;
 }
 
 void TimerDelegate::stop() {
     std::lock_guard<std::mutex> lock(m_callMutex);
-    {
-        std::lock_guard<std::mutex> lock(m_waitMutex);
-        if (m_running) {
-            m_stopping = true;
-        }
-    }
-    m_waitCondition.notify_all();
-    cleanupLocked();
+    m_timerWheel->cancel(&m_entry);
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+    m_generation++;
+    m_running = false;
 }
 
 bool TimerDelegate::activate() {
@@ -122,12 +137,6 @@ bool TimerDelegate::isActive() const {
     return m_running;
 }
 
-void TimerDelegate::cleanupLocked() {
-    if (std::this_thread::get_id() != m_thread.get_id() && m_thread.joinable()) {
-        m_thread.join();
-    }
-}
-
 }  // namespace timing
 }  // namespace utils
 }  // namespace engine
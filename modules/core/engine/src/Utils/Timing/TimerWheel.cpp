@@ -0,0 +1,260 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/Utils/Timing/TimerWheel.h"
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace timing {
+
+constexpr std::chrono::milliseconds TimerWheel::DEFAULT_TICK;
+constexpr unsigned TimerWheel::FIRST_LEVEL_BITS;
+constexpr unsigned TimerWheel::LEVEL_BITS;
+constexpr unsigned TimerWheel::LEVEL_COUNT;
+constexpr size_t TimerWheel::FIRST_LEVEL_SIZE;
+constexpr size_t TimerWheel::LEVEL_SIZE;
+constexpr uint64_t TimerWheel::WHEEL_TICKS;
+
+TimerWheel::Entry::Entry(std::function<void()> task) : m_task(std::move(task)) {
+}
+
+std::shared_ptr<TimerWheel> TimerWheel::getInstance() {
+    static std::shared_ptr<TimerWheel> s_instance(new TimerWheel());
+    return s_instance;
+}
+
+TimerWheel::TimerWheel(std::chrono::nanoseconds tick) : m_tick(tick), m_start(std::chrono::steady_clock::now()) {
+    for (auto& slot : m_slots) {
+        slot.prev = slot.next = &slot;
+    }
+    m_expired.prev = m_expired.next = &m_expired;
+    m_thread = std::thread(&TimerWheel::run, this);
+}
+
+TimerWheel::~TimerWheel() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wakeCondition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    // leave the remaining entries unlinked so that their owners can still cancel them
+    while (m_expired.next != &m_expired) {
+        unlink(m_expired.next);
+    }
+    for (auto& slot : m_slots) {
+        while (slot.next != &slot) {
+            unlink(slot.next);
+        }
+    }
+}
+
+bool TimerWheel::schedule(Entry* entry, std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (entry->m_cancelling || m_shutdown) {
+        return false;
+    }
+    if (entry->next != nullptr) {
+        unlink(entry);
+        m_size--;
+    }
+    entry->m_expiry = toTick(deadline, true);
+    insertLocked(entry);
+    m_size++;
+
+    if (entry->m_expiry < m_nextWakeTick) {
+        m_wakeRequested = true;
+        m_wakeCondition.notify_one();
+    }
+    return true;
+}
+
+bool TimerWheel::cancel(Entry* entry) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool cancelled = false;
+    if (entry->next != nullptr) {
+        unlink(entry);
+        m_size--;
+        cancelled = true;
+    }
+
+    // wait for a call to the task to return, removing the entry again if the task scheduled it
+    if (m_firing == entry && std::this_thread::get_id() != m_thread.get_id()) {
+        entry->m_cancelling = true;
+        m_firedCondition.wait(lock, [this, entry]() { return m_firing != entry; });
+        entry->m_cancelling = false;
+        if (entry->next != nullptr) {
+            unlink(entry);
+            m_size--;
+            cancelled = true;
+        }
+    }
+    return cancelled;
+}
+
+size_t TimerWheel::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size;
+}
+
+TimerWheel::Link* TimerWheel::getSlot(unsigned level, uint64_t tick) {
+    if (level == 0) {
+        return &m_slots[tick & (FIRST_LEVEL_SIZE - 1)];
+    }
+    auto shift = FIRST_LEVEL_BITS + LEVEL_BITS * (level - 1);
+    return &m_slots[FIRST_LEVEL_SIZE + LEVEL_SIZE * (level - 1) + ((tick >> shift) & (LEVEL_SIZE - 1))];
+}
+
+void TimerWheel::insertLocked(Entry* entry) {
+    // an entry that is already due expires at the next tick
+    auto expiry = std::max(entry->m_expiry, m_currentTick + 1);
+    auto delta = expiry - m_currentTick;
+    if (delta >= WHEEL_TICKS) {
+        // wait in the last slot the wheel covers, and move down when that slot cascades
+        expiry = m_currentTick + WHEEL_TICKS - 1;
+        delta = WHEEL_TICKS - 1;
+    }
+
+    unsigned level = 0;
+    while (delta >= (uint64_t{1} << (FIRST_LEVEL_BITS + LEVEL_BITS * level))) {
+        level++;
+    }
+    append(getSlot(level, expiry), entry);
+}
+
+void TimerWheel::unlink(Link* link) {
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->prev = link->next = nullptr;
+}
+
+void TimerWheel::append(Link* list, Link* link) {
+    link->prev = list->prev;
+    link->next = list;
+    list->prev->next = link;
+    list->prev = link;
+}
+
+void TimerWheel::cascadeLocked(unsigned level, uint64_t tick) {
+    auto slot = getSlot(level, tick);
+    Link pending;
+    pending.prev = pending.next = &pending;
+    while (slot->next != slot) {
+        auto link = slot->next;
+        unlink(link);
+        append(&pending, link);
+    }
+    while (pending.next != &pending) {
+        auto entry = static_cast<Entry*>(pending.next);
+        unlink(entry);
+        if (entry->m_expiry <= m_currentTick) {
+            // the first level slot of the current tick has not been processed yet
+            append(getSlot(0, m_currentTick), entry);
+        } else {
+            insertLocked(entry);
+        }
+    }
+}
+
+void TimerWheel::advanceLocked(uint64_t tick) {
+    if (m_size == 0) {
+        m_currentTick = std::max(m_currentTick, tick);
+        return;
+    }
+    while (m_currentTick < tick) {
+        m_currentTick++;
+
+        // when a level wraps around, move the entries of the next slot of the level above down
+        for (unsigned level = 1; level < LEVEL_COUNT; level++) {
+            auto shift = FIRST_LEVEL_BITS + LEVEL_BITS * (level - 1);
+            if ((m_currentTick & ((uint64_t{1} << shift) - 1)) != 0) {
+                break;
+            }
+            cascadeLocked(level, m_currentTick);
+        }
+
+        auto slot = getSlot(0, m_currentTick);
+        while (slot->next != slot) {
+            auto link = slot->next;
+            unlink(link);
+            append(&m_expired, link);
+        }
+    }
+}
+
+uint64_t TimerWheel::getNextWakeTickLocked() {
+    // the first level is only scanned up to the next cascade, when entries of higher levels may move into it
+    auto nextCascade = (m_currentTick | (FIRST_LEVEL_SIZE - 1)) + 1;
+    for (auto tick = m_currentTick + 1; tick < nextCascade; tick++) {
+        auto slot = getSlot(0, tick);
+        if (slot->next != slot) {
+            return tick;
+        }
+    }
+    return nextCascade;
+}
+
+uint64_t TimerWheel::toTick(std::chrono::steady_clock::time_point time, bool roundUp) const {
+    if (time <= m_start) {
+        return 0;
+    }
+    auto elapsed = (time - m_start).count();
+    auto tick = m_tick.count();
+    return static_cast<uint64_t>(roundUp ? (elapsed + tick - 1) / tick : elapsed / tick);
+}
+
+void TimerWheel::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown) {
+        advanceLocked(toTick(std::chrono::steady_clock::now(), false));
+
+        while (m_expired.next != &m_expired && !m_shutdown) {
+            auto entry = static_cast<Entry*>(m_expired.next);
+            unlink(entry);
+            m_size--;
+
+            // call the task without the lock, so that it can schedule or cancel entries
+            m_firing = entry;
+            lock.unlock();
+            entry->m_task();
+            lock.lock();
+            m_firing = nullptr;
+            m_firedCondition.notify_all();
+        }
+        if (m_shutdown) {
+            break;
+        }
+
+        m_wakeRequested = false;
+        if (m_size == 0) {
+            m_nextWakeTick = UINT64_MAX;
+            m_wakeCondition.wait(lock, [this]() { return m_shutdown || m_wakeRequested; });
+        } else {
+            m_nextWakeTick = getNextWakeTickLocked();
+            m_wakeCondition.wait_until(lock, m_start + m_tick * m_nextWakeTick, [this]() {
+                return m_shutdown || m_wakeRequested;
+            });
+        }
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -14,122 +14,184 @@
  */
 
 #include <AACE/Engine/Utils/UUID/UUID.h>
-#include <AACE/Engine/Core/EngineMacros.h>
 
-#include <random>
-#include <chrono>
-#include <sstream>
-#include <iomanip>
-#include <mutex>
-#include <climits>
 #include <algorithm>
-#include <functional>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <random>
+#include <thread>
+
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace uuid {
 
-/// The UUID version (Version 4), shifted into the correct position in the byte.
-static const uint8_t UUID_VERSION_VALUE = 4 << 4;
+/// The UUID version (Version 4), in the position of the version bits in the high 64 bits.
+static const uint64_t UUID_VERSION_MASK = 0xf000ULL;
+static const uint64_t UUID_VERSION_VALUE = 0x4000ULL;
 
-/// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+/// The UUID variant (Variant 1), in the position of the variant bits in the low 64 bits.
+static const uint64_t UUID_VARIANT_MASK = 0xc000000000000000ULL;
+static const uint64_t UUID_VARIANT_VALUE = 0x8000000000000000ULL;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// Maps each character of the text representation to the index of its nibble, or -1 for a separator.
+// clang-format off
+static const int8_t UUID_LAYOUT[UUID_STRING_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7, -1,
+    8, 9, 10, 11, -1,
+    12, 13, 14, 15, -1,
+    16, 17, 18, 19, -1,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+// clang-format on
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// Lower case hex digits, indexed by nibble.
+static const char HEX_DIGITS[] = "0123456789abcdef";
 
-/// Number of bits in a hex digit.
-static const size_t BITS_IN_HEX_DIGIT = 4;
+/**
+ * The per-thread random number generator state (xoshiro256**). The generator is not cryptographically secure,
+ * which is not required for identifiers, but it is seeded from the kernel entropy pool where available.
+ */
+struct GeneratorState {
+    uint64_t s[4];
+    bool seeded;
+};
 
-// String to identify log entries originating from this file.
-static const std::string TAG("aace.engine.utils.uuid.UUID");
+static thread_local GeneratorState s_generator = {{0, 0, 0, 0}, false};
+
+static uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
 
 /**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
+ * Fills @c buffer with random bytes from the kernel.
  *
- * @return A hex string of length @c numDigits.
+ * @return @c true if the buffer was filled, @c false if the kernel entropy source is not available.
  */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    unsigned short numReplacementBits) {
-    try {
-        ThrowIf(numReplacementBits > MAX_NUM_REPLACEMENT_BITS, "replacingMoreBitsThanProvided");
-        ThrowIf(numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT), "replacingMoreBitsThanGenerated");
-
-        // Makes assumption that 1 digit = 4 bits.
-        std::vector<uint8_t> bytes(ceil(numDigits / 2.0));
-        std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-        // Replace the specified number of bits from the first byte.
-        bytes.at(0) &= (0xff >> numReplacementBits);
-        replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-        bytes.at(0) |= replacementBits;
-
-        std::ostringstream oss;
-        for (const auto& byte : bytes) {
-            oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
+static bool getKernelRandom(void* buffer, size_t size) {
+#if defined(SYS_getrandom)
+    auto bytes = static_cast<uint8_t*>(buffer);
+    while (size > 0) {
+        auto result = syscall(SYS_getrandom, bytes, size, 0);
+        if (result <= 0) {
+            return false;
         }
+        bytes += result;
+        size -= result;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void seed(GeneratorState& state) {
+    uint64_t entropy[4];
+    if (!getKernelRandom(entropy, sizeof(entropy))) {
+        std::random_device rd;
+        for (auto& next : entropy) {
+            next = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+        }
+    }
+    // mix in values that are unique to this thread in case the fallback entropy source is deterministic
+    static std::atomic<uint64_t> s_seedCounter{0};
+    uint64_t mix = entropy[0] ^ std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                   static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+                   (s_seedCounter.fetch_add(1) << 32);
+    for (size_t i = 0; i < 4; i++) {
+        mix ^= entropy[i];
+        state.s[i] = splitMix64(mix);
+    }
+    state.seeded = true;
+}
 
-        std::string bytesText = oss.str();
-        // Remove the last digit for odd numDigits case.
-        bytesText.resize(numDigits);
+static uint64_t next(GeneratorState& state) {
+    const uint64_t result = rotl(state.s[1] * 5, 7) * 9;
+    const uint64_t t = state.s[1] << 17;
+    state.s[2] ^= state.s[0];
+    state.s[3] ^= state.s[1];
+    state.s[1] ^= state.s[2];
+    state.s[0] ^= state.s[3];
+    state.s[2] ^= t;
+    state.s[3] = rotl(state.s[3], 45);
+    return result;
+}
 
-        return bytesText;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "generateHexWithReplacement").d("reason", ex.what()));
-        return std::string();
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
     }
+    return -1;
 }
 
-/**
- * Randomly generate a string of hex digits.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- *
- * @return A hex string of length @c numDigits.
- */
-static const std::string generateHex(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+UUID::UUID(uint64_t high, uint64_t low) : m_high(high), m_low(low) {
 }
 
-const std::string generateUUID() {
-    static bool seeded = false;
-    static std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t> ibe;
-    static std::mutex mutex;
-    std::unique_lock<std::mutex> lock(mutex);
-    if (!seeded) {
-        std::random_device rd;
-        ibe.seed(
-            rd() +
-            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
-                .count());
-        seeded = true;
+UUID UUID::generate() {
+    auto& state = s_generator;
+    if (!state.seeded) {
+        seed(state);
     }
+    uint64_t high = next(state);
+    uint64_t low = next(state);
+    return UUID((high & ~UUID_VERSION_MASK) | UUID_VERSION_VALUE, (low & ~UUID_VARIANT_MASK) | UUID_VARIANT_VALUE);
+}
 
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
+bool UUID::parse(const std::string& text, UUID& uuid) {
+    if (text.size() != UUID_STRING_LENGTH) {
+        return false;
+    }
+    uint64_t value[2] = {0, 0};
+    for (size_t i = 0; i < UUID_STRING_LENGTH; i++) {
+        auto index = UUID_LAYOUT[i];
+        if (index < 0) {
+            if (text[i] != '-') {
+                return false;
+            }
+            continue;
+        }
+        int nibble = hexValue(text[i]);
+        if (nibble < 0) {
+            return false;
+        }
+        value[index >> 4] = (value[index >> 4] << 4) | static_cast<uint64_t>(nibble);
+    }
+    uuid = UUID(value[0], value[1]);
+    return true;
+}
 
-    lock.unlock();
+void UUID::format(char* buffer) const {
+    const uint64_t value[2] = {m_high, m_low};
+    for (size_t i = 0; i < UUID_STRING_LENGTH; i++) {
+        auto index = UUID_LAYOUT[i];
+        buffer[i] = index < 0 ? '-' : HEX_DIGITS[(value[index >> 4] >> (60 - (index & 0xf) * 4)) & 0xf];
+    }
+}
+
+std::string UUID::toString() const {
+    char buffer[UUID_STRING_LENGTH];
+    format(buffer);
+    return std::string(buffer, UUID_STRING_LENGTH);
+}
 
-    return uuidText.str();
+const std::string generateUUID() {
+    return UUID::generate().toString();
 }
 
 bool compare(const std::string& uuid1, const std::string& uuid2) {
@@ -28,6 +28,8 @@ public:
     virtual ~AudioInputEngineInterface() = default;
 
     virtual ssize_t write(const int16_t* data, const size_t size) = 0;
+
+    virtual ssize_t writeNative(const void* data, const size_t size) = 0;
 };
 
 class AudioOutputEngineInterface {
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "AudioEngineInterfaces.h"
+#include "AudioFormat.h"
 
 /** @file */
 
@@ -48,6 +49,29 @@ public:
      */
     ssize_t write(const int16_t* data, const size_t size);
 
+    /**
+     * Writes audio to the Engine in the format returned by @c getAudioFormat(). The Engine converts the audio to
+     * the format described in @c write().
+     *
+     * @param [in] data The audio buffer to write
+     * @param [in] size The number of bytes in the buffer. The bytes of an incomplete frame are kept until the
+     * next call.
+     * @return The number of bytes successfully written to the Engine or a negative error code
+     * if data could not be written
+     */
+    ssize_t writeNative(const void* data, const size_t size);
+
+    /**
+     * Returns the format of the audio written with @c writeNative(). The Engine supports LPCM audio with 16-bit or
+     * 32-bit signed integer or 32-bit float samples, any number of interleaved channels, and any sample rate.
+     * The Engine reads the format when it opens the audio input channel.
+     *
+     * The default implementation returns the format described in @c write(), which needs no conversion.
+     *
+     * @return The native @c AudioFormat of the platform audio input
+     */
+    virtual AudioFormat getAudioFormat();
+
     /**
      * Notifies the platform implementation to start writing audio samples to the Engine via @c write().
      * The platform should continue writing audio samples until the Engine calls
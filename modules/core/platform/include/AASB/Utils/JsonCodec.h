@@ -0,0 +1,702 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AASB_UTILS_JSON_CODEC_H_
+#define AASB_UTILS_JSON_CODEC_H_
+
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Direct JSON codec used by the generated AASB messages.
+ *
+ * The generated @c write_json functions append the JSON encoding of a message straight into a caller owned
+ * string buffer, and the generated @c read_json functions decode JSON straight into the message structs,
+ * without building an intermediate @c nlohmann::json document. The @c to_json and @c from_json functions
+ * are still generated, and the message @c toString() and string constructors keep using them unless the
+ * messages are compiled with @c AASB_DIRECT_JSON_CODEC defined.
+ */
+
+namespace aasb {
+namespace utils {
+namespace json {
+
+/**
+ * FNV-1a hash of an object key. The generated readers switch on the key hash to dispatch to the member.
+ */
+constexpr uint32_t hashKey(const char* key, uint32_t hash = 2166136261u) {
+    return *key == '\0' ? hash : hashKey(key + 1, (hash ^ static_cast<uint8_t>(*key)) * 16777619u);
+}
+
+inline uint32_t hashKey(const std::string& key) {
+    uint32_t hash = 2166136261u;
+    for (auto c : key) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Streaming JSON writer appending compact JSON to a string buffer. The buffer can be reused across messages
+ * to avoid reallocations.
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& buffer) : m_buffer(buffer), m_first(true), m_afterKey(false) {
+    }
+
+    void beginObject() {
+        separate();
+        m_buffer.push_back('{');
+        m_first = true;
+    }
+
+    void endObject() {
+        m_buffer.push_back('}');
+        m_first = false;
+    }
+
+    void beginArray() {
+        separate();
+        m_buffer.push_back('[');
+        m_first = true;
+    }
+
+    void endArray() {
+        m_buffer.push_back(']');
+        m_first = false;
+    }
+
+    /// Writes a key that does not need escaping, such as a member name.
+    template <size_t N>
+    void key(const char (&name)[N]) {
+        separate();
+        m_buffer.push_back('"');
+        m_buffer.append(name, N - 1);
+        m_buffer.append("\":", 2);
+        m_afterKey = true;
+    }
+
+    void key(const std::string& name) {
+        separate();
+        appendString(name);
+        m_buffer.push_back(':');
+        m_afterKey = true;
+    }
+
+    void null() {
+        separate();
+        m_buffer.append("null", 4);
+    }
+
+    void boolean(bool value) {
+        separate();
+        m_buffer.append(value ? "true" : "false");
+    }
+
+    void string(const std::string& value) {
+        separate();
+        appendString(value);
+    }
+
+    void integer(int64_t value) {
+        separate();
+        if (value < 0) {
+            m_buffer.push_back('-');
+        }
+        appendDigits(value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value));
+    }
+
+    void unsignedInteger(uint64_t value) {
+        separate();
+        appendDigits(value);
+    }
+
+    void number(double value) {
+        appendNumber(value, 15, 17);
+    }
+
+    void number(float value) {
+        appendNumber(value, 6, 9);
+    }
+
+private:
+    void separate() {
+        if (m_afterKey) {
+            m_afterKey = false;
+        } else if (m_first) {
+            m_first = false;
+        } else {
+            m_buffer.push_back(',');
+        }
+    }
+
+    void appendDigits(uint64_t value) {
+        char digits[20];
+        char* end = digits + sizeof(digits);
+        char* it = end;
+        do {
+            *--it = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        m_buffer.append(it, end - it);
+    }
+
+    void appendString(const std::string& value) {
+        static const char* hex = "0123456789abcdef";
+        m_buffer.push_back('"');
+        size_t start = 0;
+        for (size_t i = 0; i < value.size(); i++) {
+            auto c = static_cast<unsigned char>(value[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            m_buffer.append(value, start, i - start);
+            start = i + 1;
+            switch (c) {
+                case '"':
+                    m_buffer.append("\\\"", 2);
+                    break;
+                case '\\':
+                    m_buffer.append("\\\\", 2);
+                    break;
+                case '\b':
+                    m_buffer.append("\\b", 2);
+                    break;
+                case '\f':
+                    m_buffer.append("\\f", 2);
+                    break;
+                case '\n':
+                    m_buffer.append("\\n", 2);
+                    break;
+                case '\r':
+                    m_buffer.append("\\r", 2);
+                    break;
+                case '\t':
+                    m_buffer.append("\\t", 2);
+                    break;
+                default:
+                    m_buffer.append("\\u00", 4);
+                    m_buffer.push_back(hex[c >> 4]);
+                    m_buffer.push_back(hex[c & 0xf]);
+                    break;
+            }
+        }
+        m_buffer.append(value, start, std::string::npos);
+        m_buffer.push_back('"');
+    }
+
+    // writes the shortest representation that reads back to the same value, like nlohmann::json
+    template <typename T>
+    void appendNumber(T value, int minPrecision, int maxPrecision) {
+        separate();
+        if (!std::isfinite(value)) {
+            m_buffer.append("null", 4);
+            return;
+        }
+        char digits[32];
+        int length = 0;
+        for (int precision = minPrecision; precision <= maxPrecision; precision++) {
+            length = std::snprintf(digits, sizeof(digits), "%.*g", precision, static_cast<double>(value));
+            if (static_cast<T>(std::strtod(digits, nullptr)) == value) {
+                break;
+            }
+        }
+        m_buffer.append(digits, length);
+        if (std::strpbrk(digits, ".eE") == nullptr) {
+            m_buffer.append(".0", 2);
+        }
+    }
+
+private:
+    std::string& m_buffer;
+    bool m_first;
+    bool m_afterKey;
+};
+
+/**
+ * Pull JSON reader decoding values in document order. Malformed input and type mismatches throw
+ * @c std::runtime_error. The input must outlive the reader.
+ */
+class JsonReader {
+public:
+    JsonReader(const char* data, size_t size) : m_it(data), m_end(data + size), m_begin(data) {
+    }
+
+    explicit JsonReader(const std::string& json) : JsonReader(json.data(), json.size()) {
+    }
+
+    /**
+     * Starts reading an object.
+     *
+     * @param allowNull Accept @c null in place of the object.
+     * @return @c false if @c null was read instead of an object.
+     */
+    bool beginObject(bool allowNull = false) {
+        skipWhitespace();
+        if (allowNull && consumeLiteral("null")) {
+            return false;
+        }
+        expect('{');
+        m_first.push_back(true);
+        return true;
+    }
+
+    /**
+     * Reads the next key of the current object.
+     *
+     * @return @c false when the end of the object has been read.
+     */
+    bool nextKey(std::string& key) {
+        skipWhitespace();
+        if (peek() == '}') {
+            m_it++;
+            m_first.pop_back();
+            return false;
+        }
+        if (!m_first.back()) {
+            expect(',');
+            skipWhitespace();
+        }
+        m_first.back() = false;
+        readString(key);
+        skipWhitespace();
+        expect(':');
+        return true;
+    }
+
+    void beginArray() {
+        skipWhitespace();
+        expect('[');
+        m_first.push_back(true);
+    }
+
+    /**
+     * Moves to the next element of the current array.
+     *
+     * @return @c false when the end of the array has been read.
+     */
+    bool nextElement() {
+        skipWhitespace();
+        if (peek() == ']') {
+            m_it++;
+            m_first.pop_back();
+            return false;
+        }
+        if (!m_first.back()) {
+            expect(',');
+        }
+        m_first.back() = false;
+        return true;
+    }
+
+    void readString(std::string& value) {
+        skipWhitespace();
+        expect('"');
+        // fast path for strings without escape sequences
+        auto start = m_it;
+        while (m_it != m_end && *m_it != '"' && *m_it != '\\') {
+            m_it++;
+        }
+        value.assign(start, m_it);
+        while (peek() == '\\') {
+            m_it++;
+            readEscape(value);
+            start = m_it;
+            while (m_it != m_end && *m_it != '"' && *m_it != '\\') {
+                m_it++;
+            }
+            value.append(start, m_it);
+        }
+        expect('"');
+    }
+
+    bool readBool() {
+        skipWhitespace();
+        if (consumeLiteral("true")) {
+            return true;
+        }
+        if (consumeLiteral("false")) {
+            return false;
+        }
+        fail("expected boolean");
+    }
+
+    int64_t readInteger() {
+        bool integral = false;
+        auto token = readNumberToken(integral);
+        if (!integral) {
+            // non integral numbers are truncated like nlohmann::json does
+            auto value = toDouble(token);
+            if (!(value > -9223372036854775808.0 && value < 9223372036854775808.0)) {
+                fail("number out of range");
+            }
+            return static_cast<int64_t>(value);
+        }
+        errno = 0;
+        auto value = std::strtoll(token.c_str(), nullptr, 10);
+        if (errno == ERANGE) {
+            fail("number out of range");
+        }
+        return value;
+    }
+
+    uint64_t readUnsignedInteger() {
+        bool integral = false;
+        auto token = readNumberToken(integral);
+        if (token[0] == '-') {
+            fail("expected unsigned number");
+        }
+        if (!integral) {
+            auto value = toDouble(token);
+            if (!(value < 18446744073709551616.0)) {
+                fail("number out of range");
+            }
+            return static_cast<uint64_t>(value);
+        }
+        errno = 0;
+        auto value = std::strtoull(token.c_str(), nullptr, 10);
+        if (errno == ERANGE) {
+            fail("number out of range");
+        }
+        return value;
+    }
+
+    double readDouble() {
+        bool integral = false;
+        return toDouble(readNumberToken(integral));
+    }
+
+    /// Skips the next value, including nested objects and arrays.
+    void skipValue() {
+        skipWhitespace();
+        switch (peek()) {
+            case '{': {
+                std::string key;
+                beginObject();
+                while (nextKey(key)) {
+                    skipValue();
+                }
+                break;
+            }
+            case '[':
+                beginArray();
+                while (nextElement()) {
+                    skipValue();
+                }
+                break;
+            case '"': {
+                std::string value;
+                readString(value);
+                break;
+            }
+            case 't':
+            case 'f':
+                readBool();
+                break;
+            case 'n':
+                if (!consumeLiteral("null")) {
+                    fail("unexpected token");
+                }
+                break;
+            default:
+                readDouble();
+                break;
+        }
+    }
+
+    /// Verifies that only whitespace follows the decoded value.
+    void finish() {
+        skipWhitespace();
+        if (m_it != m_end) {
+            fail("unexpected trailing characters");
+        }
+    }
+
+    [[noreturn]] void fail(const std::string& reason) {
+        throw std::runtime_error("JSON parse error at offset " + std::to_string(m_it - m_begin) + ": " + reason);
+    }
+
+    [[noreturn]] static void missingKey(const char* key) {
+        throw std::runtime_error(std::string("JSON key not found: ") + key);
+    }
+
+private:
+    char peek() {
+        return m_it != m_end ? *m_it : '\0';
+    }
+
+    void skipWhitespace() {
+        while (m_it != m_end && (*m_it == ' ' || *m_it == '\n' || *m_it == '\r' || *m_it == '\t')) {
+            m_it++;
+        }
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        m_it++;
+    }
+
+    bool consumeLiteral(const char* literal) {
+        auto length = std::strlen(literal);
+        if (static_cast<size_t>(m_end - m_it) >= length && std::memcmp(m_it, literal, length) == 0) {
+            m_it += length;
+            return true;
+        }
+        return false;
+    }
+
+    std::string readNumberToken(bool& integral) {
+        skipWhitespace();
+        auto start = m_it;
+        integral = true;
+        if (peek() == '-') {
+            m_it++;
+        }
+        if (!std::isdigit(static_cast<unsigned char>(peek()))) {
+            fail("expected number");
+        }
+        while (m_it != m_end && (std::isdigit(static_cast<unsigned char>(*m_it)) || *m_it == '.' || *m_it == 'e' ||
+                                 *m_it == 'E' || *m_it == '+' || *m_it == '-')) {
+            integral = integral && std::isdigit(static_cast<unsigned char>(*m_it));
+            m_it++;
+        }
+        std::string token(start, m_it);
+        // the token must be a single number, such as "1.5e3" but not "1.5.3" or "1e"
+        char* end = nullptr;
+        std::strtod(token.c_str(), &end);
+        if (end != token.c_str() + token.size()) {
+            m_it = start + (end - token.c_str());
+            fail("invalid number");
+        }
+        return token;
+    }
+
+    double toDouble(const std::string& token) {
+        char* end = nullptr;
+        auto value = std::strtod(token.c_str(), &end);
+        if (std::isinf(value)) {
+            fail("number out of range");
+        }
+        return value;
+    }
+
+    unsigned int readHex4() {
+        if (m_end - m_it < 4) {
+            fail("invalid unicode escape");
+        }
+        unsigned int code = 0;
+        for (int i = 0; i < 4; i++) {
+            auto c = *m_it++;
+            code <<= 4;
+            if (c >= '0' && c <= '9') {
+                code |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                code |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                code |= c - 'A' + 10;
+            } else {
+                fail("invalid unicode escape");
+            }
+        }
+        return code;
+    }
+
+    void readEscape(std::string& value) {
+        auto c = peek();
+        m_it++;
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                value.push_back(c);
+                break;
+            case 'b':
+                value.push_back('\b');
+                break;
+            case 'f':
+                value.push_back('\f');
+                break;
+            case 'n':
+                value.push_back('\n');
+                break;
+            case 'r':
+                value.push_back('\r');
+                break;
+            case 't':
+                value.push_back('\t');
+                break;
+            case 'u': {
+                auto code = readHex4();
+                if (code >= 0xd800 && code <= 0xdbff) {
+                    // surrogate pair
+                    if (!consumeLiteral("\\u")) {
+                        fail("invalid surrogate pair");
+                    }
+                    auto low = readHex4();
+                    if (low < 0xdc00 || low > 0xdfff) {
+                        fail("invalid surrogate pair");
+                    }
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                } else if (code >= 0xdc00 && code <= 0xdfff) {
+                    fail("invalid surrogate pair");
+                }
+                appendUtf8(value, code);
+                break;
+            }
+            default:
+                fail("invalid escape sequence");
+        }
+    }
+
+    static void appendUtf8(std::string& value, unsigned int code) {
+        if (code < 0x80) {
+            value.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            value.push_back(static_cast<char>(0xc0 | (code >> 6)));
+            value.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        } else if (code < 0x10000) {
+            value.push_back(static_cast<char>(0xe0 | (code >> 12)));
+            value.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        } else {
+            value.push_back(static_cast<char>(0xf0 | (code >> 18)));
+            value.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3f)));
+            value.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        }
+    }
+
+private:
+    const char* m_it;
+    const char* m_end;
+    const char* m_begin;
+
+    // whether the next member or element is the first one, for each open object or array
+    std::vector<bool> m_first;
+};
+
+//
+// Codecs of the built-in AASB message types. The generated types provide their own overloads, which are
+// found by argument dependent lookup.
+//
+
+inline void write_json(JsonWriter& w, const std::string& value) {
+    w.string(value);
+}
+
+inline void write_json(JsonWriter& w, bool value) {
+    w.boolean(value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type write_json(
+    JsonWriter& w,
+    T value) {
+    w.integer(static_cast<int64_t>(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type
+write_json(JsonWriter& w, T value) {
+    w.unsignedInteger(static_cast<uint64_t>(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type write_json(JsonWriter& w, T value) {
+    w.number(value);
+}
+
+inline void write_json(JsonWriter& w, const std::unordered_map<std::string, std::string>& value) {
+    w.beginObject();
+    for (auto& next : value) {
+        w.key(next.first);
+        w.string(next.second);
+    }
+    w.endObject();
+}
+
+template <typename T>
+void write_json(JsonWriter& w, const std::vector<T>& value) {
+    w.beginArray();
+    for (const auto& next : value) {
+        write_json(w, next);
+    }
+    w.endArray();
+}
+
+inline void read_json(JsonReader& r, std::string& value) {
+    r.readString(value);
+}
+
+inline void read_json(JsonReader& r, bool& value) {
+    value = r.readBool();
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type read_json(
+    JsonReader& r,
+    T& value) {
+    value = static_cast<T>(r.readInteger());
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type
+read_json(JsonReader& r, T& value) {
+    value = static_cast<T>(r.readUnsignedInteger());
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type read_json(JsonReader& r, T& value) {
+    value = static_cast<T>(r.readDouble());
+}
+
+inline void read_json(JsonReader& r, std::unordered_map<std::string, std::string>& value) {
+    value.clear();
+    std::string key;
+    r.beginObject();
+    while (r.nextKey(key)) {
+        r.readString(value[key]);
+    }
+}
+
+template <typename T>
+void read_json(JsonReader& r, std::vector<T>& value) {
+    value.clear();
+    r.beginArray();
+    while (r.nextElement()) {
+        T next;
+        read_json(r, next);
+        value.push_back(std::move(next));
+    }
+}
+
+}  // namespace json
+}  // namespace utils
+}  // namespace aasb
+
+#endif  // AASB_UTILS_JSON_CODEC_H_
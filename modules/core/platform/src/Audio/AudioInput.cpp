@@ -24,6 +24,21 @@ ssize_t AudioInput::write(const int16_t* data, const size_t size) {
     return m_audioInputEngineInterface != nullptr ? m_audioInputEngineInterface->write(data, size) : 0;
 }
 
+ssize_t AudioInput::writeNative(const void* data, const size_t size) {
+    return m_audioInputEngineInterface != nullptr ? m_audioInputEngineInterface->writeNative(data, size) : 0;
+}
+
+AudioFormat AudioInput::getAudioFormat() {
+    return AudioFormat(
+        AudioFormat::Encoding::LPCM,
+        AudioFormat::SampleFormat::SIGNED,
+        AudioFormat::Layout::INTERLEAVED,
+        AudioFormat::Endianness::LITTLE,
+        16000,
+        16,
+        1);
+}
+
 void AudioInput::setEngineInterface(std::shared_ptr<aace::audio::AudioInputEngineInterface> audioInputEngineInterface) {
     m_audioInputEngineInterface = audioInputEngineInterface;
 }
@@ -0,0 +1,215 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// engine includes
+#include <AACE/Engine/Audio/AudioInputConverter.h>
+
+using namespace aace::engine::audio;
+using AudioFormat = aace::audio::AudioFormat;
+
+static const double PI = 3.14159265358979323846;
+static const uint32_t ENGINE_SAMPLE_RATE = 16000;
+
+/// The sample rates written by the platform in the tests.
+static const std::vector<uint32_t> TEST_SAMPLE_RATES = {48000, 44100, 32000, 16000, 8000};
+
+/// The number of bytes written to the converter per call, chosen so that calls end in the middle of a frame.
+static const size_t TEST_CHUNK_SIZE = 1237;
+
+/// The number of output samples skipped before measuring, to exclude the resampler's initial history.
+static const size_t TEST_SETTLE_SAMPLES = 500;
+
+/// The number of 10 ms frames converted by the benchmark.
+static const size_t BENCHMARK_FRAME_COUNT = 20000;
+
+/// Test harness for the conversion of native platform audio to the Engine format
+class AudioInputConverterTest : public ::testing::Test {
+protected:
+    static AudioFormat createFloatStereoFormat(uint32_t sampleRate) {
+        return AudioFormat(
+            AudioFormat::Encoding::LPCM,
+            AudioFormat::SampleFormat::FLOAT,
+            AudioFormat::Layout::INTERLEAVED,
+            AudioFormat::Endianness::LITTLE,
+            sampleRate,
+            32,
+            2);
+    }
+
+    /// Two seconds of a 1 kHz tone at half scale, plus a 12 kHz tone above the Engine's Nyquist frequency.
+    static std::vector<float> createStereoSignal(uint32_t sampleRate) {
+        std::vector<float> signal(sampleRate * 2 * 2);
+        for (size_t j = 0; j < signal.size() / 2; j++) {
+            double t = static_cast<double>(j) / sampleRate;
+            float sample = static_cast<float>(0.5 * std::sin(2 * PI * 1000 * t));
+            if (sampleRate > 2 * 12000) {
+                sample += static_cast<float>(0.3 * std::sin(2 * PI * 12000 * t));
+            }
+            signal[2 * j] = sample;
+            signal[2 * j + 1] = sample;
+        }
+        return signal;
+    }
+
+    static std::vector<int16_t> convertInChunks(AudioInputConverter& converter, const void* data, size_t size) {
+        std::vector<int16_t> result;
+        std::vector<int16_t> output;
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t offset = 0; offset < size; offset += TEST_CHUNK_SIZE) {
+            converter.convert(bytes + offset, std::min(TEST_CHUNK_SIZE, size - offset), output);
+            result.insert(result.end(), output.begin(), output.end());
+        }
+        return result;
+    }
+
+    /// Returns the amplitude of the @c frequency component of 16 kHz @c samples.
+    static double measureAmplitude(const std::vector<int16_t>& samples, double frequency) {
+        double re = 0;
+        double im = 0;
+        for (size_t j = TEST_SETTLE_SAMPLES; j < samples.size(); j++) {
+            double phase = 2 * PI * frequency * j / ENGINE_SAMPLE_RATE;
+            re += samples[j] * std::cos(phase);
+            im += samples[j] * std::sin(phase);
+        }
+        return std::sqrt(re * re + im * im) * 2 / (samples.size() - TEST_SETTLE_SAMPLES);
+    }
+
+    static uint64_t readCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+};
+
+TEST_F(AudioInputConverterTest, engineFormatNeedsNoConversion) {
+    EXPECT_TRUE(AudioInputConverter::isEngineFormat(AudioInputConverter::getEngineFormat()));
+    EXPECT_FALSE(AudioInputConverter::isEngineFormat(createFloatStereoFormat(ENGINE_SAMPLE_RATE)));
+}
+
+TEST_F(AudioInputConverterTest, createWithUnsupportedFormat) {
+    EXPECT_EQ(
+        AudioInputConverter::create(AudioFormat(
+            AudioFormat::Encoding::MP3,
+            AudioFormat::SampleFormat::SIGNED,
+            AudioFormat::Layout::INTERLEAVED,
+            AudioFormat::Endianness::LITTLE,
+            ENGINE_SAMPLE_RATE,
+            16,
+            1)),
+        nullptr);
+    EXPECT_EQ(
+        AudioInputConverter::create(AudioFormat(
+            AudioFormat::Encoding::LPCM,
+            AudioFormat::SampleFormat::SIGNED,
+            AudioFormat::Layout::INTERLEAVED,
+            AudioFormat::Endianness::LITTLE,
+            ENGINE_SAMPLE_RATE,
+            24,
+            1)),
+        nullptr);
+}
+
+TEST_F(AudioInputConverterTest, convertBigEndianSamples) {
+    auto converter = AudioInputConverter::create(AudioFormat(
+        AudioFormat::Encoding::LPCM,
+        AudioFormat::SampleFormat::SIGNED,
+        AudioFormat::Layout::INTERLEAVED,
+        AudioFormat::Endianness::BIG,
+        ENGINE_SAMPLE_RATE,
+        16,
+        1));
+    ASSERT_NE(converter, nullptr);
+
+    const uint8_t data[] = {0x12, 0x34, 0x80, 0x00};
+    std::vector<int16_t> output;
+    converter->convert(data, sizeof(data), output);
+    ASSERT_EQ(output.size(), 2u);
+    EXPECT_EQ(output[0], 0x1234);
+    EXPECT_EQ(output[1], -32768);
+}
+
+TEST_F(AudioInputConverterTest, convertFloatStereoAtEachSampleRate) {
+    for (auto sampleRate : TEST_SAMPLE_RATES) {
+        auto converter = AudioInputConverter::create(createFloatStereoFormat(sampleRate));
+        ASSERT_NE(converter, nullptr) << sampleRate;
+
+        auto signal = createStereoSignal(sampleRate);
+        auto output = convertInChunks(*converter, signal.data(), signal.size() * sizeof(float));
+
+        // two seconds of output, less the samples still held by the resampler
+        EXPECT_NEAR(output.size(), ENGINE_SAMPLE_RATE * 2, ENGINE_SAMPLE_RATE / 100) << sampleRate;
+        EXPECT_NEAR(measureAmplitude(output, 1000), 16384, 16384 * 0.02) << sampleRate;
+        if (sampleRate > 2 * 12000) {
+            // the 12 kHz tone aliases to 4 kHz unless it is filtered before decimation
+            EXPECT_LT(measureAmplitude(output, ENGINE_SAMPLE_RATE - 12000), 16) << sampleRate;
+        }
+    }
+}
+
+TEST_F(AudioInputConverterTest, resetDiscardsIncompleteFrames) {
+    auto converter = AudioInputConverter::create(createFloatStereoFormat(ENGINE_SAMPLE_RATE));
+    ASSERT_NE(converter, nullptr);
+
+    const float frame[] = {0.5f, 0.5f};
+    std::vector<int16_t> output;
+    converter->convert(frame, sizeof(float), output);
+    converter->reset();
+
+    // without the reset, the kept half frame would complete a frame here
+    converter->convert(frame, sizeof(frame) - 1, output);
+    EXPECT_TRUE(output.empty());
+    converter->convert(reinterpret_cast<const uint8_t*>(frame) + sizeof(frame) - 1, 1, output);
+    EXPECT_EQ(output.size(), 1u);
+}
+
+TEST_F(AudioInputConverterTest, benchmarkCyclesPer10msFrame) {
+    for (auto sampleRate : TEST_SAMPLE_RATES) {
+        auto converter = AudioInputConverter::create(createFloatStereoFormat(sampleRate));
+        ASSERT_NE(converter, nullptr) << sampleRate;
+
+        auto signal = createStereoSignal(sampleRate);
+        size_t frameSize = sampleRate / 100 * 2 * sizeof(float);
+        std::vector<int16_t> output;
+
+        auto startTime = std::chrono::steady_clock::now();
+        auto startCycles = readCycleCounter();
+        for (size_t j = 0; j < BENCHMARK_FRAME_COUNT; j++) {
+            converter->convert(signal.data(), frameSize, output);
+        }
+        auto cycles = (readCycleCounter() - startCycles) / BENCHMARK_FRAME_COUNT;
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - startTime)
+                               .count() /
+                           BENCHMARK_FRAME_COUNT;
+
+        auto name = "floatStereo" + std::to_string(sampleRate);
+        RecordProperty(name + ".cyclesPerFrame", static_cast<int>(cycles));
+        RecordProperty(name + ".nanosecondsPerFrame", static_cast<int>(nanoseconds));
+    }
+}
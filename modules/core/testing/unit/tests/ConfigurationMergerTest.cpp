@@ -0,0 +1,253 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Utils/JSON/ConfigurationMerger.h>
+#include <AACE/Engine/Utils/JSON/JSON.h>
+
+namespace json = aace::engine::utils::json;
+
+using ConfigurationMerger = json::ConfigurationMerger;
+
+/// The number of car control endpoints in the large configuration.
+static constexpr int LARGE_CONFIGURATION_ENDPOINTS = 1000;
+
+/// The number of services configured by the large configuration, other than car control.
+static constexpr int LARGE_CONFIGURATION_SERVICES = 40;
+
+static bool merge(ConfigurationMerger& merger, const std::string& configuration) {
+    std::stringstream stream(configuration);
+    return merger.merge(stream);
+}
+
+/// Returns the configuration streams of an Engine with many car control endpoints and services.
+static std::vector<std::string> generateLargeConfiguration() {
+    json::Value supportedRange = {{"minimumValue", 0}, {"maximumValue", 100}};
+    json::Value endpoints = json::Value::array();
+    for (int i = 0; i < LARGE_CONFIGURATION_ENDPOINTS; i++) {
+        auto id = "endpoint-" + std::to_string(i);
+        json::Value friendlyNames = {
+            {{"@type", "asset"}, {"value", {{"assetId", "My.Asset." + std::to_string(i)}}}},
+            {{"@type", "text"}, {"value", {{"text", "light " + std::to_string(i)}, {"locale", "en-US"}}}}};
+        json::Value presets = json::Value::array();
+        for (int preset = 0; preset < 4; preset++) {
+            presets.push_back({{"rangeValue", preset * 25}, {"presetResources", {{"friendlyNames", friendlyNames}}}});
+        }
+        endpoints.push_back(
+            {{"endpointId", id},
+             {"endpointResources", {{"friendlyNames", friendlyNames}}},
+             {"capabilities",
+              {{{"type", "AlexaInterface"},
+                {"interface", "Alexa.PowerController"},
+                {"version", "3"},
+                {"properties", {{"supported", {{{"name", "powerState"}}}}, {"proactivelyReported", false}}}},
+               {{"type", "AlexaInterface"},
+                {"interface", "Alexa.RangeController"},
+                {"version", "3"},
+                {"instance", "brightness"},
+                {"configuration", {{"supportedRange", supportedRange}, {"presets", presets}}},
+                {"properties", {{"supported", {{{"name", "rangeValue"}}}}, {"retrievable", true}}}}}}});
+    }
+
+    json::Value services = json::Value::object();
+    json::Value overrides = json::Value::object();
+    for (int i = 0; i < LARGE_CONFIGURATION_SERVICES; i++) {
+        auto type = "aace.service" + std::to_string(i);
+        services[type] = {{"enabled", true}, {"timeout", i * 100}, {"name", type}, {"ratio", 0.5}};
+        overrides[type] = {{"override", {{"level", i}}}};
+    }
+
+    return {json::Value({{"aace.carControl", {{"endpoints", endpoints}}}}).dump(),
+            json::Value({{"aace.carControl", {{"assets", {{"customAssetsPath", "/opt/assets.json"}}}}}}).dump(),
+            services.dump(3),
+            overrides.dump()};
+}
+
+TEST(ConfigurationMergerTest, mergesObjectsAcrossStreams) {
+    ConfigurationMerger merger;
+    ASSERT_TRUE(merge(merger, R"({"aace.a": {"x": 1, "list": [1, {"y": "z"}]}, "aace.b": {"f": 1.5}})"));
+    ASSERT_TRUE(merge(merger, R"({"aace.a": {"nested": {"u": 18446744073709551615, "n": null, "b": false}}})"));
+    ASSERT_TRUE(merge(merger, R"({"aace.c": {"i": -3}})"));
+    EXPECT_TRUE(merger.getConflicts().empty());
+
+    auto expected = json::Value::parse(R"({
+        "aace.a": {"x": 1, "list": [1, {"y": "z"}], "nested": {"u": 18446744073709551615, "n": null, "b": false}},
+        "aace.b": {"f": 1.5},
+        "aace.c": {"i": -3}
+    })");
+    EXPECT_EQ(merger.getDocument(), expected);
+    EXPECT_TRUE(merger.getDocument()["aace.a"]["nested"]["u"].is_number_unsigned());
+    EXPECT_TRUE(merger.getDocument()["aace.c"]["i"].is_number_integer());
+}
+
+TEST(ConfigurationMergerTest, reportsEveryConflict) {
+    ConfigurationMerger merger;
+    ASSERT_TRUE(merge(merger, R"({"aace.a": {"x": 1, "list": [1], "o": {"k": "v"}}, "aace.b": {"y": {}}})"));
+    ASSERT_TRUE(merge(merger, R"({"aace.a": {"x": 2, "list": [2], "o": {"k": "w", "new": 1}}, "aace.b": {"y": 3}})"));
+    ASSERT_TRUE(merge(merger, R"({"aace.b": {"y": {"k/~": [{"deep": 1}]}}})"));
+    ASSERT_TRUE(merge(merger, R"({"aace.b": {"y": {"k/~": []}}})"));
+
+    std::vector<std::string> conflicts = {"/aace.a/x", "/aace.a/list", "/aace.a/o/k", "/aace.b/y", "/aace.b/y/k~1~0"};
+    EXPECT_EQ(merger.getConflicts(), conflicts);
+
+    // the values that do not conflict are merged, the conflicting ones keep their first value
+    auto expected = json::Value::parse(R"({"x": 1, "list": [1], "o": {"k": "v", "new": 1}})");
+    EXPECT_EQ(merger.getDocument()["aace.a"], expected);
+    EXPECT_EQ(merger.getDocument()["aace.b"], json::Value::parse(R"({"y": {"k/~": [{"deep": 1}]}})"));
+}
+
+TEST(ConfigurationMergerTest, keyRepeatedInOneStreamReplacesValue) {
+    ConfigurationMerger merger;
+    ASSERT_TRUE(merge(merger, R"({"aace.a": {"x": 1, "x": {"y": 2}}})"));
+    EXPECT_TRUE(merger.getConflicts().empty());
+    EXPECT_EQ(merger.getDocument(), json::Value::parse(R"({"aace.a": {"x": {"y": 2}}})"));
+}
+
+TEST(ConfigurationMergerTest, rejectsInvalidStreams) {
+    ConfigurationMerger merger;
+    EXPECT_TRUE(merger.getDocument().is_null());
+    EXPECT_FALSE(merge(merger, "[1, 2]"));
+    EXPECT_FALSE(merge(merger, "42"));
+    EXPECT_FALSE(merge(merger, ""));
+    EXPECT_FALSE(merge(merger, R"({"aace.a": )"));
+    EXPECT_FALSE(merge(merger, R"({"aace.a": {}} trailing)"));
+}
+
+TEST(ConfigurationMergerTest, validateReportsEveryViolation) {
+    auto schema = json::Value::parse(R"({
+        "type": "object",
+        "required": ["endpoints", "mode"],
+        "additionalProperties": false,
+        "properties": {
+            "mode": {"type": "string", "enum": ["fast", "slow"]},
+            "delay": {"type": "integer", "minimum": 0, "maximum": 1000},
+            "path": {"type": ["string", "null"]},
+            "endpoints": {
+                "type": "array",
+                "items": {
+                    "type": "object",
+                    "required": ["endpointId"],
+                    "properties": {"endpointId": {"type": "string"}}
+                }
+            }
+        }
+    })");
+
+    std::vector<std::string> errors;
+    EXPECT_TRUE(json::validate(
+        json::Value::parse(R"({"mode": "fast", "path": null, "endpoints": [{"endpointId": "a"}]})"), schema, errors));
+    EXPECT_TRUE(errors.empty());
+
+    auto configuration = json::Value::parse(R"({
+        "mode": "medium",
+        "delay": -5,
+        "path": 3,
+        "extra": true,
+        "endpoints": [{"endpointId": "a"}, {"name": "b"}, {"endpointId": 7}, "c"]
+    })");
+    EXPECT_FALSE(json::validate(configuration, schema, errors, "/aace.test"));
+    std::vector<std::string> expected = {
+        "/aace.test/delay: -5 is less than 0",
+        "/aace.test/endpoints/1: missing required property \"endpointId\"",
+        "/aace.test/endpoints/2/endpointId: expected \"string\", found number",
+        "/aace.test/endpoints/3: expected \"object\", found string",
+        "/aace.test: unexpected property \"extra\"",
+        "/aace.test/mode: \"medium\" is not one of [\"fast\",\"slow\"]",
+        "/aace.test/path: expected [\"string\",\"null\"], found number"};
+    std::sort(errors.begin(), errors.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(errors, expected);
+}
+
+TEST(ConfigurationMergerTest, largeConfigurationStartup) {
+    auto streams = generateLargeConfiguration();
+    std::vector<std::string> serviceTypes = {"aace.carControl"};
+    for (int i = 0; i < LARGE_CONFIGURATION_SERVICES; i++) {
+        serviceTypes.push_back("aace.service" + std::to_string(i));
+    }
+
+    // each service parses the stream it is configured with, except car control which reads the merged document
+    size_t configuredEndpoints = 0;
+    auto documentMerge = [&]() {
+        json::Value merged = {};
+        for (auto& next : streams) {
+            ASSERT_TRUE(json::merge(merged, json::toJson(std::make_shared<std::stringstream>(next))));
+        }
+        for (auto& type : serviceTypes) {
+            auto config = json::get(merged, type, json::Type::object);
+            auto parsed = json::Value::parse(*json::toStream(config));
+            configuredEndpoints += parsed.contains("endpoints") ? parsed["endpoints"].size() : 0;
+        }
+    };
+    auto streamingMerge = [&]() {
+        ConfigurationMerger merger;
+        for (auto& next : streams) {
+            ASSERT_TRUE(merge(merger, next));
+        }
+        ASSERT_TRUE(merger.getConflicts().empty());
+        auto& merged = merger.getDocument();
+        for (auto& type : serviceTypes) {
+            auto& config = merged.at(type);
+            if (type == "aace.carControl") {
+                configuredEndpoints += config.at("endpoints").size();
+            } else {
+                auto parsed = json::Value::parse(config.dump());
+                configuredEndpoints += parsed.contains("endpoints") ? parsed["endpoints"].size() : 0;
+            }
+        }
+    };
+    auto measure = [&](const std::function<void()>& configure) {
+        double best = 0;
+        for (int run = 0; run < 3; run++) {
+            configuredEndpoints = 0;
+            auto start = std::chrono::steady_clock::now();
+            configure();
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            EXPECT_EQ(configuredEndpoints, static_cast<size_t>(LARGE_CONFIGURATION_ENDPOINTS));
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    };
+
+    size_t size = 0;
+    for (auto& next : streams) {
+        size += next.size();
+    }
+    auto documentMergeTime = measure(documentMerge);
+    auto streamingMergeTime = measure(streamingMerge);
+    RecordProperty("configurationBytes", static_cast<int>(size));
+    RecordProperty("documentMergeMicroseconds", static_cast<int>(documentMergeTime * 1000));
+    RecordProperty("streamingMergeMicroseconds", static_cast<int>(streamingMergeTime * 1000));
+
+    // both merges build the same document
+    json::Value expected = {};
+    for (auto& next : streams) {
+        json::merge(expected, json::toJson(next));
+    }
+    ConfigurationMerger merger;
+    for (auto& next : streams) {
+        merge(merger, next);
+    }
+    EXPECT_EQ(merger.getDocument(), expected);
+}
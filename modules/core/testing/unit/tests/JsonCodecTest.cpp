@@ -0,0 +1,167 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AASB/Utils/JsonCodec.h>
+
+using namespace aasb::utils::json;
+
+class JsonCodecTest : public ::testing::Test {
+protected:
+    template <typename T>
+    static std::string write(const T& value) {
+        std::string buffer;
+        JsonWriter writer(buffer);
+        write_json(writer, value);
+        return buffer;
+    }
+
+    template <typename T>
+    static T read(const std::string& json) {
+        T value;
+        JsonReader reader(json);
+        read_json(reader, value);
+        reader.finish();
+        return value;
+    }
+};
+
+TEST_F(JsonCodecTest, StringEscapesRoundTrip) {
+    std::string value = "quote\" backslash\\ slash/ newline\n tab\t bell\x07 unit\x1f";
+    auto json = write(value);
+    EXPECT_EQ(json, "\"quote\\\" backslash\\\\ slash/ newline\\n tab\\t bell\\u0007 unit\\u001f\"");
+    EXPECT_EQ(read<std::string>(json), value);
+}
+
+TEST_F(JsonCodecTest, EscapeSequencesAreDecoded) {
+    EXPECT_EQ(read<std::string>("\"\\/\\b\\f\\r\""), "/\b\f\r");
+    EXPECT_EQ(read<std::string>("\"\\u0041\\u00e9\\u20ac\""), "A\xc3\xa9\xe2\x82\xac");
+}
+
+TEST_F(JsonCodecTest, SurrogatePairIsDecodedToUtf8) {
+    EXPECT_EQ(read<std::string>("\"\\ud83d\\ude00\""), "\xf0\x9f\x98\x80");
+    EXPECT_EQ(read<std::string>("\"a\\uD834\\uDD1Eb\""), "a\xf0\x9d\x84\x9e"
+                                                          "b");
+}
+
+TEST_F(JsonCodecTest, InvalidSurrogatesThrow) {
+    // high surrogate without a low surrogate
+    EXPECT_THROW(read<std::string>("\"\\ud83d\""), std::runtime_error);
+    EXPECT_THROW(read<std::string>("\"\\ud83dx\""), std::runtime_error);
+    // high surrogate followed by something other than a low surrogate
+    EXPECT_THROW(read<std::string>("\"\\ud83d\\u0041\""), std::runtime_error);
+    // lone low surrogate
+    EXPECT_THROW(read<std::string>("\"\\ude00\""), std::runtime_error);
+}
+
+TEST_F(JsonCodecTest, MalformedInputThrows) {
+    EXPECT_THROW(read<std::string>("\"unterminated"), std::runtime_error);
+    EXPECT_THROW(read<std::string>("\"bad \\x escape\""), std::runtime_error);
+    EXPECT_THROW(read<std::string>("\"bad \\u12g4 escape\""), std::runtime_error);
+    EXPECT_THROW(read<std::string>("\"value\" trailing"), std::runtime_error);
+    EXPECT_THROW(read<std::vector<int>>("[1 2]"), std::runtime_error);
+    EXPECT_THROW(read<std::vector<int>>("[1,2"), std::runtime_error);
+    EXPECT_THROW((read<std::unordered_map<std::string, std::string>>("{\"a\" \"b\"}")), std::runtime_error);
+    EXPECT_THROW((read<std::unordered_map<std::string, std::string>>("{\"a\":\"b\"")), std::runtime_error);
+    EXPECT_THROW(read<bool>("tru"), std::runtime_error);
+    EXPECT_THROW(read<double>("1.2.3"), std::runtime_error);
+    EXPECT_THROW(read<double>("1e"), std::runtime_error);
+    EXPECT_THROW(read<int>("-"), std::runtime_error);
+    EXPECT_THROW(read<int>(""), std::runtime_error);
+}
+
+TEST_F(JsonCodecTest, SkipValueSkipsNestedValues) {
+    std::string json = "{\"skip\":{\"a\":[1,{\"b\":null},\"\\\"}\"],\"c\":true},\"keep\":42}";
+    JsonReader reader(json);
+    std::string key;
+    int keep = 0;
+    ASSERT_TRUE(reader.beginObject());
+    while (reader.nextKey(key)) {
+        if (key == "keep") {
+            read_json(reader, keep);
+        } else {
+            reader.skipValue();
+        }
+    }
+    reader.finish();
+    EXPECT_EQ(keep, 42);
+}
+
+TEST_F(JsonCodecTest, SignedIntegerLimitsRoundTrip) {
+    auto min = std::numeric_limits<int64_t>::min();
+    auto max = std::numeric_limits<int64_t>::max();
+    EXPECT_EQ(write(min), "-9223372036854775808");
+    EXPECT_EQ(write(max), "9223372036854775807");
+    EXPECT_EQ(read<int64_t>(write(min)), min);
+    EXPECT_EQ(read<int64_t>(write(max)), max);
+    EXPECT_EQ(read<int32_t>(write(std::numeric_limits<int32_t>::min())), std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(write(0), "0");
+}
+
+TEST_F(JsonCodecTest, UnsignedIntegerLimitsRoundTrip) {
+    auto max = std::numeric_limits<uint64_t>::max();
+    EXPECT_EQ(write(max), "18446744073709551615");
+    EXPECT_EQ(read<uint64_t>(write(max)), max);
+    EXPECT_EQ(write(std::numeric_limits<uint32_t>::max()), "4294967295");
+    EXPECT_EQ(read<uint32_t>("4294967295"), std::numeric_limits<uint32_t>::max());
+    EXPECT_THROW(read<uint64_t>("-1"), std::runtime_error);
+}
+
+TEST_F(JsonCodecTest, IntegerOverflowThrows) {
+    EXPECT_THROW(read<int64_t>("9223372036854775808"), std::runtime_error);
+    EXPECT_THROW(read<int64_t>("-9223372036854775809"), std::runtime_error);
+    EXPECT_THROW(read<uint64_t>("18446744073709551616"), std::runtime_error);
+    EXPECT_THROW(read<int64_t>("1e30"), std::runtime_error);
+    EXPECT_THROW(read<double>("1e400"), std::runtime_error);
+}
+
+TEST_F(JsonCodecTest, NonIntegralNumbersAreTruncatedToIntegers) {
+    EXPECT_EQ(read<int>("2.9"), 2);
+    EXPECT_EQ(read<int>("-2.9"), -2);
+    EXPECT_EQ(read<int>("1e3"), 1000);
+}
+
+TEST_F(JsonCodecTest, FloatingPointNumbersUseShortestRepresentation) {
+    EXPECT_EQ(write(0.1), "0.1");
+    EXPECT_EQ(write(0.1f), "0.1");
+    EXPECT_EQ(write(1.0), "1.0");
+    EXPECT_EQ(write(-2.5e-8), "-2.5e-08");
+    EXPECT_EQ(write(std::numeric_limits<double>::infinity()), "null");
+    EXPECT_EQ(read<double>(write(std::numeric_limits<double>::max())), std::numeric_limits<double>::max());
+    EXPECT_EQ(read<double>(write(std::numeric_limits<double>::min())), std::numeric_limits<double>::min());
+    EXPECT_EQ(read<float>(write(3.14159f)), 3.14159f);
+}
+
+TEST_F(JsonCodecTest, ContainersRoundTrip) {
+    std::vector<std::string> strings = {"a", "", "\"c\""};
+    EXPECT_EQ(read<std::vector<std::string>>(write(strings)), strings);
+    std::unordered_map<std::string, std::string> map = {{"key", "value"}, {"esc\"aped", "\\"}};
+    EXPECT_EQ((read<std::unordered_map<std::string, std::string>>(write(map))), map);
+    EXPECT_EQ(read<std::vector<int>>(" [ 1 , -2 ,3 ] "), std::vector<int>({1, -2, 3}));
+}
+
+TEST_F(JsonCodecTest, ConstexprKeyHashMatchesRuntimeHash) {
+    static_assert(hashKey("payload") != hashKey("header"), "key hashes must differ");
+    EXPECT_EQ(hashKey("payload"), hashKey(std::string("payload")));
+    EXPECT_EQ(hashKey(""), hashKey(std::string()));
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+#include <AACE/Engine/Utils/Threading/TaskQueueStats.h>
+#include <AACE/Engine/Utils/Timing/LatencyHistogram.h>
+
+using aace::engine::utils::threading::Executor;
+using aace::engine::utils::threading::TaskQueueStats;
+using aace::engine::utils::timing::LatencyHistogram;
+
+/// Timeout for the tests waiting on executor tasks.
+static const std::chrono::seconds TEST_TIMEOUT = std::chrono::seconds(5);
+
+static const std::string SAMPLE_REQUEST = R"({
+  "header": {
+    "id": "23b578ed-6dc3-460a-998e-1647ba6cde42",
+    "messageType": "Publish",
+    "version": "4.0",
+    "messageDescription": {
+        "topic": "LocationProvider",
+        "action": "GetLocation"
+    }
+  }
+})";
+
+/// Returns the registered statistics of the executor with a name.
+static std::shared_ptr<TaskQueueStats> findStats(const std::string& name) {
+    auto all = TaskQueueStats::getAll();
+    auto it = std::find_if(all.begin(), all.end(), [&name](const std::shared_ptr<TaskQueueStats>& stats) {
+        return stats->getName() == name;
+    });
+    return it != all.end() ? *it : nullptr;
+}
+
+/// Submits a task that blocks until it is released.
+static std::future<void> submitBlockingTask(Executor& executor, std::shared_future<void> release) {
+    return executor.submit([release]() { release.wait(); });
+}
+
+TEST(TaskQueueStatsTest, histogramPercentiles) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 99; i++) {
+        histogram.record(std::chrono::microseconds(10));
+    }
+    histogram.record(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(histogram.getCount(), 100u);
+    EXPECT_EQ(histogram.getMax(), std::chrono::milliseconds(100));
+
+    // 10us falls in the bucket of the durations shorter than 16us
+    EXPECT_EQ(histogram.getPercentile(0.5), std::chrono::microseconds(16));
+    EXPECT_EQ(histogram.getPercentile(0.99), std::chrono::microseconds(16));
+    EXPECT_EQ(histogram.getPercentile(1), std::chrono::milliseconds(100));
+}
+
+TEST(TaskQueueStatsTest, emptyHistogram) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getCount(), 0u);
+    EXPECT_EQ(histogram.getPercentile(0.99), std::chrono::microseconds(0));
+    EXPECT_EQ(histogram.getMean(), std::chrono::microseconds(0));
+}
+
+TEST(TaskQueueStatsTest, executorIsRegisteredUntilDestroyed) {
+    {
+        Executor executor("TaskQueueStatsTest.registered");
+        EXPECT_NE(findStats("TaskQueueStatsTest.registered"), nullptr);
+    }
+    EXPECT_EQ(findStats("TaskQueueStatsTest.registered"), nullptr);
+}
+
+TEST(TaskQueueStatsTest, depthWaitAndRuntime) {
+    Executor executor("TaskQueueStatsTest.depth");
+    auto stats = findStats("TaskQueueStatsTest.depth");
+    ASSERT_NE(stats, nullptr);
+
+    std::promise<void> release;
+    auto blocked = submitBlockingTask(executor, release.get_future().share());
+    std::vector<std::future<void>> queued;
+    for (int i = 0; i < 3; i++) {
+        queued.push_back(executor.submit([]() {}));
+    }
+
+    // wait for the blocking task to start, the other tasks stay queued behind it
+    auto deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+    while (!stats->getRunningTask().running && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(stats->getDepth(), 3u);
+    EXPECT_GE(stats->getMaxDepth(), 3u);
+
+    release.set_value();
+    ASSERT_EQ(blocked.wait_for(TEST_TIMEOUT), std::future_status::ready);
+    for (auto& next : queued) {
+        ASSERT_EQ(next.wait_for(TEST_TIMEOUT), std::future_status::ready);
+    }
+    executor.waitForSubmittedTasks();
+
+    EXPECT_EQ(stats->getDepth(), 0u);
+    EXPECT_EQ(stats->getWaitHistogram().getCount(), 5u);
+    EXPECT_GE(stats->getRuntimeHistogram().getCount(), 4u);
+}
+
+TEST(TaskQueueStatsTest, runningTaskNamesItsOrigin) {
+    Executor executor("TaskQueueStatsTest.running");
+    auto stats = findStats("TaskQueueStatsTest.running");
+    ASSERT_NE(stats, nullptr);
+    EXPECT_FALSE(stats->getRunningTask().running);
+
+    std::promise<void> release;
+    std::promise<void> started;
+    auto releaseFuture = release.get_future().share();
+    executor.submit([&started, releaseFuture]() {
+        TaskQueueStats::setCurrentTaskDetail("AddressBook:AddAddressBook:replaced");
+        TaskQueueStats::setCurrentTaskDetail("Navigation", "GetNavigationState");
+        started.set_value();
+        releaseFuture.wait();
+    });
+    ASSERT_EQ(started.get_future().wait_for(TEST_TIMEOUT), std::future_status::ready);
+
+    auto running = stats->getRunningTask();
+    EXPECT_TRUE(running.running);
+    EXPECT_EQ(running.detail, "Navigation:GetNavigationState");
+    EXPECT_NE(running.origin.find("runningTaskNamesItsOrigin"), std::string::npos) << running.origin;
+
+    release.set_value();
+    executor.waitForSubmittedTasks();
+    EXPECT_FALSE(stats->getRunningTask().running);
+}
+
+TEST(TaskQueueStatsTest, detailOutsideOfExecutorIsIgnored) {
+    TaskQueueStats::setCurrentTaskDetail("ignored");
+    SUCCEED();
+}
+
+TEST(TaskQueueStatsTest, messageBrokerTopicStats) {
+    auto broker = aace::engine::messageBroker::MessageBrokerImpl::create();
+    broker->setMessageTimeout(std::chrono::milliseconds(50));
+    broker->subscribe(
+        "LocationProvider",
+        [](const aace::engine::messageBroker::Message& message) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        },
+        aace::engine::messageBroker::Message::Direction::OUTGOING);
+
+    // nobody replies, so the synchronous message times out
+    EXPECT_FALSE(broker->publish(SAMPLE_REQUEST).get().valid());
+
+    auto topics = broker->getStats()->getAllTopicStats();
+    ASSERT_EQ(topics.count("LocationProvider"), 1u);
+    auto& topic = topics["LocationProvider"];
+    EXPECT_EQ(topic->handlerLatency.getCount(), 1u);
+    EXPECT_GE(topic->handlerLatency.getMax(), std::chrono::milliseconds(2));
+    EXPECT_EQ(topic->syncTimeouts.load(), 1u);
+
+    broker->shutdown();
+}
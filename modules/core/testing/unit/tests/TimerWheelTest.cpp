@@ -0,0 +1,284 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/Timing/TimerDelegate.h>
+#include <AACE/Engine/Utils/Timing/TimerWheel.h>
+
+using namespace aace::engine::utils::timing;
+
+/// The number of timers scheduled by the stress test.
+static const size_t STRESS_TIMER_COUNT = 100000;
+
+/// The range of deadlines of the stress test timers.
+static const std::chrono::milliseconds STRESS_DEADLINE_RANGE = std::chrono::milliseconds(2000);
+
+/// The largest allowed delay of a task call after its deadline.
+static const std::chrono::milliseconds MAXIMUM_LATENESS = std::chrono::milliseconds(50);
+
+/// A short period used by the periodic timer tests.
+static const std::chrono::milliseconds TEST_PERIOD = std::chrono::milliseconds(10);
+
+/// The time to wait for a task call that is expected to happen.
+static const std::chrono::seconds TEST_TIMEOUT = std::chrono::seconds(5);
+
+/// Test harness for the timer wheel and the timers scheduled on it
+class TimerWheelTest : public ::testing::Test {
+protected:
+    /// Returns the number of threads of the process, or 0 if it is not known.
+    static int getThreadCount() {
+#ifdef __linux__
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 8, "Threads:") == 0) {
+                return std::stoi(line.substr(8));
+            }
+        }
+#endif
+        return 0;
+    }
+};
+
+TEST_F(TimerWheelTest, scheduleCallsTaskAfterDeadline) {
+    TimerWheel wheel;
+    std::promise<std::chrono::steady_clock::time_point> called;
+    TimerWheel::Entry entry([&called]() { called.set_value(std::chrono::steady_clock::now()); });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(30);
+    ASSERT_TRUE(wheel.schedule(&entry, deadline));
+    EXPECT_EQ(wheel.size(), 1u);
+
+    auto future = called.get_future();
+    ASSERT_EQ(future.wait_for(TEST_TIMEOUT), std::future_status::ready);
+    auto time = future.get();
+    EXPECT_GE(time, deadline);
+    EXPECT_LT(time, deadline + MAXIMUM_LATENESS);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+TEST_F(TimerWheelTest, scheduleCallsPastDeadlineImmediately) {
+    TimerWheel wheel;
+    std::promise<void> called;
+    TimerWheel::Entry entry([&called]() { called.set_value(); });
+
+    ASSERT_TRUE(wheel.schedule(&entry, std::chrono::steady_clock::now() - std::chrono::seconds(1)));
+    EXPECT_EQ(called.get_future().wait_for(MAXIMUM_LATENESS), std::future_status::ready);
+}
+
+TEST_F(TimerWheelTest, scheduleOnHigherLevels) {
+    // with a fine tick, these deadlines are placed on every level of the wheel and cascade down
+    TimerWheel wheel(std::chrono::microseconds(1));
+    std::vector<std::chrono::milliseconds> delays = {
+        std::chrono::milliseconds(1), std::chrono::milliseconds(12), std::chrono::milliseconds(150)};
+    std::vector<std::chrono::steady_clock::time_point> times(delays.size());
+    std::atomic<size_t> calls{0};
+    std::vector<std::unique_ptr<TimerWheel::Entry>> entries;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t j = 0; j < delays.size(); j++) {
+        entries.emplace_back(new TimerWheel::Entry([&, j]() {
+            times[j] = std::chrono::steady_clock::now();
+            calls++;
+        }));
+        ASSERT_TRUE(wheel.schedule(entries.back().get(), start + delays[j]));
+    }
+    std::this_thread::sleep_for(delays.back() + MAXIMUM_LATENESS * 2);
+
+    ASSERT_EQ(calls, delays.size());
+    for (size_t j = 0; j < delays.size(); j++) {
+        EXPECT_GE(times[j], start + delays[j]);
+        EXPECT_LT(times[j], start + delays[j] + MAXIMUM_LATENESS);
+    }
+}
+
+TEST_F(TimerWheelTest, cancelBeforeDeadline) {
+    TimerWheel wheel;
+    std::atomic<int> calls{0};
+    TimerWheel::Entry entry([&calls]() { calls++; });
+
+    ASSERT_TRUE(wheel.schedule(&entry, std::chrono::steady_clock::now() + std::chrono::milliseconds(20)));
+    EXPECT_TRUE(wheel.cancel(&entry));
+    EXPECT_FALSE(wheel.cancel(&entry));
+    EXPECT_EQ(wheel.size(), 0u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(TimerWheelTest, scheduleReplacesDeadline) {
+    TimerWheel wheel;
+    std::atomic<int> calls{0};
+    TimerWheel::Entry entry([&calls]() { calls++; });
+
+    auto now = std::chrono::steady_clock::now();
+    ASSERT_TRUE(wheel.schedule(&entry, now + std::chrono::hours(1)));
+    ASSERT_TRUE(wheel.schedule(&entry, now + std::chrono::milliseconds(10)));
+    EXPECT_EQ(wheel.size(), 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+TEST_F(TimerWheelTest, cancelWaitsForTask) {
+    TimerWheel wheel;
+    std::promise<void> started;
+    std::atomic<bool> finished{false};
+    TimerWheel::Entry entry([&started, &finished]() {
+        started.set_value();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+
+    ASSERT_TRUE(wheel.schedule(&entry, std::chrono::steady_clock::now()));
+    ASSERT_EQ(started.get_future().wait_for(TEST_TIMEOUT), std::future_status::ready);
+    wheel.cancel(&entry);
+    EXPECT_TRUE(finished);
+}
+
+TEST_F(TimerWheelTest, delegateCallsPeriodicTaskMaxCountTimes) {
+    for (auto periodType : {TimerDelegate::PeriodType::ABSOLUTE, TimerDelegate::PeriodType::RELATIVE}) {
+        TimerDelegate delegate;
+        std::atomic<size_t> calls{0};
+        std::promise<void> done;
+        delegate.start(std::chrono::milliseconds(0), TEST_PERIOD, periodType, 3, [&calls, &done]() {
+            if (++calls == 3) {
+                done.set_value();
+            }
+        });
+        EXPECT_TRUE(delegate.isActive());
+        ASSERT_EQ(done.get_future().wait_for(TEST_TIMEOUT), std::future_status::ready);
+
+        std::this_thread::sleep_for(TEST_PERIOD * 5);
+        EXPECT_EQ(calls, 3u);
+        EXPECT_FALSE(delegate.isActive());
+    }
+}
+
+TEST_F(TimerWheelTest, delegateAbsolutePeriodDoesNotDrift) {
+    TimerDelegate delegate;
+    const size_t count = 20;
+    std::vector<std::chrono::steady_clock::time_point> times;
+    std::promise<void> done;
+    auto start = std::chrono::steady_clock::now();
+    delegate.start(TEST_PERIOD, TEST_PERIOD, TimerDelegate::PeriodType::ABSOLUTE, count, [&]() {
+        times.push_back(std::chrono::steady_clock::now());
+        if (times.size() == count) {
+            done.set_value();
+        }
+    });
+    ASSERT_EQ(done.get_future().wait_for(TEST_TIMEOUT), std::future_status::ready);
+
+    // each call is measured against its own deadline, so lateness does not accumulate
+    for (size_t j = 0; j < count; j++) {
+        auto deadline = start + TEST_PERIOD * (j + 1);
+        EXPECT_GE(times[j], deadline);
+        EXPECT_LT(times[j], deadline + MAXIMUM_LATENESS);
+    }
+}
+
+TEST_F(TimerWheelTest, delegateStopFromTask) {
+    TimerDelegate delegate;
+    std::atomic<int> calls{0};
+    delegate.start(
+        std::chrono::milliseconds(0), TEST_PERIOD, TimerDelegate::PeriodType::RELATIVE, TimerDelegate::FOREVER, [&]() {
+            calls++;
+            delegate.stop();
+        });
+
+    std::this_thread::sleep_for(TEST_PERIOD * 10);
+    EXPECT_EQ(calls, 1);
+    EXPECT_FALSE(delegate.isActive());
+}
+
+TEST_F(TimerWheelTest, delegateStopBeforeDeadline) {
+    TimerDelegate delegate;
+    std::atomic<int> calls{0};
+    delegate.start(
+        TEST_PERIOD * 2, TEST_PERIOD, TimerDelegate::PeriodType::ABSOLUTE, TimerDelegate::FOREVER, [&calls]() {
+            calls++;
+        });
+    delegate.stop();
+    EXPECT_FALSE(delegate.isActive());
+
+    std::this_thread::sleep_for(TEST_PERIOD * 5);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(TimerWheelTest, stressManyTimers) {
+    auto threadsBefore = getThreadCount();
+
+    std::vector<std::chrono::steady_clock::time_point> deadlines(STRESS_TIMER_COUNT);
+    std::vector<std::chrono::nanoseconds> lateness(STRESS_TIMER_COUNT);
+    std::vector<std::unique_ptr<TimerDelegate>> delegates;
+    delegates.reserve(STRESS_TIMER_COUNT);
+    std::atomic<size_t> calls{0};
+    std::promise<void> done;
+    int maximumThreads = threadsBefore;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t j = 0; j < STRESS_TIMER_COUNT; j++) {
+        auto delay = std::chrono::milliseconds(50) + STRESS_DEADLINE_RANGE * j / STRESS_TIMER_COUNT;
+        deadlines[j] = std::chrono::steady_clock::now() + delay;
+        delegates.emplace_back(new TimerDelegate());
+        delegates.back()->start(delay, delay, TimerDelegate::PeriodType::ABSOLUTE, 1, [&, j]() {
+            lateness[j] = std::chrono::steady_clock::now() - deadlines[j];
+            if (++calls == STRESS_TIMER_COUNT) {
+                done.set_value();
+            }
+        });
+        if (j % 10000 == 0) {
+            maximumThreads = std::max(maximumThreads, getThreadCount());
+        }
+    }
+    auto scheduleNanoseconds = (std::chrono::steady_clock::now() - start).count() / STRESS_TIMER_COUNT;
+
+    auto future = done.get_future();
+    while (future.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+        maximumThreads = std::max(maximumThreads, getThreadCount());
+        ASSERT_LT(std::chrono::steady_clock::now() - start, STRESS_DEADLINE_RANGE + TEST_TIMEOUT);
+    }
+
+    // at most the shared wheel thread was added
+    EXPECT_LE(maximumThreads, threadsBefore + 1);
+
+    std::sort(lateness.begin(), lateness.end());
+    EXPECT_GE(lateness.front().count(), 0);
+    EXPECT_LT(lateness.back(), MAXIMUM_LATENESS);
+
+    auto toMicroseconds = [](std::chrono::nanoseconds duration) {
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    };
+    auto medianMicroseconds = toMicroseconds(lateness[lateness.size() / 2]);
+    auto p99Microseconds = toMicroseconds(lateness[lateness.size() * 99 / 100]);
+    auto maximumMicroseconds = toMicroseconds(lateness.back());
+    RecordProperty("maximumThreads", maximumThreads);
+    RecordProperty("scheduleNanoseconds", static_cast<int>(scheduleNanoseconds));
+    RecordProperty("medianLatenessMicroseconds", medianMicroseconds);
+    RecordProperty("p99LatenessMicroseconds", p99Microseconds);
+    RecordProperty("maximumLatenessMicroseconds", maximumMicroseconds);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+using namespace aace::engine::utils::uuid;
+
+static const size_t TEST_UUID_COUNT = 10000;
+static const size_t TEST_THREAD_COUNT = 8;
+
+/// Test harness for the UUID utilities
+class UUIDTest : public ::testing::Test {};
+
+TEST_F(UUIDTest, generateUUIDFormat) {
+    for (size_t i = 0; i < TEST_UUID_COUNT; i++) {
+        auto uuid = generateUUID();
+        ASSERT_EQ(uuid.size(), UUID_STRING_LENGTH);
+        for (size_t j = 0; j < uuid.size(); j++) {
+            if (j == 8 || j == 13 || j == 18 || j == 23) {
+                ASSERT_EQ(uuid[j], '-') << uuid;
+            } else {
+                ASSERT_TRUE(std::isxdigit(uuid[j]) && !std::isupper(uuid[j])) << uuid;
+            }
+        }
+        ASSERT_EQ(uuid[14], '4') << "Invalid version: " << uuid;
+        ASSERT_NE(std::string("89ab").find(uuid[19]), std::string::npos) << "Invalid variant: " << uuid;
+    }
+}
+
+TEST_F(UUIDTest, generateUUIDIsUniqueAcrossThreads) {
+    std::mutex mutex;
+    std::set<std::string> uuids;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < TEST_THREAD_COUNT; t++) {
+        threads.emplace_back([&] {
+            std::vector<std::string> generated;
+            for (size_t i = 0; i < TEST_UUID_COUNT; i++) {
+                generated.push_back(generateUUID());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            uuids.insert(generated.begin(), generated.end());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(uuids.size(), TEST_UUID_COUNT * TEST_THREAD_COUNT) << "Duplicate UUID generated!";
+}
+
+TEST_F(UUIDTest, parseRoundTrip) {
+    auto uuid = UUID::generate();
+    UUID parsed;
+    ASSERT_TRUE(UUID::parse(uuid.toString(), parsed));
+    ASSERT_EQ(parsed, uuid);
+
+    // parsing is case insensitive, consistent with compare()
+    auto text = uuid.toString();
+    std::string upper = text;
+    for (auto& c : upper) {
+        c = std::toupper(c);
+    }
+    ASSERT_TRUE(compare(text, upper));
+    ASSERT_TRUE(UUID::parse(upper, parsed));
+    ASSERT_EQ(parsed, uuid);
+
+    ASSERT_TRUE(UUID::parse("00112233-4455-6677-8899-aabbccddeeff", parsed));
+    ASSERT_EQ(parsed.high(), 0x0011223344556677ULL);
+    ASSERT_EQ(parsed.low(), 0x8899aabbccddeeffULL);
+    ASSERT_EQ(parsed.toString(), "00112233-4455-6677-8899-aabbccddeeff");
+}
+
+TEST_F(UUIDTest, parseRejectsInvalidText) {
+    UUID parsed;
+    ASSERT_FALSE(UUID::parse("", parsed));
+    ASSERT_FALSE(UUID::parse("not-a-uuid", parsed));
+    ASSERT_FALSE(UUID::parse("00112233-4455-6677-8899-aabbccddeef", parsed));
+    ASSERT_FALSE(UUID::parse("00112233-4455-6677-8899-aabbccddeeff0", parsed));
+    ASSERT_FALSE(UUID::parse("00112233+4455-6677-8899-aabbccddeeff", parsed));
+    ASSERT_FALSE(UUID::parse("0011223g-4455-6677-8899-aabbccddeeff", parsed));
+}
+
+TEST_F(UUIDTest, binaryUUIDAsMapKey) {
+    std::unordered_set<UUID> uuids;
+    for (size_t i = 0; i < TEST_UUID_COUNT; i++) {
+        uuids.insert(UUID::generate());
+    }
+    ASSERT_EQ(uuids.size(), TEST_UUID_COUNT);
+
+    auto uuid = *uuids.begin();
+    UUID parsed;
+    ASSERT_TRUE(UUID::parse(uuid.toString(), parsed));
+    ASSERT_EQ(uuids.count(parsed), 1u);
+    ASSERT_EQ(uuids.count(UUID()), 0u);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_LOOPBACKDETECTOR_LOOPBACK_CORRELATOR_H
+#define AACE_ENGINE_LOOPBACKDETECTOR_LOOPBACK_CORRELATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace loopbackDetector {
+
+/**
+ * Compares the energy envelope of the microphone audio that contained a wakeword with the energy envelope of the
+ * loopback reference. A wakeword picked up from the speakers follows the loopback envelope closely, while a
+ * wakeword spoken by the user does not. Comparing envelopes rather than raw samples keeps the comparison cheap
+ * and tolerant of the room response and of residual echo cancellation.
+ */
+class LoopbackCorrelator {
+public:
+    /**
+     * @param frameSize The number of samples in one envelope frame.
+     */
+    LoopbackCorrelator(size_t frameSize);
+
+    /**
+     * Computes the log energy of each complete frame of @c samples.
+     */
+    std::vector<float> computeEnvelope(const int16_t* samples, size_t count) const;
+
+    /**
+     * Slides the @c window envelope over the @c reference envelope and returns the highest normalized
+     * cross-correlation found.
+     *
+     * @return The highest positive correlation, or @c 0 if either envelope is too short or flat. A result of @c 0
+     *         reads as "no match", so a wakeword that cannot be compared is accepted.
+     */
+    float correlate(const std::vector<float>& window, const std::vector<float>& reference) const;
+
+    /**
+     * Computes the envelopes of @c window and @c reference and correlates them.
+     */
+    float correlate(
+        const int16_t* window,
+        size_t windowCount,
+        const int16_t* reference,
+        size_t referenceCount) const;
+
+    size_t getFrameSize() const;
+
+private:
+    size_t m_frameSize;
+};
+
+}  // namespace loopbackDetector
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_LOOPBACKDETECTOR_LOOPBACK_CORRELATOR_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cmath>
+#include <AACE/Engine/LoopbackDetector/LoopbackCorrelator.h>
+
+namespace aace {
+namespace engine {
+namespace loopbackDetector {
+
+/// The minimum number of frames needed for a meaningful correlation.
+static const size_t MIN_CORRELATION_FRAMES = 10;
+
+/// Variance below which an envelope is treated as flat (for example silence).
+static const double MIN_ENVELOPE_VARIANCE = 1e-6;
+
+LoopbackCorrelator::LoopbackCorrelator(size_t frameSize) : m_frameSize(frameSize > 0 ? frameSize : 1) {
+}
+
+std::vector<float> LoopbackCorrelator::computeEnvelope(const int16_t* samples, size_t count) const {
+    std::vector<float> envelope;
+    if (samples == nullptr) {
+        return envelope;
+    }
+    envelope.reserve(count / m_frameSize);
+    for (size_t frame = 0; frame + m_frameSize <= count; frame += m_frameSize) {
+        float energy = 0;
+        for (size_t j = 0; j < m_frameSize; j++) {
+            float sample = samples[frame + j];
+            energy += sample * sample;
+        }
+        envelope.push_back(std::log10(energy / m_frameSize + 1.0f));
+    }
+    return envelope;
+}
+
+float LoopbackCorrelator::correlate(const std::vector<float>& window, const std::vector<float>& reference) const {
+    const size_t windowSize = window.size();
+    if (windowSize < MIN_CORRELATION_FRAMES || reference.size() < windowSize) {
+        return 0;
+    }
+
+    // center the window so the mean of each reference segment drops out of the cross term
+    double windowMean = 0;
+    for (auto value : window) {
+        windowMean += value;
+    }
+    windowMean /= windowSize;
+    std::vector<double> centered(windowSize);
+    double windowVariance = 0;
+    for (size_t j = 0; j < windowSize; j++) {
+        centered[j] = window[j] - windowMean;
+        windowVariance += centered[j] * centered[j];
+    }
+    if (windowVariance < MIN_ENVELOPE_VARIANCE * windowSize) {
+        return 0;
+    }
+
+    // prefix sums give the mean and variance of each reference segment in constant time
+    std::vector<double> sum(reference.size() + 1, 0);
+    std::vector<double> sumOfSquares(reference.size() + 1, 0);
+    for (size_t j = 0; j < reference.size(); j++) {
+        sum[j + 1] = sum[j] + reference[j];
+        sumOfSquares[j + 1] = sumOfSquares[j] + static_cast<double>(reference[j]) * reference[j];
+    }
+
+    float best = 0;
+    for (size_t offset = 0; offset + windowSize <= reference.size(); offset++) {
+        double segmentSum = sum[offset + windowSize] - sum[offset];
+        double segmentVariance =
+            sumOfSquares[offset + windowSize] - sumOfSquares[offset] - segmentSum * segmentSum / windowSize;
+        if (segmentVariance < MIN_ENVELOPE_VARIANCE * windowSize) {
+            continue;
+        }
+        double product = 0;
+        for (size_t j = 0; j < windowSize; j++) {
+            product += centered[j] * reference[offset + j];
+        }
+        float correlation = static_cast<float>(product / std::sqrt(windowVariance * segmentVariance));
+        if (correlation > best) {
+            best = correlation;
+        }
+    }
+    return best;
+}
+
+float LoopbackCorrelator::correlate(
+    const int16_t* window,
+    size_t windowCount,
+    const int16_t* reference,
+    size_t referenceCount) const {
+    return correlate(computeEnvelope(window, windowCount), computeEnvelope(reference, referenceCount));
+}
+
+size_t LoopbackCorrelator::getFrameSize() const {
+    return m_frameSize;
+}
+
+}  // namespace loopbackDetector
+}  // namespace engine
+}  // namespace aace
@@ -15,7 +15,9 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <climits>
+#include <vector>
 #include <AACE/Engine/Core/EngineMacros.h>
 #include "LoopbackDetector.h"
 
@@ -23,34 +25,35 @@ namespace aace {
 namespace engine {
 namespace loopbackDetector {
 
-/// The maximum number of readers of the stream.
-static const size_t MAX_READERS = 2;
-
-/// The amount of audio data to keep in the ring buffer.
-static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(5);
+/// The duration of one frame of the energy envelopes compared by the correlation prefilter.
+static const std::chrono::milliseconds CORRELATION_FRAME_DURATION = std::chrono::milliseconds(10);
 
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.alexa.LoopbackDetector");
 
-LoopbackDetector::LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) :
+LoopbackDetector::LoopbackDetector(
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    const LoopbackDetectorOptions& options) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_audioFormat(audioFormat),
-        m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT) {
+        m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT),
+        m_options(options),
+        m_correlator(audioFormat.sampleRateHz * CORRELATION_FRAME_DURATION.count() / 1000) {
 }
 
 bool LoopbackDetector::initialize(
     const std::string& defaultLocale,
-    std::shared_ptr<audio::AudioManagerInterface> audioManager,
-    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter) {
+    std::shared_ptr<alexa::AudioInputStreamManager> audioInputStreamManager,
+    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter,
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> audioFocusManager) {
     try {
-        ThrowIfNull(audioManager, "invalidAudioManager");
-
-        // create the audio channel
-        m_audioInputChannel = audioManager->openAudioInputChannel(
-            "LoopbackDetector", audio::AudioManagerInterface::AudioInputType::LOOPBACK);
-        ThrowIfNull(m_audioInputChannel, "invalidAudioInputChannel");
+        m_audioInputStreamManager = audioInputStreamManager;
+        ThrowIfNull(m_audioInputStreamManager, "invalidAudioInputStreamManager");
 
-        ThrowIfNot(initializeAudioInputStream(), "initializeAudioInputStreamFailed");
+        // get the shared capture ring of the loopback audio input
+        m_audioInputStream = m_audioInputStreamManager->getAudioInputStream(
+            audio::AudioManagerInterface::AudioInputType::LOOPBACK, "LoopbackDetector");
+        ThrowIfNull(m_audioInputStream, "invalidAudioInputStream");
 
         m_wakewordEngineAdapter = wakewordEngineAdapter;
         ThrowIfNull(m_wakewordEngineAdapter, "invalidWakewordEngineAdapter");
@@ -60,6 +63,14 @@ bool LoopbackDetector::initialize(
             "wakewordInitializeFailed");
         m_wakewordEngineAdapter->addKeyWordObserver(shared_from_this());
 
+        if (m_options.gatingEnabled) {
+            // detection starts when an output channel acquires focus
+            m_audioFocusManager = audioFocusManager;
+            ThrowIfNull(m_audioFocusManager, "invalidAudioFocusManager");
+            m_audioFocusManager->addObserver(shared_from_this());
+            return true;
+        }
+
         // Enable WW
         ThrowIfNot(m_wakewordEngineAdapter->enable(), "enableFailed");
 
@@ -76,15 +87,18 @@ bool LoopbackDetector::initialize(
 std::shared_ptr<LoopbackDetector> LoopbackDetector::create(
     const std::string& defaultLocale,
     const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
-    std::shared_ptr<audio::AudioManagerInterface> audioManager,
-    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter) {
+    std::shared_ptr<alexa::AudioInputStreamManager> audioInputStreamManager,
+    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter,
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> audioFocusManager,
+    const LoopbackDetectorOptions& options) {
     std::shared_ptr<LoopbackDetector> loopbackDetector = nullptr;
 
     try {
-        loopbackDetector = std::shared_ptr<LoopbackDetector>(new LoopbackDetector(audioFormat));
+        loopbackDetector = std::shared_ptr<LoopbackDetector>(new LoopbackDetector(audioFormat, options));
 
         ThrowIfNot(
-            loopbackDetector->initialize(defaultLocale, audioManager, wakewordEngineAdapter),
+            loopbackDetector->initialize(
+                defaultLocale, audioInputStreamManager, wakewordEngineAdapter, audioFocusManager),
             "initializeLoopbackDetectorFailed");
 
         return loopbackDetector;
@@ -98,11 +112,23 @@ std::shared_ptr<LoopbackDetector> LoopbackDetector::create(
 }
 
 void LoopbackDetector::doShutdown() {
-    if (m_audioInputWriter != nullptr) {
-        m_audioInputWriter->close();
-        m_audioInputWriter.reset();
+    if (m_audioFocusManager != nullptr) {
+        m_audioFocusManager->removeObserver(shared_from_this());
+        m_audioFocusManager.reset();
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_gateMutex);
+        m_isShuttingDown = true;
+    }
+    m_gateCV.notify_all();
+    m_executor.shutdown();
+
+    if (m_currentCaptureId != alexa::AudioInputStreamManager::INVALID_CAPTURE) {
+        stopAudioInput();
+    }
+    m_audioInputStreamManager.reset();
+
     if (m_wakewordEngineAdapter != nullptr) {
         m_wakewordEngineAdapter->disable();
         m_wakewordEngineAdapter->removeKeyWordObserver(shared_from_this());
@@ -110,46 +136,13 @@ void LoopbackDetector::doShutdown() {
     }
 }
 
-bool LoopbackDetector::initializeAudioInputStream() {
-    try {
-        size_t size = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
-            m_audioFormat.sampleRateHz * AMOUNT_OF_AUDIO_DATA_IN_BUFFER.count(), m_wordSize, MAX_READERS);
-        auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(size);
-        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
-
-        // create the audio input stream
-        m_audioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, m_wordSize, MAX_READERS);
-        ThrowIfNull(m_audioInputStream, "couldNotCreateAudioInputStream");
-
-        // create the audio input writer
-        m_audioInputWriter = m_audioInputStream->createWriter(
-            alexaClientSDK::avsCommon::avs::AudioInputStream::Writer::Policy::NONBLOCKABLE);
-        ThrowIfNull(m_audioInputWriter, "couldNotCreateAudioInputWriter");
-
-        return true;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "initializeAudioInputStream").d("reason", ex.what()));
-        m_audioInputStream.reset();
-        m_audioInputWriter.reset();
-        return false;
-    }
-}
-
 bool LoopbackDetector::startAudioInput() {
     try {
-        std::weak_ptr<LoopbackDetector> wp = shared_from_this();
+        m_currentCaptureId =
+            m_audioInputStreamManager->startCapture(audio::AudioManagerInterface::AudioInputType::LOOPBACK);
 
-        m_currentChannelId = m_audioInputChannel->start([wp](const int16_t* data, const size_t size) {
-            if (auto sp = wp.lock()) {
-                sp->write(data, size);
-            } else {
-                AACE_ERROR(LX(TAG, "startAudioInput").d("reason", "invalidWeakPtrReference"));
-            }
-        });
-
-        // throw an exception if we failed to start the audio input channel
-        ThrowIf(
-            m_currentChannelId == audio::AudioInputChannelInterface::INVALID_CHANNEL, "audioInputChannelStartFailed");
+        // throw an exception if we failed to start the audio capture
+        ThrowIf(m_currentCaptureId == alexa::AudioInputStreamManager::INVALID_CAPTURE, "audioInputCaptureStartFailed");
 
         return true;
     } catch (std::exception& ex) {
@@ -160,35 +153,51 @@ bool LoopbackDetector::startAudioInput() {
 
 bool LoopbackDetector::stopAudioInput() {
     try {
-        ThrowIf(m_currentChannelId == audio::AudioInputChannelInterface::INVALID_CHANNEL, "invalidAudioChannelId");
-        m_audioInputChannel->stop(m_currentChannelId);
+        ThrowIf(m_currentCaptureId == alexa::AudioInputStreamManager::INVALID_CAPTURE, "invalidAudioCaptureId");
+        m_audioInputStreamManager->stopCapture(
+            audio::AudioManagerInterface::AudioInputType::LOOPBACK, m_currentCaptureId);
 
-        // reset the channel id
-        m_currentChannelId = audio::AudioInputChannelInterface::INVALID_CHANNEL;
+        // reset the capture id
+        m_currentCaptureId = alexa::AudioInputStreamManager::INVALID_CAPTURE;
 
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "stopAudioInput").d("reason", ex.what()));
-        m_currentChannelId = audio::AudioInputChannelInterface::INVALID_CHANNEL;
+        m_currentCaptureId = alexa::AudioInputStreamManager::INVALID_CAPTURE;
         return false;
     }
 }
 
-ssize_t LoopbackDetector::write(const int16_t* data, const size_t size) {
-    try {
-        ThrowIfNull(m_audioInputWriter, "nullAudioInputWriter");
-
-        ssize_t result = m_audioInputWriter->write(data, size);
-        ThrowIf(result < 0, "errorWritingData");
+bool LoopbackDetector::shouldBlock(
+    const std::string& wakeword,
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+    const std::chrono::milliseconds& timeout) {
+    if (isGateClosed(timeout)) {
+        AACE_DEBUG(LX(TAG, "shouldBlock").d("wakeword", wakeword).m("noOutputActive"));
+        return false;
+    }
 
-        return result;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "write").d("reason", ex.what()));
-        return -1;
+    if (m_options.correlationEnabled) {
+        // a wakeword that does not resemble the speaker output cannot be a self reference,
+        // so there is no need to wait for the loopback wakeword engine
+        auto correlation = correlateWithLoopback(stream, beginIndex, endIndex);
+        AACE_DEBUG(LX(TAG, "shouldBlock").d("wakeword", wakeword).d("correlation", correlation));
+        if (correlation >= 0 && correlation < m_options.correlationThreshold) {
+            return false;
+        }
     }
+
+    return shouldBlock(wakeword, timeout);
 }
 
 bool LoopbackDetector::shouldBlock(const std::string& wakeword, const std::chrono::milliseconds& timeout) {
+    if (isGateClosed(timeout)) {
+        AACE_DEBUG(LX(TAG, "shouldBlock").d("wakeword", wakeword).m("noOutputActive"));
+        return false;
+    }
+
     std::unique_lock<std::mutex> lock(m_detectionMutex);
 
     AACE_DEBUG(LX(TAG, "shouldBlock").d("wakeword", wakeword));
@@ -219,6 +228,128 @@ void LoopbackDetector::onKeyWordDetected(
     m_detectionCV.notify_all();
 }
 
+void LoopbackDetector::onFocusChanged(
+    const std::string& channelName,
+    alexaClientSDK::avsCommon::avs::FocusState newFocus) {
+    bool isOutputActive;
+    {
+        std::lock_guard<std::mutex> lock(m_gateMutex);
+        m_channelFocus[channelName] = newFocus;
+        isOutputActive = isOutputActiveLocked();
+    }
+
+    if (isOutputActive) {
+        // wake up a pending close so that it sees the output is active again
+        m_gateCV.notify_all();
+        m_executor.submit([this] { openGate(); });
+    } else {
+        m_executor.submit([this] { closeGateAfterHoldTime(); });
+    }
+}
+
+void LoopbackDetector::openGate() {
+    try {
+        {
+            std::lock_guard<std::mutex> lock(m_gateMutex);
+            ReturnIf(m_gateOpen || m_isShuttingDown);
+            m_gateOpen = true;
+        }
+
+        AACE_DEBUG(LX(TAG));
+        ThrowIfNot(m_wakewordEngineAdapter->enable(), "enableFailed");
+        ThrowIfNot(startAudioInput(), "platformStartAudioInputFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+    }
+}
+
+void LoopbackDetector::closeGateAfterHoldTime() {
+    try {
+        {
+            std::unique_lock<std::mutex> lock(m_gateMutex);
+            m_gateCV.wait_for(
+                lock, m_options.gateHoldTime, [this] { return m_isShuttingDown || isOutputActiveLocked(); });
+            ReturnIf(!m_gateOpen || m_isShuttingDown || isOutputActiveLocked());
+            m_gateOpen = false;
+            m_gateClosedTime = std::chrono::system_clock::now();
+        }
+
+        AACE_DEBUG(LX(TAG));
+        ThrowIfNot(stopAudioInput(), "platformStopAudioInputFailed");
+        ThrowIfNot(m_wakewordEngineAdapter->disable(), "disableFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+    }
+}
+
+bool LoopbackDetector::isGateClosed(const std::chrono::milliseconds& timeout) {
+    if (!m_options.gatingEnabled) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_gateMutex);
+    // a detection just before the gate closed may still belong to the wakeword being verified
+    return !m_gateOpen && (std::chrono::system_clock::now() - m_gateClosedTime) >= timeout;
+}
+
+bool LoopbackDetector::isOutputActiveLocked() const {
+    for (const auto& next : m_channelFocus) {
+        if (next.second != alexaClientSDK::avsCommon::avs::FocusState::NONE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+float LoopbackDetector::correlateWithLoopback(
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+    alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex) {
+    using AudioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream;
+    using Index = AudioInputStream::Index;
+
+    try {
+        ThrowIfNull(stream, "invalidStream");
+        ThrowIf(
+            beginIndex == KeyWordObserverInterface::UNSPECIFIED_INDEX ||
+                endIndex == KeyWordObserverInterface::UNSPECIFIED_INDEX || endIndex <= beginIndex,
+            "invalidWakewordIndex");
+        ThrowIf(stream->getWordSize() != m_wordSize, "wordSizeMismatch");
+
+        auto micReader = stream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING, true);
+        ThrowIfNull(micReader, "createMicrophoneReaderFailed");
+        auto loopbackReader = m_audioInputStream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING, true);
+        ThrowIfNull(loopbackReader, "createLoopbackReaderFailed");
+
+        // both streams are written in real time, so the wakeword is as far behind the microphone writer
+        // as the matching reference is behind the loopback writer
+        Index micWriter = micReader->tell();
+        Index loopbackWriter = loopbackReader->tell();
+        ThrowIf(micWriter < endIndex, "invalidWakewordIndex");
+        Index behindWriter = micWriter - endIndex;
+        Index windowSize = endIndex - beginIndex;
+        Index maxLag = m_audioFormat.sampleRateHz * m_options.maxCorrelationLag.count() / 1000;
+        ThrowIf(loopbackWriter < behindWriter + windowSize + maxLag, "notEnoughLoopbackAudio");
+
+        Index referenceBegin = loopbackWriter - behindWriter - windowSize - maxLag;
+        Index referenceEnd = std::min(loopbackWriter, loopbackWriter - behindWriter + maxLag);
+
+        std::vector<int16_t> window(windowSize);
+        ThrowIfNot(micReader->seek(beginIndex), "seekMicrophoneFailed");
+        ThrowIf(micReader->read(window.data(), window.size()) != static_cast<ssize_t>(window.size()), "readFailed");
+
+        std::vector<int16_t> reference(referenceEnd - referenceBegin);
+        ThrowIfNot(loopbackReader->seek(referenceBegin), "seekLoopbackFailed");
+        ThrowIf(
+            loopbackReader->read(reference.data(), reference.size()) != static_cast<ssize_t>(reference.size()),
+            "readFailed");
+
+        return m_correlator.correlate(window.data(), window.size(), reference.data(), reference.size());
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()));
+        return -1;
+    }
+}
+
 }  // namespace loopbackDetector
 }  // namespace engine
 }  // namespace aace
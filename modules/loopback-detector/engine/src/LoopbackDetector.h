@@ -21,38 +21,79 @@
 #include <memory>
 #include <string>
 #include <chrono>
+#include <unordered_map>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/SDKInterfaces/FocusManagerInterface.h>
+#include <AVSCommon/SDKInterfaces/FocusManagerObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/KeyWordObserverInterface.h>
-#include <AACE/Engine/Audio/AudioManagerInterface.h>
+#include <AACE/Engine/Alexa/AudioInputStreamManager.h>
 #include <AACE/Engine/Alexa/InitiatorVerifier.h>
 #include <AACE/Engine/Alexa/WakewordEngineAdapter.h>
+#include <AACE/Engine/Utils/Threading/Executor.h>
+
+#include <AACE/Engine/LoopbackDetector/LoopbackCorrelator.h>
 
 namespace aace {
 namespace engine {
 namespace loopbackDetector {
 
+/// Options for gating loopback detection and for the correlation prefilter.
+struct LoopbackDetectorOptions {
+    /// Run loopback detection only while Alexa has audio output focus.
+    bool gatingEnabled = false;
+    /// How long detection keeps running after the last output channel releases focus.
+    std::chrono::milliseconds gateHoldTime = std::chrono::milliseconds(1500);
+    /// Compare the wakeword audio with the loopback reference before waiting for the loopback wakeword engine.
+    bool correlationEnabled = false;
+    /// The correlation below which the wakeword is accepted without waiting for the loopback wakeword engine.
+    float correlationThreshold = 0.6f;
+    /// The maximum delay between the loopback reference and the microphone audio.
+    std::chrono::milliseconds maxCorrelationLag = std::chrono::milliseconds(250);
+};
+
 class LoopbackDetector
         : public alexaClientSDK::avsCommon::sdkInterfaces::KeyWordObserverInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerObserverInterface
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<LoopbackDetector>
         , public alexa::InitiatorVerifier {
 private:
-    LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat);
+    LoopbackDetector(
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+        const LoopbackDetectorOptions& options);
 
     bool initialize(
         const std::string& defaultLocale,
-        std::shared_ptr<audio::AudioManagerInterface> audioManager,
-        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter);
+        std::shared_ptr<alexa::AudioInputStreamManager> audioInputStreamManager,
+        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> audioFocusManager);
 
 public:
+    /**
+     * Creates a @c LoopbackDetector.
+     *
+     * @param audioInputStreamManager The manager of the shared capture ring of the @c LOOPBACK audio input.
+     * @param audioFocusManager The audio focus manager used to detect when Alexa is playing audio. Required if
+     *        gating is enabled in @c options.
+     * @param options The gating and correlation options.
+     */
     static std::shared_ptr<LoopbackDetector> create(
         const std::string& defaultLocale,
         const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
-        std::shared_ptr<audio::AudioManagerInterface> audioManager,
-        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr);
+        std::shared_ptr<alexa::AudioInputStreamManager> audioInputStreamManager,
+        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr,
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> audioFocusManager = nullptr,
+        const LoopbackDetectorOptions& options = LoopbackDetectorOptions());
 
     bool shouldBlock(const std::string& wakeword, const std::chrono::milliseconds& timeout) override;
+    bool shouldBlock(
+        const std::string& wakeword,
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex,
+        const std::chrono::milliseconds& timeout) override;
+    using alexa::InitiatorVerifier::shouldBlock;
 
     // KeyWordObserverInterface
     void onKeyWordDetected(
@@ -63,24 +104,46 @@ public:
         alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex = KeyWordObserverInterface::UNSPECIFIED_INDEX,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr) override;
 
+    // FocusManagerObserverInterface
+    void onFocusChanged(const std::string& channelName, alexaClientSDK::avsCommon::avs::FocusState newFocus)
+        override;
+
 protected:
     virtual void doShutdown() override;
 
 private:
-    bool initializeAudioInputStream();
-
     bool startAudioInput();
     bool stopAudioInput();
-    ssize_t write(const int16_t* data, const size_t size);
+
+    /// Starts the loopback audio input and the wakeword engine if they are not running.
+    void openGate();
+
+    /// Stops the loopback audio input and the wakeword engine once no output has been active for the hold time.
+    void closeGateAfterHoldTime();
+
+    /// Returns @c true if loopback detection is gated and has been idle for longer than @c timeout.
+    bool isGateClosed(const std::chrono::milliseconds& timeout);
+
+    /// Returns @c true if any audio focus channel is active. @c m_gateMutex must be held.
+    bool isOutputActiveLocked() const;
+
+    /**
+     * Correlates the wakeword audio in @c stream with the loopback reference recorded at the same time.
+     *
+     * @return The correlation, or a negative value if the audio is not available.
+     */
+    float correlateWithLoopback(
+        std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> stream,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index beginIndex,
+        alexaClientSDK::avsCommon::avs::AudioInputStream::Index endIndex);
 
 private:
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    /// The shared capture ring of the @c LOOPBACK audio input type.
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> m_audioInputStream;
-    std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
 
-    std::shared_ptr<audio::AudioInputChannelInterface> m_audioInputChannel;
-    audio::AudioInputChannelInterface::ChannelId m_currentChannelId =
-        audio::AudioInputChannelInterface::INVALID_CHANNEL;
+    std::shared_ptr<alexa::AudioInputStreamManager> m_audioInputStreamManager;
+    alexa::AudioInputStreamManager::CaptureId m_currentCaptureId = alexa::AudioInputStreamManager::INVALID_CAPTURE;
 
     unsigned int m_wordSize;
 
@@ -90,6 +153,19 @@ private:
     std::condition_variable m_detectionCV;
 
     std::chrono::time_point<std::chrono::system_clock> m_lastDetection;
+
+    LoopbackDetectorOptions m_options;
+    LoopbackCorrelator m_correlator;
+
+    /// Gating
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> m_audioFocusManager;
+    std::mutex m_gateMutex;
+    std::condition_variable m_gateCV;
+    std::unordered_map<std::string, alexaClientSDK::avsCommon::avs::FocusState> m_channelFocus;
+    bool m_gateOpen = false;
+    bool m_isShuttingDown = false;
+    std::chrono::time_point<std::chrono::system_clock> m_gateClosedTime;
+    aace::engine::utils::threading::Executor m_executor{"LoopbackDetector"};
 };
 
 }  // namespace loopbackDetector
@@ -17,8 +17,8 @@
 
 #include <climits>
 #include <AACE/Engine/Core/EngineMacros.h>
-#include <AACE/Engine/Audio/AudioManagerInterface.h>
 #include <AACE/Engine/Utils/JSON/JSON.h>
+#include <AACE/Engine/Alexa/AlexaComponentInterface.h>
 #include <AACE/Engine/Alexa/WakewordEngineManager.h>
 #include "AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h"
 #include <AVSCommon/Utils/AudioFormat.h>
@@ -56,6 +56,29 @@ bool LoopbackDetectorEngineService::configure(std::shared_ptr<std::istream> conf
             m_wakewordEngineName = configRoot["wakewordEngine"].GetString();
         }
 
+        if (configRoot.HasMember("gating") && configRoot["gating"].IsObject()) {
+            auto gating = configRoot["gating"].GetObject();
+            if (gating.HasMember("enabled") && gating["enabled"].IsBool()) {
+                m_options.gatingEnabled = gating["enabled"].GetBool();
+            }
+            if (gating.HasMember("holdTime") && gating["holdTime"].IsUint()) {
+                m_options.gateHoldTime = std::chrono::milliseconds(gating["holdTime"].GetUint());
+            }
+        }
+
+        if (configRoot.HasMember("correlation") && configRoot["correlation"].IsObject()) {
+            auto correlation = configRoot["correlation"].GetObject();
+            if (correlation.HasMember("enabled") && correlation["enabled"].IsBool()) {
+                m_options.correlationEnabled = correlation["enabled"].GetBool();
+            }
+            if (correlation.HasMember("threshold") && correlation["threshold"].IsNumber()) {
+                m_options.correlationThreshold = correlation["threshold"].GetFloat();
+            }
+            if (correlation.HasMember("maxLag") && correlation["maxLag"].IsUint()) {
+                m_options.maxCorrelationLag = std::chrono::milliseconds(correlation["maxLag"].GetUint());
+            }
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_WARN(LX(TAG, "configure").d("reason", ex.what()));
@@ -107,14 +130,29 @@ bool LoopbackDetectorEngineService::prepareVerifier() {
         audioFormat.encoding = AudioFormat::Encoding::LPCM;
         audioFormat.layout = AudioFormat::Layout::INTERLEAVED;
 
-        auto audioManager = getContext()->getServiceInterface<audio::AudioManagerInterface>("aace.audio");
         auto propertyManager =
             getContext()->getServiceInterface<aace::engine::propertyManager::PropertyManagerServiceInterface>(
                 "aace.propertyManager");
         ThrowIfNull(propertyManager, "nullPropertyManagerServiceInterface");
         auto locale = propertyManager->getProperty(aace::alexa::property::LOCALE);
 
-        m_loopbackDetector = LoopbackDetector::create(locale, audioFormat, audioManager, secondaryAdapter);
+        auto alexaComponents =
+            getContext()->getServiceInterface<aace::engine::alexa::AlexaComponentInterface>("aace.alexa");
+        ThrowIfNull(alexaComponents, "invalidAlexaComponentInterface");
+
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> audioFocusManager;
+        if (m_options.gatingEnabled) {
+            audioFocusManager = alexaComponents->getAudioFocusManager();
+            ThrowIfNull(audioFocusManager, "invalidAudioFocusManager");
+        }
+
+        m_loopbackDetector = LoopbackDetector::create(
+            locale,
+            audioFormat,
+            alexaComponents->getAudioInputStreamManager(),
+            secondaryAdapter,
+            audioFocusManager,
+            m_options);
         ThrowIfNull(m_loopbackDetector, "Failed to create LoopbackDetector");
 
         return true;
@@ -45,6 +45,7 @@ private:
     bool prepareVerifier();
 
     std::string m_wakewordEngineName;
+    LoopbackDetectorOptions m_options;
     std::shared_ptr<LoopbackDetector> m_loopbackDetector;
 };
 
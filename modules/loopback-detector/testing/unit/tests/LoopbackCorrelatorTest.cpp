@@ -0,0 +1,117 @@
+/*
+ * Copyright Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: LicenseRef-.amazon.com.-ASL-1.0
+ *
+ * Licensed under the Amazon Software License (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/asl/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <AACE/Engine/LoopbackDetector/LoopbackCorrelator.h>
+
+using namespace aace::engine::loopbackDetector;
+
+/// The sample rate of the test audio.
+static const size_t SAMPLE_RATE_HZ = 16000;
+/// The number of samples in one 10 ms envelope frame.
+static const size_t FRAME_SIZE = SAMPLE_RATE_HZ / 100;
+/// The number of samples in one 50 ms segment of constant loudness.
+static const size_t SEGMENT_SIZE = SAMPLE_RATE_HZ / 20;
+/// The correlation threshold used by the loopback detector by default.
+static const float DEFAULT_THRESHOLD = 0.6f;
+
+class LoopbackCorrelatorTest : public ::testing::Test {
+protected:
+    LoopbackCorrelatorTest() : m_correlator(FRAME_SIZE) {
+    }
+
+    /**
+     * Generates noise whose loudness changes every 50 ms, like speech.
+     */
+    static std::vector<int16_t> generateSpeechLikeAudio(size_t count, unsigned int seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> loudness(100, 10000);
+        std::uniform_real_distribution<float> noise(-1, 1);
+        std::vector<int16_t> samples(count);
+        float amplitude = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (i % SEGMENT_SIZE == 0) {
+                amplitude = loudness(generator);
+            }
+            samples[i] = static_cast<int16_t>(amplitude * noise(generator));
+        }
+        return samples;
+    }
+
+    LoopbackCorrelator m_correlator;
+};
+
+TEST_F(LoopbackCorrelatorTest, ComputesOneEnvelopeValuePerCompleteFrame) {
+    std::vector<int16_t> samples(FRAME_SIZE * 3 + FRAME_SIZE / 2, 100);
+    auto envelope = m_correlator.computeEnvelope(samples.data(), samples.size());
+    ASSERT_EQ(envelope.size(), 3u);
+    EXPECT_FLOAT_EQ(envelope[0], envelope[2]);
+    EXPECT_GT(envelope[0], 0);
+
+    std::vector<int16_t> silence(FRAME_SIZE, 0);
+    auto silentEnvelope = m_correlator.computeEnvelope(silence.data(), silence.size());
+    ASSERT_EQ(silentEnvelope.size(), 1u);
+    EXPECT_FLOAT_EQ(silentEnvelope[0], 0);
+
+    EXPECT_TRUE(m_correlator.computeEnvelope(nullptr, samples.size()).empty());
+}
+
+TEST_F(LoopbackCorrelatorTest, CorrelatedInputMatches) {
+    // The wakeword is a quieter, delayed copy of part of the speaker output
+    auto reference = generateSpeechLikeAudio(SAMPLE_RATE_HZ * 2, 1);
+    size_t offset = SAMPLE_RATE_HZ * 3 / 10;
+    std::vector<int16_t> window(reference.begin() + offset, reference.begin() + offset + SAMPLE_RATE_HZ * 8 / 10);
+    for (auto& sample : window) {
+        sample /= 4;
+    }
+    float correlation = m_correlator.correlate(window.data(), window.size(), reference.data(), reference.size());
+    EXPECT_GT(correlation, 0.9f);
+    EXPECT_LE(correlation, 1.0f + 1e-5f);
+}
+
+TEST_F(LoopbackCorrelatorTest, UncorrelatedInputDoesNotMatch) {
+    // The wakeword is spoken over unrelated speaker output
+    auto reference = generateSpeechLikeAudio(SAMPLE_RATE_HZ * 2, 1);
+    auto window = generateSpeechLikeAudio(SAMPLE_RATE_HZ * 8 / 10, 2);
+    float correlation = m_correlator.correlate(window.data(), window.size(), reference.data(), reference.size());
+    EXPECT_GE(correlation, 0);
+    EXPECT_LT(correlation, DEFAULT_THRESHOLD);
+}
+
+TEST_F(LoopbackCorrelatorTest, SilentInputDoesNotMatch) {
+    auto audio = generateSpeechLikeAudio(SAMPLE_RATE_HZ * 2, 1);
+    std::vector<int16_t> silence(SAMPLE_RATE_HZ * 2, 0);
+
+    // Silent speaker output
+    EXPECT_EQ(m_correlator.correlate(audio.data(), SAMPLE_RATE_HZ, silence.data(), silence.size()), 0);
+    // Silent microphone audio
+    EXPECT_EQ(m_correlator.correlate(silence.data(), SAMPLE_RATE_HZ, audio.data(), audio.size()), 0);
+}
+
+TEST_F(LoopbackCorrelatorTest, ShortInputDoesNotMatch) {
+    auto reference = generateSpeechLikeAudio(SAMPLE_RATE_HZ * 2, 1);
+
+    // Fewer than 10 envelope frames
+    EXPECT_EQ(m_correlator.correlate(reference.data(), FRAME_SIZE * 9, reference.data(), reference.size()), 0);
+    // A reference shorter than the window
+    EXPECT_EQ(m_correlator.correlate(reference.data(), SAMPLE_RATE_HZ, reference.data(), SAMPLE_RATE_HZ / 2), 0);
+}
@@ -63,7 +63,7 @@ struct MobileBridgeEngineImpl::Impl {
         m_config = config ? config : std::make_shared<Config>(Config::getDefault());
     }
 
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"MobileBridge"};
 
     bool start(int tunFd) {
         return m_executor.submit([this, tunFd] { return execStart(tunFd); }).get();
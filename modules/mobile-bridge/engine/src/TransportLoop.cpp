@@ -63,7 +63,7 @@ struct TransportLoop::Impl {
     std::shared_ptr<aace::mobileBridge::Transport> m_transport;
     std::weak_ptr<Listener> m_listener;
 
-    aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_executor{"MobileBridge.transportLoop"};
     std::function<void()> m_abortConnectionLoop;
     std::atomic<bool> m_quit;
     std::condition_variable m_cvQuit;
@@ -31,6 +31,7 @@
 #include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 
 #include "NavigationHandlerInterface.h"
+#include "NavigationState.h"
 
 namespace aace {
 namespace engine {
@@ -201,11 +202,6 @@ private:
     void showPreviousWaypointsError(AgentId::IdType agentId, std::string code, std::string description);
     void navigateToPreviousWaypointError(AgentId::IdType agentId, std::string code, std::string description);
 
-    /**
-     * Check Navigation State for validity
-     */
-    bool isNavigationStateValid(std::string navigationState);
-
     /**
      * @name Executor Thread Variables
      *
@@ -229,9 +225,12 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The last known NavigationState payload
+    /// The last valid NavigationState payload provided by the platform
     std::string m_navigationStatePayload;
 
+    /// The navigation state parsed from @c m_navigationStatePayload
+    std::shared_ptr<NavigationState> m_navigationState;
+
     /// The metric recorder.
     std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
+#define AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+/**
+ * The parsed and validated navigation state reported by the platform, with the route shape reduced to the number
+ * of points allowed in the @c Navigation.NavigationState context.
+ */
+class NavigationState {
+public:
+    /// A latitude-longitude pair, in degrees.
+    struct Coordinate {
+        double latitude;
+        double longitude;
+    };
+
+    /// The maximum number of shape points allowed in the context.
+    static constexpr size_t MAXIMUM_SHAPES_IN_CONTEXT = 100;
+
+private:
+    NavigationState(std::string contextPayload, size_t shapeCount);
+
+public:
+    /**
+     * Parses and validates a navigation state payload. If the route has more than @c maxShapes shape points, it is
+     * simplified to @c maxShapes points with @c simplifyShapes().
+     *
+     * @param payload The navigation state payload provided by the platform.
+     * @param maxShapes The maximum number of shape points in the context payload.
+     * @return The navigation state, or @c nullptr if @c payload is not valid.
+     */
+    static std::shared_ptr<NavigationState> create(
+        const std::string& payload,
+        size_t maxShapes = MAXIMUM_SHAPES_IN_CONTEXT);
+
+    /**
+     * Selects at most @c maxShapes points of a route that best preserve its shape. The first and last points are
+     * always selected, so the selection spans the whole route. The remaining points are selected with a
+     * Douglas-Peucker simplification that repeatedly keeps the point farthest from the simplified route.
+     *
+     * @param shapes The points of the route, in driving order.
+     * @param maxShapes The maximum number of points to select.
+     * @return The indices of the selected points, in ascending order.
+     */
+    static std::vector<size_t> simplifyShapes(const std::vector<Coordinate>& shapes, size_t maxShapes);
+
+    /// Returns the payload to report in the @c Navigation.NavigationState context.
+    const std::string& getContextPayload() const;
+
+    /// Returns the number of shape points in the payload provided by the platform.
+    size_t getShapeCount() const;
+
+private:
+    /// The serialized context payload.
+    std::string m_contextPayload;
+
+    /// The number of shape points provided by the platform.
+    size_t m_shapeCount;
+};
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
@@ -16,7 +16,6 @@
 #include <stdexcept>
 
 #include <string>
-#include <rapidjson/error/en.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
@@ -70,14 +69,7 @@ static const std::string NAVIGATION_CAPABILITY_INTERFACE_VERSION = "2.0";
 static const std::string CAPABILITY_INTERFACE_NAVIGATION_PROVIDER_NAME_KEY = "provider";
 
 /// NavigationState state accepted values
-static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
 static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
-static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
-
-// Waypoint Type accepted values
-static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
-static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
-static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
 
 /// Default when provided NavigationState is empty
 // clang-format off
@@ -87,9 +79,6 @@ static const std::string DEFAULT_NAVIGATION_STATE_PAYLOAD = R"({
 	"shapes": []
 })";
 
-//// max number of shapes allowable in context
-static const int MAXIMUM_SHAPES_IN_CONTEXT = 100;
-
 // Navigation Event Strings
 static const std::string START_NAVIGATION_SUCCESS = "StartNavigationSuccess";
 static const std::string SHOW_PREVIOUS_WAYPOINTS_SUCCESS = "ShowPreviousWaypointsSuccess";
@@ -446,28 +435,23 @@ void NavigationCapabilityAgent::executeProvideState( const NamespaceAndName& sta
     try
     {
         ThrowIfNull( m_contextManager, "contextManagerIsNull" );
-        bool payloadChanged = false;
-        std::string payload;
         auto agentId = stateProviderName.getAgentId();
 
-        payload = m_navigationHandler->getNavigationState(agentId);
-
-        if( payload.empty() && m_navigationStatePayload.compare(DEFAULT_NAVIGATION_STATE_PAYLOAD) != 0 ) {
+        std::string payload = m_navigationHandler->getNavigationState(agentId);
+        if( payload.empty() ) {
             payload = DEFAULT_NAVIGATION_STATE_PAYLOAD;
-            payloadChanged = true;
-        } else if ( !payload.empty() && payload.compare( m_navigationStatePayload ) != 0 ){
-            payloadChanged = true;
         }
 
-        if( payloadChanged ) {
-            if ( isNavigationStateValid( payload )  ) {
-                // set the context NavigationState
-                ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
-            }
-        } else {
-            // send empty if no change
-            ThrowIf( m_contextManager->setState( NAVIGATION_STATE, "", alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateEmptyPayloadFailed" );
+        // the route is only parsed and simplified again when the platform reports a different navigation state
+        if( m_navigationState == nullptr || payload.compare( m_navigationStatePayload ) != 0 ) {
+            auto navigationState = NavigationState::create( payload );
+            ThrowIfNull( navigationState, "invalidNavigationState" );
+            m_navigationStatePayload = std::move( payload );
+            m_navigationState = navigationState;
         }
+
+        // every context request gets the full state, the cached context payload is reused when it did not change
+        ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationState->getContextPayload(), alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
     }
     catch( std::exception& ex ) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -692,122 +676,6 @@ void NavigationCapabilityAgent::showPreviousWaypointsError( AgentId::IdType agen
     m_messageSender->sendMessage( request );
 }
 
-bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationState )
-{
-    AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
-    try
-    {
-        rapidjson::Document document;
-        document.Parse<0>( navigationState.c_str() );
-
-        if( document.HasParseError() ) {
-            rapidjson::ParseErrorCode ok = document.GetParseError();
-            AACE_ERROR(LX(TAG).d( "HasParseError", GetParseError_En(ok) ) );
-            Throw( "parseError" );
-        }
-
-        ThrowIfNot( document.HasMember("state"), "stateKeyMissing");
-
-        if( document[ "state" ].IsNull() || !document[ "state" ].IsString() ) {
-            Throw( "stateNotValid" );
-        }
-        std::string state = document[ "state" ].GetString();
-        if( ( state.compare(NAVIGATION_STATE_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_NOT_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_UNKNOWN) != 0 ) ) {
-            Throw( "stateValueNotValid" );
-        }
-        if ( document.HasMember("waypoints") ) {
-            if( !document[ "waypoints" ].IsArray() ) {
-                Throw( "waypointsArrayNotValid" );
-            }
-
-            auto waypoints = document["waypoints"].GetArray();
-            for ( size_t i = 0; i < waypoints.Size() ; i++ ) {
-                auto waypoint  = waypoints[i].GetObject();
-                ThrowIfNot( waypoint.HasMember("type"), "waypointTypeMissing");
-
-                std::string waypointType = waypoint["type"].GetString();
-                if( waypoint[ "type" ].IsNull() || !waypoint[ "type" ].IsString() ) {
-                    Throw( "waypointTypeNotValid" );
-                }
-                if( ( waypointType.compare(WAYPOINT_TYPE_SOURCE) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_INTERIM) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_DESTINATION) != 0 ) ) {
-                    Throw( "waypointTypeValueNotValid" );
-                }
-                if ( waypoint.HasMember("estimatedTimeOfArrival") ) {
-                    auto estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"].GetObject();
-                    ThrowIfNot( estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
-                    if ( ( estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString() ) ||
-                         ( estimatedTimeOfArrival.HasMember("predicted") && !estimatedTimeOfArrival["predicted"].IsString() ) ) {
-
-                        Throw( "estimatedTimeOfArrivalNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("address") ) {
-                    auto address = waypoint["address"].GetObject();
-                    if ( ( address.HasMember("addressLine1") && !address["addressLine1"].IsString() ) ||
-                         ( address.HasMember("addressLine2") && !address["addressLine2"].IsString() ) ||
-                         ( address.HasMember("addressLine3") && !address["addressLine3"].IsString() ) ||
-                         ( address.HasMember("city") && !address["city"].IsString() ) ||
-                         ( address.HasMember("stateOrRegion") && !address["stateOrRegion"].IsString() ) ||
-                         ( address.HasMember("countryCode") && !address["countryCode"].IsString() ) ||
-                         ( address.HasMember("districtOrCounty") && !address["districtOrCounty"].IsString() ) ||
-                         ( address.HasMember("postalCode") && !address["postalCode"].IsString() )
-                    ) {
-                        Throw( "AddressNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("name") ) {
-                    if ( waypoint[ "name" ].IsNull() || !waypoint[ "name" ].IsString() ) {
-                        Throw( "waypointNameNotValid" );
-                    }
-                }
-
-                ThrowIfNot( waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
-                auto coordinate = waypoint["coordinate"].GetArray();
-                if ( coordinate[0].IsNull() ) {
-                    Throw( "LatitudeNotValid" );
-                }
-                if ( coordinate[1].IsNull() ) {
-                    Throw( "LongitudeNotValid" );
-                }
-                if ( waypoint.HasMember("pointOfInterest") ) {
-                    auto poi = waypoint["pointOfInterest"].GetObject();
-                    if ( !poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber") ) {
-                        waypoint.EraseMember("pointOfInterest");
-                    }
-                }
-            }
-        }
-        ThrowIfNot( document.HasMember("shapes"), "shapesKeyMissing" );
-
-        if( !document[ "shapes" ].IsArray() ) {
-            Throw( "shapesArrayNotValid" );
-        }
-        if ( document[ "waypoints" ].Size() != 0 && document[ "shapes" ].Size() < 2 ) {
-            AACE_WARN(LX(TAG).d("shapes","Shapes should not be less than 2 for local POI"));
-        }
-
-        if( document[ "shapes" ].Size() > MAXIMUM_SHAPES_IN_CONTEXT ) {
-            AACE_WARN(LX(TAG, "isNavigationStateValid").d("shapes", "Too many shapes in payload. Only using first 100."));
-            ThrowIfNot( document[ "shapes" ].Erase(document[ "shapes" ].Begin() + MAXIMUM_SHAPES_IN_CONTEXT, document[ "shapes" ].End()), "unable to operate on shapes Array" );
-        }
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-        document.Accept( writer );
-        navigationState = buffer.GetString();
-
-        // set current navigation state payload
-        m_navigationStatePayload = navigationState;
-        return true;
-    } catch( std::exception& ex ) {
-        AACE_ERROR(LX(TAG).d("reason",ex.what() ));
-        return false;
-    }
-}
-
 std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>> NavigationCapabilityAgent::getCapabilityConfigurations() {
     return m_capabilityConfigurations;
 }
@@ -0,0 +1,289 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include "AACE/Engine/Navigation/NavigationState.h"
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.navigation.NavigationState");
+
+/// NavigationState state accepted values
+static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
+static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
+static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
+
+// Waypoint Type accepted values
+static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
+static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
+static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
+
+/// The address fields that must be strings if present.
+static const char* const ADDRESS_FIELDS[] = {"addressLine1",
+                                             "addressLine2",
+                                             "addressLine3",
+                                             "city",
+                                             "stateOrRegion",
+                                             "countryCode",
+                                             "districtOrCounty",
+                                             "postalCode"};
+
+/// Degrees to radians.
+static const double RADIANS_PER_DEGREE = 3.14159265358979323846 / 180;
+
+constexpr size_t NavigationState::MAXIMUM_SHAPES_IN_CONTEXT;
+
+/// Validates a waypoint, removing an empty point of interest.
+static void validateWaypoint(rapidjson::Value& waypoint) {
+    ThrowIfNot(waypoint.IsObject(), "waypointNotValid");
+    ThrowIfNot(waypoint.HasMember("type"), "waypointTypeMissing");
+    if (!waypoint["type"].IsString()) {
+        Throw("waypointTypeNotValid");
+    }
+    std::string waypointType = waypoint["type"].GetString();
+    if (waypointType != WAYPOINT_TYPE_SOURCE && waypointType != WAYPOINT_TYPE_INTERIM &&
+        waypointType != WAYPOINT_TYPE_DESTINATION) {
+        Throw("waypointTypeValueNotValid");
+    }
+    if (waypoint.HasMember("estimatedTimeOfArrival")) {
+        auto& estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"];
+        ThrowIfNot(estimatedTimeOfArrival.IsObject(), "estimatedTimeOfArrivalNotValid");
+        ThrowIfNot(estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
+        if ((estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString()) ||
+            !estimatedTimeOfArrival["predicted"].IsString()) {
+            Throw("estimatedTimeOfArrivalNotString");
+        }
+    }
+    if (waypoint.HasMember("address")) {
+        auto& address = waypoint["address"];
+        ThrowIfNot(address.IsObject(), "AddressNotValid");
+        for (const auto& field : ADDRESS_FIELDS) {
+            if (address.HasMember(field) && !address[field].IsString()) {
+                Throw("AddressNotString");
+            }
+        }
+    }
+    if (waypoint.HasMember("name") && !waypoint["name"].IsString()) {
+        Throw("waypointNameNotValid");
+    }
+
+    ThrowIfNot(waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
+    auto& coordinate = waypoint["coordinate"];
+    ThrowIfNot(coordinate.IsArray() && coordinate.Size() >= 2, "coordinateNotValid");
+    if (coordinate[0].IsNull()) {
+        Throw("LatitudeNotValid");
+    }
+    if (coordinate[1].IsNull()) {
+        Throw("LongitudeNotValid");
+    }
+    if (waypoint.HasMember("pointOfInterest") && waypoint["pointOfInterest"].IsObject()) {
+        auto& poi = waypoint["pointOfInterest"];
+        if (!poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber")) {
+            waypoint.EraseMember("pointOfInterest");
+        }
+    }
+}
+
+NavigationState::NavigationState(std::string contextPayload, size_t shapeCount) :
+        m_contextPayload(std::move(contextPayload)), m_shapeCount(shapeCount) {
+}
+
+std::shared_ptr<NavigationState> NavigationState::create(const std::string& payload, size_t maxShapes) {
+    try {
+        rapidjson::Document document;
+        document.Parse<0>(payload.c_str());
+        if (document.HasParseError()) {
+            AACE_ERROR(LX(TAG).d("HasParseError", rapidjson::GetParseError_En(document.GetParseError())));
+            Throw("parseError");
+        }
+        ThrowIfNot(document.IsObject(), "navigationStateNotValid");
+        auto& allocator = document.GetAllocator();
+
+        ThrowIfNot(document.HasMember("state"), "stateKeyMissing");
+        if (!document["state"].IsString()) {
+            Throw("stateNotValid");
+        }
+        std::string state = document["state"].GetString();
+        if (state != NAVIGATION_STATE_NAVIGATING && state != NAVIGATION_STATE_NOT_NAVIGATING &&
+            state != NAVIGATION_STATE_UNKNOWN) {
+            Throw("stateValueNotValid");
+        }
+
+        size_t waypointCount = 0;
+        if (document.HasMember("waypoints")) {
+            if (!document["waypoints"].IsArray()) {
+                Throw("waypointsArrayNotValid");
+            }
+            for (auto& waypoint : document["waypoints"].GetArray()) {
+                validateWaypoint(waypoint);
+            }
+            waypointCount = document["waypoints"].Size();
+        }
+
+        ThrowIfNot(document.HasMember("shapes"), "shapesKeyMissing");
+        auto& shapes = document["shapes"];
+        if (!shapes.IsArray()) {
+            Throw("shapesArrayNotValid");
+        }
+        size_t shapeCount = shapes.Size();
+        if (waypointCount != 0 && shapeCount < 2) {
+            AACE_WARN(LX(TAG).d("shapes", "Shapes should not be less than 2 for local POI"));
+        }
+
+        if (shapeCount > maxShapes) {
+            std::vector<Coordinate> coordinates;
+            coordinates.reserve(shapeCount);
+            for (auto& shape : shapes.GetArray()) {
+                ThrowIfNot(
+                    shape.IsArray() && shape.Size() >= 2 && shape[0].IsNumber() && shape[1].IsNumber(),
+                    "shapeNotValid");
+                coordinates.push_back({shape[0].GetDouble(), shape[1].GetDouble()});
+            }
+
+            // replace the route with the points that best preserve its shape from the source to the destination
+            rapidjson::Value simplified(rapidjson::kArrayType);
+            for (auto index : simplifyShapes(coordinates, maxShapes)) {
+                simplified.PushBack(shapes[static_cast<rapidjson::SizeType>(index)], allocator);
+            }
+            shapes = simplified;
+
+            AACE_DEBUG(LX(TAG).d("shapes", shapeCount).d("simplifiedShapes", shapes.Size()));
+        }
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        ThrowIfNot(document.Accept(writer), "failedToWriteJsonDocument");
+
+        return std::shared_ptr<NavigationState>(new NavigationState(buffer.GetString(), shapeCount));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::vector<size_t> NavigationState::simplifyShapes(const std::vector<Coordinate>& shapes, size_t maxShapes) {
+    std::vector<size_t> selected;
+    if (shapes.size() <= maxShapes) {
+        for (size_t j = 0; j < shapes.size(); j++) {
+            selected.push_back(j);
+        }
+        return selected;
+    }
+    if (maxShapes < 2) {
+        if (maxShapes == 1) {
+            selected.push_back(shapes.size() - 1);
+        }
+        return selected;
+    }
+
+    // project the route onto a plane, scaling longitude so that distances are comparable in both directions
+    double latitudeSum = 0;
+    for (const auto& shape : shapes) {
+        latitudeSum += shape.latitude;
+    }
+    double longitudeScale = std::cos(latitudeSum / shapes.size() * RADIANS_PER_DEGREE);
+    std::vector<double> x(shapes.size());
+    std::vector<double> y(shapes.size());
+    for (size_t j = 0; j < shapes.size(); j++) {
+        x[j] = shapes[j].longitude * longitudeScale;
+        y[j] = shapes[j].latitude;
+    }
+
+    // a part of the route between two selected points, and its point farthest from the line between them
+    struct Segment {
+        size_t first;
+        size_t last;
+        size_t farthest;
+        double distance;
+        bool operator<(const Segment& other) const {
+            return distance < other.distance;
+        }
+    };
+    auto createSegment = [&x, &y](size_t first, size_t last) {
+        Segment segment{first, last, first, 0};
+        double dx = x[last] - x[first];
+        double dy = y[last] - y[first];
+        double lengthSquared = dx * dx + dy * dy;
+        for (size_t j = first + 1; j < last; j++) {
+            double t = lengthSquared > 0 ? ((x[j] - x[first]) * dx + (y[j] - y[first]) * dy) / lengthSquared : 0;
+            t = std::max(0.0, std::min(1.0, t));
+            double ex = x[first] + t * dx - x[j];
+            double ey = y[first] + t * dy - y[j];
+            double distance = ex * ex + ey * ey;
+            if (distance > segment.distance) {
+                segment.farthest = j;
+                segment.distance = distance;
+            }
+        }
+        return segment;
+    };
+
+    std::vector<bool> keep(shapes.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+    size_t keepCount = 2;
+
+    std::priority_queue<Segment> segments;
+    segments.push(createSegment(0, shapes.size() - 1));
+    while (keepCount < maxShapes && !segments.empty()) {
+        auto segment = segments.top();
+        segments.pop();
+        if (segment.distance <= 0) {
+            // the remaining points are on the simplified route
+            break;
+        }
+        keep[segment.farthest] = true;
+        keepCount++;
+        if (segment.farthest - segment.first > 1) {
+            segments.push(createSegment(segment.first, segment.farthest));
+        }
+        if (segment.last - segment.farthest > 1) {
+            segments.push(createSegment(segment.farthest, segment.last));
+        }
+    }
+
+    selected.reserve(keepCount);
+    for (size_t j = 0; j < keep.size(); j++) {
+        if (keep[j]) {
+            selected.push_back(j);
+        }
+    }
+    return selected;
+}
+
+const std::string& NavigationState::getContextPayload() const {
+    return m_contextPayload;
+}
+
+size_t NavigationState::getShapeCount() const {
+    return m_shapeCount;
+}
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
@@ -15,7 +15,10 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <condition_variable>
 #include <future>
+#include <mutex>
+#include <vector>
 
 #include <AACE/Test/Unit/AVS/MockAttachmentManager.h>
 #include <AVSCommon/SDKInterfaces/test/MockExceptionEncounteredSender.h>
@@ -256,6 +259,46 @@ TEST_F(NavigationCapabilityAgentTest, testCancelNavigationDirective) {
     m_wakeSetCompletedFuture.wait_for(TIMEOUT);
 }
 
+TEST_F(NavigationCapabilityAgentTest, provideStateWithSameRouteSetsFullStateEveryTime) {
+    static const std::string NAVIGATION_STATE_PAYLOAD =
+        R"({"state":"NAVIGATING","waypoints":[{"type":"SOURCE","coordinate":[37.41,-122.025]},)"
+        R"({"type":"DESTINATION","coordinate":[37.396,-122.046],"name":"work"}],)"
+        R"("shapes":[[37.41,-122.025],[37.402,-122.032],[37.396,-122.046]]})";
+    static const unsigned int STATE_REQUEST_TOKEN = 42;
+
+    std::mutex mutex;
+    std::condition_variable stateSet;
+    std::vector<std::string> states;
+    EXPECT_CALL(*m_testNavigationHandler, getNavigationState(testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Return(NAVIGATION_STATE_PAYLOAD));
+    EXPECT_CALL(
+        *m_alexaMockFactory->getContextManagerInterfaceMock(),
+        setState(testing::_, testing::_, testing::_, STATE_REQUEST_TOKEN))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([&](
+                                            const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
+                                            const std::string& jsonState,
+                                            const alexaClientSDK::avsCommon::avs::StateRefreshPolicy& refreshPolicy,
+                                            const unsigned int stateRequestToken) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                states.push_back(jsonState);
+            }
+            stateSet.notify_all();
+            return alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS;
+        }));
+
+    alexaClientSDK::avsCommon::avs::NamespaceAndName stateProviderName{NAMESPACE, "NavigationState"};
+    m_capAgent->provideState(stateProviderName, STATE_REQUEST_TOKEN);
+    m_capAgent->provideState(stateProviderName, STATE_REQUEST_TOKEN);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(stateSet.wait_for(lock, TIMEOUT, [&states] { return states.size() == 2; }));
+    EXPECT_FALSE(states[0].empty());
+    EXPECT_EQ(states[1], states[0]);
+}
+
 }  // namespace navigation
 }  // namespace unit
 }  // namespace test
@@ -0,0 +1,202 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+#include <AACE/Engine/Navigation/NavigationState.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace navigation {
+
+using NavigationState = aace::engine::navigation::NavigationState;
+
+/// The number of points in the synthetic routes.
+static const size_t ROUTE_SHAPE_COUNT = 10000;
+
+/// The number of times each benchmark step is repeated.
+static const size_t BENCHMARK_ITERATIONS = 20;
+
+/// Test harness for parsing and simplifying the navigation state reported by the platform
+class NavigationStateTest : public ::testing::Test {
+protected:
+    /// A winding route of about 100 km heading north east, with a detour near the destination.
+    static std::vector<NavigationState::Coordinate> createRoute(size_t shapeCount) {
+        std::vector<NavigationState::Coordinate> route;
+        for (size_t j = 0; j < shapeCount; j++) {
+            double t = static_cast<double>(j) / (shapeCount - 1);
+            double detour = t > 0.9 ? 0.05 * std::sin((t - 0.9) * 10 * 3.14159265358979) : 0;
+            route.push_back({37.0 + 0.6 * t + 0.02 * std::sin(t * 40) + detour, -122.0 + 0.7 * t});
+        }
+        return route;
+    }
+
+    static std::string createPayload(const std::vector<NavigationState::Coordinate>& route) {
+        std::ostringstream payload;
+        payload.precision(10);
+        payload << R"({"state":"NAVIGATING","waypoints":[)"
+                << R"({"type":"SOURCE","coordinate":[)" << route.front().latitude << "," << route.front().longitude
+                << "]},"
+                << R"({"type":"DESTINATION","coordinate":[)" << route.back().latitude << ","
+                << route.back().longitude << R"(],"name":"work"}],"shapes":[)";
+        for (size_t j = 0; j < route.size(); j++) {
+            payload << (j > 0 ? "," : "") << "[" << route[j].latitude << "," << route[j].longitude << "]";
+        }
+        payload << "]}";
+        return payload.str();
+    }
+
+    /// Returns the largest distance, in degrees, from a point of @c route to the route through @c selected.
+    static double measureMaximumDeviation(
+        const std::vector<NavigationState::Coordinate>& route,
+        const std::vector<size_t>& selected) {
+        double maximumDeviation = 0;
+        for (size_t k = 1; k < selected.size(); k++) {
+            const auto& first = route[selected[k - 1]];
+            const auto& last = route[selected[k]];
+            double dx = last.longitude - first.longitude;
+            double dy = last.latitude - first.latitude;
+            double lengthSquared = dx * dx + dy * dy;
+            for (size_t j = selected[k - 1]; j <= selected[k]; j++) {
+                double t = lengthSquared > 0 ? ((route[j].longitude - first.longitude) * dx +
+                                                (route[j].latitude - first.latitude) * dy) /
+                                                   lengthSquared
+                                             : 0;
+                t = std::max(0.0, std::min(1.0, t));
+                double ex = first.longitude + t * dx - route[j].longitude;
+                double ey = first.latitude + t * dy - route[j].latitude;
+                maximumDeviation = std::max(maximumDeviation, std::sqrt(ex * ex + ey * ey));
+            }
+        }
+        return maximumDeviation;
+    }
+};
+
+TEST_F(NavigationStateTest, createWithShortRoute) {
+    auto navigationState = NavigationState::create(createPayload(createRoute(3)));
+    ASSERT_NE(navigationState, nullptr);
+    EXPECT_EQ(navigationState->getShapeCount(), 3u);
+
+    rapidjson::Document context;
+    context.Parse(navigationState->getContextPayload().c_str());
+    ASSERT_FALSE(context.HasParseError());
+    EXPECT_STREQ(context["state"].GetString(), "NAVIGATING");
+    EXPECT_EQ(context["waypoints"].Size(), 2u);
+    EXPECT_EQ(context["shapes"].Size(), 3u);
+}
+
+TEST_F(NavigationStateTest, createWithInvalidPayload) {
+    EXPECT_EQ(NavigationState::create("{"), nullptr);
+    EXPECT_EQ(NavigationState::create(R"({"state":"DRIVING","waypoints":[],"shapes":[]})"), nullptr);
+    EXPECT_EQ(NavigationState::create(R"({"state":"NAVIGATING","waypoints":[]})"), nullptr);
+    EXPECT_EQ(
+        NavigationState::create(
+            R"({"state":"NAVIGATING","waypoints":[{"type":"HOME","coordinate":[1,2]}],"shapes":[]})"),
+        nullptr);
+}
+
+TEST_F(NavigationStateTest, createWithLongRouteSpansWholeRoute) {
+    auto route = createRoute(ROUTE_SHAPE_COUNT);
+    auto navigationState = NavigationState::create(createPayload(route));
+    ASSERT_NE(navigationState, nullptr);
+    EXPECT_EQ(navigationState->getShapeCount(), ROUTE_SHAPE_COUNT);
+
+    rapidjson::Document context;
+    context.Parse(navigationState->getContextPayload().c_str());
+    ASSERT_FALSE(context.HasParseError());
+    auto shapes = context["shapes"].GetArray();
+    ASSERT_EQ(shapes.Size(), NavigationState::MAXIMUM_SHAPES_IN_CONTEXT);
+
+    // the context ends at the destination rather than after the first points of the route
+    EXPECT_NEAR(shapes[0][0].GetDouble(), route.front().latitude, 1e-6);
+    EXPECT_NEAR(shapes[shapes.Size() - 1][0].GetDouble(), route.back().latitude, 1e-6);
+    EXPECT_NEAR(shapes[shapes.Size() - 1][1].GetDouble(), route.back().longitude, 1e-6);
+}
+
+TEST_F(NavigationStateTest, simplifyShapesPreservesShape) {
+    auto route = createRoute(ROUTE_SHAPE_COUNT);
+    auto selected = NavigationState::simplifyShapes(route, NavigationState::MAXIMUM_SHAPES_IN_CONTEXT);
+    ASSERT_EQ(selected.size(), NavigationState::MAXIMUM_SHAPES_IN_CONTEXT);
+    EXPECT_EQ(selected.front(), 0u);
+    EXPECT_EQ(selected.back(), ROUTE_SHAPE_COUNT - 1);
+    EXPECT_TRUE(std::is_sorted(selected.begin(), selected.end()));
+
+    // the simplified route stays within about 100 m of the full route, closer than the same number of evenly
+    // spaced points
+    std::vector<size_t> evenlySpaced;
+    for (size_t j = 0; j < selected.size(); j++) {
+        evenlySpaced.push_back(j * (ROUTE_SHAPE_COUNT - 1) / (selected.size() - 1));
+    }
+    auto deviation = measureMaximumDeviation(route, selected);
+    EXPECT_LT(deviation, 0.001);
+    EXPECT_LT(deviation, measureMaximumDeviation(route, evenlySpaced));
+}
+
+TEST_F(NavigationStateTest, simplifyShapesStopsOnStraightRoute) {
+    std::vector<NavigationState::Coordinate> route;
+    for (size_t j = 0; j < 1000; j++) {
+        route.push_back({37.0 + j * 0.001, -122.0});
+    }
+    auto selected = NavigationState::simplifyShapes(route, NavigationState::MAXIMUM_SHAPES_IN_CONTEXT);
+    ASSERT_EQ(selected.size(), 2u);
+    EXPECT_EQ(selected.back(), route.size() - 1);
+}
+
+TEST_F(NavigationStateTest, benchmarkLongRoute) {
+    auto payload = createPayload(createRoute(ROUTE_SHAPE_COUNT));
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::shared_ptr<NavigationState> navigationState;
+    for (size_t j = 0; j < BENCHMARK_ITERATIONS; j++) {
+        navigationState = NavigationState::create(payload);
+    }
+    auto createMicroseconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() /
+        BENCHMARK_ITERATIONS;
+    ASSERT_NE(navigationState, nullptr);
+
+    // an unchanged route is recognized by comparing payloads, without parsing it again
+    auto copy = payload;
+    size_t unchanged = 0;
+    startTime = std::chrono::steady_clock::now();
+    for (size_t j = 0; j < BENCHMARK_ITERATIONS; j++) {
+        unchanged += copy.compare(payload) == 0 ? 1 : 0;
+    }
+    auto compareMicroseconds =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() /
+        BENCHMARK_ITERATIONS;
+    EXPECT_EQ(unchanged, BENCHMARK_ITERATIONS);
+
+    RecordProperty("shapes", static_cast<int>(ROUTE_SHAPE_COUNT));
+    RecordProperty("payloadBytes", static_cast<int>(payload.size()));
+    RecordProperty("contextBytes", static_cast<int>(navigationState->getContextPayload().size()));
+    RecordProperty("createMicroseconds", static_cast<int>(createMicroseconds));
+    RecordProperty("unchangedMicroseconds", static_cast<int>(compareMicroseconds));
+}
+
+}  // namespace navigation
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,110 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_PHONECALLCONTROLLER_PHONE_CALL_CONTEXT_H
+#define AACE_ENGINE_PHONECALLCONTROLLER_PHONE_CALL_CONTEXT_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/PhoneCallController/PhoneCallControllerEngineInterfaces.h>
+
+namespace aace {
+namespace engine {
+namespace phoneCallController {
+
+/**
+ * The model of the PhoneCallControllerState context. Each call keeps its serialized JSON, which is rebuilt only when
+ * the state of that call changes, so adding, updating, or removing a call takes constant time. The context is
+ * serialized again only when a call, the connection state, or the device configuration changed since it was last
+ * requested.
+ */
+class PhoneCallContext {
+public:
+    enum class CallState { IDLE, ACTIVE, TRYING, INBOUND_RINGING, OUTBOUND_RINGING, INVITED };
+
+    using ConnectionState = aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState;
+    using CallingDeviceConfigurationProperty =
+        aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty;
+
+    PhoneCallContext();
+
+    void setConnectionState(ConnectionState state);
+    void setDeviceConfiguration(const std::unordered_map<CallingDeviceConfigurationProperty, bool>& configurationMap);
+
+    /// Sets the state of a call, adding the call if it does not exist.
+    void setCallState(const std::string& callId, CallState state);
+
+    /// Removes a call. Returns @c false if the call does not exist.
+    bool removeCall(const std::string& callId);
+
+    bool hasCall(const std::string& callId);
+
+    /// Returns the state of a call, or @c CallState::IDLE if the call does not exist.
+    CallState getCallState(const std::string& callId);
+
+    /// Sets the call reported as the current call while it exists and is not idle.
+    void setCurrentCall(const std::string& callId);
+
+    /// Returns the serialized context, serializing it only if it changed.
+    std::string toString();
+
+    /// Returns the serialized JSON array of the calls that are not idle.
+    std::string getAllCallsString();
+
+    /// Returns the number of times the context was serialized.
+    uint64_t getSerializationCount();
+
+    static std::string connectionStateToString(ConnectionState state);
+    static std::string callStateToString(CallState state);
+    static std::string configurationFeatureToString(CallingDeviceConfigurationProperty feature);
+
+private:
+    struct Call {
+        std::string callId;
+        CallState state;
+
+        /// The serialized JSON object of the call.
+        std::string json;
+    };
+
+    static void serializeCall(Call& call);
+    const std::string& getAllCallsStringLocked();
+
+    /// The calls in the order they were added, with an index by call ID.
+    std::list<Call> m_calls;
+    std::unordered_map<std::string, std::list<Call>::iterator> m_callIndex;
+    std::string m_currentCallId;
+
+    std::string m_deviceJson;
+    std::string m_configurationJson;
+    std::string m_allCallsJson;
+    std::string m_json;
+
+    bool m_allCallsChanged;
+    bool m_changed;
+    uint64_t m_serializationCount;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace phoneCallController
+}  // namespace engine
+}  // namespace aace
+
+#endif
@@ -29,6 +29,7 @@
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
 
 #include <AACE/PhoneCallController/PhoneCallControllerEngineInterfaces.h>
+#include "PhoneCallContext.h"
 #include "PhoneCallControllerInterface.h"
 
 namespace aace {
@@ -41,7 +42,7 @@ class PhoneCallControllerCapabilityAgent
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<PhoneCallControllerCapabilityAgent> {
 public:
-    enum class CallState { IDLE, ACTIVE, TRYING, INBOUND_RINGING, OUTBOUND_RINGING, INVITED };
+    using CallState = PhoneCallContext::CallState;
 
     enum class CallMethod { DIAL, REDIAL };
 
@@ -164,15 +165,9 @@ private:
     std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>>
         m_capabilityConfigurations;
 
-    std::string m_currentCallId;
-    std::unordered_map<std::string, CallState> m_allCallsMap;
+    PhoneCallContext m_context;
     std::unordered_map<std::string, CallMethod> m_callMethodMap;
     std::unordered_map<std::string, alexaClientSDK::avsCommon::avs::AgentId::IdType> m_callAgentMap;
-    std::unordered_map<
-        aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty,
-        bool>
-        m_deviceConfigurationMap;
-    aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState m_connectionState;
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 };
 
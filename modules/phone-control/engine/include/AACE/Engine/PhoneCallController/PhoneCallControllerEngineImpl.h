@@ -54,7 +54,8 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 public:
     static std::shared_ptr<PhoneCallControllerEngineImpl> create(
@@ -67,7 +68,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient = nullptr);
 
     // PhoneCallControllerEngineInterface
     void onConnectionStateChanged(ConnectionState state) override;
@@ -128,6 +130,9 @@ private:
     /// Used for getting the ACMS endpoint.
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> m_alexaEndpoints;
 
+    /// Used for the ACMS account requests.
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> m_httpClient;
+
     /// Thread for auto provisioning.
     std::thread m_autoProvisioningThread;
 };
@@ -20,6 +20,7 @@
 #include <AVSCommon/Utils/DeviceInfo.h>
 
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
+#include <AACE/Engine/Alexa/HttpClientInterface.h>
 
 namespace aace {
 namespace engine {
@@ -61,12 +62,14 @@ struct AlexaAccountInfo {
  * 
  * @param authDelegate The reference to @c AuthDelegateInterface to get the auth token.
  * @param deviceInfo The reference to @c DeviceInfo to get the auth token.
+ * @param httpClient The reference to @c HttpClientInterface used to perform the request.
  * @return On successful it returns @c AlexaAccountInfo otherwise if will return the default @c AlexaAccountInfo.
  */
 AlexaAccountInfo getAlexaAccountInfo(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 /**
  * Function to perform the auto provisioning of the account.
@@ -74,13 +77,15 @@ AlexaAccountInfo getAlexaAccountInfo(
  * @param alexaAccountInfo The reference to AlexaAccountInfo providing the directedId.
  * @param authDelegate The reference to @c AuthDelegateInterface to get the auth token.
  * @param deviceInfo The reference to @c DeviceInfo to get the auth token.
+ * @param httpClient The reference to @c HttpClientInterface used to perform the request.
  * @return On successful it returns @c true otherwise if will return the default @c false.
  */
 bool doAccountAutoProvision(
     const AlexaAccountInfo& alexaAccountInfo,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient);
 
 }  // namespace phoneCallController
 }  // namespace engine
@@ -0,0 +1,248 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/PhoneCallController/PhoneCallContext.h"
+
+#include <iterator>
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+namespace aace {
+namespace engine {
+namespace phoneCallController {
+
+/// Writes a string value or key of a known length.
+static void writeString(rapidjson::Writer<rapidjson::StringBuffer>& writer, const std::string& value) {
+    writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+}
+
+/// Writes a serialized JSON value.
+static void writeRaw(
+    rapidjson::Writer<rapidjson::StringBuffer>& writer,
+    const std::string& json,
+    rapidjson::Type type) {
+    writer.RawValue(json.c_str(), json.size(), type);
+}
+
+PhoneCallContext::PhoneCallContext() : m_allCallsChanged(true), m_changed(true), m_serializationCount(0) {
+    setConnectionState(ConnectionState::DISCONNECTED);
+    setDeviceConfiguration({});
+}
+
+void PhoneCallContext::setConnectionState(ConnectionState state) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("connectionState");
+    writeString(writer, connectionStateToString(state));
+    writer.EndObject();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_deviceJson != buffer.GetString()) {
+        m_deviceJson = buffer.GetString();
+        m_changed = true;
+    }
+}
+
+void PhoneCallContext::setDeviceConfiguration(
+    const std::unordered_map<CallingDeviceConfigurationProperty, bool>& configurationMap) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("callingFeature");
+    writer.StartArray();
+    for (auto& it : configurationMap) {
+        writer.StartObject();
+        writeString(writer, configurationFeatureToString(it.first));
+        writer.Bool(it.second);
+        writer.EndObject();
+    }
+    writer.StartObject();
+    writer.Key("OVERRIDE_RINGTONE_SUPPORTED");
+    writer.Bool(false);
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_configurationJson != buffer.GetString()) {
+        m_configurationJson = buffer.GetString();
+        m_changed = true;
+    }
+}
+
+void PhoneCallContext::setCallState(const std::string& callId, CallState state) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_callIndex.find(callId);
+    if (it == m_callIndex.end()) {
+        m_calls.push_back({callId, state, ""});
+        it = m_callIndex.emplace(callId, std::prev(m_calls.end())).first;
+    } else if (it->second->state == state) {
+        return;
+    } else {
+        it->second->state = state;
+    }
+    serializeCall(*it->second);
+    m_allCallsChanged = true;
+    m_changed = true;
+}
+
+bool PhoneCallContext::removeCall(const std::string& callId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_callIndex.find(callId);
+    if (it == m_callIndex.end()) {
+        return false;
+    }
+    m_calls.erase(it->second);
+    m_callIndex.erase(it);
+    m_allCallsChanged = true;
+    m_changed = true;
+    return true;
+}
+
+bool PhoneCallContext::hasCall(const std::string& callId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_callIndex.find(callId) != m_callIndex.end();
+}
+
+PhoneCallContext::CallState PhoneCallContext::getCallState(const std::string& callId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_callIndex.find(callId);
+    return it != m_callIndex.end() ? it->second->state : CallState::IDLE;
+}
+
+void PhoneCallContext::setCurrentCall(const std::string& callId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_currentCallId != callId) {
+        m_currentCallId = callId;
+        m_changed = true;
+    }
+}
+
+std::string PhoneCallContext::toString() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_changed) {
+        return m_json;
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("device");
+    writeRaw(writer, m_deviceJson, rapidjson::kObjectType);
+    writer.Key("configuration");
+    writeRaw(writer, m_configurationJson, rapidjson::kObjectType);
+    writer.Key("allCalls");
+    writeRaw(writer, getAllCallsStringLocked(), rapidjson::kArrayType);
+    auto current = m_callIndex.find(m_currentCallId);
+    if (current != m_callIndex.end() && current->second->state != CallState::IDLE) {
+        writer.Key("currentCall");
+        writer.StartObject();
+        writer.Key("callId");
+        writeString(writer, m_currentCallId);
+        writer.EndObject();
+    }
+    writer.EndObject();
+
+    m_json.assign(buffer.GetString(), buffer.GetSize());
+    m_changed = false;
+    m_serializationCount++;
+    return m_json;
+}
+
+std::string PhoneCallContext::getAllCallsString() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return getAllCallsStringLocked();
+}
+
+uint64_t PhoneCallContext::getSerializationCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_serializationCount;
+}
+
+const std::string& PhoneCallContext::getAllCallsStringLocked() {
+    if (m_allCallsChanged) {
+        // join the serialized calls, the idle calls are not reported
+        m_allCallsJson = "[";
+        for (auto& call : m_calls) {
+            if (call.state == CallState::IDLE) {
+                continue;
+            }
+            if (m_allCallsJson.size() > 1) {
+                m_allCallsJson += ",";
+            }
+            m_allCallsJson += call.json;
+        }
+        m_allCallsJson += "]";
+        m_allCallsChanged = false;
+    }
+    return m_allCallsJson;
+}
+
+void PhoneCallContext::serializeCall(Call& call) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("callId");
+    writeString(writer, call.callId);
+    writer.Key("callState");
+    writeString(writer, callStateToString(call.state));
+    writer.EndObject();
+    call.json.assign(buffer.GetString(), buffer.GetSize());
+}
+
+std::string PhoneCallContext::connectionStateToString(ConnectionState state) {
+    switch (state) {
+        case ConnectionState::CONNECTED:
+            return "CONNECTED";
+        case ConnectionState::DISCONNECTED:
+            return "DISCONNECTED";
+        default:
+            return "";
+    }
+}
+
+std::string PhoneCallContext::callStateToString(CallState state) {
+    switch (state) {
+        case CallState::ACTIVE:
+            return "ACTIVE";
+        case CallState::IDLE:
+            return "IDLE";
+        case CallState::INBOUND_RINGING:
+            return "INBOUND_RINGING";
+        case CallState::INVITED:
+            return "INVITED";
+        case CallState::OUTBOUND_RINGING:
+            return "OUTBOUND_RINGING";
+        case CallState::TRYING:
+            return "TRYING";
+        default:
+            return "";
+    }
+}
+
+std::string PhoneCallContext::configurationFeatureToString(CallingDeviceConfigurationProperty feature) {
+    switch (feature) {
+        case CallingDeviceConfigurationProperty::DTMF_SUPPORTED:
+            return "DTMF_SUPPORTED";
+        default:
+            return "";
+    }
+}
+
+}  // namespace phoneCallController
+}  // namespace engine
+}  // namespace aace
@@ -161,7 +161,6 @@ PhoneCallControllerCapabilityAgent::PhoneCallControllerCapabilityAgent(
         m_focusManager{focusManager},
         m_phoneCallController{phoneCallController} {
     m_capabilityConfigurations.insert(getPhoneCallControllerCapabilityConfiguration());
-    m_connectionState = aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState::DISCONNECTED;
     std::string context = getContextString();
     updateContextManager(context);
 }
@@ -249,7 +248,7 @@ void PhoneCallControllerCapabilityAgent::handleDialDirective(std::shared_ptr<Dir
         if (m_phoneCallController->dial(info->directive->getPayload())) {
             auto agentId = info->directive->getAgentId();
             m_callMethodMap[callId] = CallMethod::DIAL;
-            m_currentCallId = callId;
+            m_context.setCurrentCall(callId);
             m_callAgentMap[callId] = agentId;
         } else {
             removeCall(callId);
@@ -289,7 +288,7 @@ void PhoneCallControllerCapabilityAgent::handleRedialDirective(std::shared_ptr<D
         if (m_phoneCallController->redial(info->directive->getPayload())) {
             auto agentId = info->directive->getAgentId();
             m_callMethodMap[callId] = CallMethod::REDIAL;
-            m_currentCallId = callId;
+            m_context.setCurrentCall(callId);
             m_callAgentMap[callId] = agentId;
         } else {
             removeCall(callId);
@@ -456,7 +455,7 @@ PhoneCallControllerCapabilityAgent::getCapabilityConfigurations() {
 
 void PhoneCallControllerCapabilityAgent::connectionStateChanged(
     aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState state) {
-    m_connectionState = state;
+    m_context.setConnectionState(state);
     std::string context = getContextString();
     updateContextManager(context);
 }
@@ -518,7 +517,7 @@ void PhoneCallControllerCapabilityAgent::deviceConfigurationUpdated(
     std::unordered_map<
         aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty,
         bool> configurationMap) {
-    m_deviceConfigurationMap = configurationMap;
+    m_context.setDeviceConfiguration(configurationMap);
     std::string context = getContextString();
     updateContextManager(context);
 }
@@ -536,62 +535,7 @@ void PhoneCallControllerCapabilityAgent::updateContextManager(const std::string&
 }
 
 std::string PhoneCallControllerCapabilityAgent::getContextString() {
-    try {
-        rapidjson::Document document(rapidjson::kObjectType);
-
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-        rapidjson::Value device(rapidjson::kObjectType);
-        device.AddMember(
-            "connectionState",
-            rapidjson::Value(connectionStateToString(m_connectionState).c_str(), allocator),
-            allocator);
-        document.AddMember("device", device, allocator);
-
-        rapidjson::Value configuration(rapidjson::kObjectType);
-        rapidjson::Value callingFeature(rapidjson::kArrayType);
-        for (auto it : m_deviceConfigurationMap) {
-            rapidjson::Value tempConfig(rapidjson::kObjectType);
-            tempConfig.AddMember(
-                rapidjson::Value(configurationFeatureToString(it.first).c_str(), allocator),
-                rapidjson::Value().SetBool(it.second),
-                allocator);
-            callingFeature.PushBack(tempConfig, allocator);
-        }
-        rapidjson::Value tempConfig(rapidjson::kObjectType);
-        tempConfig.AddMember("OVERRIDE_RINGTONE_SUPPORTED", rapidjson::Value().SetBool(false), allocator);
-        callingFeature.PushBack(tempConfig, allocator);
-
-        configuration.AddMember("callingFeature", callingFeature, allocator);
-        document.AddMember("configuration", configuration, allocator);
-
-        rapidjson::Value allCalls(rapidjson::kArrayType);
-        for (auto it : m_allCallsMap) {
-            if (it.second == CallState::IDLE) {
-                continue;
-            }
-            rapidjson::Value tempCall(rapidjson::kObjectType);
-            tempCall.AddMember("callId", rapidjson::Value(it.first.c_str(), allocator), allocator);
-            tempCall.AddMember(
-                "callState", rapidjson::Value(callStateToString(it.second).c_str(), allocator), allocator);
-            allCalls.PushBack(tempCall, allocator);
-        }
-        document.AddMember("allCalls", allCalls, allocator);
-
-        if (callExist(m_currentCallId) && getCallState(m_currentCallId) != CallState::IDLE) {
-            rapidjson::Value currentCall(rapidjson::kObjectType);
-            currentCall.AddMember("callId", rapidjson::Value(m_currentCallId.c_str(), allocator), allocator);
-            document.AddMember("currentCall", currentCall, allocator);
-        }
-
-        ThrowIfNot(document.Accept(writer), "failedToWriteJsonDocument");
-        return buffer.GetString();
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return "";
-    }
+    return m_context.toString();
 }
 
 const std::pair<std::string, std::string> PhoneCallControllerCapabilityAgent::buildEventAndUpdateContext(
@@ -599,25 +543,25 @@ const std::pair<std::string, std::string> PhoneCallControllerCapabilityAgent::bu
     const std::string& payload) {
     const std::pair<std::string, std::string> emptyPair;
     std::string context = getContextString();
-    rapidjson::Document contextPayload;
-    if (contextPayload.Parse(context.c_str()).HasParseError()) {
-        AACE_ERROR(LX(TAG).d("reason", "failedToParseContextPayload"));
-        return emptyPair;
-    }
-    rapidjson::Document document(rapidjson::kArrayType);
+
+    // wrap the serialized context without parsing it again
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-    rapidjson::Value contextObject(rapidjson::kObjectType);
-    contextObject.AddMember("payload", contextPayload, allocator);
-    rapidjson::Value header(rapidjson::kObjectType);
-    header.AddMember("namespace", rapidjson::Value(NAMESPACE.c_str(), allocator), allocator);
-    header.AddMember("name", rapidjson::Value("PhoneCallControllerState", allocator), allocator);
-    contextObject.AddMember("header", header, allocator);
-    document.PushBack(contextObject, allocator);
-
-    if (!document.Accept(writer)) {
+    writer.StartArray();
+    writer.StartObject();
+    writer.Key("payload");
+    writer.RawValue(context.c_str(), context.size(), rapidjson::kObjectType);
+    writer.Key("header");
+    writer.StartObject();
+    writer.Key("namespace");
+    writer.String(NAMESPACE.c_str());
+    writer.Key("name");
+    writer.String("PhoneCallControllerState");
+    writer.EndObject();
+    writer.EndObject();
+    writer.EndArray();
+
+    if (context.empty() || !writer.IsComplete()) {
         AACE_ERROR(LX(TAG).d("reason", "failedToCreateContextWithHeader"));
         return emptyPair;
     }
@@ -649,11 +593,10 @@ void PhoneCallControllerCapabilityAgent::executeCallStateChanged(
     }
     auto eventName = getEventName(state, callId);
     auto agentId = executeGetAgentByCallId(callId, eventName);
-    rapidjson::Document payload(rapidjson::kObjectType);
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
-    m_currentCallId = callId;
+    m_context.setCurrentCall(callId);
 
     // Context Handling
     if (state == CallState::IDLE) {
@@ -671,37 +614,28 @@ void PhoneCallControllerCapabilityAgent::executeCallStateChanged(
         releaseCommunicationsChannelFocus();
     }
 
+    writer.StartObject();
     if (state == CallState::INVITED) {
-        rapidjson::Document allCallsPayload(rapidjson::kArrayType);
-        rapidjson::Document receivedCallPayload(rapidjson::kObjectType);
-
-        for (auto it : m_allCallsMap) {
-            if (it.second == CallState::IDLE) {
-                continue;
-            }
-            rapidjson::Value tempCall(rapidjson::kObjectType);
-            tempCall.AddMember(
-                "callId", rapidjson::Value(it.first.c_str(), payload.GetAllocator()), payload.GetAllocator());
-            tempCall.AddMember(
-                "callState",
-                rapidjson::Value(callStateToString(it.second).c_str(), payload.GetAllocator()),
-                payload.GetAllocator());
-            allCallsPayload.PushBack(tempCall, payload.GetAllocator());
-        }
-        payload.AddMember("allCalls", allCallsPayload, payload.GetAllocator());
-        receivedCallPayload.AddMember(
-            "callId", rapidjson::Value(callId.c_str(), payload.GetAllocator()), payload.GetAllocator());
+        auto allCalls = m_context.getAllCallsString();
+        writer.Key("allCalls");
+        writer.RawValue(allCalls.c_str(), allCalls.size(), rapidjson::kArrayType);
+        writer.Key("receivedCall");
+        writer.StartObject();
+        writer.Key("callId");
+        writer.String(callId.c_str());
         if (callerId != "") {
-            receivedCallPayload.AddMember(
-                "callerId", rapidjson::Value(callerId.c_str(), payload.GetAllocator()), payload.GetAllocator());
+            writer.Key("callerId");
+            writer.String(callerId.c_str());
         }
-        payload.AddMember("receivedCall", receivedCallPayload, payload.GetAllocator());
+        writer.EndObject();
     } else {
-        payload.AddMember("callId", rapidjson::Value(callId.c_str(), payload.GetAllocator()), payload.GetAllocator());
+        writer.Key("callId");
+        writer.String(callId.c_str());
     }
+    writer.EndObject();
 
     try {
-        ThrowIfNot(payload.Accept(writer), "failedToWriteJsonDocument");
+        ThrowIfNot(writer.IsComplete(), "failedToWriteJsonDocument");
         auto event = buildEventAndUpdateContext(eventName, buffer.GetString());
         ThrowIf(event.second.empty(), "failedToCreateEvent");
         auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>(agentId, event.second);
@@ -893,44 +827,16 @@ std::string PhoneCallControllerCapabilityAgent::getEventName(CallState state, co
 
 std::string PhoneCallControllerCapabilityAgent::connectionStateToString(
     aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState state) {
-    switch (state) {
-        case aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState::CONNECTED:
-            return "CONNECTED";
-        case aace::phoneCallController::PhoneCallControllerEngineInterface::ConnectionState::DISCONNECTED:
-            return "DISCONNECTED";
-        default:
-            return "";
-    }
+    return PhoneCallContext::connectionStateToString(state);
 }
 
 std::string PhoneCallControllerCapabilityAgent::callStateToString(CallState state) {
-    switch (state) {
-        case CallState::ACTIVE:
-            return "ACTIVE";
-        case CallState::IDLE:
-            return "IDLE";
-        case CallState::INBOUND_RINGING:
-            return "INBOUND_RINGING";
-        case CallState::INVITED:
-            return "INVITED";
-        case CallState::OUTBOUND_RINGING:
-            return "OUTBOUND_RINGING";
-        case CallState::TRYING:
-            return "TRYING";
-        default:
-            return "";
-    }
+    return PhoneCallContext::callStateToString(state);
 }
 
 std::string PhoneCallControllerCapabilityAgent::configurationFeatureToString(
     aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty feature) {
-    switch (feature) {
-        case aace::phoneCallController::PhoneCallControllerEngineInterface::CallingDeviceConfigurationProperty::
-            DTMF_SUPPORTED:
-            return "DTMF_SUPPORTED";
-        default:
-            return "";
-    }
+    return PhoneCallContext::configurationFeatureToString(feature);
 }
 
 std::string PhoneCallControllerCapabilityAgent::callErrorToString(
@@ -963,23 +869,23 @@ std::string PhoneCallControllerCapabilityAgent::dtmfErrorToString(
 }
 
 void PhoneCallControllerCapabilityAgent::addCall(std::string callId, CallState state) {
-    m_allCallsMap[callId] = state;
+    m_context.setCallState(callId, state);
 }
 
 PhoneCallControllerCapabilityAgent::CallState PhoneCallControllerCapabilityAgent::getCallState(std::string callId) {
-    return m_allCallsMap[callId];
+    return m_context.getCallState(callId);
 }
 
 void PhoneCallControllerCapabilityAgent::setCallState(std::string callId, CallState state) {
-    m_allCallsMap[callId] = state;
+    m_context.setCallState(callId, state);
 }
 
 void PhoneCallControllerCapabilityAgent::removeCall(std::string callId) {
-    m_allCallsMap.erase(callId);
+    m_context.removeCall(callId);
 }
 
 bool PhoneCallControllerCapabilityAgent::callExist(std::string callId) {
-    return m_allCallsMap.find(callId) != m_allCallsMap.end();
+    return m_context.hasCall(callId);
 }
 
 }  // namespace phoneCallController
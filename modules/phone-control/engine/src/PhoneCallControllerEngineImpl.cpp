@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerEngineImpl.h"
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerRESTAgent.h"
+#include "AACE/Engine/Alexa/HttpClientPool.h"
 
 #include <AACE/Engine/Core/EngineMacros.h>
 
@@ -70,7 +71,8 @@ bool PhoneCallControllerEngineImpl::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     try {
         m_phoneCallControllerCapabilityAgent = PhoneCallControllerCapabilityAgent::create(
             shared_from_this(), contextManager, exceptionSender, messageSender, focusManager);
@@ -79,6 +81,8 @@ bool PhoneCallControllerEngineImpl::initialize(
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
         m_alexaEndpoints = alexaEndpoints;
+        m_httpClient = httpClient != nullptr ? httpClient : aace::engine::alexa::HttpClientPool::create();
+        ThrowIfNull(m_httpClient, "nullHttpClient");
 
         m_authDelegate->addAuthObserver(shared_from_this());
 
@@ -105,7 +109,8 @@ std::shared_ptr<PhoneCallControllerEngineImpl> PhoneCallControllerEngineImpl::cr
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     try {
         ThrowIfNull(phoneCallControllerPlatformInterface, "nullPlatformInterface");
         ThrowIfNull(capabilitiesRegistrar, "nullCapabilitiesRegistrar");
@@ -128,7 +133,8 @@ std::shared_ptr<PhoneCallControllerEngineImpl> PhoneCallControllerEngineImpl::cr
                 focusManager,
                 authDelegate,
                 deviceInfo,
-                alexaEndpoints),
+                alexaEndpoints,
+                httpClient),
             "initializePhoneCallControllerEngineImplFailed");
 
         // set the platform engine interface reference
@@ -296,7 +302,7 @@ void PhoneCallControllerEngineImpl::autoProvisioningThread() {
         AlexaAccountInfo alexaAccountInfo;
         int retryCounter = 0;
         while (!m_isShuttingDown && retryCounter < MAX_HTTP_RETRY_COUNT) {
-            alexaAccountInfo = getAlexaAccountInfo(m_authDelegate, m_deviceInfo, m_alexaEndpoints);
+            alexaAccountInfo = getAlexaAccountInfo(m_authDelegate, m_deviceInfo, m_alexaEndpoints, m_httpClient);
             if (AlexaAccountInfo::AccountProvisionStatus::INVALID != alexaAccountInfo.provisionStatus) {
                 break;
             }
@@ -332,7 +338,8 @@ void PhoneCallControllerEngineImpl::autoProvisioningThread() {
             bool success = false;
             int retryCounter = 0;
             while (!m_isShuttingDown && retryCounter < MAX_HTTP_RETRY_COUNT) {
-                success = doAccountAutoProvision(alexaAccountInfo, m_authDelegate, m_deviceInfo, m_alexaEndpoints);
+                success = doAccountAutoProvision(
+                    alexaAccountInfo, m_authDelegate, m_deviceInfo, m_alexaEndpoints, m_httpClient);
                 if (success) {
                     break;
                 }
@@ -89,6 +89,9 @@ bool PhoneCallControllerEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::alexa::AlexaEndpointInterface>("aace.alexa");
         ThrowIfNull(alexaEndpoints, "alexaEndpointsInvalid");
 
+        // the shared HTTP client is optional, the engine implementation falls back to its own pool
+        auto httpClient = getContext()->getServiceInterface<aace::engine::alexa::HttpClientInterface>("aace.alexa");
+
         m_phoneCallControllerEngineImpl = aace::engine::phoneCallController::PhoneCallControllerEngineImpl::create(
             phoneCallController,
             defaultCapabilitiesRegistrar,
@@ -98,7 +101,8 @@ bool PhoneCallControllerEngineService::registerPlatformInterfaceType(
             focusManager,
             authDelegate,
             deviceInfo,
-            alexaEndpoints);
+            alexaEndpoints,
+            httpClient);
         ThrowIfNull(m_phoneCallControllerEngineImpl, "createPhoneCallControllerEngineImplFailed");
 
         return true;
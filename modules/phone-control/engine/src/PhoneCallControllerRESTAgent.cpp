@@ -16,8 +16,6 @@
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerRESTAgent.h"
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AACE/Engine/Core/EngineMacros.h>
@@ -116,6 +114,7 @@ static bool parseCommonHTTPResponse(const alexaClientSDK::avsCommon::utils::libc
 /**
  * Helper function to do HTTP POST operation.
  *
+ * @param httpClient The @c HttpClientInterface used to perform the request.
  * @param url The endpoint url.
  * @param headerLines The HTTP header passed as part of HTTP POST.
  * @param data The HTTP body passed as part of HTTP POST.
@@ -123,17 +122,17 @@ static bool parseCommonHTTPResponse(const alexaClientSDK::avsCommon::utils::libc
  * @return On success returns @c HTTPResponse received from server, otherwise empty object of @c HTTPResponse.
  */
 static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doPost(
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient,
     const std::string& url,
     const std::vector<std::string> headerLines,
     const std::string& data,
     std::chrono::seconds timeout) {
     try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
+        ThrowIfNull(httpClient, "nullHttpClient");
 
-        return httpPost->doPost(url, headerLines, data, timeout);
+        // The shared client resets pooled handles on checkout, so curl in libcurlUtils uses the latest provided
+        // curl options.
+        return httpClient->doPost(url, headerLines, data, timeout);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "doPost").d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -143,20 +142,21 @@ static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doPost(
 /**
  * Helper function to do HTTP GET operation.
  *
+ * @param httpClient The @c HttpClientInterface used to perform the request.
  * @param url The endpoint url.
  * @param headerLines The HTTP header passed as part of HTTP GET.
  * @return On success returns @c HTTPResponse received from server, otherwise empty object of @c HTTPResponse.
  */
 static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doGet(
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient,
     const std::string& url,
     const std::vector<std::string>& headers) {
     try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
+        ThrowIfNull(httpClient, "nullHttpClient");
 
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
+        // The shared client resets pooled handles on checkout, so curl in libcurlUtils uses the latest provided
+        // curl options.
+        return httpClient->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "doGet").d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -216,13 +216,15 @@ static std::string getACMSEndpoint(std::shared_ptr<aace::engine::alexa::AlexaEnd
 AlexaAccountInfo getAlexaAccountInfo(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     rapidjson::Document document;
     AlexaAccountInfo alexaAccount;
 
     auto httpHeaderData = buildCommonHTTPHeader(deviceInfo->getDeviceSerialNumber(), authDelegate->getAuthToken());
     try {
-        auto httpResponse = doGet(getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH, httpHeaderData);
+        auto httpResponse =
+            doGet(httpClient, getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH, httpHeaderData);
 
         ThrowIfNot(
             parseCommonHTTPResponse(httpResponse),
@@ -277,13 +279,15 @@ bool doAccountAutoProvision(
     const AlexaAccountInfo& alexaAccountInfo,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::alexa::HttpClientInterface> httpClient) {
     auto httpHeaderData = buildCommonHTTPHeader(deviceInfo->getDeviceSerialNumber(), authDelegate->getAuthToken());
     httpHeaderData.insert(httpHeaderData.end(), CONTENT_TYPE_APPLICATION_JSON);
 
     auto autoProvisionJson = buildAutoAccountProvisionJson();
     try {
         auto httpResponse = doPost(
+            httpClient,
             getACMSEndpoint(alexaEndpoints) + FORWARD_SLASH + ACCOUNTS_PATH + FORWARD_SLASH +
                 alexaAccountInfo.directedId + FORWARD_SLASH + USERS_PATH,
             httpHeaderData,
@@ -0,0 +1,168 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/PhoneCallController/PhoneCallContext.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace phoneCallController {
+
+using PhoneCallContext = aace::engine::phoneCallController::PhoneCallContext;
+using CallState = PhoneCallContext::CallState;
+using ConnectionState = PhoneCallContext::ConnectionState;
+
+/// The number of state changes of the busy conference.
+static constexpr int CONFERENCE_STATE_CHANGES = 10000;
+
+/// The number of context requests between two state changes of the busy conference.
+static constexpr int CONTEXT_REQUESTS_PER_CHANGE = 4;
+
+static const std::string DISCONNECTED_CONTEXT = R"({
+    "device": {"connectionState": "DISCONNECTED"},
+    "configuration": {"callingFeature": [{"OVERRIDE_RINGTONE_SUPPORTED": false}]},
+    "allCalls": []
+})";
+
+/// Returns the average time of a state change in a conference with a number of calls, in nanoseconds.
+static double measureStateChange(int callCount) {
+    PhoneCallContext context;
+    for (int i = 0; i < callCount; i++) {
+        context.setCallState("call-" + std::to_string(i), CallState::ACTIVE);
+    }
+    std::vector<std::string> callIds;
+    for (int i = 0; i < callCount; i++) {
+        callIds.push_back("call-" + std::to_string(i));
+    }
+
+    double best = 0;
+    for (int run = 0; run < 3; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < CONFERENCE_STATE_CHANGES; i++) {
+            auto state = (i / callCount) % 2 == 0 ? CallState::INBOUND_RINGING : CallState::ACTIVE;
+            context.setCallState(callIds[i % callCount], state);
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        auto average = elapsed / CONFERENCE_STATE_CHANGES;
+        best = run == 0 ? average : std::min(best, average);
+    }
+    return best;
+}
+
+TEST(PhoneCallContextTest, initialContext) {
+    PhoneCallContext context;
+    EXPECT_EQ(nlohmann::json::parse(context.toString()), nlohmann::json::parse(DISCONNECTED_CONTEXT));
+}
+
+TEST(PhoneCallContextTest, callsAreReportedInOrder) {
+    PhoneCallContext context;
+    context.setConnectionState(ConnectionState::CONNECTED);
+    context.setDeviceConfiguration({{PhoneCallContext::CallingDeviceConfigurationProperty::DTMF_SUPPORTED, true}});
+    context.setCallState("first", CallState::ACTIVE);
+    context.setCallState("idle", CallState::IDLE);
+    context.setCallState("second", CallState::INBOUND_RINGING);
+    context.setCurrentCall("second");
+
+    auto expected = nlohmann::json::parse(R"({
+        "device": {"connectionState": "CONNECTED"},
+        "configuration": {"callingFeature": [{"DTMF_SUPPORTED": true}, {"OVERRIDE_RINGTONE_SUPPORTED": false}]},
+        "allCalls": [{"callId": "first", "callState": "ACTIVE"}, {"callId": "second", "callState": "INBOUND_RINGING"}],
+        "currentCall": {"callId": "second"}
+    })");
+    EXPECT_EQ(nlohmann::json::parse(context.toString()), expected);
+    EXPECT_TRUE(context.hasCall("idle"));
+    EXPECT_EQ(context.getCallState("second"), CallState::INBOUND_RINGING);
+
+    // removing the current call removes it from the context
+    EXPECT_TRUE(context.removeCall("second"));
+    EXPECT_FALSE(context.removeCall("second"));
+    EXPECT_EQ(context.getCallState("second"), CallState::IDLE);
+    auto json = nlohmann::json::parse(context.toString());
+    EXPECT_EQ(json["allCalls"].size(), 1u);
+    EXPECT_EQ(json.count("currentCall"), 0u);
+}
+
+TEST(PhoneCallContextTest, callIdIsEscaped) {
+    PhoneCallContext context;
+    context.setCallState("call \"1\"", CallState::ACTIVE);
+    auto json = nlohmann::json::parse(context.toString());
+    EXPECT_EQ(json["allCalls"][0]["callId"], "call \"1\"");
+    EXPECT_EQ(nlohmann::json::parse(context.getAllCallsString()), json["allCalls"]);
+}
+
+TEST(PhoneCallContextTest, contextIsSerializedOnlyWhenChanged) {
+    PhoneCallContext context;
+    context.toString();
+    context.toString();
+    EXPECT_EQ(context.getSerializationCount(), 1u);
+
+    context.setConnectionState(ConnectionState::DISCONNECTED);
+    context.setCallState("call", CallState::ACTIVE);
+    context.toString();
+    EXPECT_EQ(context.getSerializationCount(), 2u);
+
+    // updates that do not change anything keep the serialized context
+    context.setCallState("call", CallState::ACTIVE);
+    context.setDeviceConfiguration({});
+    context.toString();
+    EXPECT_EQ(context.getSerializationCount(), 2u);
+}
+
+TEST(PhoneCallContextTest, busyConference) {
+    static constexpr int legCount = 48;
+    PhoneCallContext context;
+    context.setConnectionState(ConnectionState::CONNECTED);
+    for (int i = 0; i < legCount; i++) {
+        context.setCallState("leg-" + std::to_string(i), CallState::ACTIVE);
+    }
+    context.toString();
+    auto serializations = context.getSerializationCount();
+
+    // each leg flips between ringing and active while the context is requested repeatedly
+    for (int i = 0; i < CONFERENCE_STATE_CHANGES; i++) {
+        auto callId = "leg-" + std::to_string(i % legCount);
+        auto state = context.getCallState(callId) == CallState::ACTIVE ? CallState::INBOUND_RINGING : CallState::ACTIVE;
+        context.setCallState(callId, state);
+        context.setCurrentCall(callId);
+        for (int request = 0; request < CONTEXT_REQUESTS_PER_CHANGE; request++) {
+            context.toString();
+        }
+    }
+    EXPECT_EQ(context.getSerializationCount() - serializations, static_cast<uint64_t>(CONFERENCE_STATE_CHANGES));
+
+    auto json = nlohmann::json::parse(context.toString());
+    EXPECT_EQ(json["allCalls"].size(), static_cast<size_t>(legCount));
+}
+
+TEST(PhoneCallContextTest, stateChangeTimeDoesNotDependOnCallCount) {
+    auto small = measureStateChange(8);
+    auto large = measureStateChange(512);
+    RecordProperty("stateChangeNanoseconds8Calls", static_cast<int>(small));
+    RecordProperty("stateChangeNanoseconds512Calls", static_cast<int>(large));
+
+    // a context rebuilt on every change would be about 64 times slower with 512 calls
+    EXPECT_LT(large, small * 8);
+}
+
+}  // namespace phoneCallController
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,183 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
+#define AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/Audio/AudioStream.h>
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+/**
+ * LRU cache of synthesized speech. Entries are kept in memory and, when a cache directory is configured,
+ * persisted to disk so they survive an engine restart. Speech is cached by recording the audio stream
+ * returned by the provider while the platform reads it; only streams that are read to the end are cached.
+ */
+class SynthesizedSpeechCache : public std::enable_shared_from_this<SynthesizedSpeechCache> {
+public:
+    /// Cache configuration.
+    struct Config {
+        /// Maximum number of audio bytes held in memory across all entries.
+        size_t maxMemorySize = 4 * 1024 * 1024;
+
+        /// Maximum size of a single entry. Longer speech is not cached.
+        size_t maxEntrySize = 512 * 1024;
+
+        /// Directory for the disk cache. The disk cache is disabled if empty.
+        std::string diskCachePath;
+
+        /// Maximum number of audio bytes stored in the disk cache.
+        size_t maxDiskSize = 32 * 1024 * 1024;
+    };
+
+    /// A cached synthesized speech resource.
+    struct Entry {
+        /// The synthesized audio data.
+        std::string audio;
+
+        /// The speech metadata reported by the provider.
+        std::string metadata;
+
+        /// The format of the synthesized audio.
+        aace::audio::AudioFormat audioFormat;
+
+        /// The media type of the synthesized audio.
+        aace::audio::AudioStream::MediaType mediaType = aace::audio::AudioStream::MediaType::UNKNOWN;
+    };
+
+    /**
+     * Creates an instance of @c SynthesizedSpeechCache with the default configuration.
+     *
+     * @return A new instance of @c SynthesizedSpeechCache on success, @c nullptr otherwise.
+     */
+    static std::shared_ptr<SynthesizedSpeechCache> create();
+
+    /**
+     * Creates an instance of @c SynthesizedSpeechCache.
+     *
+     * @param config The cache configuration.
+     * @return A new instance of @c SynthesizedSpeechCache on success, @c nullptr otherwise.
+     */
+    static std::shared_ptr<SynthesizedSpeechCache> create(const Config& config);
+
+    /**
+     * Builds the cache key of a speech synthesis request. The voice and locale are part of the request options.
+     *
+     * @param provider The name of the Text To Speech provider.
+     * @param text The text or SSML to synthesize.
+     * @param options The request options sent to the provider.
+     */
+    static std::string getKey(const std::string& provider, const std::string& text, const std::string& options);
+
+    /**
+     * Looks up an entry, first in memory and then on disk. Entries loaded from disk are kept in memory.
+     *
+     * @return The cached entry, or @c nullptr on a cache miss.
+     */
+    std::shared_ptr<const Entry> get(const std::string& key);
+
+    /**
+     * Adds an entry to the cache, evicting the least recently used entries to stay within the size limits.
+     *
+     * @return @c true if the entry was cached, @c false if it exceeds the maximum entry size.
+     */
+    bool put(const std::string& key, std::shared_ptr<const Entry> entry);
+
+    /**
+     * Creates an audio stream that replays a cached entry.
+     */
+    static std::shared_ptr<aace::audio::AudioStream> createAudioStream(std::shared_ptr<const Entry> entry);
+
+    /**
+     * Wraps the audio stream returned by a provider. The audio read through the returned stream is added to
+     * the cache under @c key once the provider stream is closed.
+     *
+     * @param key The cache key of the request.
+     * @param preparedAudio The audio stream returned by the provider.
+     * @param metadata The speech metadata returned by the provider.
+     */
+    std::shared_ptr<aace::audio::AudioStream> createCachingAudioStream(
+        const std::string& key,
+        std::shared_ptr<aace::audio::AudioStream> preparedAudio,
+        const std::string& metadata);
+
+    /// Removes all entries from memory and disk.
+    void clear();
+
+    /// Gets the number of audio bytes held in memory.
+    size_t getMemorySize();
+
+    /// Gets the number of audio bytes stored on disk.
+    size_t getDiskSize();
+
+private:
+    /// A least recently used list with an index into it.
+    struct LruIndex {
+        std::list<std::string> order;
+        std::unordered_map<std::string, std::list<std::string>::iterator> positions;
+    };
+
+    SynthesizedSpeechCache(const Config& config);
+
+    bool initialize();
+
+    void putInMemoryLocked(const std::string& key, std::shared_ptr<const Entry> entry);
+    void putOnDiskLocked(const std::string& key, const Entry& entry);
+    std::shared_ptr<const Entry> loadFromDiskLocked(const std::string& key);
+    void removeFromDiskLocked(std::string fileName);
+    std::string getFilePath(const std::string& fileName);
+
+    static std::string getFileName(const std::string& key);
+    static void touchLocked(LruIndex& index, const std::string& key);
+
+private:
+    /// The cache configuration.
+    const Config m_config;
+
+    /// The in-memory entries.
+    std::unordered_map<std::string, std::shared_ptr<const Entry>> m_memoryEntries;
+
+    /// The recency order of the in-memory entries.
+    LruIndex m_memoryIndex;
+
+    /// Number of audio bytes held in memory.
+    size_t m_memorySize;
+
+    /// The size of each entry stored on disk, by file name.
+    std::unordered_map<std::string, size_t> m_diskEntries;
+
+    /// The recency order of the disk entries, by file name.
+    LruIndex m_diskIndex;
+
+    /// Number of audio bytes stored on disk.
+    size_t m_diskSize;
+
+    /// Serializes access to the cache.
+    std::mutex m_mutex;
+};
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
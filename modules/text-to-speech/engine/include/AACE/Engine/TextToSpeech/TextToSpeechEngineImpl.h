@@ -16,13 +16,18 @@
 #ifndef AACE_ENGINE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_IMPL_H
 #define AACE_ENGINE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_IMPL_H
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <AACE/Engine/Metrics/MetricRecorderServiceInterface.h>
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
 #include "AACE/TextToSpeech/TextToSpeech.h"
 #include "AACE/TextToSpeech/TextToSpeechEngineInterface.h"
+#include "SynthesizedSpeechCache.h"
 #include "TextToSpeechServiceInterface.h"
 
 namespace aace {
@@ -31,14 +36,34 @@ namespace textToSpeech {
 
 class TextToSpeechEngineImpl : public aace::textToSpeech::TextToSpeechEngineInterface {
 private:
-    TextToSpeechEngineImpl(std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface);
+    TextToSpeechEngineImpl(
+        std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
+        unsigned int maxConcurrentRequests);
 
-    bool initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
+    bool initialize(
+        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+        std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+        std::shared_ptr<SynthesizedSpeechCache> speechCache);
 
 public:
+    /// Default maximum number of prepare speech requests in flight per provider
+    static constexpr unsigned int DEFAULT_MAX_CONCURRENT_REQUESTS = 4;
+
+    /**
+     * Creates an instance of @c TextToSpeechEngineImpl.
+     *
+     * @param textToSpeechPlatformInterface The @c TextToSpeech platform interface.
+     * @param textToSpeechServiceInterface The service interface used to look up the Text To Speech providers.
+     * @param metricRecorder The recorder for the speech cache metrics.
+     * @param speechCache The cache of synthesized speech. Caching is disabled if @c nullptr.
+     * @param maxConcurrentRequests The maximum number of prepare speech requests in flight per provider.
+     */
     static std::shared_ptr<TextToSpeechEngineImpl> create(
         std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
+        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+        std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder = nullptr,
+        std::shared_ptr<SynthesizedSpeechCache> speechCache = nullptr,
+        unsigned int maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS);
 
     // TextToSpeechEngineInterface
     bool onPrepareSpeech(
@@ -51,20 +76,41 @@ public:
     void shutdown();
 
 private:
+    /// Executor running the prepare speech requests of a provider, with the number of requests queued on it
+    struct PrepareSpeechWorker {
+        explicit PrepareSpeechWorker(const std::string& provider) : executor("TextToSpeech.prepareSpeech." + provider) {
+        }
+
+        aace::engine::utils::threading::Executor executor;
+        std::shared_ptr<std::atomic<size_t>> pendingRequests = std::make_shared<std::atomic<size_t>>(0);
+    };
+
     bool executeOnPrepareSpeech(
         const std::string& speechId,
         const std::string& text,
+        const std::string& provider,
         std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
         const std::string& options);
+    std::shared_ptr<PrepareSpeechWorker> getPrepareSpeechWorker(const std::string& provider);
+    void submitSpeechCacheMetric(bool hit);
     bool executeOnGetCapabilities(
         const std::string& requestId,
         std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider);
 
     std::shared_ptr<aace::textToSpeech::TextToSpeech> m_textToSpeechPlatformInterface;
     std::weak_ptr<TextToSpeechServiceInterface> m_textToSpeechServiceInterface;
+    std::weak_ptr<aace::engine::metrics::MetricRecorderServiceInterface> m_metricRecorder;
+    std::shared_ptr<SynthesizedSpeechCache> m_speechCache;
+
+    // maximum number of prepare speech requests in flight per provider
+    const unsigned int m_maxConcurrentRequests;
+
+    // workers for speech synthesis requests, by provider name
+    std::unordered_map<std::string, std::vector<std::shared_ptr<PrepareSpeechWorker>>> m_prepareSpeechWorkers;
+    std::mutex m_prepareSpeechWorkersMutex;
 
-    // executor for speech synthesis requests
-    aace::engine::utils::threading::Executor m_executor;
+    // executor for capabilities requests and cached speech
+    aace::engine::utils::threading::Executor m_executor{"TextToSpeech"};
 };
 
 }  // namespace textToSpeech
@@ -19,6 +19,7 @@
 #include "AACE/Engine/Core/EngineService.h"
 #include "AACE/TextToSpeech/TextToSpeech.h"
 
+#include "SynthesizedSpeechCache.h"
 #include "TextToSpeechEngineImpl.h"
 #include "TextToSpeechServiceInterface.h"
 #include "TextToSpeechSynthesizerInterface.h"
@@ -49,6 +50,7 @@ public:
 protected:
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool initialize() override;
+    bool configure(std::shared_ptr<std::istream> configuration) override;
     bool shutdown() override;
 
 private:
@@ -68,6 +70,11 @@ private:
     // Map to store Text To Speech provider name and the associated Text To Speech Providers
     std::unordered_map<std::string, std::shared_ptr<TextToSpeechSynthesizerInterface>>
         m_registeredTextToSpeechProviders;
+    // Maximum number of prepare speech requests in flight per provider
+    unsigned int m_maxConcurrentRequests = TextToSpeechEngineImpl::DEFAULT_MAX_CONCURRENT_REQUESTS;
+    // Synthesized speech cache configuration
+    bool m_speechCacheEnabled = true;
+    SynthesizedSpeechCache::Config m_speechCacheConfig;
 };
 
 }  // namespace textToSpeech
@@ -0,0 +1,454 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/TextToSpeech/SynthesizedSpeechCache.h"
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.textToSpeech.SynthesizedSpeechCache");
+
+// File extension of the disk cache entries
+static const std::string CACHE_FILE_EXTENSION = ".tts";
+
+// Suffix of a disk cache entry while it is being written
+static const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+/**
+ * Audio stream replaying a cached entry.
+ */
+class CachedAudioStream : public aace::audio::AudioStream {
+public:
+    CachedAudioStream(std::shared_ptr<const SynthesizedSpeechCache::Entry> entry) : m_entry(entry), m_offset(0) {
+    }
+
+    // aace::audio::AudioStream
+    ssize_t read(char* data, const size_t size) override {
+        auto count = std::min(size, m_entry->audio.size() - m_offset);
+        std::memcpy(data, m_entry->audio.data() + m_offset, count);
+        m_offset += count;
+        return static_cast<ssize_t>(count);
+    }
+
+    bool isClosed() override {
+        return m_offset >= m_entry->audio.size();
+    }
+
+    AudioFormat getAudioFormat() override {
+        return m_entry->audioFormat;
+    }
+
+    Encoding getEncoding() override {
+        return getAudioFormat().getEncoding();
+    }
+
+    MediaType getMediaType() override {
+        return m_entry->mediaType;
+    }
+
+private:
+    std::shared_ptr<const SynthesizedSpeechCache::Entry> m_entry;
+    size_t m_offset;
+};
+
+/**
+ * Audio stream forwarding the audio of a provider and recording it. The recorded audio is added to the
+ * cache when the provider stream is closed, unless it exceeded the maximum entry size.
+ */
+class CachingAudioStream : public aace::audio::AudioStream {
+public:
+    CachingAudioStream(
+        std::weak_ptr<SynthesizedSpeechCache> cache,
+        const std::string& key,
+        std::shared_ptr<aace::audio::AudioStream> source,
+        const std::string& metadata,
+        size_t maxEntrySize) :
+            m_cache(cache),
+            m_key(key),
+            m_source(source),
+            m_entry(std::make_shared<SynthesizedSpeechCache::Entry>()),
+            m_maxEntrySize(maxEntrySize),
+            m_done(false) {
+        m_entry->metadata = metadata;
+    }
+
+    // aace::audio::AudioStream
+    ssize_t read(char* data, const size_t size) override {
+        auto count = m_source->read(data, size);
+        if (!m_done && count > 0) {
+            if (m_entry->audio.size() + count > m_maxEntrySize) {
+                AACE_DEBUG(LX(TAG).m("speechTooLongToCache").d("maxEntrySize", m_maxEntrySize));
+                m_entry->audio.clear();
+                m_done = true;
+            } else {
+                m_entry->audio.append(data, count);
+            }
+        }
+        if (m_source->isClosed()) {
+            commit();
+        }
+        return count;
+    }
+
+    bool isClosed() override {
+        if (m_source->isClosed()) {
+            commit();
+            return true;
+        }
+        return false;
+    }
+
+    AudioFormat getAudioFormat() override {
+        return m_source->getAudioFormat();
+    }
+
+    Encoding getEncoding() override {
+        return m_source->getEncoding();
+    }
+
+    MediaType getMediaType() override {
+        return m_source->getMediaType();
+    }
+
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override {
+        return m_source->getProperties();
+    }
+
+private:
+    void commit() {
+        if (m_done) {
+            return;
+        }
+        m_done = true;
+        auto cache = m_cache.lock();
+        if (cache != nullptr && !m_entry->audio.empty()) {
+            m_entry->audioFormat = m_source->getAudioFormat();
+            m_entry->mediaType = m_source->getMediaType();
+            cache->put(m_key, m_entry);
+        }
+    }
+
+private:
+    std::weak_ptr<SynthesizedSpeechCache> m_cache;
+    std::string m_key;
+    std::shared_ptr<aace::audio::AudioStream> m_source;
+    std::shared_ptr<SynthesizedSpeechCache::Entry> m_entry;
+    size_t m_maxEntrySize;
+    bool m_done;
+};
+
+static nlohmann::json audioFormatToJson(aace::audio::AudioFormat audioFormat) {
+    return {{"encoding", static_cast<int>(audioFormat.getEncoding())},
+            {"sampleFormat", static_cast<int>(audioFormat.getSampleFormat())},
+            {"layout", static_cast<int>(audioFormat.getLayout())},
+            {"endianness", static_cast<int>(audioFormat.getEndianness())},
+            {"sampleRate", audioFormat.getSampleRate()},
+            {"sampleSize", audioFormat.getSampleSize()},
+            {"channels", audioFormat.getNumChannels()}};
+}
+
+static aace::audio::AudioFormat audioFormatFromJson(const nlohmann::json& json) {
+    using AudioFormat = aace::audio::AudioFormat;
+    return AudioFormat(
+        static_cast<AudioFormat::Encoding>(json.value("encoding", 0)),
+        static_cast<AudioFormat::SampleFormat>(json.value("sampleFormat", 0)),
+        static_cast<AudioFormat::Layout>(json.value("layout", 0)),
+        static_cast<AudioFormat::Endianness>(json.value("endianness", 0)),
+        json.value("sampleRate", 0u),
+        json.value("sampleSize", 0u),
+        json.value("channels", 0u));
+}
+
+SynthesizedSpeechCache::SynthesizedSpeechCache(const Config& config) :
+        m_config(config), m_memorySize(0), m_diskSize(0) {
+}
+
+std::shared_ptr<SynthesizedSpeechCache> SynthesizedSpeechCache::create() {
+    return create(Config());
+}
+
+std::shared_ptr<SynthesizedSpeechCache> SynthesizedSpeechCache::create(const Config& config) {
+    try {
+        auto cache = std::shared_ptr<SynthesizedSpeechCache>(new SynthesizedSpeechCache(config));
+        ThrowIfNot(cache->initialize(), "initializeSynthesizedSpeechCacheFailed");
+        return cache;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+bool SynthesizedSpeechCache::initialize() {
+    try {
+        if (m_config.diskCachePath.empty()) {
+            return true;
+        }
+        ThrowIf(
+            ::mkdir(m_config.diskCachePath.c_str(), 0700) != 0 && errno != EEXIST, "createCacheDirectoryFailed");
+        auto dir = ::opendir(m_config.diskCachePath.c_str());
+        ThrowIfNull(dir, "openCacheDirectoryFailed");
+
+        // restore the disk index, most recently used (modified) entries first
+        std::vector<std::pair<time_t, std::string>> files;
+        while (auto item = ::readdir(dir)) {
+            std::string fileName = item->d_name;
+            struct stat info;
+            if (fileName.size() <= CACHE_FILE_EXTENSION.size() ||
+                fileName.compare(
+                    fileName.size() - CACHE_FILE_EXTENSION.size(),
+                    CACHE_FILE_EXTENSION.size(),
+                    CACHE_FILE_EXTENSION) != 0 ||
+                ::stat(getFilePath(fileName).c_str(), &info) != 0) {
+                continue;
+            }
+            files.emplace_back(info.st_mtime, fileName);
+            m_diskEntries[fileName] = info.st_size;
+            m_diskSize += info.st_size;
+        }
+        ::closedir(dir);
+
+        std::sort(files.begin(), files.end());
+        for (auto& file : files) {
+            touchLocked(m_diskIndex, file.second);
+        }
+        while (m_diskSize > m_config.maxDiskSize && !m_diskIndex.order.empty()) {
+            removeFromDiskLocked(m_diskIndex.order.back());
+        }
+        AACE_DEBUG(LX(TAG).d("diskEntries", m_diskEntries.size()).d("diskSize", m_diskSize));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", m_config.diskCachePath));
+        return false;
+    }
+}
+
+std::string SynthesizedSpeechCache::getKey(
+    const std::string& provider,
+    const std::string& text,
+    const std::string& options) {
+    // length prefixes keep the key unambiguous
+    return std::to_string(provider.size()) + ":" + provider + std::to_string(text.size()) + ":" + text + options;
+}
+
+std::shared_ptr<const SynthesizedSpeechCache::Entry> SynthesizedSpeechCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_memoryEntries.find(key);
+    if (it != m_memoryEntries.end()) {
+        touchLocked(m_memoryIndex, key);
+        return it->second;
+    }
+    if (m_config.diskCachePath.empty()) {
+        return nullptr;
+    }
+    auto entry = loadFromDiskLocked(key);
+    if (entry != nullptr) {
+        putInMemoryLocked(key, entry);
+    }
+    return entry;
+}
+
+bool SynthesizedSpeechCache::put(const std::string& key, std::shared_ptr<const Entry> entry) {
+    try {
+        ThrowIfNull(entry, "nullEntry");
+        ThrowIf(entry->audio.size() > m_config.maxEntrySize, "entryTooLarge");
+        std::lock_guard<std::mutex> lock(m_mutex);
+        putInMemoryLocked(key, entry);
+        if (!m_config.diskCachePath.empty()) {
+            putOnDiskLocked(key, *entry);
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+std::shared_ptr<aace::audio::AudioStream> SynthesizedSpeechCache::createAudioStream(
+    std::shared_ptr<const Entry> entry) {
+    return entry != nullptr ? std::make_shared<CachedAudioStream>(entry) : nullptr;
+}
+
+std::shared_ptr<aace::audio::AudioStream> SynthesizedSpeechCache::createCachingAudioStream(
+    const std::string& key,
+    std::shared_ptr<aace::audio::AudioStream> preparedAudio,
+    const std::string& metadata) {
+    if (preparedAudio == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<CachingAudioStream>(
+        shared_from_this(), key, preparedAudio, metadata, m_config.maxEntrySize);
+}
+
+void SynthesizedSpeechCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryEntries.clear();
+    m_memoryIndex = LruIndex();
+    m_memorySize = 0;
+    while (!m_diskIndex.order.empty()) {
+        removeFromDiskLocked(m_diskIndex.order.back());
+    }
+}
+
+size_t SynthesizedSpeechCache::getMemorySize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memorySize;
+}
+
+size_t SynthesizedSpeechCache::getDiskSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_diskSize;
+}
+
+void SynthesizedSpeechCache::putInMemoryLocked(const std::string& key, std::shared_ptr<const Entry> entry) {
+    auto it = m_memoryEntries.find(key);
+    if (it != m_memoryEntries.end()) {
+        m_memorySize -= it->second->audio.size();
+        it->second = entry;
+    } else {
+        m_memoryEntries.emplace(key, entry);
+    }
+    m_memorySize += entry->audio.size();
+    touchLocked(m_memoryIndex, key);
+
+    // evict the least recently used entries, keeping at least the new one
+    while (m_memorySize > m_config.maxMemorySize && m_memoryIndex.order.size() > 1) {
+        auto& lruKey = m_memoryIndex.order.back();
+        auto lru = m_memoryEntries.find(lruKey);
+        m_memorySize -= lru->second->audio.size();
+        m_memoryEntries.erase(lru);
+        m_memoryIndex.positions.erase(lruKey);
+        m_memoryIndex.order.pop_back();
+    }
+}
+
+void SynthesizedSpeechCache::putOnDiskLocked(const std::string& key, const Entry& entry) {
+    try {
+        auto fileName = getFileName(key);
+        auto path = getFilePath(fileName);
+        auto header = nlohmann::json{{"key", key},
+                                     {"metadata", entry.metadata},
+                                     {"audioFormat", audioFormatToJson(entry.audioFormat)},
+                                     {"mediaType", static_cast<int>(entry.mediaType)}}
+                          .dump();
+        {
+            std::ofstream file(path + TEMP_FILE_SUFFIX, std::ios::binary | std::ios::trunc);
+            file << header << '\n';
+            file.write(entry.audio.data(), entry.audio.size());
+            ThrowIfNot(file.good(), "writeFileFailed");
+        }
+        ThrowIf(std::rename((path + TEMP_FILE_SUFFIX).c_str(), path.c_str()) != 0, "renameFileFailed");
+
+        auto size = header.size() + 1 + entry.audio.size();
+        auto it = m_diskEntries.find(fileName);
+        if (it != m_diskEntries.end()) {
+            m_diskSize -= it->second;
+        }
+        m_diskEntries[fileName] = size;
+        m_diskSize += size;
+        touchLocked(m_diskIndex, fileName);
+
+        while (m_diskSize > m_config.maxDiskSize && m_diskIndex.order.size() > 1) {
+            removeFromDiskLocked(m_diskIndex.order.back());
+        }
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()));
+    }
+}
+
+std::shared_ptr<const SynthesizedSpeechCache::Entry> SynthesizedSpeechCache::loadFromDiskLocked(
+    const std::string& key) {
+    auto fileName = getFileName(key);
+    if (m_diskEntries.find(fileName) == m_diskEntries.end()) {
+        return nullptr;
+    }
+    try {
+        std::ifstream file(getFilePath(fileName), std::ios::binary);
+        std::string headerLine;
+        ThrowIfNot(std::getline(file, headerLine), "readHeaderFailed");
+        auto header = nlohmann::json::parse(headerLine);
+        if (header.value("key", "") != key) {
+            // another request with the same file name
+            return nullptr;
+        }
+        auto entry = std::make_shared<Entry>();
+        entry->metadata = header.value("metadata", "");
+        entry->audioFormat = audioFormatFromJson(header.value("audioFormat", nlohmann::json::object()));
+        entry->mediaType = static_cast<aace::audio::AudioStream::MediaType>(
+            header.value("mediaType", static_cast<int>(aace::audio::AudioStream::MediaType::UNKNOWN)));
+        entry->audio.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        ThrowIf(file.bad(), "readAudioFailed");
+        touchLocked(m_diskIndex, fileName);
+        return entry;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).d("fileName", fileName));
+        removeFromDiskLocked(fileName);
+        return nullptr;
+    }
+}
+
+void SynthesizedSpeechCache::removeFromDiskLocked(std::string fileName) {
+    auto it = m_diskEntries.find(fileName);
+    if (it != m_diskEntries.end()) {
+        m_diskSize -= it->second;
+        m_diskEntries.erase(it);
+    }
+    auto position = m_diskIndex.positions.find(fileName);
+    if (position != m_diskIndex.positions.end()) {
+        m_diskIndex.order.erase(position->second);
+        m_diskIndex.positions.erase(position);
+    }
+    std::remove(getFilePath(fileName).c_str());
+}
+
+std::string SynthesizedSpeechCache::getFilePath(const std::string& fileName) {
+    return m_config.diskCachePath + "/" + fileName;
+}
+
+std::string SynthesizedSpeechCache::getFileName(const std::string& key) {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>()(key) << CACHE_FILE_EXTENSION;
+    return ss.str();
+}
+
+void SynthesizedSpeechCache::touchLocked(LruIndex& index, const std::string& key) {
+    auto it = index.positions.find(key);
+    if (it != index.positions.end()) {
+        index.order.splice(index.order.begin(), index.order, it->second);
+    } else {
+        index.order.push_front(key);
+        index.positions[key] = index.order.begin();
+    }
+}
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
@@ -15,6 +15,9 @@
 
 #include <unordered_map>
 
+#include <AACE/Engine/Metrics/CounterDataPointBuilder.h>
+#include <AACE/Engine/Metrics/MetricEventBuilder.h>
+
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechEngineImpl.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechSynthesizerInterface.h"
@@ -50,27 +53,45 @@ static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED = "Prepa
 static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED = "PrepareSpeechFailed";
 static const std::string METRIC_TEXT_TO_SPEECH_CAPABILITIES_RECEIVED = "CapabilitiesReceived";
 
+/// Counter metrics for the synthesized speech cache
+static const std::string METRIC_TEXT_TO_SPEECH_CACHE_HIT = "SpeechCacheHit";
+static const std::string METRIC_TEXT_TO_SPEECH_CACHE_MISS = "SpeechCacheMiss";
+
+constexpr unsigned int TextToSpeechEngineImpl::DEFAULT_MAX_CONCURRENT_REQUESTS;
+
 TextToSpeechEngineImpl::TextToSpeechEngineImpl(
-    std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface) :
-        m_textToSpeechPlatformInterface(textToSpeechPlatformInterface) {
+    std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
+    unsigned int maxConcurrentRequests) :
+        m_textToSpeechPlatformInterface(textToSpeechPlatformInterface),
+        m_maxConcurrentRequests(maxConcurrentRequests) {
 }
 
-bool TextToSpeechEngineImpl::initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
+bool TextToSpeechEngineImpl::initialize(
+    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+    std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+    std::shared_ptr<SynthesizedSpeechCache> speechCache) {
     m_textToSpeechServiceInterface = textToSpeechServiceInterface;
+    m_metricRecorder = metricRecorder;
+    m_speechCache = speechCache;
     return true;
 }
 
 std::shared_ptr<TextToSpeechEngineImpl> TextToSpeechEngineImpl::create(
     std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
+    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+    std::shared_ptr<aace::engine::metrics::MetricRecorderServiceInterface> metricRecorder,
+    std::shared_ptr<SynthesizedSpeechCache> speechCache,
+    unsigned int maxConcurrentRequests) {
     try {
         ThrowIfNull(textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         ThrowIfNull(textToSpeechServiceInterface, "nullTextToSpeechServiceInterface");
-        auto textToSpeechEngineImpl =
-            std::shared_ptr<TextToSpeechEngineImpl>(new TextToSpeechEngineImpl(textToSpeechPlatformInterface));
+        ThrowIf(maxConcurrentRequests == 0, "invalidMaxConcurrentRequests");
+        auto textToSpeechEngineImpl = std::shared_ptr<TextToSpeechEngineImpl>(
+            new TextToSpeechEngineImpl(textToSpeechPlatformInterface, maxConcurrentRequests));
 
         ThrowIfNot(
-            textToSpeechEngineImpl->initialize(textToSpeechServiceInterface), "initializeTextToSpeechEngineImplFailed");
+            textToSpeechEngineImpl->initialize(textToSpeechServiceInterface, metricRecorder, speechCache),
+            "initializeTextToSpeechEngineImplFailed");
 
         // Set the Engine Interface reference
         textToSpeechPlatformInterface->setEngineInterface(textToSpeechEngineImpl);
@@ -99,7 +120,7 @@ bool TextToSpeechEngineImpl::onPrepareSpeech(
         ThrowIfNull(m_textToSpeechServiceInterface_lock, "nullTextToSpeechServiceInterface");
         auto textToSpeechProvider = m_textToSpeechServiceInterface_lock->getTextToSpeechProvider(provider);
         ThrowIfNull(textToSpeechProvider, "nullTextToSpeechProvider");
-        return executeOnPrepareSpeech(speechId, text, textToSpeechProvider, options);
+        return executeOnPrepareSpeech(speechId, text, provider, textToSpeechProvider, options);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
@@ -122,6 +143,7 @@ bool TextToSpeechEngineImpl::onGetCapabilities(const std::string& requestId, con
 bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
     const std::string& speechId,
     const std::string& text,
+    const std::string& provider,
     std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
     const std::string& options) {
     try {
@@ -129,7 +151,6 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
         ThrowIfNull(m_textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         auto textToSpeechPlatformInterface = m_textToSpeechPlatformInterface;
         std::string requestPayload;
-        std::string requestTimeout;
         if (!options.empty()) {
             nlohmann::json optionsPayload = nlohmann::json::parse(options);
             if (optionsPayload.contains(REQUEST_PAYLOAD_KEY)) {
@@ -138,32 +159,64 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
                 requestPayload = options;
             }
         }
-        m_executor.submit(
-            [speechId, text, textToSpeechProvider, requestTimeout, requestPayload, textToSpeechPlatformInterface] {
-                try {
-                    AACE_DEBUG(LX(TAG).m("Executing prepare speech"));
-                    auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
-                    auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
-                    if (status == std::future_status::timeout) {
-                        textToSpeechPlatformInterface->prepareSpeechFailed(speechId, REQUEST_TIMED_OUT);
+
+        // the request payload carries the voice and locale of the request
+        auto speechCache = m_speechCache;
+        std::string cacheKey;
+        if (speechCache != nullptr) {
+            cacheKey = SynthesizedSpeechCache::getKey(provider, text, requestPayload);
+            auto cachedSpeech = speechCache->get(cacheKey);
+            submitSpeechCacheMetric(cachedSpeech != nullptr);
+            if (cachedSpeech != nullptr) {
+                AACE_DEBUG(LX(TAG).m("Using cached speech").d("speechId", speechId));
+                m_executor.submit([speechId, cachedSpeech, textToSpeechPlatformInterface] {
+                    textToSpeechPlatformInterface->prepareSpeechCompleted(
+                        speechId, SynthesizedSpeechCache::createAudioStream(cachedSpeech), cachedSpeech->metadata);
+                });
+                return true;
+            }
+        }
+
+        // each provider gets its own workers so a slow request only delays requests queued on the same worker
+        auto worker = getPrepareSpeechWorker(provider);
+        auto pendingRequests = worker->pendingRequests;
+        (*pendingRequests)++;
+        worker->executor.submit([speechId,
+                                 text,
+                                 textToSpeechProvider,
+                                 requestPayload,
+                                 textToSpeechPlatformInterface,
+                                 speechCache,
+                                 cacheKey,
+                                 pendingRequests] {
+            try {
+                AACE_DEBUG(LX(TAG).m("Executing prepare speech"));
+                auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
+                auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
+                if (status == std::future_status::timeout) {
+                    textToSpeechPlatformInterface->prepareSpeechFailed(speechId, REQUEST_TIMED_OUT);
+                } else {
+                    auto prepareSpeechResult = prepareSpeechFuture.get();
+                    auto speechId = prepareSpeechResult.getSpeechId();
+                    auto failureReason = prepareSpeechResult.getFailureReason();
+                    auto metadata = prepareSpeechResult.getSpeechMetadata();
+                    auto synthesizedSpeech = prepareSpeechResult.getPreparedAudio();
+                    if (!failureReason.empty()) {
+                        textToSpeechPlatformInterface->prepareSpeechFailed(speechId, failureReason);
                     } else {
-                        auto prepareSpeechResult = prepareSpeechFuture.get();
-                        auto speechId = prepareSpeechResult.getSpeechId();
-                        auto failureReason = prepareSpeechResult.getFailureReason();
-                        auto metadata = prepareSpeechResult.getSpeechMetadata();
-                        auto synthesizedSpeech = prepareSpeechResult.getPreparedAudio();
-                        if (!failureReason.empty()) {
-                            textToSpeechPlatformInterface->prepareSpeechFailed(speechId, failureReason);
-                        } else {
-                            textToSpeechPlatformInterface->prepareSpeechCompleted(
-                                speechId, synthesizedSpeech, metadata);
+                        if (speechCache != nullptr && synthesizedSpeech != nullptr) {
+                            synthesizedSpeech =
+                                speechCache->createCachingAudioStream(cacheKey, synthesizedSpeech, metadata);
                         }
+                        textToSpeechPlatformInterface->prepareSpeechCompleted(speechId, synthesizedSpeech, metadata);
                     }
-                } catch (std::exception& ex) {
-                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
-                    textToSpeechPlatformInterface->prepareSpeechFailed(speechId, INTERNAL_ERROR);
                 }
-            });
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                textToSpeechPlatformInterface->prepareSpeechFailed(speechId, INTERNAL_ERROR);
+            }
+            (*pendingRequests)--;
+        });
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -171,6 +224,42 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
     }
 }
 
+std::shared_ptr<TextToSpeechEngineImpl::PrepareSpeechWorker> TextToSpeechEngineImpl::getPrepareSpeechWorker(
+    const std::string& provider) {
+    std::lock_guard<std::mutex> lock(m_prepareSpeechWorkersMutex);
+    auto& workers = m_prepareSpeechWorkers[provider];
+    std::shared_ptr<PrepareSpeechWorker> worker;
+    for (auto& candidate : workers) {
+        if (worker == nullptr || *candidate->pendingRequests < *worker->pendingRequests) {
+            worker = candidate;
+        }
+    }
+    // add a worker while all of them are busy, up to the concurrency limit
+    if ((worker == nullptr || *worker->pendingRequests > 0) && workers.size() < m_maxConcurrentRequests) {
+        worker = std::make_shared<PrepareSpeechWorker>(provider);
+        workers.push_back(worker);
+    }
+    return worker;
+}
+
+void TextToSpeechEngineImpl::submitSpeechCacheMetric(bool hit) {
+    auto metricRecorder = m_metricRecorder.lock();
+    if (metricRecorder == nullptr) {
+        return;
+    }
+    auto metricBuilder =
+        aace::engine::metrics::MetricEventBuilder().withSourceName(METRIC_PROGRAM_NAME_SUFFIX).withAlexaAgentId();
+    metricBuilder.addDataPoint(aace::engine::metrics::CounterDataPointBuilder{}
+                                   .withName(hit ? METRIC_TEXT_TO_SPEECH_CACHE_HIT : METRIC_TEXT_TO_SPEECH_CACHE_MISS)
+                                   .increment(1)
+                                   .build());
+    try {
+        aace::engine::metrics::recordMetric(metricRecorder, metricBuilder.build());
+    } catch (std::invalid_argument& ex) {
+        AACE_ERROR(LX(TAG).m("Failed to record metric").d("reason", ex.what()));
+    }
+}
+
 bool TextToSpeechEngineImpl::executeOnGetCapabilities(
     const std::string& requestId,
     std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider) {
@@ -206,6 +295,15 @@ void TextToSpeechEngineImpl::shutdown() {
         m_textToSpeechPlatformInterface->setEngineInterface(nullptr);
         m_textToSpeechPlatformInterface.reset();
     }
+    {
+        std::lock_guard<std::mutex> lock(m_prepareSpeechWorkersMutex);
+        for (auto& providerWorkers : m_prepareSpeechWorkers) {
+            for (auto& worker : providerWorkers.second) {
+                worker->executor.shutdown();
+            }
+        }
+        m_prepareSpeechWorkers.clear();
+    }
     m_executor.shutdown();
 }
 
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechEngineService.h"
+#include <nlohmann/json.hpp>
 
 namespace aace {
 namespace engine {
@@ -43,6 +44,29 @@ bool TextToSpeechEngineService::initialize() {
     }
 }
 
+bool TextToSpeechEngineService::configure(std::shared_ptr<std::istream> configuration) {
+    try {
+        auto config = nlohmann::json::parse(*configuration);
+        m_maxConcurrentRequests = config.value("maxConcurrentRequests", m_maxConcurrentRequests);
+        if (m_maxConcurrentRequests == 0) {
+            AACE_WARN(LX(TAG).m("invalidMaxConcurrentRequests").d("using", 1));
+            m_maxConcurrentRequests = 1;
+        }
+        if (config.contains("speechCache")) {
+            auto cacheConfig = config.at("speechCache");
+            m_speechCacheEnabled = cacheConfig.value("enabled", m_speechCacheEnabled);
+            m_speechCacheConfig.maxMemorySize = cacheConfig.value("maxMemorySize", m_speechCacheConfig.maxMemorySize);
+            m_speechCacheConfig.maxEntrySize = cacheConfig.value("maxEntrySize", m_speechCacheConfig.maxEntrySize);
+            m_speechCacheConfig.diskCachePath = cacheConfig.value("diskCachePath", m_speechCacheConfig.diskCachePath);
+            m_speechCacheConfig.maxDiskSize = cacheConfig.value("maxDiskSize", m_speechCacheConfig.maxDiskSize);
+        }
+    } catch (nlohmann::json::exception& ex) {
+        AACE_ERROR(LX(TAG).m("configuration is not valid").d("exception", ex.what()));
+        return false;
+    }
+    return true;
+}
+
 bool TextToSpeechEngineService::shutdown() {
     AACE_INFO(LX(TAG));
     if (m_textToSpeechEngineImpl != nullptr) {
@@ -70,8 +94,18 @@ bool TextToSpeechEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_textToSpeechEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_textToSpeechEngineImpl =
-            aace::engine::textToSpeech::TextToSpeechEngineImpl::create(textToSpeech, shared_from_this());
+        auto metricRecorder =
+            getContext()->getServiceInterface<aace::engine::metrics::MetricRecorderServiceInterface>("aace.metrics");
+        ThrowIfNull(metricRecorder, "nullMetricRecorder");
+
+        std::shared_ptr<SynthesizedSpeechCache> speechCache;
+        if (m_speechCacheEnabled) {
+            // the engine works without the cache if it cannot be created
+            speechCache = SynthesizedSpeechCache::create(m_speechCacheConfig);
+        }
+
+        m_textToSpeechEngineImpl = aace::engine::textToSpeech::TextToSpeechEngineImpl::create(
+            textToSpeech, shared_from_this(), metricRecorder, speechCache, m_maxConcurrentRequests);
         ThrowIfNull(m_textToSpeechEngineImpl, "createTextToSpeechEngineImplFailed");
 
         return true;
@@ -13,15 +13,24 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <AVSCommon/Utils/WaitEvent.h>
+
 #include <AACE/TextToSpeech/TextToSpeech.h>
 #include <AACE/Audio/AudioStream.h>
 #include <AACE/Engine/TextToSpeech/TextToSpeechEngineImpl.h>
 #include <AACE/Engine/TextToSpeech/TextToSpeechServiceInterface.h>
 #include <AACE/Engine/TextToSpeech/TextToSpeechSynthesizerInterface.h>
 #include <AACE/Engine/TextToSpeech/PrepareSpeechResult.h>
+#include <AACE/Engine/TextToSpeech/SynthesizedSpeechCache.h>
+#include <AACE/Test/Unit/Metrics/MockMetricRecorderServiceInterface.h>
 
 namespace aace {
 namespace test {
@@ -81,6 +90,55 @@ public:
     MOCK_METHOD1(getCapabilities, std::future<std::string>(const std::string& requestId));
 };
 
+/**
+ * Audio stream returning fixed audio data.
+ */
+class TestAudioStream : public aace::audio::AudioStream {
+public:
+    TestAudioStream(const std::string& data) : m_data(data), m_offset(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        auto count = std::min(size, m_data.size() - m_offset);
+        std::memcpy(data, m_data.data() + m_offset, count);
+        m_offset += count;
+        return count;
+    }
+
+    bool isClosed() override {
+        return m_offset >= m_data.size();
+    }
+
+private:
+    std::string m_data;
+    size_t m_offset;
+};
+
+/**
+ * Reads an audio stream to the end.
+ */
+static std::string readAll(std::shared_ptr<aace::audio::AudioStream> stream) {
+    std::string audio;
+    char buffer[4];
+    while (stream != nullptr && !stream->isClosed()) {
+        auto count = stream->read(buffer, sizeof(buffer));
+        audio.append(buffer, count);
+    }
+    return audio;
+}
+
+/**
+ * Creates a ready future with a successful prepare speech result.
+ */
+static std::future<aace::engine::textToSpeech::PrepareSpeechResult> createPrepareSpeechResult(
+    const std::string& speechId,
+    const std::string& audio) {
+    std::promise<aace::engine::textToSpeech::PrepareSpeechResult> promise;
+    promise.set_value(aace::engine::textToSpeech::PrepareSpeechResult(
+        speechId, std::make_shared<TestAudioStream>(audio), "{\"speechMarks\":[]}"));
+    return promise.get_future();
+}
+
 /**
  * Unit test creation of TextToSpeechEngineImpl class.
  */
@@ -232,6 +290,102 @@ TEST_F(TextToSpeechEngineImplTest, getCapabilitiesWithInvalidProvider) {
         << "Call to onPrepareSpeech() expected to fail!";
 }
 
+/**
+ * @test prepareSpeechRequestsRunConcurrently
+ */
+TEST_F(TextToSpeechEngineImplTest, prepareSpeechRequestsRunConcurrently) {
+    auto platformInterface = std::make_shared<testing::StrictMock<MockTextToSpeechPlatformInterface>>();
+    auto testTextToSpeechEngineImpl = engine::textToSpeech::TextToSpeechEngineImpl::create(
+        platformInterface, m_mockTextToSpeechServiceInterface, nullptr, nullptr, 2);
+    ASSERT_NE(nullptr, testTextToSpeechEngineImpl);
+    const std::string provider = "text-to-speech-provider";
+
+    // the first request never completes and the second completes immediately
+    std::promise<aace::engine::textToSpeech::PrepareSpeechResult> pendingPromise;
+    EXPECT_CALL(*m_mockTextToSpeechServiceInterface, getTextToSpeechProvider(provider))
+        .Times(2)
+        .WillRepeatedly(testing::Return(m_mockTextToSpeechSynthesizerInterface));
+    EXPECT_CALL(*m_mockTextToSpeechSynthesizerInterface, prepareSpeech("SPEECH-1", "Turn left", ""))
+        .WillOnce(testing::Return(testing::ByMove(pendingPromise.get_future())));
+    EXPECT_CALL(*m_mockTextToSpeechSynthesizerInterface, prepareSpeech("SPEECH-2", "Turn right", ""))
+        .WillOnce(testing::Return(testing::ByMove(createPrepareSpeechResult("SPEECH-2", "AUDIO"))));
+
+    alexaClientSDK::avsCommon::utils::WaitEvent completedEvent, failedEvent;
+    EXPECT_CALL(*platformInterface, prepareSpeechCompleted("SPEECH-2", testing::_, testing::_))
+        .WillOnce(testing::InvokeWithoutArgs([&completedEvent] { completedEvent.wakeUp(); }));
+    EXPECT_CALL(*platformInterface, prepareSpeechFailed("SPEECH-1", "REQUEST_TIMED_OUT"))
+        .WillOnce(testing::InvokeWithoutArgs([&failedEvent] { failedEvent.wakeUp(); }));
+
+    EXPECT_TRUE(testTextToSpeechEngineImpl->onPrepareSpeech("SPEECH-1", "Turn left", provider, ""));
+    EXPECT_TRUE(testTextToSpeechEngineImpl->onPrepareSpeech("SPEECH-2", "Turn right", provider, ""));
+
+    // the second request does not wait for the first one to time out
+    EXPECT_TRUE(completedEvent.wait(std::chrono::milliseconds(500)));
+    EXPECT_TRUE(failedEvent.wait(std::chrono::milliseconds(2000)));
+    testTextToSpeechEngineImpl->shutdown();
+}
+
+/**
+ * @test repeatedPrepareSpeechIsServedFromCache
+ */
+TEST_F(TextToSpeechEngineImplTest, repeatedPrepareSpeechIsServedFromCache) {
+    auto platformInterface = std::make_shared<testing::StrictMock<MockTextToSpeechPlatformInterface>>();
+    auto metricRecorder =
+        std::make_shared<testing::NiceMock<aace::test::unit::core::MockMetricRecorderServiceInterface>>();
+    auto speechCache = aace::engine::textToSpeech::SynthesizedSpeechCache::create();
+    ASSERT_NE(nullptr, speechCache);
+    auto testTextToSpeechEngineImpl = engine::textToSpeech::TextToSpeechEngineImpl::create(
+        platformInterface, m_mockTextToSpeechServiceInterface, metricRecorder, speechCache);
+    ASSERT_NE(nullptr, testTextToSpeechEngineImpl);
+    const std::string provider = "text-to-speech-provider";
+    const std::string text = "Turn left in 200 meters";
+    const std::string options = "{\"requestPayload\":{\"voiceId\":\"Alexa\",\"locale\":\"en-US\"}}";
+    const std::string audio = "SYNTHESIZED_AUDIO";
+
+    EXPECT_CALL(*m_mockTextToSpeechServiceInterface, getTextToSpeechProvider(provider))
+        .Times(3)
+        .WillRepeatedly(testing::Return(m_mockTextToSpeechSynthesizerInterface));
+    EXPECT_CALL(*m_mockTextToSpeechSynthesizerInterface, prepareSpeech("SPEECH-1", text, testing::_))
+        .WillOnce(testing::Return(testing::ByMove(createPrepareSpeechResult("SPEECH-1", audio))));
+    EXPECT_CALL(*m_mockTextToSpeechSynthesizerInterface, prepareSpeech("SPEECH-3", text, testing::_))
+        .WillOnce(testing::Return(testing::ByMove(createPrepareSpeechResult("SPEECH-3", audio))));
+    EXPECT_CALL(*metricRecorder, recordMetric(testing::_)).Times(3);
+
+    std::string preparedAudio;
+    std::string preparedMetadata;
+    alexaClientSDK::avsCommon::utils::WaitEvent completedEvent;
+    EXPECT_CALL(*platformInterface, prepareSpeechCompleted(testing::_, testing::_, testing::_))
+        .Times(3)
+        .WillRepeatedly(testing::Invoke([&](const std::string& speechId,
+                                            std::shared_ptr<aace::audio::AudioStream> stream,
+                                            const std::string& metadata) {
+            preparedAudio = readAll(stream);
+            preparedMetadata = metadata;
+            completedEvent.wakeUp();
+        }));
+
+    // the first request is synthesized and cached once its audio is read
+    EXPECT_TRUE(testTextToSpeechEngineImpl->onPrepareSpeech("SPEECH-1", text, provider, options));
+    ASSERT_TRUE(completedEvent.wait(std::chrono::milliseconds(1000)));
+    EXPECT_EQ(audio, preparedAudio);
+    EXPECT_EQ(audio.size(), speechCache->getMemorySize());
+
+    // the same request is served from the cache without calling the provider
+    completedEvent.reset();
+    preparedAudio.clear();
+    EXPECT_TRUE(testTextToSpeechEngineImpl->onPrepareSpeech("SPEECH-2", text, provider, options));
+    ASSERT_TRUE(completedEvent.wait(std::chrono::milliseconds(1000)));
+    EXPECT_EQ(audio, preparedAudio);
+    EXPECT_EQ("{\"speechMarks\":[]}", preparedMetadata);
+
+    // a different voice is a cache miss
+    completedEvent.reset();
+    const std::string otherVoiceOptions = "{\"requestPayload\":{\"voiceId\":\"Other\",\"locale\":\"en-US\"}}";
+    EXPECT_TRUE(testTextToSpeechEngineImpl->onPrepareSpeech("SPEECH-3", text, provider, otherVoiceOptions));
+    ASSERT_TRUE(completedEvent.wait(std::chrono::milliseconds(1000)));
+    testTextToSpeechEngineImpl->shutdown();
+}
+
 }  // namespace textToSpeech
 }  // namespace unit
 }  // namespace test
@@ -1,4 +1,4 @@
-import os, logging
+import os, logging, json
 from Cheetah.Template import Template
 
 
@@ -33,6 +33,9 @@ class Generator:
 
     message_include_path_root = "AASB/Message/"
 
+    codec_test_folder = "tests"
+    codec_test_filename = "AASBMessageCodecTest.cpp"
+
     def __init__(self, model):
         self.model = model
         self.template_path = os.path.abspath(os.path.join(__file__, "..", "templates"))
@@ -41,6 +44,7 @@ class Generator:
         self.output_folder = output_folder
         for next in self.model.get_exported_interfaces():
             self.generate_interface(next)
+        self.generate_codec_test()
 
     def generate_interface(self, interface):
         # generate all of the message headers
@@ -72,6 +76,12 @@ class Generator:
         return include_path
 
     def generate_type(self, type_def):
+        # the direct json readers dispatch on the key hash so the keys of each object must not collide
+        if type_def.type == "message":
+            self.check_key_hashes(type_def, type_def.payload)
+            self.check_key_hashes(type_def, type_def.reply)
+        elif type_def.type == "struct":
+            self.check_key_hashes(type_def, type_def.values)
         self._generate_type(
             type_def, "header.h.tmpl", "footer.h.tmpl", f"{type_def.type}.h.tmpl", "include", f"{type_def.name}.h"
         )
@@ -105,6 +115,112 @@ class Generator:
         with open(os.path.join(output_file_path, output_filename), "w") as file:
             file.write(str(type_template))
 
+    def generate_codec_test(self):
+        messages = []
+        for interface in self.model.get_exported_interfaces():
+            for next in interface.get_message_names():
+                message = interface.get_message(next)
+                include = self.get_cpp_includes(message)[0]
+                type_name = message.symbol.replace(".", "::")
+                if message.messageType == message.PUBLISH:
+                    messages.append(
+                        {
+                            "include": include,
+                            "type": type_name,
+                            "symbol": message.symbol,
+                            "sample": self.get_sample_message(message, message.payload, "Publish"),
+                        }
+                    )
+                if message.reply:
+                    messages.append(
+                        {
+                            "include": include,
+                            "type": f"{type_name}Reply",
+                            "symbol": f"{message.symbol}Reply",
+                            "sample": self.get_sample_message(message, message.reply, "Reply"),
+                        }
+                    )
+        if not messages:
+            return
+        template = Template(
+            file=os.path.join(self.template_path, "codec_test.cpp.tmpl"),
+            searchList=[
+                {
+                    "generator": self,
+                    "includes": list(dict.fromkeys(next["include"] for next in messages)),
+                    "messages": messages,
+                }
+            ],
+        )
+        output_file_path = os.path.join(self.output_folder, self.codec_test_folder)
+        os.makedirs(output_file_path, exist_ok=True)
+        with open(os.path.join(output_file_path, self.codec_test_filename), "w") as file:
+            file.write(str(template))
+
+    def get_sample_message(self, message, values, message_type):
+        description = {"topic": message.topic, "action": message.action}
+        if message_type == "Reply":
+            description["replyToId"] = "00000000-0000-0000-0000-000000000000"
+        header = {
+            "version": self.model.version,
+            "messageType": message_type,
+            "id": "00000000-0000-0000-0000-000000000001",
+            "messageDescription": description,
+        }
+        payload = {next.name: self.get_sample_value(next) for next in values} if values else None
+        return json.dumps({"header": header, "payload": payload}, separators=(",", ":"))
+
+    def get_sample_value(self, value_def, depth=0):
+        if value_def.value is not None:
+            return value_def.value
+        if value_def.is_list():
+            element_type = value_def.type[5:] if value_def.type.startswith("list:") else "string"
+            return [self.get_sample_type(element_type, value_def.interface, depth)]
+        return self.get_sample_type(value_def.type, value_def.interface, depth)
+
+    def get_sample_type(self, type_name, interface, depth):
+        if type_name in ["string"]:
+            return "sample"
+        if type_name in ["int", "long", "int32", "int64"]:
+            return 1
+        if type_name in ["float", "double"]:
+            return 1.5
+        if type_name == "bool":
+            return True
+        if type_name == "dict":
+            return {"key": "value"}
+        if type_name == "list":
+            return ["sample"]
+        type_def = None
+        for next in [interface] + list(self.model.interfaces.values()):
+            if next.has_type(type_name):
+                type_def = next.get_type(type_name)
+                break
+        if not type_def:
+            raise Exception("Unknown type: %s" % type_name)
+        if type_def.type == type_def.ALIAS:
+            return self.get_sample_type(type_def.alias, type_def.interface, depth)
+        if type_def.type == type_def.ENUM:
+            return type_def.get_value_names()[0]
+        if depth > 8:
+            raise Exception("Recursive type: %s" % type_def.symbol)
+        return {next.name: self.get_sample_value(next, depth + 1) for next in type_def.values}
+
+    def check_key_hashes(self, type_def, values):
+        hashes = {}
+        for next in values or []:
+            key_hash = self.get_key_hash(next.name)
+            if key_hash in hashes and hashes[key_hash] != next.name:
+                raise Exception(f"Key hash collision in {type_def.symbol}: {hashes[key_hash]}, {next.name}")
+            hashes[key_hash] = next.name
+
+    def get_key_hash(self, key):
+        # must match aasb::utils::json::hashKey()
+        key_hash = 2166136261
+        for next in key.encode("utf-8"):
+            key_hash = ((key_hash ^ next) * 16777619) & 0xFFFFFFFF
+        return key_hash
+
     def get_header_guard(self, message):
         return ("%s_H" % message.symbol.replace(".", "_")).upper()
 